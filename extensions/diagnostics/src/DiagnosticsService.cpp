@@ -19,16 +19,22 @@
 **/
 
 #include "DiagnosticsService.h"
+#include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/handlers/DiagnosticHandlers.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/utils/Tracing.h"
 
 namespace catapult { namespace diagnostics {
 
 	namespace {
-		thread::Task CreateLoggingTask(const std::vector<utils::DiagnosticCounter>& counters) {
-			return thread::CreateNamedTask("logging task", [counters]() {
+		using HistogramsSupplier = supplier<utils::DiagnosticHistograms>;
+
+		thread::Task CreateLoggingTask(
+				const std::vector<utils::DiagnosticCounter>& counters,
+				const HistogramsSupplier& histogramsSupplier) {
+			return thread::CreateNamedTask("logging task", [counters, histogramsSupplier]() {
 				std::ostringstream table;
 				table << "--- current counter values ---";
 				for (const auto& counter : counters) {
@@ -36,17 +42,34 @@ namespace catapult { namespace diagnostics {
 					table << std::endl << counter.id().name() << " : " << counter.value();
 				}
 
+				table << std::endl << "--- current histogram values ---";
+				for (const auto& histogram : histogramsSupplier()) {
+					auto snapshot = histogram.snapshot();
+					if (0 == snapshot.count())
+						continue;
+
+					table.width(utils::DiagnosticCounterId::Max_Counter_Name_Size);
+					table << std::endl << histogram.id().name() << " [" << histogram.tag() << "] : " << snapshot;
+				}
+
 				CATAPULT_LOG(info) << table.str();
 				return thread::make_ready_future(thread::TaskResult::Continue);
 			});
 		}
 
-		void AddDiagnosticHandlers(const std::vector<utils::DiagnosticCounter>& counters, extensions::ServiceState& state) {
+		void AddDiagnosticHandlers(
+				const std::vector<utils::DiagnosticCounter>& counters,
+				const HistogramsSupplier& histogramsSupplier,
+				extensions::ServiceState& state) {
 			auto& handlers = state.packetHandlers();
 			handlers.setAllowedHosts(state.config().Node.TrustedHosts);
 
 			handlers::RegisterDiagnosticCountersHandler(handlers, counters);
+			handlers::RegisterDiagnosticHistogramsHandler(handlers, histogramsSupplier);
+			auto traceFilename = config::CatapultDataDirectory(state.config().User.DataDirectory).rootDir().file("trace.json");
+			handlers::RegisterDiagnosticTraceEventsHandler(handlers, traceFilename);
 			handlers::RegisterDiagnosticNodesHandler(handlers, state.nodes());
+			handlers::RegisterDiagnosticNodeTrafficHandler(handlers, state.nodes());
 			handlers::RegisterDiagnosticBlockStatementHandler(handlers, state.storage());
 			state.pluginManager().addDiagnosticHandlers(handlers, state.cache());
 
@@ -68,11 +91,22 @@ namespace catapult { namespace diagnostics {
 				auto counters = state.counters();
 				counters.insert(counters.end(), locator.counters().cbegin(), locator.counters().cend());
 
+				// merge all histograms lazily because most histogram sources are registered after this service
+				auto histogramsSupplier = [&locator, &handlers = state.packetHandlers()]() {
+					auto histograms = locator.histograms();
+					auto handlerHistograms = handlers.histograms();
+					histograms.insert(histograms.end(), handlerHistograms.cbegin(), handlerHistograms.cend());
+					return histograms;
+				};
+
+				// enable (or disable) span tracing
+				utils::SetTracingEnabled(state.config().Node.EnableTracing);
+
 				// add task
-				state.tasks().push_back(CreateLoggingTask(counters));
+				state.tasks().push_back(CreateLoggingTask(counters, histogramsSupplier));
 
 				// add packet handlers
-				AddDiagnosticHandlers(counters, state);
+				AddDiagnosticHandlers(counters, histogramsSupplier, state);
 			}
 		};
 	}
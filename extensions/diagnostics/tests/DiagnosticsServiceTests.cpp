@@ -20,6 +20,7 @@
 
 #include "diagnostics/src/DiagnosticsService.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DiagnosticHistogramValue.h"
 #include "tests/test/core/HandlersTrustedHostTests.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/local/ServiceLocatorTestContext.h"
@@ -68,10 +69,13 @@ namespace catapult { namespace diagnostics {
 		context.boot();
 		const auto& packetHandlers = context.testState().state().packetHandlers();
 
-		// Assert: three default handlers were added
-		EXPECT_EQ(4u, packetHandlers.size());
+		// Assert: six default handlers were added
+		EXPECT_EQ(7u, packetHandlers.size());
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Diagnostic_Counters)); // the default (counters) diagnostic handler
+		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Diagnostic_Histograms)); // the default (histograms) diagnostic handler
+		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Diagnostic_Trace_Events)); // the default (trace) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Active_Node_Infos)); // the default (nodes) diagnostic handler
+		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Active_Node_Traffic)); // the default (traffic) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Block_Statement)); // the default (statements) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Chain_Info)); // the diagnostic handler hook registered above
 
@@ -114,4 +118,41 @@ namespace catapult { namespace diagnostics {
 		EXPECT_EQ(Num_Counters, actualCounterNames.size());
 		EXPECT_EQ(std::set<std::string>({ "ALPHA", "BETA" }), actualCounterNames);
 	}
+
+	TEST(TEST_CLASS, HistogramsAreSourcedFromLocatorAndPacketHandlers) {
+		// Arrange: add histogram to locator (packet handler histograms are added implicitly)
+		TestContext context;
+		auto pHistogram = std::make_shared<utils::LatencyHistogram>();
+		pHistogram->record(std::chrono::microseconds(123));
+		context.locator().registerHistogram(utils::DiagnosticHistogram(utils::DiagnosticCounterId("ALPHA"), 7, pHistogram));
+
+		// Act:
+		context.boot();
+		const auto& packetHandlers = context.testState().state().packetHandlers();
+
+		// - process a histograms request
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+		pPacket->Type = ionet::PacketType::Diagnostic_Histograms;
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(packetHandlers.process(*pPacket, handlerContext));
+
+		// Assert: header is correct and contains one histogram from locator and one histogram per packet handler
+		auto numHistograms = 1 + packetHandlers.size();
+		auto expectedPacketSize = sizeof(ionet::PacketHeader) + numHistograms * sizeof(model::DiagnosticHistogramValue);
+		test::AssertPacketHeader(handlerContext, expectedPacketSize, ionet::PacketType::Diagnostic_Histograms);
+
+		// - check the locator histogram
+		const auto* pHistogramValue = reinterpret_cast<const model::DiagnosticHistogramValue*>(test::GetSingleBufferData(handlerContext));
+		EXPECT_EQ("ALPHA", utils::DiagnosticCounterId(pHistogramValue->Id).name());
+		EXPECT_EQ(7u, pHistogramValue->Tag);
+		EXPECT_EQ(1u, pHistogramValue->Count);
+		EXPECT_EQ(123u, pHistogramValue->Max);
+
+		// - check the packet handler histograms
+		for (auto i = 1u; i < numHistograms; ++i) {
+			++pHistogramValue;
+			EXPECT_EQ("PKT HANDLER", utils::DiagnosticCounterId(pHistogramValue->Id).name()) << i;
+			EXPECT_TRUE(packetHandlers.canProcess(static_cast<ionet::PacketType>(pHistogramValue->Tag))) << i;
+		}
+	}
 }}
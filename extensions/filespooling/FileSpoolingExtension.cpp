@@ -31,22 +31,25 @@ namespace catapult { namespace filespooling {
 	namespace {
 		class FileQueueFactory {
 		public:
-			explicit FileQueueFactory(const std::string& dataDirectory)
+			FileQueueFactory(const std::string& dataDirectory, utils::FileSize maxSegmentSize)
 					: m_dataDirectory(config::CatapultDataDirectoryPreparer::Prepare(dataDirectory))
+					, m_maxSegmentSize(maxSegmentSize)
 			{}
 
 		public:
 			std::unique_ptr<io::FileQueueWriter> create(const std::string& queueName) const {
-				return std::make_unique<io::FileQueueWriter>(m_dataDirectory.spoolDir(queueName).str());
+				return std::make_unique<io::FileQueueWriter>(m_dataDirectory.spoolDir(queueName).str(), "index.dat", m_maxSegmentSize);
 			}
 
 		private:
 			config::CatapultDataDirectory m_dataDirectory;
+			utils::FileSize m_maxSegmentSize;
 		};
 
 		void RegisterExtension(extensions::ProcessBootstrapper& bootstrapper) {
 			// register subscribers
-			FileQueueFactory factory(bootstrapper.config().User.DataDirectory);
+			const auto& config = bootstrapper.config();
+			FileQueueFactory factory(config.User.DataDirectory, config.Node.MaxSpoolSegmentSize);
 			auto& subscriptionManager = bootstrapper.subscriptionManager();
 			subscriptionManager.addBlockChangeSubscriber(CreateFileBlockChangeStorage(factory.create("block_change")));
 			subscriptionManager.addUtChangeSubscriber(CreateFileUtChangeStorage(factory.create("unconfirmed_transactions_change")));
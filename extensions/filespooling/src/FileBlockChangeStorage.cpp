@@ -52,6 +52,10 @@ namespace catapult { namespace filespooling {
 				m_pOutputStream->flush();
 			}
 
+			void flush() override {
+				// empty because all changes are flushed by other calls
+			}
+
 		private:
 			std::unique_ptr<io::OutputStream> m_pOutputStream;
 		};
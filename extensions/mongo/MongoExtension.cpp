@@ -31,7 +31,7 @@
 #include "src/MongoTransactionStorage.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/extensions/RootedService.h"
-#include "catapult/io/BlockStorageChangeSubscriber.h"
+#include "catapult/utils/NetworkTime.h"
 #include <mongocxx/instance.hpp>
 
 namespace catapult { namespace mongo {
@@ -119,7 +119,17 @@ namespace catapult { namespace mongo {
 
 			// add a pre load handler for initializing (nemesis) storage
 			// (pPluginManager is kept alive by pTransactionRegistry)
-			auto pMongoBlockStorage = CreateMongoBlockStorage(*pMongoContext, *pTransactionRegistry, pPluginManager->receiptRegistry());
+			auto networkTime = utils::NetworkTime(config.BlockChain.Network.EpochAdjustment);
+			auto bulkIngestionOptions = BulkIngestionOptions{
+				dbConfig.BulkIngestionMaxPendingBlocks,
+				dbConfig.BulkIngestionMinBlockAge,
+				[networkTime]() { return networkTime.now(); }
+			};
+			auto pMongoBlockStorage = CreateMongoBlockStorage(
+					*pMongoContext,
+					*pTransactionRegistry,
+					pPluginManager->receiptRegistry(),
+					bulkIngestionOptions);
 
 			// empty unconfirmed and partial transactions collections
 			EmptyCollection(*pMongoContext, Ut_Collection_Name);
@@ -127,7 +137,7 @@ namespace catapult { namespace mongo {
 
 			// register subscriptions
 			bootstrapper.subscriptionManager().addBlockChangeSubscriber(
-					io::CreateBlockStorageChangeSubscriber(std::move(pMongoBlockStorage)));
+					CreateBulkIngestionBlockChangeSubscriber(std::move(pMongoBlockStorage)));
 			bootstrapper.subscriptionManager().addUtChangeSubscriber(
 					CreateMongoTransactionStorage(*pMongoContext, *pTransactionRegistry, Ut_Collection_Name));
 			bootstrapper.subscriptionManager().addPtChangeSubscriber(CreateMongoPtStorage(*pMongoContext, *pTransactionRegistry));
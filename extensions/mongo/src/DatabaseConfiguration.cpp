@@ -40,12 +40,15 @@ namespace catapult { namespace mongo {
 		LOAD_DB_PROPERTY(DatabaseName);
 		LOAD_DB_PROPERTY(MaxWriterThreads);
 
+		LOAD_DB_PROPERTY(BulkIngestionMaxPendingBlocks);
+		LOAD_DB_PROPERTY(BulkIngestionMinBlockAge);
+
 #undef LOAD_DB_PROPERTY
 
 		auto pluginsPair = utils::ExtractSectionAsUnorderedSet(bag, "plugins");
 		config.Plugins = pluginsPair.first;
 
-		utils::VerifyBagSizeLte(bag, 3 + pluginsPair.second);
+		utils::VerifyBagSizeLte(bag, 5 + pluginsPair.second);
 		return config;
 	}
 
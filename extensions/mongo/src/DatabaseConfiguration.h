@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/utils/TimeSpan.h"
 #include <boost/filesystem/path.hpp>
 #include <string>
 #include <unordered_set>
@@ -39,6 +40,12 @@ namespace catapult { namespace mongo {
 		/// Maximum number of database writer threads.
 		uint32_t MaxWriterThreads;
 
+		/// Maximum number of blocks with writes in flight during bulk ingestion.
+		uint32_t BulkIngestionMaxPendingBlocks;
+
+		/// Minimum age of a block for it to be ingested in bulk.
+		utils::TimeSpan BulkIngestionMinBlockAge;
+
 		/// Named database plugins to enable.
 		std::unordered_set<std::string> Plugins;
 
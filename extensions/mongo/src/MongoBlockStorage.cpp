@@ -28,6 +28,7 @@
 #include "mappers/ResolutionStatementMapper.h"
 #include "mappers/TransactionMapper.h"
 #include "mappers/TransactionStatementMapper.h"
+#include <deque>
 
 using namespace bsoncxx::builder::stream;
 
@@ -62,12 +63,74 @@ namespace catapult { namespace mongo {
 				CATAPULT_THROW_RUNTIME_ERROR("saveBlock failed: block header was not inserted");
 		}
 
-		void SaveTransactions(
+		using BulkWriteResultFutures = std::vector<thread::future<BulkWriteResult>>;
+
+		// all (in flight) writes of a single block
+		class PendingBlockWrites {
+		private:
+			struct PendingWrite {
+				BulkWriteResultFutures Results;
+				size_t NumExpectedInserts;
+				std::string ItemsDescription;
+			};
+
+		public:
+			explicit PendingBlockWrites(Height height) : m_height(height)
+			{}
+
+		public:
+			Height height() const {
+				return m_height;
+			}
+
+			bool isReady() const {
+				return std::all_of(m_writes.cbegin(), m_writes.cend(), [](const auto& write) {
+					return std::all_of(write.Results.cbegin(), write.Results.cend(), [](const auto& future) {
+						return future.is_ready();
+					});
+				});
+			}
+
+		public:
+			void add(BulkWriteResultFutures&& results, size_t numExpectedInserts, const std::string& itemsDescription) {
+				m_writes.push_back({ std::move(results), numExpectedInserts, itemsDescription });
+			}
+
+			void wait(const MongoErrorPolicy& errorPolicy) {
+				for (auto& write : m_writes) {
+					auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(write.Results)));
+					errorPolicy.checkInserted(write.NumExpectedInserts, aggregateResult, write.ItemsDescription);
+				}
+
+				m_writes.clear();
+			}
+
+		private:
+			Height m_height;
+			std::vector<PendingWrite> m_writes;
+		};
+
+		std::string GetItemsDescription(const char* items, Height height) {
+			return std::string(items) + " at height " + std::to_string(height.unwrap());
+		}
+
+		// notice that all submit functions wait for the bulk writer to map all documents but not for the writes to complete,
+		// so block elements do not need to outlive the submit calls
+
+		void SubmitBlockHeader(MongoBulkWriter& bulkWriter, const model::BlockElement& blockElement, PendingBlockWrites& pendingWrites) {
+			auto blockElements = std::vector<const model::BlockElement*>{ &blockElement };
+			auto results = bulkWriter.bulkInsert("blocks", blockElements, [](const auto* pBlockElement, auto) {
+				return mappers::ToDbModel(*pBlockElement);
+			}).get();
+			pendingWrites.add(std::move(results), 1, GetItemsDescription("block header", blockElement.Block.Height));
+		}
+
+		void SubmitTransactions(
 				MongoBulkWriter& bulkWriter,
 				Height height,
 				const std::vector<model::TransactionElement>& transactions,
 				const MongoTransactionRegistry& registry,
-				const MongoErrorPolicy& errorPolicy) {
+				PendingBlockWrites& pendingWrites) {
 			std::atomic<size_t> numTotalTransactionDocuments(0);
 			auto createDocuments = [height, &registry, &numTotalTransactionDocuments](const auto& transactionElement, auto index) {
 				auto metadata = MongoTransactionMetadata(transactionElement, height, index);
@@ -76,19 +139,16 @@ namespace catapult { namespace mongo {
 				return documents;
 			};
 			auto results = bulkWriter.bulkInsert("transactions", transactions, createDocuments).get();
-			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(results)));
-
-			auto itemsDescription = "transactions at height " + std::to_string(height.unwrap());
-			errorPolicy.checkInserted(numTotalTransactionDocuments, aggregateResult, itemsDescription);
+			pendingWrites.add(std::move(results), numTotalTransactionDocuments, GetItemsDescription("transactions", height));
 		}
 
-		void SaveBlockStatement(
+		void SubmitBlockStatement(
 				MongoBulkWriter& bulkWriter,
 				Height height,
 				const model::BlockStatement& blockStatement,
 				const MongoReceiptRegistry& registry,
-				const MongoErrorPolicy& errorPolicy) {
-			using BulkWriteResultFuture = thread::future<std::vector<thread::future<BulkWriteResult>>>;
+				PendingBlockWrites& pendingWrites) {
+			using BulkWriteResultFuture = thread::future<BulkWriteResultFutures>;
 
 			std::vector<BulkWriteResultFuture> futures;
 			std::vector<size_t> numExpectedInserts;
@@ -117,19 +177,9 @@ namespace catapult { namespace mongo {
 				return mappers::ToDbModel(height, pair.second);
 			}));
 
-			auto statementsFuture = thread::when_all(std::move(futures)).then([height, numExpectedInserts, &errorPolicy](
-					auto&& resultsFuture) {
-				auto insertResultsContainer = resultsFuture.get();
-				auto i = 0u;
-				auto itemsDescription = "statements at height " + std::to_string(height.unwrap());
-				for (auto& insertResults : insertResultsContainer) {
-					auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(insertResults.get())));
-					errorPolicy.checkInserted(numExpectedInserts[i], aggregateResult, itemsDescription);
-					++i;
-				}
-			});
-
-			statementsFuture.get();
+			auto itemsDescription = GetItemsDescription("statements", height);
+			for (auto i = 0u; i < futures.size(); ++i)
+				pendingWrites.add(futures[i].get(), numExpectedInserts[i], itemsDescription);
 		}
 
 		void DropDocuments(mongocxx::database& database, const std::string& collectionName, const std::string& indexName, Height height) {
@@ -145,19 +195,29 @@ namespace catapult { namespace mongo {
 				CATAPULT_THROW_RUNTIME_ERROR("delete returned empty result");
 		}
 
-		class MongoBlockStorage final : public io::LightBlockStorage {
+		class MongoBlockStorage final : public BulkIngestionBlockStorage {
 		public:
 			MongoBlockStorage(
 					MongoStorageContext& context,
 					const MongoTransactionRegistry& transactionRegistry,
-					const MongoReceiptRegistry& receiptRegistry)
+					const MongoReceiptRegistry& receiptRegistry,
+					const BulkIngestionOptions& bulkIngestionOptions)
 					: m_context(context)
 					, m_transactionRegistry(transactionRegistry)
 					, m_receiptRegistry(receiptRegistry)
+					, m_bulkIngestionOptions(bulkIngestionOptions)
 					, m_database(m_context.createDatabaseConnection())
 					, m_errorPolicy(m_context.createCollectionErrorPolicy(""))
 			{}
 
+			~MongoBlockStorage() override {
+				try {
+					completePendingWrites(0);
+				} catch (const std::exception& ex) {
+					CATAPULT_LOG(error) << "failed to complete pending block writes: " << ex.what();
+				}
+			}
+
 		public:
 			// region LightBlockStorage
 
@@ -188,22 +248,39 @@ namespace catapult { namespace mongo {
 				if (MongoErrorPolicy::Mode::Idempotent == m_errorPolicy.mode())
 					dropBlocksAfter(height - Height(1));
 
-				auto dbHeight = chainHeight();
+				// pending blocks have not yet been reflected in the chain height
+				auto dbHeight = m_pendingBlockWrites.empty() ? chainHeight() : m_pendingBlockWrites.back().height();
 				if (height != dbHeight + Height(1)) {
 					std::ostringstream out;
 					out << "cannot save block with height " << height << " when storage height is " << dbHeight;
 					CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
 				}
 
+				if (shouldIngestInBulk(blockElement.Block)) {
+					// keep writes of up to MaxPendingBlocks blocks in flight
+					completePendingWrites(m_bulkIngestionOptions.MaxPendingBlocks - 1);
+
+					m_pendingBlockWrites.emplace_back(height);
+					auto& pendingWrites = m_pendingBlockWrites.back();
+					SubmitBlockHeader(m_context.bulkWriter(), blockElement, pendingWrites);
+					submitBlockData(blockElement, pendingWrites);
+					return;
+				}
+
+				// restore ordered (per block) semantics by waiting for all previous blocks
+				completePendingWrites(0);
+
+				PendingBlockWrites pendingWrites(height);
+				submitBlockData(blockElement, pendingWrites);
 				SaveBlockHeader(m_database, blockElement);
-				SaveTransactions(m_context.bulkWriter(), height, blockElement.Transactions, m_transactionRegistry, m_errorPolicy);
-				if (blockElement.OptionalStatement)
-					SaveBlockStatement(m_context.bulkWriter(), height, *blockElement.OptionalStatement, m_receiptRegistry, m_errorPolicy);
+				pendingWrites.wait(m_errorPolicy);
 
-				setHeight(blockElement.Block.Height);
+				setHeight(height);
 			}
 
 			void dropBlocksAfter(Height height) override {
+				completePendingWrites(0);
+
 				auto dbHeight = chainHeight();
 				if (dbHeight <= height)
 					return;
@@ -214,7 +291,42 @@ namespace catapult { namespace mongo {
 
 			// endregion
 
+		public:
+			void flush() override {
+				completePendingWrites(0);
+			}
+
 		private:
+			bool shouldIngestInBulk(const model::Block& block) const {
+				if (m_bulkIngestionOptions.MaxPendingBlocks < 2 || MongoErrorPolicy::Mode::Idempotent == m_errorPolicy.mode())
+					return false;
+
+				auto networkTime = m_bulkIngestionOptions.NetworkTimeSupplier();
+				return block.Timestamp + Timestamp(m_bulkIngestionOptions.MinBlockAge.millis()) < networkTime;
+			}
+
+			void submitBlockData(const model::BlockElement& blockElement, PendingBlockWrites& pendingWrites) {
+				auto& bulkWriter = m_context.bulkWriter();
+				auto height = blockElement.Block.Height;
+				SubmitTransactions(bulkWriter, height, blockElement.Transactions, m_transactionRegistry, pendingWrites);
+				if (blockElement.OptionalStatement)
+					SubmitBlockStatement(bulkWriter, height, *blockElement.OptionalStatement, m_receiptRegistry, pendingWrites);
+			}
+
+			void completePendingWrites(size_t maxPendingBlocks) {
+				// complete the oldest blocks until at most maxPendingBlocks remain and then any other blocks that are already done
+				Height lastCompletedHeight;
+				while (!m_pendingBlockWrites.empty()
+						&& (m_pendingBlockWrites.size() > maxPendingBlocks || m_pendingBlockWrites.front().isReady())) {
+					m_pendingBlockWrites.front().wait(m_errorPolicy);
+					lastCompletedHeight = m_pendingBlockWrites.front().height();
+					m_pendingBlockWrites.pop_front();
+				}
+
+				if (Height() != lastCompletedHeight)
+					setHeight(lastCompletedHeight);
+			}
+
 			void setHeight(Height height) {
 				auto journalHeight = document()
 						<< "$set" << open_document
@@ -238,8 +350,33 @@ namespace catapult { namespace mongo {
 			MongoStorageContext& m_context;
 			const MongoTransactionRegistry& m_transactionRegistry;
 			const MongoReceiptRegistry& m_receiptRegistry;
+			BulkIngestionOptions m_bulkIngestionOptions;
 			MongoDatabase m_database;
 			MongoErrorPolicy m_errorPolicy;
+			std::deque<PendingBlockWrites> m_pendingBlockWrites;
+		};
+
+		class BulkIngestionBlockChangeSubscriber final : public io::BlockChangeSubscriber {
+		public:
+			explicit BulkIngestionBlockChangeSubscriber(std::unique_ptr<BulkIngestionBlockStorage>&& pStorage)
+					: m_pStorage(std::move(pStorage))
+			{}
+
+		public:
+			void notifyBlock(const model::BlockElement& blockElement) override {
+				m_pStorage->saveBlock(blockElement);
+			}
+
+			void notifyDropBlocksAfter(Height height) override {
+				m_pStorage->dropBlocksAfter(height);
+			}
+
+			void flush() override {
+				m_pStorage->flush();
+			}
+
+		private:
+			std::unique_ptr<BulkIngestionBlockStorage> m_pStorage;
 		};
 	}
 
@@ -247,6 +384,19 @@ namespace catapult { namespace mongo {
 			MongoStorageContext& context,
 			const MongoTransactionRegistry& transactionRegistry,
 			const MongoReceiptRegistry& receiptRegistry) {
-		return std::make_unique<MongoBlockStorage>(context, transactionRegistry, receiptRegistry);
+		return CreateMongoBlockStorage(context, transactionRegistry, receiptRegistry, { 0, utils::TimeSpan(), supplier<Timestamp>() });
+	}
+
+	std::unique_ptr<BulkIngestionBlockStorage> CreateMongoBlockStorage(
+			MongoStorageContext& context,
+			const MongoTransactionRegistry& transactionRegistry,
+			const MongoReceiptRegistry& receiptRegistry,
+			const BulkIngestionOptions& bulkIngestionOptions) {
+		return std::make_unique<MongoBlockStorage>(context, transactionRegistry, receiptRegistry, bulkIngestionOptions);
+	}
+
+	std::unique_ptr<io::BlockChangeSubscriber> CreateBulkIngestionBlockChangeSubscriber(
+			std::unique_ptr<BulkIngestionBlockStorage>&& pStorage) {
+		return std::make_unique<BulkIngestionBlockChangeSubscriber>(std::move(pStorage));
 	}
 }}
@@ -20,7 +20,10 @@
 
 #pragma once
 #include "MongoStorageContext.h"
+#include "catapult/io/BlockChangeSubscriber.h"
 #include "catapult/io/BlockStorage.h"
+#include "catapult/utils/TimeSpan.h"
+#include "catapult/functions.h"
 
 namespace catapult {
 	namespace mongo {
@@ -31,9 +34,43 @@ namespace catapult {
 
 namespace catapult { namespace mongo {
 
+	/// Options for bulk ingestion of blocks that are being caught up.
+	struct BulkIngestionOptions {
+		/// Maximum number of blocks with writes in flight.
+		/// \note Bulk ingestion is disabled when this is less than two.
+		uint32_t MaxPendingBlocks;
+
+		/// Minimum age of a block (relative to network time) for it to be ingested in bulk.
+		utils::TimeSpan MinBlockAge;
+
+		/// Network time supplier.
+		supplier<Timestamp> NetworkTimeSupplier;
+	};
+
+	/// Mongodb block storage that can have block writes in flight.
+	class BulkIngestionBlockStorage : public io::LightBlockStorage {
+	public:
+		/// Waits for all in flight block writes to complete.
+		virtual void flush() = 0;
+	};
+
 	/// Creates a mongodb block storage around \a context, \a transactionRegistry and \a receiptRegistry.
 	std::unique_ptr<io::LightBlockStorage> CreateMongoBlockStorage(
 			MongoStorageContext& context,
 			const MongoTransactionRegistry& transactionRegistry,
 			const MongoReceiptRegistry& receiptRegistry);
+
+	/// Creates a mongodb block storage around \a context, \a transactionRegistry and \a receiptRegistry
+	/// that ingests old blocks in bulk according to \a bulkIngestionOptions.
+	/// \note During bulk ingestion, writes of multiple blocks are in flight until the storage is flushed and the stored chain height
+	///        is only advanced after all writes of a block (and its predecessors) have completed.
+	std::unique_ptr<BulkIngestionBlockStorage> CreateMongoBlockStorage(
+			MongoStorageContext& context,
+			const MongoTransactionRegistry& transactionRegistry,
+			const MongoReceiptRegistry& receiptRegistry,
+			const BulkIngestionOptions& bulkIngestionOptions);
+
+	/// Creates a block change subscriber that saves blocks to \a pStorage and flushes \a pStorage when it is flushed.
+	std::unique_ptr<io::BlockChangeSubscriber> CreateBulkIngestionBlockChangeSubscriber(
+			std::unique_ptr<BulkIngestionBlockStorage>&& pStorage);
 }}
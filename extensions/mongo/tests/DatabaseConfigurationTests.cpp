@@ -37,7 +37,10 @@ namespace catapult { namespace mongo {
 						{
 							{ "databaseUri", "mongodb://hostname:port" },
 							{ "databaseName", "foo" },
-							{ "maxWriterThreads", "3" }
+							{ "maxWriterThreads", "3" },
+
+							{ "bulkIngestionMaxPendingBlocks", "7" },
+							{ "bulkIngestionMinBlockAge", "12m" }
 						}
 					},
 					{
@@ -60,6 +63,9 @@ namespace catapult { namespace mongo {
 				EXPECT_EQ("", config.DatabaseUri);
 				EXPECT_EQ("", config.DatabaseName);
 				EXPECT_EQ(0u, config.MaxWriterThreads);
+
+				EXPECT_EQ(0u, config.BulkIngestionMaxPendingBlocks);
+				EXPECT_EQ(utils::TimeSpan(), config.BulkIngestionMinBlockAge);
 				EXPECT_EQ(std::unordered_set<std::string>(), config.Plugins);
 			}
 
@@ -68,6 +74,9 @@ namespace catapult { namespace mongo {
 				EXPECT_EQ("mongodb://hostname:port", config.DatabaseUri);
 				EXPECT_EQ("foo", config.DatabaseName);
 				EXPECT_EQ(3u, config.MaxWriterThreads);
+
+				EXPECT_EQ(7u, config.BulkIngestionMaxPendingBlocks);
+				EXPECT_EQ(utils::TimeSpan::FromMinutes(12), config.BulkIngestionMinBlockAge);
 				EXPECT_EQ(std::unordered_set<std::string>({ "Alpha", "gamma" }), config.Plugins);
 			}
 		};
@@ -90,6 +99,8 @@ namespace catapult { namespace mongo {
 		EXPECT_EQ("mongodb://127.0.0.1:27017", config.DatabaseUri);
 		EXPECT_EQ("catapult", config.DatabaseName);
 		EXPECT_EQ(8u, config.MaxWriterThreads);
+		EXPECT_EQ(16u, config.BulkIngestionMaxPendingBlocks);
+		EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.BulkIngestionMinBlockAge);
 		EXPECT_FALSE(config.Plugins.empty());
 	}
 
@@ -67,19 +67,24 @@ namespace catapult { namespace mongo {
 			}
 		};
 
-		std::shared_ptr<io::LightBlockStorage> CreateMongoBlockStorage(
+		BulkIngestionOptions CreateDisabledBulkIngestionOptions() {
+			return { 0, utils::TimeSpan(), []() { return Timestamp(); } };
+		}
+
+		std::shared_ptr<BulkIngestionBlockStorage> CreateMongoBlockStorage(
 				std::unique_ptr<MongoTransactionPlugin>&& pTransactionPlugin,
-				MongoErrorPolicy::Mode errorPolicyMode = MongoErrorPolicy::Mode::Strict) {
+				MongoErrorPolicy::Mode errorPolicyMode = MongoErrorPolicy::Mode::Strict,
+				const BulkIngestionOptions& bulkIngestionOptions = CreateDisabledBulkIngestionOptions()) {
 			auto pMongoReceiptRegistry = std::make_shared<MongoReceiptRegistry>();
 			auto mockReceiptType = utils::to_underlying_type(mocks::MockReceipt::Receipt_Type);
 			pMongoReceiptRegistry->registerPlugin(mocks::CreateMockReceiptMongoPlugin(mockReceiptType));
 			const auto& receiptRegistry = *pMongoReceiptRegistry;
-			auto pBlockStorage = test::CreateMongoStorage<io::LightBlockStorage>(
+			auto pBlockStorage = test::CreateMongoStorage<BulkIngestionBlockStorage>(
 					std::move(pTransactionPlugin),
 					test::DbInitializationType::None,
 					errorPolicyMode,
-					[&receiptRegistry](auto& context, const auto& transactionRegistry) {
-						return mongo::CreateMongoBlockStorage(context, transactionRegistry, receiptRegistry);
+					[&receiptRegistry, &bulkIngestionOptions](auto& context, const auto& transactionRegistry) {
+						return mongo::CreateMongoBlockStorage(context, transactionRegistry, receiptRegistry, bulkIngestionOptions);
 					});
 
 			return decltype(pBlockStorage)(pBlockStorage.get(), [pMongoReceiptRegistry, pBlockStorage](const auto*) {});
@@ -335,11 +340,24 @@ namespace catapult { namespace mongo {
 		class TestContext final : public test::PrepareDatabaseMixin {
 		public:
 			explicit TestContext(size_t topHeight, MongoErrorPolicy::Mode errorPolicyMode = MongoErrorPolicy::Mode::Strict)
-					: m_pStorage(CreateMongoBlockStorage(mocks::CreateMockTransactionMongoPlugin(), errorPolicyMode)) {
+					: TestContext(topHeight, errorPolicyMode, CreateDisabledBulkIngestionOptions())
+			{}
+
+			TestContext(size_t topHeight, const BulkIngestionOptions& bulkIngestionOptions)
+					: TestContext(topHeight, MongoErrorPolicy::Mode::Strict, bulkIngestionOptions)
+			{}
+
+		private:
+			TestContext(size_t topHeight, MongoErrorPolicy::Mode errorPolicyMode, const BulkIngestionOptions& bulkIngestionOptions)
+					: m_pStorage(CreateMongoBlockStorage(
+							mocks::CreateMockTransactionMongoPlugin(),
+							errorPolicyMode,
+							bulkIngestionOptions)) {
 				for (auto i = 1u; i <= topHeight; ++i) {
 					auto transactions = test::GenerateRandomTransactions(10);
 					m_blocks.push_back(test::GenerateBlockWithTransactions(transactions));
 					m_blocks.back()->Height = Height(i);
+					m_blocks.back()->Timestamp = Timestamp(i * 1000);
 					auto blockElement = test::BlockToBlockElement(*m_blocks.back(), test::GenerateRandomByteArray<Hash256>());
 					AddStatements(blockElement, { 0, 1, 2, 3});
 					m_blockElements.emplace_back(blockElement);
@@ -347,7 +365,7 @@ namespace catapult { namespace mongo {
 			}
 
 		public:
-			io::LightBlockStorage& storage() {
+			BulkIngestionBlockStorage& storage() {
 				return *m_pStorage;
 			}
 
@@ -363,7 +381,7 @@ namespace catapult { namespace mongo {
 		private:
 			std::vector<std::unique_ptr<model::Block>> m_blocks;
 			std::vector<model::BlockElement> m_blockElements;
-			std::shared_ptr<io::LightBlockStorage> m_pStorage;
+			std::shared_ptr<BulkIngestionBlockStorage> m_pStorage;
 		};
 
 		// endregion
@@ -526,6 +544,49 @@ namespace catapult { namespace mongo {
 		AssertCollectionSizes(blockElementCounts);
 	}
 
+	namespace {
+		void AssertAllBlocksSaved(TestContext& context) {
+			ASSERT_EQ(Height(Multiple_Blocks_Count), context.storage().chainHeight());
+			BlockElementCounts blockElementCounts;
+			for (const auto& blockElement : context.elements()) {
+				AssertEqual(blockElement);
+				blockElementCounts.AddCounts(blockElement);
+			}
+
+			AssertCollectionSizes(blockElementCounts);
+		}
+	}
+
+	TEST(TEST_CLASS, CanSaveMultipleBlocksWithBulkIngestion) {
+		// Arrange: all blocks are older than min block age
+		TestContext context(Multiple_Blocks_Count, { 4, utils::TimeSpan::FromMinutes(1), []() { return Timestamp(1'000'000); } });
+
+		// Act:
+		context.saveBlocks();
+
+		// Assert: chain height lags by at most max pending blocks
+		auto chainHeight = context.storage().chainHeight();
+		EXPECT_LE(Height(Multiple_Blocks_Count - 4), chainHeight);
+		EXPECT_GE(Height(Multiple_Blocks_Count), chainHeight);
+
+		// Act: flush to complete all pending writes
+		context.storage().flush();
+
+		// Assert:
+		AssertAllBlocksSaved(context);
+	}
+
+	TEST(TEST_CLASS, BulkIngestionCompletesAllPendingWritesWhenRecentBlockIsSaved) {
+		// Arrange: blocks at heights 1-7 are old but blocks at heights 8-10 are recent
+		TestContext context(Multiple_Blocks_Count, { 4, utils::TimeSpan(), []() { return Timestamp(7 * 1000 + 1); } });
+
+		// Act:
+		context.saveBlocks();
+
+		// Assert: all writes completed in order
+		AssertAllBlocksSaved(context);
+	}
+
 	TEST(TEST_CLASS, SaveBlockDoesNotOverwriteScore) {
 		// Arrange:
 		TestContext context(Multiple_Blocks_Count);
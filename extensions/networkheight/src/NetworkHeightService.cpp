@@ -83,6 +83,11 @@ namespace catapult { namespace networkheight {
 					return networkChainHeight.load() < storageView.chainHeight().unwrap() + 4;
 				});
 
+				// expose the network chain height so that other services (e.g. sync) can react to the height gap
+				state.hooks().setNetworkChainHeightSupplier([&networkChainHeight = *pNetworkChainHeight]() {
+					return Height(networkChainHeight.load());
+				});
+
 				// add tasks
 				state.tasks().push_back(CreateChainHeightDetectionTask(
 						state.hooks().remoteChainHeightsRetriever(),
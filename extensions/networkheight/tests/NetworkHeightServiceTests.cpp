@@ -159,6 +159,30 @@ namespace catapult { namespace networkheight {
 
 	// endregion
 
+	// region networkChainHeightSupplier
+
+	TEST(TEST_CLASS, NetworkChainHeightSupplierHookReturnsNetworkChainHeight) {
+		// Arrange:
+		TestContext context;
+		context.boot();
+
+		auto pNetworkChainHeight = GetNetworkChainHeight(context.locator());
+		ASSERT_TRUE(!!pNetworkChainHeight);
+
+		auto supplier = context.testState().state().hooks().networkChainHeightSupplier();
+
+		// Act + Assert: supplier reflects changes to network chain height
+		EXPECT_EQ(Height(0), supplier());
+
+		*pNetworkChainHeight = 123;
+		EXPECT_EQ(Height(123), supplier());
+
+		*pNetworkChainHeight = 234;
+		EXPECT_EQ(Height(234), supplier());
+	}
+
+	// endregion
+
 	// region network chain height detection
 
 	namespace {
@@ -45,6 +45,19 @@ namespace catapult { namespace packetserver {
 			return task;
 		}
 
+		net::FairShareReadSchedulerSettings CreateReadSchedulerSettings(extensions::ServiceState& state) {
+			const auto& config = state.config().Node;
+			net::FairShareReadSchedulerSettings settings;
+			settings.EnableFairShare = config.EnableFairShareReads;
+			settings.Interval = config.FairShareReadInterval;
+			settings.MinShareSize = config.FairShareReadMinSize;
+			settings.PriorityWeight = config.FairShareReadPriorityWeight;
+			settings.TrafficConsumer = [&nodes = state.nodes()](const auto& identity, auto numBytes, auto numPackets) {
+				nodes.modifier().addReadTraffic(identity, numBytes, numPackets);
+			};
+			return settings;
+		}
+
 		class NetworkPacketReadersServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			extensions::ServiceRegistrarInfo info() const override {
@@ -61,11 +74,12 @@ namespace catapult { namespace packetserver {
 				const auto& config = state.config();
 				auto pServiceGroup = state.pool().pushServiceGroup(Service_Name);
 				auto pReaders = pServiceGroup->pushService(
-						net::CreatePacketReaders,
+						[](const auto& pPool, const auto&... args) { return net::CreatePacketReaders(pPool, args...); },
 						state.packetHandlers(),
 						locator.keys().caPublicKey(),
 						extensions::GetConnectionSettings(config),
-						config.Node.MaxIncomingConnectionsPerIdentity);
+						config.Node.MaxIncomingConnectionsPerIdentity,
+						CreateReadSchedulerSettings(state));
 				extensions::BootServer(
 						*pServiceGroup,
 						config.Node.Port,
@@ -175,6 +175,54 @@ namespace catapult { namespace packetserver {
 		EXPECT_EQ(25u, pData[2]);
 	}
 
+	namespace {
+		void AssertReadTrafficIsAddedToNodeContainer(bool enableFairShareReads) {
+			// Arrange:
+			TestContext context;
+			const_cast<config::NodeConfiguration&>(context.testState().config().Node).EnableFairShareReads = enableFairShareReads;
+			auto& nodes = context.testState().state().nodes();
+			auto& packetHandlers = context.testState().state().packetHandlers();
+
+			// - register a single handler
+			handlers::BatchHandlerFactory<SquaresTraits>::RegisterOne(packetHandlers, [](const auto& values) {
+				return SquaresTraits::Producer(values);
+			});
+
+			context.boot();
+
+			// - connect to the server as a reader
+			auto pPool = test::CreateStartedIoThreadPool();
+			auto pIo = test::ConnectToLocalHost(pPool->ioContext(), test::GetLocalHostPort());
+
+			// - wait for a single connection and add the connected reader to the node container
+			WAIT_FOR_ONE_EXPR(context.counter(Counter_Name));
+
+			auto pReaders = context.locator().service<net::PacketReaders>(Service_Name);
+			auto identity = *pReaders->identities().cbegin();
+			nodes.modifier().add(ionet::Node(identity), ionet::NodeSource::Dynamic);
+
+			// Act: send a simple squares request
+			auto pRequestPacket = GenerateSquaresRequestPacket();
+			pIo->write(ionet::PacketPayload(pRequestPacket), [](auto) {});
+
+			// Assert: the traffic was added to the node container
+			WAIT_FOR_ONE_EXPR(nodes.view().getNodeInfo(identity).traffic().NumReadPackets);
+
+			auto view = nodes.view();
+			const auto& traffic = view.getNodeInfo(identity).traffic();
+			EXPECT_EQ(pRequestPacket->Size, traffic.NumReadBytes);
+			EXPECT_EQ(1u, traffic.NumReadPackets);
+		}
+	}
+
+	TEST(TEST_CLASS, ReadTrafficIsAddedToNodeContainerWhenFairShareReadsAreEnabled) {
+		AssertReadTrafficIsAddedToNodeContainer(true);
+	}
+
+	TEST(TEST_CLASS, ReadTrafficIsAddedToNodeContainerWhenFairShareReadsAreDisabled) {
+		AssertReadTrafficIsAddedToNodeContainer(false);
+	}
+
 	// endregion
 
 	// region bannedNodeIdentitySink
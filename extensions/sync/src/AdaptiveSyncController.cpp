@@ -0,0 +1,116 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "AdaptiveSyncController.h"
+#include "catapult/utils/Logging.h"
+#include <algorithm>
+
+namespace catapult { namespace sync {
+
+	AdaptiveSyncController::AdaptiveSyncController(const AdaptiveSyncSettings& settings, const AdaptiveSyncInputs& inputs)
+			: m_settings(settings)
+			, m_inputs(inputs)
+			, m_lastSampleTime(0)
+			, m_lastSampleHeight(0)
+			, m_commitThroughput(0)
+			, m_isCatchingUp(false)
+	{}
+
+	double AdaptiveSyncController::commitThroughput() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_commitThroughput;
+	}
+
+	uint32_t AdaptiveSyncController::targetBlocksPerSyncAttempt() const {
+		auto gap = heightGap();
+		if (gap <= m_settings.MaxBlocksPerSyncAttempt)
+			return 0;
+
+		// leave headroom in the block disruptor by shrinking the batch as it fills up
+		auto maxTargetBlocks = static_cast<uint64_t>(m_settings.MaxBlocksPerSyncAttempt) * m_settings.MaxBatchMultiplier;
+		auto targetBlocks = static_cast<uint64_t>(static_cast<double>(maxTargetBlocks) * (1 - fillLevel()));
+
+		{
+			// don't pull more blocks than can be committed within a configured synchronizer interval
+			utils::SpinLockGuard guard(m_lock);
+			if (0 != m_commitThroughput && utils::TimeSpan() != m_lastConfiguredDelay) {
+				auto numCommittableBlocks = static_cast<uint64_t>(m_commitThroughput * m_lastConfiguredDelay.millis() / 1000);
+				targetBlocks = std::min(targetBlocks, numCommittableBlocks);
+			}
+		}
+
+		targetBlocks = std::max<uint64_t>(targetBlocks, m_settings.MaxBlocksPerSyncAttempt);
+		return static_cast<uint32_t>(std::min(targetBlocks, gap));
+	}
+
+	utils::TimeSpan AdaptiveSyncController::adjustDelay(const utils::TimeSpan& delay) {
+		auto localHeight = m_inputs.LocalChainHeightSupplier();
+		auto isCatchingUp = heightGap() > m_settings.MaxBlocksPerSyncAttempt;
+		auto fill = fillLevel();
+
+		utils::SpinLockGuard guard(m_lock);
+		m_lastConfiguredDelay = delay;
+		if (isCatchingUp != m_isCatchingUp) {
+			CATAPULT_LOG(info) << "synchronizer " << (isCatchingUp ? "is catching up with" : "has caught up with") << " network chain";
+			m_isCatchingUp = isCatchingUp;
+		}
+
+		if (!isCatchingUp) {
+			// commit throughput at the tip is bounded by the block generation rate, so restart measurement when catching up again
+			m_lastSampleHeight = Height(0);
+			return delay;
+		}
+
+		updateCommitThroughput(localHeight);
+
+		// sync back-to-back while the block disruptor has room and fall back to the configured delay as it fills up
+		auto minDelayMillis = std::min(m_settings.MinDelay.millis(), delay.millis());
+		auto delayRangeMillis = delay.millis() - minDelayMillis;
+		return utils::TimeSpan::FromMilliseconds(minDelayMillis + static_cast<uint64_t>(static_cast<double>(delayRangeMillis) * fill));
+	}
+
+	uint64_t AdaptiveSyncController::heightGap() const {
+		auto localHeight = m_inputs.LocalChainHeightSupplier();
+		auto networkHeight = m_inputs.NetworkChainHeightSupplier();
+		return networkHeight > localHeight ? (networkHeight - localHeight).unwrap() : 0;
+	}
+
+	double AdaptiveSyncController::fillLevel() const {
+		if (0 == m_settings.MaxPendingElements)
+			return 0;
+
+		auto numPendingElements = std::min<size_t>(m_inputs.NumPendingElementsSupplier(), m_settings.MaxPendingElements);
+		return static_cast<double>(numPendingElements) / m_settings.MaxPendingElements;
+	}
+
+	void AdaptiveSyncController::updateCommitThroughput(Height localHeight) {
+		auto now = m_inputs.TimeSupplier();
+		if (Height(0) != m_lastSampleHeight && now > m_lastSampleTime && localHeight >= m_lastSampleHeight) {
+			auto numBlocks = static_cast<double>((localHeight - m_lastSampleHeight).unwrap());
+			auto blocksPerSecond = numBlocks * 1000 / static_cast<double>((now - m_lastSampleTime).unwrap());
+
+			// smooth measurements with an exponential moving average
+			m_commitThroughput = 0 == m_commitThroughput ? blocksPerSecond : (m_commitThroughput + blocksPerSecond) / 2;
+		}
+
+		m_lastSampleTime = now;
+		m_lastSampleHeight = localHeight;
+	}
+}}
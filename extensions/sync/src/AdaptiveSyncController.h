@@ -0,0 +1,97 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/SpinLock.h"
+#include "catapult/utils/TimeSpan.h"
+#include "catapult/functions.h"
+#include "catapult/types.h"
+
+namespace catapult { namespace sync {
+
+	/// Adaptive sync controller settings.
+	struct AdaptiveSyncSettings {
+		/// Maximum number of blocks that are pulled by a single blocks-from request.
+		uint32_t MaxBlocksPerSyncAttempt;
+
+		/// Maximum multiple of MaxBlocksPerSyncAttempt that a single sync attempt can target.
+		uint32_t MaxBatchMultiplier;
+
+		/// Minimum delay between sync attempts.
+		utils::TimeSpan MinDelay;
+
+		/// Number of pending block elements at which the block disruptor is considered to be full.
+		uint32_t MaxPendingElements;
+	};
+
+	/// Suppliers of the state observed by an adaptive sync controller.
+	struct AdaptiveSyncInputs {
+		/// Supplies the local chain height.
+		supplier<Height> LocalChainHeightSupplier;
+
+		/// Supplies the network chain height (zero when unknown).
+		supplier<Height> NetworkChainHeightSupplier;
+
+		/// Supplies the number of block elements pending in the block disruptor.
+		supplier<size_t> NumPendingElementsSupplier;
+
+		/// Supplies the current time.
+		supplier<Timestamp> TimeSupplier;
+	};
+
+	/// Feedback controller that derives the synchronizer interval and batch size from the gap between the local and the network
+	/// chain heights, the block disruptor fill level and the measured commit throughput.
+	/// \note This class is thread safe.
+	class AdaptiveSyncController {
+	public:
+		/// Creates a controller around \a settings and \a inputs.
+		AdaptiveSyncController(const AdaptiveSyncSettings& settings, const AdaptiveSyncInputs& inputs);
+
+	public:
+		/// Gets the measured commit throughput (in blocks per second) while catching up.
+		double commitThroughput() const;
+
+	public:
+		/// Gets the number of blocks that the next sync attempt should pull.
+		/// \note Zero is returned when the local chain is close to the network chain, which results in a single pull.
+		uint32_t targetBlocksPerSyncAttempt() const;
+
+		/// Adjusts the configured synchronizer \a delay and updates the commit throughput measurement.
+		utils::TimeSpan adjustDelay(const utils::TimeSpan& delay);
+
+	private:
+		uint64_t heightGap() const;
+
+		double fillLevel() const;
+
+		void updateCommitThroughput(Height localHeight);
+
+	private:
+		AdaptiveSyncSettings m_settings;
+		AdaptiveSyncInputs m_inputs;
+
+		Timestamp m_lastSampleTime;
+		Height m_lastSampleHeight;
+		double m_commitThroughput;
+		utils::TimeSpan m_lastConfiguredDelay;
+		bool m_isCatchingUp;
+		mutable utils::SpinLock m_lock;
+	};
+}}
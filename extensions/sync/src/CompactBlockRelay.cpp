@@ -0,0 +1,124 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "CompactBlockRelay.h"
+#include "catapult/api/RemoteChainApi.h"
+#include "catapult/ionet/BroadcastUtils.h"
+#include "catapult/model/Elements.h"
+#include "catapult/model/EntityHasher.h"
+#include "catapult/net/PacketWriters.h"
+
+namespace catapult { namespace sync {
+
+	namespace {
+		using ShortHashesPointer = std::shared_ptr<const std::vector<utils::ShortHash>>;
+
+		ShortHashesPointer CalculateShortHashes(
+				const model::Block& block,
+				const model::TransactionRegistry& registry,
+				const GenerationHash& generationHash) {
+			auto pShortHashes = std::make_shared<std::vector<utils::ShortHash>>();
+			for (const auto& transaction : block.Transactions()) {
+				model::TransactionElement transactionElement(transaction);
+				model::UpdateHashes(registry, generationHash, transactionElement);
+				pShortHashes->push_back(utils::ToShortHash(transactionElement.EntityHash));
+			}
+
+			return pShortHashes;
+		}
+
+		void PushFullBlock(const ionet::NodePacketIoPair& packetIoPair, const std::shared_ptr<const model::Block>& pBlock) {
+			packetIoPair.io()->write(ionet::CreateBroadcastPayload(pBlock), [packetIoPair](auto code) {
+				if (ionet::SocketOperationCode::Success != code)
+					CATAPULT_LOG(warning) << "failed to push full block to " << packetIoPair.node() << " (" << code << ")";
+			});
+		}
+
+		void PushCompactBlock(
+				const ionet::NodePacketIoPair& packetIoPair,
+				const std::shared_ptr<api::RemoteChainApi>& pApi,
+				const std::shared_ptr<const model::Block>& pBlock,
+				const ShortHashesPointer& pShortHashes,
+				const std::vector<uint32_t>& prefilledIndexes,
+				bool isRetry) {
+			auto indexesFuture = pApi->compactBlock(pBlock, *pShortHashes, prefilledIndexes);
+
+			// the packet io pair must be captured in order to keep the writer checked out until all pushes complete
+			indexesFuture.then([packetIoPair, pApi, pBlock, pShortHashes, isRetry](auto&& completedFuture) {
+				std::vector<uint32_t> missingIndexes;
+				try {
+					auto indexes = completedFuture.get();
+					missingIndexes.assign(indexes.cbegin(), indexes.cend());
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning) << "exception thrown while relaying compact block to " << packetIoPair.node() << ": " << e.what();
+					return;
+				}
+
+				if (missingIndexes.empty()) {
+					CATAPULT_LOG(trace) << "compact block at height " << pBlock->Height << " was reconstructed by " << packetIoPair.node();
+					return;
+				}
+
+				CATAPULT_LOG(debug)
+						<< packetIoPair.node() << " is missing " << missingIndexes.size() << " of " << pShortHashes->size()
+						<< " transactions in compact block at height " << pBlock->Height;
+
+				// prefill all missing transactions once and fall back to the full block if reconstruction still fails
+				if (isRetry)
+					PushFullBlock(packetIoPair, pBlock);
+				else
+					PushCompactBlock(packetIoPair, pApi, pBlock, pShortHashes, missingIndexes, true);
+			});
+		}
+	}
+
+	extensions::NewBlockSink CreateCompactBlockRelaySink(
+			net::PacketWriters& packetWriters,
+			const model::TransactionRegistry& registry,
+			const GenerationHash& generationHash,
+			const utils::TimeSpan& timeout) {
+		return [&packetWriters, &registry, generationHash, timeout](const auto& pBlock) {
+			// a block without transactions cannot be compacted
+			if (0 == model::GetTransactionPayloadSize(*pBlock)) {
+				packetWriters.broadcast(ionet::CreateBroadcastPayload(pBlock));
+				return;
+			}
+
+			// writers that are checked out cannot be picked, so fall back to a full broadcast instead of skipping them
+			auto numActiveWriters = packetWriters.numActiveWriters();
+			auto packetIoPairs = net::PickMultiple(packetWriters, numActiveWriters, timeout);
+			if (packetIoPairs.size() < numActiveWriters) {
+				CATAPULT_LOG(debug)
+						<< "broadcasting full block at height " << pBlock->Height << " because only " << packetIoPairs.size()
+						<< " of " << numActiveWriters << " writers are available";
+				packetIoPairs.clear();
+				packetWriters.broadcast(ionet::CreateBroadcastPayload(pBlock));
+				return;
+			}
+
+			auto pShortHashes = CalculateShortHashes(*pBlock, registry, generationHash);
+			for (const auto& packetIoPair : packetIoPairs) {
+				const auto& identity = packetIoPair.node().identity();
+				auto pApi = std::shared_ptr<api::RemoteChainApi>(api::CreateRemoteChainApi(*packetIoPair.io(), identity, registry));
+				PushCompactBlock(packetIoPair, pApi, pBlock, pShortHashes, {}, false);
+			}
+		};
+	}
+}}
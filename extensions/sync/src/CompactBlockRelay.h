@@ -0,0 +1,42 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/extensions/ServerHooks.h"
+#include "catapult/utils/TimeSpan.h"
+
+namespace catapult {
+	namespace model { class TransactionRegistry; }
+	namespace net { class PacketWriters; }
+}
+
+namespace catapult { namespace sync {
+
+	/// Creates a new block sink that relays blocks to all active \a packetWriters as compact blocks composed of transaction
+	/// short hashes. Peers that cannot reconstruct a block from their unconfirmed transactions are sent the missing
+	/// transactions and, if reconstruction still fails, the full block. The full block is broadcast instead when not all
+	/// active writers can be checked out.
+	/// \note \a registry and \a generationHash are used to calculate transaction hashes and \a timeout bounds writer checkout.
+	extensions::NewBlockSink CreateCompactBlockRelaySink(
+			net::PacketWriters& packetWriters,
+			const model::TransactionRegistry& registry,
+			const GenerationHash& generationHash,
+			const utils::TimeSpan& timeout);
+}}
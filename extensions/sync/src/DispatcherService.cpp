@@ -22,6 +22,7 @@
 #include "DispatcherSyncHandlers.h"
 #include "PredicateUtils.h"
 #include "RollbackInfo.h"
+#include "TransactionSpamThrottle.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/cache_core/BlockStatisticCache.h"
@@ -377,6 +378,9 @@ namespace catapult { namespace sync {
 		// endregion
 
 		chain::UtUpdater& CreateAndRegisterUtUpdater(extensions::ServiceLocator& locator, extensions::ServiceState& state) {
+			auto pThrottleCounters = std::make_shared<SpamThrottleCounters>();
+			locator.registerRootedService("dispatcher.utThrottle", pThrottleCounters);
+
 			auto pUtUpdater = std::make_shared<chain::UtUpdater>(
 					state.utCache(),
 					state.cache(),
@@ -384,11 +388,17 @@ namespace catapult { namespace sync {
 					extensions::CreateExecutionConfiguration(state.pluginManager()),
 					state.timeSupplier(),
 					extensions::SubscriberToSink(state.transactionStatusSubscriber()),
-					CreateUtUpdaterThrottle(state.config()));
+					CreateUtUpdaterThrottle(state.config(), pThrottleCounters));
 			locator.registerRootedService("dispatcher.utUpdater", pUtUpdater);
 
 			auto& utUpdater = *pUtUpdater;
-			state.hooks().addTransactionsChangeHandler([&utUpdater](const auto& changeInfo) {
+			auto enableIncrementalUtRebase = state.config().Node.EnableIncrementalUtRebase;
+			state.hooks().addTransactionsChangeHandler([&utUpdater, enableIncrementalUtRebase](const auto& changeInfo) {
+				if (enableIncrementalUtRebase && changeInfo.pChangedAddresses) {
+					utUpdater.update(changeInfo.AddedTransactionHashes, changeInfo.RevertedTransactionInfos, *changeInfo.pChangedAddresses);
+					return;
+				}
+
 				utUpdater.update(changeInfo.AddedTransactionHashes, changeInfo.RevertedTransactionInfos);
 			});
 
@@ -431,6 +441,13 @@ namespace catapult { namespace sync {
 				AddRollbackCounter(locator, "RB COMMIT RCT", RollbackResult::Committed, RollbackCounterType::Recent);
 				AddRollbackCounter(locator, "RB IGNORE ALL", RollbackResult::Ignored, RollbackCounterType::All);
 				AddRollbackCounter(locator, "RB IGNORE RCT", RollbackResult::Ignored, RollbackCounterType::Recent);
+
+				locator.registerServiceCounter<SpamThrottleCounters>("dispatcher.utThrottle", "UT FULL REJ", [](const auto& counters) {
+					return counters.NumCacheFullRejections.load();
+				});
+				locator.registerServiceCounter<SpamThrottleCounters>("dispatcher.utThrottle", "UT THROT REJ", [](const auto& counters) {
+					return counters.NumThrottledRejections.load();
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
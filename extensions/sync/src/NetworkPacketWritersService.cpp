@@ -19,6 +19,8 @@
 **/
 
 #include "NetworkPacketWritersService.h"
+#include "CompactBlockRelay.h"
+#include "TransactionAnnouncer.h"
 #include "catapult/api/RemoteChainApi.h"
 #include "catapult/config/CatapultKeys.h"
 #include "catapult/extensions/NetworkUtils.h"
@@ -26,6 +28,7 @@
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/extensions/ServiceUtils.h"
 #include "catapult/ionet/BroadcastUtils.h"
+#include "catapult/plugins/PluginManager.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/thread/MultiServicePool.h"
 
@@ -61,6 +64,42 @@ namespace catapult { namespace sync {
 			};
 		}
 
+		BlockSink CreateNewBlockSink(
+				const extensions::ServiceLocator& locator,
+				const extensions::ServiceState& state,
+				net::PacketWriters& packetWriters) {
+			const auto& config = state.config();
+			if (!config.Node.EnableCompactBlockRelay)
+				return extensions::CreatePushEntitySink<BlockSink>(locator, Service_Name);
+
+			// relay short transaction hashes so that peers can reconstruct blocks from their unconfirmed transactions
+			return CreateCompactBlockRelaySink(
+					packetWriters,
+					state.pluginManager().transactionRegistry(),
+					config.BlockChain.Network.GenerationHash,
+					config.Node.SyncTimeout);
+		}
+
+		TransactionsSink CreateNewTransactionsSink(
+				const extensions::ServiceLocator& locator,
+				const extensions::ServiceState& state,
+				net::PacketWriters& packetWriters) {
+			const auto& config = state.config();
+			if (!config.Node.EnableTransactionAnnouncements)
+				return extensions::CreatePushEntitySink<TransactionsSink>(locator, Service_Name);
+
+			// announce transaction hashes to a subset of peers and only push the transactions they are missing
+			auto pInventories = std::make_shared<PeerTransactionInventories>(
+					config.Node.MaxKnownTransactionHashesPerPeer,
+					extensions::GetConnectionSettings(config).NodeIdentityEqualityStrategy);
+			TransactionAnnouncerConfiguration announcerConfig{ config.Node.MaxTransactionAnnouncementFanOut, config.Node.SyncTimeout };
+			return CreateTransactionAnnouncingSink(
+					packetWriters,
+					state.pluginManager().transactionRegistry(),
+					announcerConfig,
+					pInventories);
+		}
+
 		class NetworkPacketWritersServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			extensions::ServiceRegistrarInfo info() const override {
@@ -82,8 +121,8 @@ namespace catapult { namespace sync {
 				state.packetIoPickers().insert(*pWriters, ionet::NodeRoles::Peer);
 
 				// add sinks
-				state.hooks().addNewBlockSink(extensions::CreatePushEntitySink<BlockSink>(locator, Service_Name));
-				state.hooks().addNewTransactionsSink(extensions::CreatePushEntitySink<TransactionsSink>(locator, Service_Name));
+				state.hooks().addNewBlockSink(CreateNewBlockSink(locator, state, *pWriters));
+				state.hooks().addNewTransactionsSink(CreateNewTransactionsSink(locator, state, *pWriters));
 				state.hooks().addPacketPayloadSink([&writers = *pWriters](const auto& payload) { writers.broadcast(payload); });
 				state.hooks().addBannedNodeIdentitySink(extensions::CreateCloseConnectionSink(*pWriters));
 
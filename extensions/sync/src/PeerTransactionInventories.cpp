@@ -0,0 +1,75 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PeerTransactionInventories.h"
+
+namespace catapult { namespace sync {
+
+	PeerTransactionInventories::PeerTransactionInventories(
+			uint32_t maxHashesPerPeer,
+			model::NodeIdentityEqualityStrategy equalityStrategy)
+			: m_maxHashesPerPeer(maxHashesPerPeer)
+			, m_inventories(model::CreateNodeIdentityMap<Inventory>(equalityStrategy))
+	{}
+
+	size_t PeerTransactionInventories::size() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_inventories.size();
+	}
+
+	size_t PeerTransactionInventories::size(const model::NodeIdentity& identity) const {
+		utils::SpinLockGuard guard(m_lock);
+		auto iter = m_inventories.find(identity);
+		return m_inventories.cend() == iter ? 0 : iter->second.Hashes.size();
+	}
+
+	bool PeerTransactionInventories::contains(const model::NodeIdentity& identity, const Hash256& hash) const {
+		utils::SpinLockGuard guard(m_lock);
+		auto iter = m_inventories.find(identity);
+		return m_inventories.cend() != iter && iter->second.Hashes.cend() != iter->second.Hashes.find(hash);
+	}
+
+	void PeerTransactionInventories::add(const model::NodeIdentity& identity, const Hash256& hash) {
+		if (0 == m_maxHashesPerPeer)
+			return;
+
+		utils::SpinLockGuard guard(m_lock);
+		auto& inventory = m_inventories[identity];
+		if (!inventory.Hashes.insert(hash).second)
+			return;
+
+		inventory.InsertionOrder.push_back(hash);
+		if (inventory.InsertionOrder.size() <= m_maxHashesPerPeer)
+			return;
+
+		inventory.Hashes.erase(inventory.InsertionOrder.front());
+		inventory.InsertionOrder.pop_front();
+	}
+
+	void PeerTransactionInventories::retain(const model::NodeIdentitySet& identities) {
+		utils::SpinLockGuard guard(m_lock);
+		for (auto iter = m_inventories.begin(); m_inventories.end() != iter;) {
+			if (identities.cend() == identities.find(iter->first))
+				iter = m_inventories.erase(iter);
+			else
+				++iter;
+		}
+	}
+}}
@@ -0,0 +1,68 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/NodeIdentity.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/SpinLock.h"
+#include "catapult/types.h"
+#include <deque>
+#include <unordered_set>
+
+namespace catapult { namespace sync {
+
+	/// Bounded per peer inventories of transaction hashes that are known to be available at peers.
+	/// \note This class is thread safe.
+	class PeerTransactionInventories {
+	public:
+		/// Creates inventories that remember at most \a maxHashesPerPeer hashes per peer and compare peers
+		/// using \a equalityStrategy.
+		PeerTransactionInventories(uint32_t maxHashesPerPeer, model::NodeIdentityEqualityStrategy equalityStrategy);
+
+	public:
+		/// Gets the number of peers with inventories.
+		size_t size() const;
+
+		/// Gets the number of hashes in the inventory of the peer with \a identity.
+		size_t size(const model::NodeIdentity& identity) const;
+
+		/// Returns \c true if \a hash is in the inventory of the peer with \a identity.
+		bool contains(const model::NodeIdentity& identity, const Hash256& hash) const;
+
+	public:
+		/// Adds \a hash to the inventory of the peer with \a identity.
+		/// \note The oldest hash is evicted when the inventory is full.
+		void add(const model::NodeIdentity& identity, const Hash256& hash);
+
+		/// Removes the inventories of all peers that are not contained in \a identities.
+		void retain(const model::NodeIdentitySet& identities);
+
+	private:
+		struct Inventory {
+			std::unordered_set<Hash256, utils::ArrayHasher<Hash256>> Hashes;
+			std::deque<Hash256> InsertionOrder;
+		};
+
+	private:
+		uint32_t m_maxHashesPerPeer;
+		model::NodeIdentityMap<Inventory> m_inventories;
+		mutable utils::SpinLock m_lock;
+	};
+}}
@@ -37,14 +37,22 @@ namespace catapult { namespace sync {
 			return transaction.Type == model::MakeEntityType(model::BasicEntityType::Transaction, model::FacilityCode::Aggregate, 2);
 		}
 
-		chain::UtUpdater::Throttle CreateDefaultUtUpdaterThrottle(uint64_t maxCacheSize) {
-			return [maxCacheSize](const auto&, const auto& context) {
-				return context.TransactionsCache.size() >= maxCacheSize;
+		chain::UtUpdater::Throttle CreateDefaultUtUpdaterThrottle(
+				uint64_t maxCacheSize,
+				const std::shared_ptr<SpamThrottleCounters>& pCounters) {
+			return [maxCacheSize, pCounters](const auto&, const auto& context) {
+				if (context.TransactionsCache.size() < maxCacheSize)
+					return false;
+
+				++pCounters->NumCacheFullRejections;
+				return true;
 			};
 		}
 	}
 
-	chain::UtUpdater::Throttle CreateUtUpdaterThrottle(const config::CatapultConfiguration& config) {
+	chain::UtUpdater::Throttle CreateUtUpdaterThrottle(
+			const config::CatapultConfiguration& config,
+			const std::shared_ptr<SpamThrottleCounters>& pCounters) {
 		SpamThrottleConfiguration throttleConfig(
 				config.Node.TransactionSpamThrottlingMaxBoostFee,
 				config.BlockChain.TotalChainImportance,
@@ -52,7 +60,7 @@ namespace catapult { namespace sync {
 				config.BlockChain.MaxTransactionsPerBlock);
 
 		return config.Node.EnableTransactionSpamThrottling
-				? CreateTransactionSpamThrottle(throttleConfig, IsBondedTransaction)
-				: CreateDefaultUtUpdaterThrottle(throttleConfig.MaxCacheSize);
+				? CreateTransactionSpamThrottle(throttleConfig, IsBondedTransaction, pCounters)
+				: CreateDefaultUtUpdaterThrottle(throttleConfig.MaxCacheSize, pCounters);
 	}
 }}
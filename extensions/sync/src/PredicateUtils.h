@@ -23,13 +23,18 @@
 #include "catapult/consumers/TransactionConsumers.h"
 #include "catapult/model/Elements.h"
 
-namespace catapult { namespace config { class CatapultConfiguration; } }
+namespace catapult {
+	namespace config { class CatapultConfiguration; }
+	namespace sync { struct SpamThrottleCounters; }
+}
 
 namespace catapult { namespace sync {
 
 	/// Converts a known hash predicate (\a knownHashPredicate) to a requires validation predicate.
 	model::MatchingEntityPredicate ToRequiresValidationPredicate(const chain::KnownHashPredicate& knownHashPredicate);
 
-	/// Creates a ut updater throttle based on \a config.
-	chain::UtUpdater::Throttle CreateUtUpdaterThrottle(const config::CatapultConfiguration& config);
+	/// Creates a ut updater throttle based on \a config that tracks rejections in \a pCounters.
+	chain::UtUpdater::Throttle CreateUtUpdaterThrottle(
+			const config::CatapultConfiguration& config,
+			const std::shared_ptr<SpamThrottleCounters>& pCounters);
 }}
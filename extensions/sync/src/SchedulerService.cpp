@@ -75,6 +75,14 @@ namespace catapult { namespace sync {
 							taskConfig.NumTransitionRounds);
 				}
 
+				if (scheduledTask.AdjustDelay) {
+					auto nextDelay = scheduledTask.NextDelay;
+					auto adjustDelay = scheduledTask.AdjustDelay;
+					scheduledTask.NextDelay = [nextDelay, adjustDelay]() {
+						return adjustDelay(nextDelay());
+					};
+				}
+
 				return scheduledTask;
 			}
 
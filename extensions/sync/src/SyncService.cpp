@@ -19,6 +19,7 @@
 **/
 
 #include "SyncService.h"
+#include "AdaptiveSyncController.h"
 #include "NetworkPacketWritersService.h"
 #include "catapult/api/LocalChainApi.h"
 #include "catapult/api/RemoteChainApi.h"
@@ -26,9 +27,13 @@
 #include "catapult/cache_tx/MemoryUtCache.h"
 #include "catapult/chain/UtSynchronizer.h"
 #include "catapult/config/CatapultConfiguration.h"
+#include "catapult/disruptor/ConsumerDispatcher.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/PeersConnectionTasks.h"
+#include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/SynchronizerTaskCallbacks.h"
+#include "catapult/io/BlockStorageCache.h"
+#include "catapult/ionet/NodeContainer.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/MemoryUtils.h"
 
@@ -38,6 +43,9 @@ namespace catapult { namespace sync {
 		constexpr auto Sync_Source = disruptor::InputSource::Remote_Pull;
 		constexpr auto Service_Id = ionet::ServiceIdentifier(0x53594E43);
 
+		// chain synchronizer stops pulling when its unprocessed elements exceed 3 * MaxChainBytesPerSyncAttempt
+		constexpr uint32_t Max_Pending_Sync_Elements = 3;
+
 		thread::Task CreateConnectPeersTask(extensions::ServiceState& state, net::PacketWriters& packetWriters) {
 			auto settings = extensions::SelectorSettings(
 					state.cache(),
@@ -59,14 +67,69 @@ namespace catapult { namespace sync {
 			return chainSynchronizerConfig;
 		}
 
-		thread::Task CreateSynchronizerTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
+		chain::ChainSynchronizerMonitors CreateChainSynchronizerMonitors(
+				extensions::ServiceLocator& locator,
+				const extensions::ServiceState& state) {
+			chain::ChainSynchronizerMonitors monitors;
+			monitors.pCompareChains = std::make_shared<utils::LatencyHistogram>();
+			monitors.pBlocksFrom = std::make_shared<utils::LatencyHistogram>();
+
+			using utils::DiagnosticCounterId;
+			locator.registerHistogram(utils::DiagnosticHistogram(DiagnosticCounterId("SYNC COMPARE"), 0, monitors.pCompareChains));
+			locator.registerHistogram(utils::DiagnosticHistogram(DiagnosticCounterId("SYNC BLOCKS"), 0, monitors.pBlocksFrom));
+
+			// feed measured peer performance back into the node container so that it can be used during peer selection
+			monitors.RoundTripTimeConsumer = [&nodes = state.nodes()](const auto& identity, const auto& roundTripTime) {
+				nodes.modifier().addRoundTripTime(identity, roundTripTime);
+			};
+			monitors.ThroughputConsumer = [&nodes = state.nodes()](const auto& identity, auto numBytes, const auto& elapsedTime) {
+				nodes.modifier().addThroughput(identity, numBytes, elapsedTime);
+			};
+			return monitors;
+		}
+
+		std::shared_ptr<AdaptiveSyncController> CreateAdaptiveSyncController(
+				const extensions::ServiceLocator& locator,
+				const extensions::ServiceState& state) {
+			const auto& config = state.config().Node;
+			AdaptiveSyncSettings settings;
+			settings.MaxBlocksPerSyncAttempt = config.MaxBlocksPerSyncAttempt;
+			settings.MaxBatchMultiplier = config.MaxAdaptiveSyncBatchMultiplier;
+			settings.MinDelay = config.AdaptiveSyncMinDelay;
+			settings.MaxPendingElements = Max_Pending_Sync_Elements;
+
+			AdaptiveSyncInputs inputs;
+			inputs.LocalChainHeightSupplier = [&storage = state.storage()]() {
+				return storage.view().chainHeight();
+			};
+			inputs.NetworkChainHeightSupplier = state.hooks().networkChainHeightSupplier();
+			inputs.NumPendingElementsSupplier = [pDispatcher = locator.service<disruptor::ConsumerDispatcher>("dispatcher.block")]() {
+				return pDispatcher->numActiveElements();
+			};
+			inputs.TimeSupplier = state.timeSupplier();
+			return std::make_shared<AdaptiveSyncController>(settings, inputs);
+		}
+
+		thread::Task CreateSynchronizerTask(
+				const extensions::ServiceState& state,
+				net::PacketWriters& packetWriters,
+				const chain::ChainSynchronizerMonitors& monitors,
+				const std::shared_ptr<AdaptiveSyncController>& pAdaptiveSyncController) {
 			const auto& config = state.config();
+			auto chainSynchronizerConfig = CreateChainSynchronizerConfiguration(config);
+			if (pAdaptiveSyncController) {
+				chainSynchronizerConfig.TargetBlocksPerSyncAttemptSupplier = [pAdaptiveSyncController]() {
+					return pAdaptiveSyncController->targetBlocksPerSyncAttempt();
+				};
+			}
+
 			auto chainSynchronizer = chain::CreateChainSynchronizer(
 					api::CreateLocalChainApi(state.storage(), [&score = state.score()]() {
 						return score.get();
 					}),
-					CreateChainSynchronizerConfiguration(config),
-					state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source));
+					chainSynchronizerConfig,
+					state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source),
+					monitors);
 
 			thread::Task task;
 			task.Name = "synchronizer task";
@@ -76,6 +139,13 @@ namespace catapult { namespace sync {
 					packetWriters,
 					state,
 					task.Name);
+
+			if (pAdaptiveSyncController) {
+				task.AdjustDelay = [pAdaptiveSyncController](const auto& delay) {
+					return pAdaptiveSyncController->adjustDelay(delay);
+				};
+			}
+
 			return task;
 		}
 
@@ -111,7 +181,11 @@ namespace catapult { namespace sync {
 
 				// add tasks
 				state.tasks().push_back(CreateConnectPeersTask(state, packetWriters));
-				state.tasks().push_back(CreateSynchronizerTask(state, packetWriters));
+				auto monitors = CreateChainSynchronizerMonitors(locator, state);
+				auto pAdaptiveSyncController = state.config().Node.EnableAdaptiveSync
+						? CreateAdaptiveSyncController(locator, state)
+						: nullptr;
+				state.tasks().push_back(CreateSynchronizerTask(state, packetWriters, monitors, pAdaptiveSyncController));
 				state.tasks().push_back(CreatePullUtTask(state, packetWriters));
 			}
 		};
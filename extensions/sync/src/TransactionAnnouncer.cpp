@@ -0,0 +1,145 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TransactionAnnouncer.h"
+#include "catapult/api/RemoteTransactionApi.h"
+#include "catapult/ionet/BroadcastUtils.h"
+#include "catapult/net/PacketWriters.h"
+#include "catapult/utils/ArraySet.h"
+
+namespace catapult { namespace sync {
+
+	namespace {
+		using TransactionInfosPointer = std::shared_ptr<consumers::TransactionInfos>;
+
+		TransactionInfosPointer FilterUnknownTransactionInfos(
+				const consumers::TransactionInfos& transactionInfos,
+				const model::NodeIdentity& identity,
+				const PeerTransactionInventories& inventories) {
+			auto pUnknownTransactionInfos = std::make_shared<consumers::TransactionInfos>();
+			for (const auto& transactionInfo : transactionInfos) {
+				if (!inventories.contains(identity, transactionInfo.EntityHash))
+					pUnknownTransactionInfos->push_back(transactionInfo.copy());
+			}
+
+			return pUnknownTransactionInfos;
+		}
+
+		model::AnnouncedTransactionRange ExtractAnnouncedTransactions(const consumers::TransactionInfos& transactionInfos) {
+			auto transactions = model::AnnouncedTransactionRange::PrepareFixed(transactionInfos.size());
+			auto transactionsIter = transactions.begin();
+			for (const auto& transactionInfo : transactionInfos) {
+				auto& transaction = *transactionsIter++;
+				transaction.Deadline = transactionInfo.pEntity->Deadline;
+				transaction.EntityHash = transactionInfo.EntityHash;
+			}
+
+			return transactions;
+		}
+
+		consumers::TransactionInfos SelectTransactionInfos(
+				const consumers::TransactionInfos& transactionInfos,
+				const model::HashRange& hashes) {
+			utils::HashPointerSet hashPointers;
+			for (const auto& hash : hashes)
+				hashPointers.insert(&hash);
+
+			consumers::TransactionInfos selectedTransactionInfos;
+			for (const auto& transactionInfo : transactionInfos) {
+				if (hashPointers.cend() != hashPointers.find(&transactionInfo.EntityHash))
+					selectedTransactionInfos.push_back(transactionInfo.copy());
+			}
+
+			return selectedTransactionInfos;
+		}
+
+		void AnnounceToPeer(
+				const ionet::NodePacketIoPair& packetIoPair,
+				const model::TransactionRegistry& registry,
+				const TransactionInfosPointer& pTransactionInfos,
+				const std::shared_ptr<PeerTransactionInventories>& pInventories) {
+			const auto& identity = packetIoPair.node().identity();
+			auto pApi = std::shared_ptr<api::RemoteTransactionApi>(api::CreateRemoteTransactionApi(*packetIoPair.io(), identity, registry));
+			auto hashesFuture = pApi->unknownTransactionHashes(ExtractAnnouncedTransactions(*pTransactionInfos));
+
+			// the packet io pair must be captured in order to keep the writer checked out until the push completes
+			hashesFuture.then([packetIoPair, pApi, pTransactionInfos, pInventories](auto&& completedFuture) {
+				model::HashRange unknownHashes;
+				try {
+					unknownHashes = completedFuture.get();
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning)
+							<< "exception thrown while announcing transactions to " << packetIoPair.node() << ": " << e.what();
+					return;
+				}
+
+				// after the announcement, all announced transactions are either known or pushed
+				const auto& identity = packetIoPair.node().identity();
+				for (const auto& transactionInfo : *pTransactionInfos)
+					pInventories->add(identity, transactionInfo.EntityHash);
+
+				auto unknownTransactionInfos = SelectTransactionInfos(*pTransactionInfos, unknownHashes);
+				CATAPULT_LOG(trace)
+						<< "pushing " << unknownTransactionInfos.size() << " of " << pTransactionInfos->size()
+						<< " announced transactions to " << packetIoPair.node();
+				if (unknownTransactionInfos.empty())
+					return;
+
+				auto payload = ionet::CreateBroadcastPayload(unknownTransactionInfos);
+				packetIoPair.io()->write(payload, [packetIoPair](auto code) {
+					if (ionet::SocketOperationCode::Success != code)
+						CATAPULT_LOG(warning) << "failed to push announced transactions to " << packetIoPair.node() << " (" << code << ")";
+				});
+			});
+		}
+	}
+
+	extensions::SharedNewTransactionsSink CreateTransactionAnnouncingSink(
+			net::PacketWriters& packetWriters,
+			const model::TransactionRegistry& registry,
+			const TransactionAnnouncerConfiguration& config,
+			const std::shared_ptr<PeerTransactionInventories>& pInventories) {
+		return [&packetWriters, &registry, config, pInventories](const auto& transactionInfos) {
+			// forget inventories of peers that are no longer connected
+			pInventories->retain(packetWriters.identities());
+
+			// writers that are checked out cannot be picked, so fall back to a broadcast instead of skipping them
+			auto fanOut = std::min<size_t>(config.MaxFanOut, packetWriters.numActiveWriters());
+			auto packetIoPairs = net::PickMultiple(packetWriters, fanOut, config.Timeout);
+			if (packetIoPairs.size() < fanOut) {
+				CATAPULT_LOG(debug)
+						<< "broadcasting " << transactionInfos.size() << " transactions because only " << packetIoPairs.size()
+						<< " of " << fanOut << " writers are available";
+				packetIoPairs.clear();
+				packetWriters.broadcast(ionet::CreateBroadcastPayload(transactionInfos));
+				return;
+			}
+
+			for (const auto& packetIoPair : packetIoPairs) {
+				const auto& identity = packetIoPair.node().identity();
+				auto pUnknownTransactionInfos = FilterUnknownTransactionInfos(transactionInfos, identity, *pInventories);
+				if (pUnknownTransactionInfos->empty())
+					continue;
+
+				AnnounceToPeer(packetIoPair, registry, pUnknownTransactionInfos, pInventories);
+			}
+		};
+	}
+}}
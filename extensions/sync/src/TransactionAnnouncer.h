@@ -0,0 +1,52 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PeerTransactionInventories.h"
+#include "catapult/extensions/ServerHooks.h"
+#include "catapult/utils/TimeSpan.h"
+
+namespace catapult {
+	namespace model { class TransactionRegistry; }
+	namespace net { class PacketWriters; }
+}
+
+namespace catapult { namespace sync {
+
+	/// Configuration for announcing new transactions to peers.
+	struct TransactionAnnouncerConfiguration {
+		/// Maximum number of peers to which new transactions are announced.
+		uint32_t MaxFanOut;
+
+		/// Maximum duration of a single announcement (including the push of unknown transactions).
+		utils::TimeSpan Timeout;
+	};
+
+	/// Creates a new transactions sink that announces transaction hashes to at most \a config.MaxFanOut peers picked from
+	/// \a packetWriters and only pushes the transactions that are reported as unknown by each peer.
+	/// Hashes already known by a peer (tracked in \a pInventories) are not announced to that peer again.
+	/// \note When fewer peers than the fan-out can be picked, all transactions are broadcast instead.
+	/// \note \a registry is used to create the remote apis used for announcing.
+	extensions::SharedNewTransactionsSink CreateTransactionAnnouncingSink(
+			net::PacketWriters& packetWriters,
+			const model::TransactionRegistry& registry,
+			const TransactionAnnouncerConfiguration& config,
+			const std::shared_ptr<PeerTransactionInventories>& pInventories);
+}}
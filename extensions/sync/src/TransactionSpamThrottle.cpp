@@ -24,6 +24,9 @@
 #include "catapult/cache_core/ImportanceView.h"
 #include "catapult/cache_tx/MemoryUtCache.h"
 #include "catapult/model/Transaction.h"
+#include "catapult/utils/Hashers.h"
+#include <unordered_map>
+#include <vector>
 #include <cmath>
 
 namespace catapult { namespace sync {
@@ -37,32 +40,142 @@ namespace catapult { namespace sync {
 			return importance + Importance(attemptedImportanceBoost);
 		}
 
-		size_t GetMaxTransactions(size_t cacheSize, size_t maxCacheSize, Importance effectiveImportance, Importance totalImportance) {
-			auto slotsLeft = static_cast<double>(maxCacheSize - cacheSize);
-			auto scaleFactor = std::exp(-3.0 * static_cast<double>(cacheSize) / static_cast<double>(maxCacheSize));
-			auto importancePercentage = static_cast<double>(effectiveImportance.unwrap()) / static_cast<double>(totalImportance.unwrap());
+		// region ScaleFactorTable
 
-			// the value 100 is empirical and thus has no special meaning
-			return static_cast<size_t>(scaleFactor * importancePercentage * 100.0 * slotsLeft);
+		// lookup table for the scale factor e^(-3 * cacheSize / maxCacheSize)
+		// (since e^(a + b) == e^a * e^b, the factor is split into a coarse and a fine part so that the table stays small
+		// even for large caches)
+		// \note the product of the two parts only matches std::exp up to floating point rounding, so an allowance that is within
+		//       rounding error of an integer can differ by one from the allowance calculated with std::exp directly
+		class ScaleFactorTable {
+		private:
+			static constexpr size_t Fine_Bits = 10;
+			static constexpr size_t Fine_Mask = (1u << Fine_Bits) - 1;
+
+		public:
+			explicit ScaleFactorTable(size_t maxCacheSize)
+					: m_coarseFactors((maxCacheSize >> Fine_Bits) + 1)
+					, m_fineFactors(1u << Fine_Bits) {
+				auto exponentMultiplier = -3.0 / static_cast<double>(maxCacheSize);
+				for (auto i = 0u; i < m_coarseFactors.size(); ++i)
+					m_coarseFactors[i] = std::exp(exponentMultiplier * static_cast<double>(i << Fine_Bits));
+
+				for (auto i = 0u; i < m_fineFactors.size(); ++i)
+					m_fineFactors[i] = std::exp(exponentMultiplier * static_cast<double>(i));
+			}
+
+		public:
+			double operator()(size_t cacheSize) const {
+				return m_coarseFactors[cacheSize >> Fine_Bits] * m_fineFactors[cacheSize & Fine_Mask];
+			}
+
+		private:
+			std::vector<double> m_coarseFactors;
+			std::vector<double> m_fineFactors;
+		};
+
+		// endregion
+
+		// region SignerImportanceCache
+
+		// caches signer importances read from the unconfirmed state at a single cache height
+		// (importances supplied as not cacheable, e.g. ones that depend on account links, are always looked up)
+		class SignerImportanceCache {
+		public:
+			explicit SignerImportanceCache(size_t maxSize) : m_maxSize(maxSize)
+			{}
+
+		public:
+			template<typename TImportanceSupplier>
+			Importance get(const Key& signer, Height cacheHeight, TImportanceSupplier importanceSupplier) {
+				if (m_cacheHeight != cacheHeight) {
+					clear();
+					m_cacheHeight = cacheHeight;
+				}
+
+				auto iter = m_importances.find(signer);
+				if (m_importances.cend() != iter)
+					return iter->second;
+
+				auto isCacheable = false;
+				auto importance = importanceSupplier(isCacheable);
+				if (!isCacheable)
+					return importance;
+
+				// bound memory usage by starting over when the cache is full
+				if (m_maxSize <= m_importances.size())
+					m_importances.clear();
+
+				m_importances.emplace(signer, importance);
+				return importance;
+			}
+
+			void clear() {
+				if (!m_importances.empty())
+					m_importances.clear();
+			}
+
+		private:
+			size_t m_maxSize;
+			Height m_cacheHeight;
+			std::unordered_map<Key, Importance, utils::ArrayHasher<Key>> m_importances;
+		};
+
+		bool HasLinkIndependentImportance(const cache::ReadOnlyAccountStateCache& cache, const Key& publicKey) {
+			// a new remote account must either not exist or be an unlinked remote account, so the importances of unlinked and
+			// main accounts are always their own, whereas (unconfirmed) key link transactions change the importances of remote accounts
+			auto accountStateIter = cache.find(publicKey);
+			if (!accountStateIter.tryGet())
+				return false;
+
+			auto accountType = accountStateIter.get().AccountType;
+			return state::AccountType::Unlinked == accountType || state::AccountType::Main == accountType;
 		}
 
+		// endregion
+
 		class TransactionSpamThrottle {
 		private:
 			using TransactionSource = chain::UtUpdater::TransactionSource;
 
+			struct ThrottleState {
+			public:
+				explicit ThrottleState(size_t maxCacheSize)
+						: ScaleFactors(maxCacheSize)
+						, SignerImportances(maxCacheSize)
+				{}
+
+			public:
+				ScaleFactorTable ScaleFactors;
+				SignerImportanceCache SignerImportances;
+			};
+
 		public:
-			TransactionSpamThrottle(const SpamThrottleConfiguration& config, const predicate<const model::Transaction&>& isBonded)
+			TransactionSpamThrottle(
+					const SpamThrottleConfiguration& config,
+					const predicate<const model::Transaction&>& isBonded,
+					const std::shared_ptr<SpamThrottleCounters>& pCounters)
 					: m_config(config)
 					, m_isBonded(isBonded)
+					, m_pCounters(pCounters)
+					, m_pState(std::make_shared<ThrottleState>(m_config.MaxCacheSize))
 			{}
 
 		public:
 			bool operator()(const model::TransactionInfo& transactionInfo, const chain::UtUpdater::ThrottleContext& context) const {
 				auto cacheSize = context.TransactionsCache.size();
 
+				// cached importances are only valid for the chain they were read from:
+				// - reverted and existing transactions are only applied when rebasing after a chain change (possibly at the same height)
+				// - a rebase without transactions to apply leaves the ut cache empty, so importances are dropped while it is uncongested
+				if (TransactionSource::New != context.TransactionSource || m_config.MaxBlockSize > cacheSize)
+					m_pState->SignerImportances.clear();
+
 				// always reject if cache is completely full
-				if (cacheSize >= m_config.MaxCacheSize)
+				if (cacheSize >= m_config.MaxCacheSize) {
+					++m_pCounters->NumCacheFullRejections;
 					return true;
+				}
 
 				// do not apply throttle unless cache contains more transactions than can fit in a single block
 				if (m_config.MaxBlockSize > cacheSize)
@@ -73,23 +186,50 @@ namespace catapult { namespace sync {
 					return false;
 
 				const auto& signer = transactionInfo.pEntity->SignerPublicKey;
-				auto readOnlyAccountStateCache = context.UnconfirmedCatapultCache.sub<cache::AccountStateCache>();
-				cache::ImportanceView importanceView(readOnlyAccountStateCache);
-				auto importance = importanceView.getAccountImportanceOrDefault(signer, context.CacheHeight);
+				auto importance = getImportance(signer, context);
 				auto effectiveImportance = GetEffectiveImportance(transactionInfo.pEntity->MaxFee, importance, m_config);
-				auto maxTransactions = GetMaxTransactions(cacheSize, m_config.MaxCacheSize, effectiveImportance, m_config.TotalImportance);
-				return context.TransactionsCache.count(signer) >= maxTransactions;
+				auto maxTransactions = getMaxTransactions(cacheSize, effectiveImportance);
+				if (context.TransactionsCache.count(signer) < maxTransactions)
+					return false;
+
+				++m_pCounters->NumThrottledRejections;
+				return true;
+			}
+
+		private:
+			Importance getImportance(const Key& signer, const chain::UtUpdater::ThrottleContext& context) const {
+				auto readOnlyAccountStateCache = context.UnconfirmedCatapultCache.sub<cache::AccountStateCache>();
+				auto importanceSupplier = [&signer, &context, &readOnlyAccountStateCache](auto& isCacheable) {
+					isCacheable = HasLinkIndependentImportance(readOnlyAccountStateCache, signer);
+
+					cache::ImportanceView importanceView(readOnlyAccountStateCache);
+					return importanceView.getAccountImportanceOrDefault(signer, context.CacheHeight);
+				};
+				return m_pState->SignerImportances.get(signer, context.CacheHeight, importanceSupplier);
+			}
+
+			size_t getMaxTransactions(size_t cacheSize, Importance effectiveImportance) const {
+				auto slotsLeft = static_cast<double>(m_config.MaxCacheSize - cacheSize);
+				auto scaleFactor = m_pState->ScaleFactors(cacheSize);
+				auto importancePercentage =
+						static_cast<double>(effectiveImportance.unwrap()) / static_cast<double>(m_config.TotalImportance.unwrap());
+
+				// the value 100 is empirical and thus has no special meaning
+				return static_cast<size_t>(scaleFactor * importancePercentage * 100.0 * slotsLeft);
 			}
 
 		private:
 			SpamThrottleConfiguration m_config;
 			predicate<const model::Transaction&> m_isBonded;
+			std::shared_ptr<SpamThrottleCounters> m_pCounters;
+			std::shared_ptr<ThrottleState> m_pState;
 		};
 	}
 
 	chain::UtUpdater::Throttle CreateTransactionSpamThrottle(
 			const SpamThrottleConfiguration& config,
-			const predicate<const model::Transaction&>& isBonded) {
-		return TransactionSpamThrottle(config, isBonded);
+			const predicate<const model::Transaction&>& isBonded,
+			const std::shared_ptr<SpamThrottleCounters>& pCounters) {
+		return TransactionSpamThrottle(config, isBonded, pCounters);
 	}
 }}
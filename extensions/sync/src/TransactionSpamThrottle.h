@@ -20,6 +20,7 @@
 
 #pragma once
 #include "catapult/chain/UtUpdater.h"
+#include <atomic>
 
 namespace catapult { namespace sync {
 
@@ -55,9 +56,29 @@ namespace catapult { namespace sync {
 		uint32_t MaxBlockSize;
 	};
 
+	/// Spam throttle counters.
+	struct SpamThrottleCounters {
+	public:
+		/// Creates zero-initialized counters.
+		SpamThrottleCounters()
+				: NumCacheFullRejections(0)
+				, NumThrottledRejections(0)
+		{}
+
+	public:
+		/// Number of transactions rejected because the transactions cache is full.
+		std::atomic<uint64_t> NumCacheFullRejections;
+
+		/// Number of transactions rejected because their signers exceeded their allowances.
+		std::atomic<uint64_t> NumThrottledRejections;
+	};
+
 	/// Creates a throttle using \a config to filter out transactions that are considered to be spam.
 	/// \a isBonded indicates whether a transaction is bonded or not.
+	/// Rejections are tracked in \a pCounters.
+	/// \note Signer importances are cached per importance height, so the throttle must not be invoked concurrently.
 	chain::UtUpdater::Throttle CreateTransactionSpamThrottle(
 			const SpamThrottleConfiguration& config,
-			const predicate<const model::Transaction&>& isBonded);
+			const predicate<const model::Transaction&>& isBonded,
+			const std::shared_ptr<SpamThrottleCounters>& pCounters);
 }}
@@ -0,0 +1,293 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "sync/src/AdaptiveSyncController.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace sync {
+
+#define TEST_CLASS AdaptiveSyncControllerTests
+
+	namespace {
+		constexpr auto Configured_Delay = utils::TimeSpan::FromMilliseconds(3000);
+
+		AdaptiveSyncSettings CreateSettings() {
+			AdaptiveSyncSettings settings;
+			settings.MaxBlocksPerSyncAttempt = 10;
+			settings.MaxBatchMultiplier = 8;
+			settings.MinDelay = utils::TimeSpan::FromMilliseconds(100);
+			settings.MaxPendingElements = 4;
+			return settings;
+		}
+
+		class TestContext {
+		public:
+			TestContext()
+					: LocalHeight(1000)
+					, NetworkHeight(0)
+					, NumPendingElements(0)
+					, Time(10'000)
+					, m_controller(CreateSettings(), createInputs())
+			{}
+
+		public:
+			AdaptiveSyncController& controller() {
+				return m_controller;
+			}
+
+		public:
+			void setGap(uint64_t gap) {
+				NetworkHeight = LocalHeight + Height(gap);
+			}
+
+			void advance(uint64_t numBlocks, uint64_t numMillis) {
+				LocalHeight = LocalHeight + Height(numBlocks);
+				NetworkHeight = NetworkHeight + Height(numBlocks);
+				Time = Time + Timestamp(numMillis);
+			}
+
+		private:
+			AdaptiveSyncInputs createInputs() {
+				AdaptiveSyncInputs inputs;
+				inputs.LocalChainHeightSupplier = [this]() { return LocalHeight; };
+				inputs.NetworkChainHeightSupplier = [this]() { return NetworkHeight; };
+				inputs.NumPendingElementsSupplier = [this]() { return NumPendingElements; };
+				inputs.TimeSupplier = [this]() { return Time; };
+				return inputs;
+			}
+
+		public:
+			Height LocalHeight;
+			Height NetworkHeight;
+			size_t NumPendingElements;
+			Timestamp Time;
+
+		private:
+			AdaptiveSyncController m_controller;
+		};
+
+		uint32_t GetTargetBlocks(uint64_t gap, size_t numPendingElements) {
+			// Arrange:
+			TestContext context;
+			context.setGap(gap);
+			context.NumPendingElements = numPendingElements;
+
+			// Act:
+			return context.controller().targetBlocksPerSyncAttempt();
+		}
+
+		utils::TimeSpan GetAdjustedDelay(uint64_t gap, size_t numPendingElements, const utils::TimeSpan& delay = Configured_Delay) {
+			// Arrange:
+			TestContext context;
+			context.setGap(gap);
+			context.NumPendingElements = numPendingElements;
+
+			// Act:
+			return context.controller().adjustDelay(delay);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateController) {
+		// Act:
+		TestContext context;
+
+		// Assert:
+		EXPECT_EQ(0.0, context.controller().commitThroughput());
+	}
+
+	// endregion
+
+	// region targetBlocksPerSyncAttempt
+
+	TEST(TEST_CLASS, TargetBlocksIsZeroWhenNetworkChainHeightIsUnknown) {
+		// Arrange:
+		TestContext context;
+
+		// Act + Assert:
+		EXPECT_EQ(0u, context.controller().targetBlocksPerSyncAttempt());
+	}
+
+	TEST(TEST_CLASS, TargetBlocksIsZeroWhenLocalChainIsCloseToNetworkChain) {
+		for (auto gap : std::initializer_list<uint64_t>{ 0, 1, 5, 10 })
+			EXPECT_EQ(0u, GetTargetBlocks(gap, 0)) << "gap " << gap;
+	}
+
+	TEST(TEST_CLASS, TargetBlocksIsMaxBatchWhenFarBehindAndDisruptorIsEmpty) {
+		EXPECT_EQ(80u, GetTargetBlocks(81, 0));
+		EXPECT_EQ(80u, GetTargetBlocks(1000, 0));
+	}
+
+	TEST(TEST_CLASS, TargetBlocksIsLimitedByGap) {
+		EXPECT_EQ(11u, GetTargetBlocks(11, 0));
+		EXPECT_EQ(50u, GetTargetBlocks(50, 0));
+	}
+
+	TEST(TEST_CLASS, TargetBlocksShrinksAsDisruptorFillsUp) {
+		EXPECT_EQ(60u, GetTargetBlocks(1000, 1));
+		EXPECT_EQ(40u, GetTargetBlocks(1000, 2));
+		EXPECT_EQ(20u, GetTargetBlocks(1000, 3));
+	}
+
+	TEST(TEST_CLASS, TargetBlocksIsMaxBlocksPerSyncAttemptWhenDisruptorIsFull) {
+		EXPECT_EQ(10u, GetTargetBlocks(1000, 4));
+		EXPECT_EQ(10u, GetTargetBlocks(1000, 100));
+	}
+
+	namespace {
+		uint32_t GetTargetBlocksWithThroughput(uint64_t numBlocksPerSecond) {
+			// Arrange: measure throughput
+			TestContext context;
+			context.setGap(1000);
+			context.controller().adjustDelay(Configured_Delay);
+			context.advance(numBlocksPerSecond, 1000);
+			context.controller().adjustDelay(Configured_Delay);
+
+			// Sanity:
+			EXPECT_EQ(static_cast<double>(numBlocksPerSecond), context.controller().commitThroughput());
+
+			// Act:
+			return context.controller().targetBlocksPerSyncAttempt();
+		}
+	}
+
+	TEST(TEST_CLASS, TargetBlocksIsLimitedByBlocksCommittableWithinConfiguredDelay) {
+		EXPECT_EQ(10u, GetTargetBlocksWithThroughput(1));
+		EXPECT_EQ(15u, GetTargetBlocksWithThroughput(5));
+		EXPECT_EQ(60u, GetTargetBlocksWithThroughput(20));
+		EXPECT_EQ(80u, GetTargetBlocksWithThroughput(100));
+	}
+
+	// endregion
+
+	// region adjustDelay
+
+	TEST(TEST_CLASS, AdjustDelayReturnsConfiguredDelayWhenLocalChainIsCloseToNetworkChain) {
+		for (auto gap : std::initializer_list<uint64_t>{ 0, 1, 5, 10 }) {
+			EXPECT_EQ(Configured_Delay, GetAdjustedDelay(gap, 0)) << "gap " << gap;
+			EXPECT_EQ(Configured_Delay, GetAdjustedDelay(gap, 4)) << "gap " << gap;
+		}
+	}
+
+	TEST(TEST_CLASS, AdjustDelayReturnsMinDelayWhenFarBehindAndDisruptorIsEmpty) {
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(100), GetAdjustedDelay(11, 0));
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(100), GetAdjustedDelay(1000, 0));
+	}
+
+	TEST(TEST_CLASS, AdjustDelayIncreasesAsDisruptorFillsUp) {
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(825), GetAdjustedDelay(1000, 1));
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(1550), GetAdjustedDelay(1000, 2));
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(2275), GetAdjustedDelay(1000, 3));
+	}
+
+	TEST(TEST_CLASS, AdjustDelayReturnsConfiguredDelayWhenFarBehindAndDisruptorIsFull) {
+		EXPECT_EQ(Configured_Delay, GetAdjustedDelay(1000, 4));
+		EXPECT_EQ(Configured_Delay, GetAdjustedDelay(1000, 100));
+	}
+
+	TEST(TEST_CLASS, AdjustDelayNeverIncreasesConfiguredDelayLessThanMinDelay) {
+		auto delay = utils::TimeSpan::FromMilliseconds(50);
+		EXPECT_EQ(delay, GetAdjustedDelay(1000, 0, delay));
+		EXPECT_EQ(delay, GetAdjustedDelay(1000, 4, delay));
+	}
+
+	// endregion
+
+	// region commit throughput
+
+	TEST(TEST_CLASS, AdjustDelayMeasuresCommitThroughputWhenFarBehind) {
+		// Arrange:
+		TestContext context;
+		context.setGap(1000);
+
+		// Act + Assert: first sample does not produce a measurement
+		context.controller().adjustDelay(Configured_Delay);
+		EXPECT_EQ(0.0, context.controller().commitThroughput());
+
+		// - 100 blocks in 2s
+		context.advance(100, 2000);
+		context.controller().adjustDelay(Configured_Delay);
+		EXPECT_EQ(50.0, context.controller().commitThroughput());
+
+		// - 20 blocks in 1s (smoothed)
+		context.advance(20, 1000);
+		context.controller().adjustDelay(Configured_Delay);
+		EXPECT_EQ(35.0, context.controller().commitThroughput());
+	}
+
+	TEST(TEST_CLASS, AdjustDelayDoesNotMeasureCommitThroughputWhenLocalChainIsCloseToNetworkChain) {
+		// Arrange:
+		TestContext context;
+		context.setGap(5);
+
+		// Act:
+		context.controller().adjustDelay(Configured_Delay);
+		context.advance(100, 2000);
+		context.controller().adjustDelay(Configured_Delay);
+
+		// Assert:
+		EXPECT_EQ(0.0, context.controller().commitThroughput());
+	}
+
+	TEST(TEST_CLASS, AdjustDelayRestartsCommitThroughputMeasurementWhenCatchingUpAgain) {
+		// Arrange: measure 50 blocks per second
+		TestContext context;
+		context.setGap(1000);
+		context.controller().adjustDelay(Configured_Delay);
+		context.advance(100, 2000);
+		context.controller().adjustDelay(Configured_Delay);
+
+		// - catch up and fall behind again after a long time
+		context.setGap(5);
+		context.controller().adjustDelay(Configured_Delay);
+		context.advance(10, 100'000);
+		context.setGap(1000);
+
+		// Act: first sample after catching up again does not produce a measurement
+		context.controller().adjustDelay(Configured_Delay);
+		auto throughput1 = context.controller().commitThroughput();
+
+		context.advance(30, 1000);
+		context.controller().adjustDelay(Configured_Delay);
+		auto throughput2 = context.controller().commitThroughput();
+
+		// Assert:
+		EXPECT_EQ(50.0, throughput1);
+		EXPECT_EQ(40.0, throughput2);
+	}
+
+	TEST(TEST_CLASS, AdjustDelayIgnoresSamplesWhenLocalChainHeightDecreases) {
+		// Arrange:
+		TestContext context;
+		context.setGap(1000);
+		context.controller().adjustDelay(Configured_Delay);
+
+		// Act: simulate a rollback
+		context.LocalHeight = context.LocalHeight - Height(10);
+		context.Time = context.Time + Timestamp(1000);
+		context.controller().adjustDelay(Configured_Delay);
+
+		// Assert:
+		EXPECT_EQ(0.0, context.controller().commitThroughput());
+	}
+
+	// endregion
+}}
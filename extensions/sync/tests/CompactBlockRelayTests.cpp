@@ -0,0 +1,280 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "sync/src/CompactBlockRelay.h"
+#include "catapult/api/ChainPackets.h"
+#include "catapult/model/Elements.h"
+#include "catapult/model/EntityHasher.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/PacketPayloadTestUtils.h"
+#include "tests/test/core/mocks/MockPacketIo.h"
+#include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/test/net/mocks/MockPacketWriters.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace sync {
+
+#define TEST_CLASS CompactBlockRelayTests
+
+	namespace {
+		constexpr auto Default_Timeout = utils::TimeSpan::FromSeconds(7);
+
+		// region RelayMockPacketWriters
+
+		class RelayMockPacketWriters : public mocks::BroadcastAwareMockPacketWriters {
+		public:
+			RelayMockPacketWriters(size_t numPeers, size_t numAvailablePeers)
+					: m_numAvailablePeers(numAvailablePeers)
+					, m_nextIndex(0) {
+				for (auto i = 0u; i < numPeers; ++i) {
+					connectSync(ionet::Node({ test::GenerateRandomByteArray<Key>(), "peer " + std::to_string(i) }));
+					m_packetIos.push_back(std::make_shared<mocks::MockPacketIo>());
+				}
+			}
+
+		public:
+			mocks::MockPacketIo& packetIo(size_t index) {
+				return *m_packetIos[index];
+			}
+
+			const std::vector<utils::TimeSpan>& pickOneDurations() const {
+				return m_ioDurations;
+			}
+
+		public:
+			ionet::NodePacketIoPair pickOne(const utils::TimeSpan& ioDuration) override {
+				m_ioDurations.push_back(ioDuration);
+				if (m_nextIndex >= m_numAvailablePeers)
+					return ionet::NodePacketIoPair();
+
+				auto index = m_nextIndex++;
+				return ionet::NodePacketIoPair(connectedNodes()[index], m_packetIos[index]);
+			}
+
+		private:
+			size_t m_numAvailablePeers;
+			size_t m_nextIndex;
+			std::vector<std::shared_ptr<mocks::MockPacketIo>> m_packetIos;
+			std::vector<utils::TimeSpan> m_ioDurations;
+		};
+
+		// endregion
+
+		// region test context
+
+		class TestContext {
+		public:
+			TestContext(size_t numPeers, size_t numTransactions) : TestContext(numPeers, numPeers, numTransactions)
+			{}
+
+			TestContext(size_t numPeers, size_t numAvailablePeers, size_t numTransactions)
+					: Writers(numPeers, numAvailablePeers)
+					, NumTransactions(static_cast<uint32_t>(numTransactions))
+					, pBlock(test::GenerateBlockWithTransactions(numTransactions, Height(123)))
+					, m_registry(mocks::CreateDefaultTransactionRegistry())
+					, m_generationHash(test::GenerateRandomByteArray<GenerationHash>())
+					, m_sink(CreateCompactBlockRelaySink(Writers, m_registry, m_generationHash, Default_Timeout))
+			{}
+
+		public:
+			void relay() {
+				m_sink(pBlock);
+			}
+
+			std::vector<utils::ShortHash> expectedShortHashes() const {
+				std::vector<utils::ShortHash> shortHashes;
+				for (const auto& transaction : pBlock->Transactions()) {
+					model::TransactionElement transactionElement(transaction);
+					model::UpdateHashes(m_registry, m_generationHash, transactionElement);
+					shortHashes.push_back(utils::ToShortHash(transactionElement.EntityHash));
+				}
+
+				return shortHashes;
+			}
+
+		public:
+			RelayMockPacketWriters Writers;
+			uint32_t NumTransactions;
+			std::shared_ptr<const model::Block> pBlock;
+
+		private:
+			model::TransactionRegistry m_registry;
+			GenerationHash m_generationHash;
+			extensions::NewBlockSink m_sink;
+		};
+
+		void QueueCompactBlockResponse(mocks::MockPacketIo& packetIo, const std::vector<uint32_t>& missingIndexes) {
+			packetIo.queueWrite(ionet::SocketOperationCode::Success);
+			packetIo.queueRead(ionet::SocketOperationCode::Success, [missingIndexes](const auto*) {
+				auto dataSize = static_cast<uint32_t>(missingIndexes.size() * sizeof(uint32_t));
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(dataSize);
+				pResponsePacket->Type = ionet::PacketType::Compact_Block;
+				std::memcpy(pResponsePacket->Data(), missingIndexes.data(), dataSize);
+				return pResponsePacket;
+			});
+		}
+
+		void AssertCompactBlockRequest(
+				TestContext& context,
+				size_t peerIndex,
+				size_t writeIndex,
+				const std::vector<uint32_t>& expectedPrefilledIndexes) {
+			const auto& packet = context.Writers.packetIo(peerIndex).writtenPacketAt<ionet::Packet>(writeIndex);
+			ASSERT_EQ(ionet::PacketType::Compact_Block, packet.Type);
+
+			const auto& request = static_cast<const api::CompactBlockRequest&>(packet);
+			auto numTransactions = context.NumTransactions;
+			EXPECT_EQ(numTransactions, request.TransactionsCount);
+			EXPECT_EQ(expectedPrefilledIndexes.size(), request.PrefilledTransactionsCount);
+
+			const auto* pData = reinterpret_cast<const uint8_t*>(&request + 1);
+			EXPECT_EQ_MEMORY(context.pBlock.get(), pData, sizeof(model::BlockHeader));
+			pData += sizeof(model::BlockHeader);
+
+			const auto* pShortHashes = reinterpret_cast<const utils::ShortHash*>(pData);
+			EXPECT_EQ(context.expectedShortHashes(), std::vector<utils::ShortHash>(pShortHashes, pShortHashes + numTransactions));
+			pData += numTransactions * sizeof(utils::ShortHash);
+
+			const auto* pPrefilledIndexes = reinterpret_cast<const uint32_t*>(pData);
+			auto numPrefilledIndexes = expectedPrefilledIndexes.size();
+			EXPECT_EQ(expectedPrefilledIndexes, std::vector<uint32_t>(pPrefilledIndexes, pPrefilledIndexes + numPrefilledIndexes));
+		}
+
+		// endregion
+	}
+
+	// region basic
+
+	TEST(TEST_CLASS, BlockWithoutTransactionsIsBroadcast) {
+		// Arrange:
+		TestContext context(3, 0);
+
+		// Act:
+		context.relay();
+
+		// Assert:
+		EXPECT_TRUE(context.Writers.pickOneDurations().empty());
+		ASSERT_EQ(1u, context.Writers.numBroadcastCalls());
+		test::AssertPacketHeader(
+				context.Writers.broadcastedPayloads()[0],
+				sizeof(ionet::PacketHeader) + context.pBlock->Size,
+				ionet::PacketType::Push_Block);
+	}
+
+	TEST(TEST_CLASS, CompactBlockIsRelayedToAllActiveWriters) {
+		// Arrange:
+		TestContext context(3, 5);
+		for (auto i = 0u; i < 3; ++i)
+			QueueCompactBlockResponse(context.Writers.packetIo(i), {});
+
+		// Act:
+		context.relay();
+
+		// Assert:
+		EXPECT_EQ(std::vector<utils::TimeSpan>(3, Default_Timeout), context.Writers.pickOneDurations());
+		EXPECT_EQ(0u, context.Writers.numBroadcastCalls());
+		for (auto i = 0u; i < 3; ++i) {
+			EXPECT_EQ(1u, context.Writers.packetIo(i).numReads()) << i;
+			ASSERT_EQ(1u, context.Writers.packetIo(i).numWrites()) << i;
+			AssertCompactBlockRequest(context, i, 0, {});
+		}
+	}
+
+	TEST(TEST_CLASS, FullBlockIsBroadcastWhenNotAllActiveWritersAreAvailable) {
+		// Arrange: only two of three writers can be picked
+		TestContext context(3, 2, 5);
+
+		// Act:
+		context.relay();
+
+		// Assert: no compact blocks are relayed to the picked writers
+		EXPECT_EQ(std::vector<utils::TimeSpan>(3, Default_Timeout), context.Writers.pickOneDurations());
+		for (auto i = 0u; i < 3; ++i)
+			EXPECT_EQ(0u, context.Writers.packetIo(i).numWrites()) << i;
+
+		ASSERT_EQ(1u, context.Writers.numBroadcastCalls());
+		test::AssertPacketHeader(
+				context.Writers.broadcastedPayloads()[0],
+				sizeof(ionet::PacketHeader) + context.pBlock->Size,
+				ionet::PacketType::Push_Block);
+	}
+
+	// endregion
+
+	// region missing transactions
+
+	TEST(TEST_CLASS, MissingTransactionsArePrefilledInSecondCompactBlock) {
+		// Arrange:
+		TestContext context(1, 5);
+		QueueCompactBlockResponse(context.Writers.packetIo(0), { 1, 3 });
+		QueueCompactBlockResponse(context.Writers.packetIo(0), {});
+
+		// Act:
+		context.relay();
+
+		// Assert:
+		const auto& packetIo = context.Writers.packetIo(0);
+		EXPECT_EQ(2u, packetIo.numReads());
+		ASSERT_EQ(2u, packetIo.numWrites());
+		AssertCompactBlockRequest(context, 0, 0, {});
+		AssertCompactBlockRequest(context, 0, 1, { 1, 3 });
+	}
+
+	TEST(TEST_CLASS, FullBlockIsPushedWhenPrefilledCompactBlockCannotBeReconstructed) {
+		// Arrange:
+		TestContext context(1, 5);
+		auto& packetIo = context.Writers.packetIo(0);
+		QueueCompactBlockResponse(packetIo, { 1, 3 });
+		QueueCompactBlockResponse(packetIo, { 2 });
+		packetIo.queueWrite(ionet::SocketOperationCode::Success);
+
+		// Act:
+		context.relay();
+
+		// Assert:
+		EXPECT_EQ(2u, packetIo.numReads());
+		ASSERT_EQ(3u, packetIo.numWrites());
+		AssertCompactBlockRequest(context, 0, 0, {});
+		AssertCompactBlockRequest(context, 0, 1, { 1, 3 });
+
+		const auto& packet = packetIo.writtenPacketAt<ionet::Packet>(2);
+		EXPECT_EQ(ionet::PacketType::Push_Block, packet.Type);
+		ASSERT_EQ(sizeof(ionet::PacketHeader) + context.pBlock->Size, packet.Size);
+		EXPECT_EQ_MEMORY(context.pBlock.get(), packet.Data(), context.pBlock->Size);
+	}
+
+	TEST(TEST_CLASS, NothingIsPushedWhenCompactBlockRelayFails) {
+		// Arrange:
+		TestContext context(1, 5);
+		auto& packetIo = context.Writers.packetIo(0);
+		packetIo.queueWrite(ionet::SocketOperationCode::Success);
+		packetIo.queueRead(ionet::SocketOperationCode::Read_Error);
+
+		// Act:
+		context.relay();
+
+		// Assert:
+		EXPECT_EQ(1u, packetIo.numReads());
+		ASSERT_EQ(1u, packetIo.numWrites());
+		AssertCompactBlockRequest(context, 0, 0, {});
+	}
+
+	// endregion
+}}
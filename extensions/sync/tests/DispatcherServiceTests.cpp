@@ -46,8 +46,8 @@ namespace catapult { namespace sync {
 #define TEST_CLASS DispatcherServiceTests
 
 	namespace {
-		constexpr auto Num_Expected_Services = 5u;
-		constexpr auto Num_Expected_Counters = 8u;
+		constexpr auto Num_Expected_Services = 6u;
+		constexpr auto Num_Expected_Counters = 10u;
 		constexpr auto Num_Expected_Tasks = 1u;
 
 		constexpr auto Block_Elements_Counter_Name = "BLK ELEM TOT";
@@ -58,6 +58,8 @@ namespace catapult { namespace sync {
 		constexpr auto Rollback_Elements_Committed_Recent = "RB COMMIT RCT";
 		constexpr auto Rollback_Elements_Ignored_All = "RB IGNORE ALL";
 		constexpr auto Rollback_Elements_Ignored_Recent = "RB IGNORE RCT";
+		constexpr auto Ut_Cache_Full_Rejections = "UT FULL REJ";
+		constexpr auto Ut_Throttled_Rejections = "UT THROT REJ";
 		constexpr auto Sentinel_Counter_Value = extensions::ServiceLocator::Sentinel_Counter_Value;
 
 		// region utils
@@ -332,6 +334,7 @@ namespace catapult { namespace sync {
 		EXPECT_TRUE(!!context.locator().service<disruptor::ConsumerDispatcher>("dispatcher.transaction"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.transaction.batch"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.utUpdater"));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.utThrottle"));
 		EXPECT_TRUE(!!context.locator().service<void>("rollbacks"));
 
 		// - all counters should be zero
@@ -343,6 +346,8 @@ namespace catapult { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		EXPECT_EQ(0u, context.counter(Ut_Cache_Full_Rejections));
+		EXPECT_EQ(0u, context.counter(Ut_Throttled_Rejections));
 
 		// - block dispatcher should be initialized
 		auto blockDispatcherStatus = GetBlockDispatcherStatus(context.locator());
@@ -414,6 +419,7 @@ namespace catapult { namespace sync {
 		EXPECT_FALSE(!!context.locator().service<disruptor::ConsumerDispatcher>("dispatcher.transaction"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.transaction.batch"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.utUpdater"));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.utThrottle"));
 		EXPECT_TRUE(!!context.locator().service<void>("rollbacks"));
 
 		// - all counters should indicate shutdown
@@ -425,6 +431,8 @@ namespace catapult { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		EXPECT_EQ(0u, context.counter(Ut_Cache_Full_Rejections));
+		EXPECT_EQ(0u, context.counter(Ut_Throttled_Rejections));
 	}
 
 	// endregion
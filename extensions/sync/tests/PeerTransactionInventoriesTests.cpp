@@ -0,0 +1,158 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "sync/src/PeerTransactionInventories.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace sync {
+
+#define TEST_CLASS PeerTransactionInventoriesTests
+
+	namespace {
+		constexpr auto Equality_Strategy = model::NodeIdentityEqualityStrategy::Key;
+
+		model::NodeIdentity CreateRandomIdentity() {
+			return { test::GenerateRandomByteArray<Key>(), "11.22.33.44" };
+		}
+
+		std::vector<Hash256> AddRandomHashes(PeerTransactionInventories& inventories, const model::NodeIdentity& identity, size_t count) {
+			std::vector<Hash256> hashes;
+			for (auto i = 0u; i < count; ++i) {
+				hashes.push_back(test::GenerateRandomByteArray<Hash256>());
+				inventories.add(identity, hashes.back());
+			}
+
+			return hashes;
+		}
+	}
+
+	TEST(TEST_CLASS, InventoriesAreInitiallyEmpty) {
+		// Act:
+		PeerTransactionInventories inventories(10, Equality_Strategy);
+
+		// Assert:
+		EXPECT_EQ(0u, inventories.size());
+		EXPECT_EQ(0u, inventories.size(CreateRandomIdentity()));
+		EXPECT_FALSE(inventories.contains(CreateRandomIdentity(), test::GenerateRandomByteArray<Hash256>()));
+	}
+
+	TEST(TEST_CLASS, CanAddHashesToInventory) {
+		// Arrange:
+		PeerTransactionInventories inventories(10, Equality_Strategy);
+		auto identity = CreateRandomIdentity();
+
+		// Act:
+		auto hashes = AddRandomHashes(inventories, identity, 3);
+
+		// Assert:
+		EXPECT_EQ(1u, inventories.size());
+		EXPECT_EQ(3u, inventories.size(identity));
+		for (const auto& hash : hashes)
+			EXPECT_TRUE(inventories.contains(identity, hash)) << hash;
+
+		EXPECT_FALSE(inventories.contains(identity, test::GenerateRandomByteArray<Hash256>()));
+	}
+
+	TEST(TEST_CLASS, AddingKnownHashHasNoEffect) {
+		// Arrange:
+		PeerTransactionInventories inventories(10, Equality_Strategy);
+		auto identity = CreateRandomIdentity();
+		auto hashes = AddRandomHashes(inventories, identity, 3);
+
+		// Act:
+		inventories.add(identity, hashes[1]);
+
+		// Assert:
+		EXPECT_EQ(3u, inventories.size(identity));
+	}
+
+	TEST(TEST_CLASS, InventoriesAreIsolatedPerPeer) {
+		// Arrange:
+		PeerTransactionInventories inventories(10, Equality_Strategy);
+		auto identity1 = CreateRandomIdentity();
+		auto identity2 = CreateRandomIdentity();
+
+		// Act:
+		auto hashes1 = AddRandomHashes(inventories, identity1, 3);
+		auto hashes2 = AddRandomHashes(inventories, identity2, 2);
+
+		// Assert:
+		EXPECT_EQ(2u, inventories.size());
+		EXPECT_EQ(3u, inventories.size(identity1));
+		EXPECT_EQ(2u, inventories.size(identity2));
+
+		EXPECT_TRUE(inventories.contains(identity1, hashes1[0]));
+		EXPECT_FALSE(inventories.contains(identity2, hashes1[0]));
+		EXPECT_FALSE(inventories.contains(identity1, hashes2[0]));
+		EXPECT_TRUE(inventories.contains(identity2, hashes2[0]));
+	}
+
+	TEST(TEST_CLASS, OldestHashesAreEvictedWhenInventoryIsFull) {
+		// Arrange:
+		PeerTransactionInventories inventories(5, Equality_Strategy);
+		auto identity = CreateRandomIdentity();
+
+		// Act:
+		auto hashes = AddRandomHashes(inventories, identity, 7);
+
+		// Assert:
+		EXPECT_EQ(5u, inventories.size(identity));
+		for (auto i = 0u; i < hashes.size(); ++i)
+			EXPECT_EQ(i >= 2, inventories.contains(identity, hashes[i])) << i;
+	}
+
+	TEST(TEST_CLASS, NoHashesAreAddedWhenMaxHashesPerPeerIsZero) {
+		// Arrange:
+		PeerTransactionInventories inventories(0, Equality_Strategy);
+		auto identity = CreateRandomIdentity();
+
+		// Act:
+		AddRandomHashes(inventories, identity, 3);
+
+		// Assert:
+		EXPECT_EQ(0u, inventories.size());
+		EXPECT_EQ(0u, inventories.size(identity));
+	}
+
+	TEST(TEST_CLASS, RetainRemovesInventoriesOfPeersNotInIdentities) {
+		// Arrange:
+		PeerTransactionInventories inventories(10, Equality_Strategy);
+		std::vector<model::NodeIdentity> identities;
+		for (auto i = 0u; i < 4; ++i) {
+			identities.push_back(CreateRandomIdentity());
+			AddRandomHashes(inventories, identities.back(), i + 1);
+		}
+
+		// Act:
+		auto retainedIdentities = model::CreateNodeIdentitySet(Equality_Strategy);
+		retainedIdentities.insert(identities[1]);
+		retainedIdentities.insert(identities[3]);
+		retainedIdentities.insert(CreateRandomIdentity());
+		inventories.retain(retainedIdentities);
+
+		// Assert:
+		EXPECT_EQ(2u, inventories.size());
+		EXPECT_EQ(0u, inventories.size(identities[0]));
+		EXPECT_EQ(2u, inventories.size(identities[1]));
+		EXPECT_EQ(0u, inventories.size(identities[2]));
+		EXPECT_EQ(4u, inventories.size(identities[3]));
+	}
+}}
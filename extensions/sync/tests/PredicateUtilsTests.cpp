@@ -19,6 +19,7 @@
 **/
 
 #include "sync/src/PredicateUtils.h"
+#include "sync/src/TransactionSpamThrottle.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "catapult/cache_tx/MemoryUtCache.h"
@@ -142,14 +143,20 @@ namespace catapult { namespace sync {
 			// Sanity:
 			EXPECT_EQ(cacheSize, utCacheModifier.size());
 
+			auto pCounters = std::make_shared<SpamThrottleCounters>();
+
 			// Act:
-			auto isThrottled = CreateUtUpdaterThrottle(config)(model::TransactionInfo(pTransaction), throttleContext);
+			auto isThrottled = CreateUtUpdaterThrottle(config, pCounters)(model::TransactionInfo(pTransaction), throttleContext);
 
 			// Assert:
-			EXPECT_EQ(expectedIsThrottled, isThrottled)
-					<< "cacheSize = " << cacheSize
-					<< ", maxCacheSize = " << settings.MaxCacheSize
-					<< ", maxBlockSize = " << settings.MaxBlockSize;
+			auto message = "cacheSize = " + std::to_string(cacheSize)
+					+ ", maxCacheSize = " + std::to_string(settings.MaxCacheSize)
+					+ ", maxBlockSize = " + std::to_string(settings.MaxBlockSize);
+			EXPECT_EQ(expectedIsThrottled, isThrottled) << message;
+
+			auto isCacheFull = cacheSize >= settings.MaxCacheSize;
+			EXPECT_EQ(expectedIsThrottled && isCacheFull ? 1u : 0u, pCounters->NumCacheFullRejections.load()) << message;
+			EXPECT_EQ(expectedIsThrottled && !isCacheFull ? 1u : 0u, pCounters->NumThrottledRejections.load()) << message;
 		}
 
 		constexpr ThrottleTestSettings No_Spam_Test_Settings = { false, 100, 50 };
@@ -242,5 +242,45 @@ namespace catapult { namespace sync {
 		});
 	}
 
+	TEST(TEST_CLASS, SchedulerRespectsTaskDelayAdjuster) {
+		// Assert: non-deterministic because delay is impacted by scheduling
+		test::RunNonDeterministicTest("SchedulerService", [](auto i) {
+			// Arrange:
+			std::atomic<uint32_t> counter(0);
+			std::vector<utils::TimeSpan> adjustedDelays;
+			TestContext context;
+
+			// - add a single task that shortens the configured repeat delay from 8 to 2
+			auto timeUnit = test::GetTimeUnitForIteration(i);
+			auto task = CreateContinuousTaskWithCounter("gamma", counter);
+			task.AdjustDelay = [&adjustedDelays](const auto& delay) {
+				adjustedDelays.push_back(delay);
+				return utils::TimeSpan::FromMilliseconds(delay.millis() / 4);
+			};
+			context.testState().state().tasks().push_back(task);
+
+			auto config = TasksConfiguration::Uninitialized();
+			config.Tasks.emplace("gamma", CreateUniformTaskConfiguration(timeUnit, 8 * timeUnit));
+
+			// Act:
+			context.boot(config);
+
+			// Assert: after sleeping 6x, the timer should have fired at 1, 3, 5
+			test::Sleep(6 * timeUnit);
+			if (!EXPECT_EQ_RETRY(3u, counter))
+				return false;
+
+			EXPECT_EQ(1u, context.counter(Counter_Name));
+
+			// - the adjuster was passed the configured delay
+			context.shutdown();
+			EXPECT_LE(3u, adjustedDelays.size());
+			for (const auto& delay : adjustedDelays)
+				EXPECT_EQ(utils::TimeSpan::FromMilliseconds(8 * timeUnit), delay);
+
+			return true;
+		});
+	}
+
 	// endregion
 }}
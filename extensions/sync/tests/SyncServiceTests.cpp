@@ -19,6 +19,7 @@
 **/
 
 #include "sync/src/SyncService.h"
+#include "catapult/disruptor/ConsumerDispatcher.h"
 #include "catapult/extensions/ServerHooks.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/local/ServiceLocatorTestContext.h"
@@ -70,4 +71,40 @@ namespace catapult { namespace sync {
 	}
 
 	// endregion
+
+	// region adaptive sync
+
+	TEST(TEST_CLASS, SynchronizerTaskDoesNotAdjustDelayWhenAdaptiveSyncIsDisabled) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		test::RunTaskTest(context, Num_Expected_Tasks, "synchronizer task", [](const auto& task) {
+			// Assert:
+			EXPECT_FALSE(!!task.AdjustDelay);
+		});
+	}
+
+	TEST(TEST_CLASS, SynchronizerTaskAdjustsDelayWhenAdaptiveSyncIsEnabled) {
+		// Arrange:
+		TestContext context;
+		const_cast<bool&>(context.testState().config().Node.EnableAdaptiveSync) = true;
+
+		// - register dependent dispatcher service
+		auto options = disruptor::ConsumerDispatcherOptions("dispatcher.block", 16);
+		auto consumers = std::vector<disruptor::DisruptorConsumer>{ [](const auto&) { return disruptor::ConsumerResult::Continue(); } };
+		context.locator().registerService("dispatcher.block", std::make_shared<disruptor::ConsumerDispatcher>(options, consumers));
+
+		// - set network chain height hook
+		context.testState().state().hooks().setNetworkChainHeightSupplier([]() { return Height(1); });
+
+		// Act:
+		test::RunTaskTest(context, Num_Expected_Tasks, "synchronizer task", [](const auto& task) {
+			// Assert: local chain is not behind network chain, so delay is not changed
+			ASSERT_TRUE(!!task.AdjustDelay);
+			EXPECT_EQ(utils::TimeSpan::FromSeconds(3), task.AdjustDelay(utils::TimeSpan::FromSeconds(3)));
+		});
+	}
+
+	// endregion
 }}
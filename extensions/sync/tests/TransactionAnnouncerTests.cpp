@@ -0,0 +1,380 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "sync/src/TransactionAnnouncer.h"
+#include "catapult/model/TransactionPlugin.h"
+#include "tests/test/core/PacketPayloadTestUtils.h"
+#include "tests/test/core/TransactionInfoTestUtils.h"
+#include "tests/test/core/mocks/MockPacketIo.h"
+#include "tests/test/net/mocks/MockPacketWriters.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace sync {
+
+#define TEST_CLASS TransactionAnnouncerTests
+
+	namespace {
+		constexpr auto Default_Timeout = utils::TimeSpan::FromSeconds(7);
+
+		// region AnnouncingMockPacketWriters
+
+		class AnnouncingMockPacketWriters : public mocks::MockPacketWriters {
+		public:
+			AnnouncingMockPacketWriters(size_t numPeers, size_t numAvailablePeers)
+					: m_numAvailablePeers(numAvailablePeers)
+					, m_nextIndex(0) {
+				for (auto i = 0u; i < numPeers; ++i) {
+					connectSync(ionet::Node({ test::GenerateRandomByteArray<Key>(), "peer " + std::to_string(i) }));
+					m_packetIos.push_back(std::make_shared<mocks::MockPacketIo>());
+				}
+			}
+
+		public:
+			mocks::MockPacketIo& packetIo(size_t index) {
+				return *m_packetIos[index];
+			}
+
+			const std::vector<utils::TimeSpan>& pickOneDurations() const {
+				return m_ioDurations;
+			}
+
+			const std::vector<ionet::PacketPayload>& broadcastedPayloads() const {
+				return m_payloads;
+			}
+
+			void resetPicks() {
+				m_nextIndex = 0;
+			}
+
+		public:
+			void broadcast(const ionet::PacketPayload& payload) override {
+				m_payloads.push_back(payload);
+			}
+
+			ionet::NodePacketIoPair pickOne(const utils::TimeSpan& ioDuration) override {
+				m_ioDurations.push_back(ioDuration);
+				if (m_nextIndex >= m_numAvailablePeers)
+					return ionet::NodePacketIoPair();
+
+				auto index = m_nextIndex++;
+				return ionet::NodePacketIoPair(connectedNodes()[index], m_packetIos[index]);
+			}
+
+		private:
+			size_t m_numAvailablePeers;
+			size_t m_nextIndex;
+			std::vector<std::shared_ptr<mocks::MockPacketIo>> m_packetIos;
+			std::vector<utils::TimeSpan> m_ioDurations;
+			std::vector<ionet::PacketPayload> m_payloads;
+		};
+
+		// endregion
+
+		// region test context
+
+		class TestContext {
+		public:
+			TestContext(size_t numPeers, uint32_t maxFanOut, uint32_t maxHashesPerPeer = 100)
+					: TestContext(numPeers, numPeers, maxFanOut, maxHashesPerPeer)
+			{}
+
+			TestContext(size_t numPeers, size_t numAvailablePeers, uint32_t maxFanOut, uint32_t maxHashesPerPeer)
+					: Writers(numPeers, numAvailablePeers)
+					, pInventories(std::make_shared<PeerTransactionInventories>(
+							maxHashesPerPeer,
+							model::NodeIdentityEqualityStrategy::Key))
+					, Sink(CreateTransactionAnnouncingSink(Writers, m_registry, { maxFanOut, Default_Timeout }, pInventories))
+			{}
+
+		public:
+			AnnouncingMockPacketWriters Writers;
+			std::shared_ptr<PeerTransactionInventories> pInventories;
+
+		private:
+			model::TransactionRegistry m_registry;
+
+		public:
+			extensions::SharedNewTransactionsSink Sink;
+		};
+
+		void QueueAnnouncement(mocks::MockPacketIo& packetIo, const std::vector<size_t>& unknownHashIndexes) {
+			// inventory request + response
+			packetIo.queueWrite(ionet::SocketOperationCode::Success);
+			packetIo.queueRead(ionet::SocketOperationCode::Success, [unknownHashIndexes](const auto* pRequestPacket) {
+				const auto* pRequestTransactions = reinterpret_cast<const model::AnnouncedTransaction*>(pRequestPacket->Data());
+				auto responseDataSize = static_cast<uint32_t>(unknownHashIndexes.size() * Hash256::Size);
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(responseDataSize);
+				pResponsePacket->Type = ionet::PacketType::Transaction_Inventory;
+
+				auto* pResponseHash = reinterpret_cast<Hash256*>(pResponsePacket->Data());
+				for (auto index : unknownHashIndexes)
+					*pResponseHash++ = pRequestTransactions[index].EntityHash;
+
+				return pResponsePacket;
+			});
+
+			// push of unknown transactions
+			if (!unknownHashIndexes.empty())
+				packetIo.queueWrite(ionet::SocketOperationCode::Success);
+		}
+
+		void AssertInventoryRequest(
+				const mocks::MockPacketIo& packetIo,
+				size_t index,
+				const consumers::TransactionInfos& expectedTransactionInfos) {
+			const auto& packet = packetIo.writtenPacketAt<ionet::Packet>(index);
+			EXPECT_EQ(ionet::PacketType::Transaction_Inventory, packet.Type);
+			auto expectedSize = sizeof(ionet::PacketHeader) + expectedTransactionInfos.size() * sizeof(model::AnnouncedTransaction);
+			ASSERT_EQ(expectedSize, packet.Size);
+
+			const auto* pTransaction = reinterpret_cast<const model::AnnouncedTransaction*>(packet.Data());
+			for (const auto& transactionInfo : expectedTransactionInfos) {
+				EXPECT_EQ(transactionInfo.pEntity->Deadline, pTransaction->Deadline);
+				EXPECT_EQ(transactionInfo.EntityHash, pTransaction->EntityHash);
+				++pTransaction;
+			}
+		}
+
+		void AssertPush(const mocks::MockPacketIo& packetIo, size_t index, const consumers::TransactionInfos& expectedTransactionInfos) {
+			const auto& packet = packetIo.writtenPacketAt<ionet::Packet>(index);
+			EXPECT_EQ(ionet::PacketType::Push_Transactions, packet.Type);
+
+			auto expectedSize = sizeof(ionet::PacketHeader);
+			for (const auto& transactionInfo : expectedTransactionInfos)
+				expectedSize += transactionInfo.pEntity->Size;
+
+			ASSERT_EQ(expectedSize, packet.Size);
+
+			const auto* pData = packet.Data();
+			for (const auto& transactionInfo : expectedTransactionInfos) {
+				EXPECT_EQ_MEMORY(transactionInfo.pEntity.get(), pData, transactionInfo.pEntity->Size);
+				pData += transactionInfo.pEntity->Size;
+			}
+		}
+
+		consumers::TransactionInfos Select(const consumers::TransactionInfos& transactionInfos, const std::vector<size_t>& indexes) {
+			consumers::TransactionInfos selectedTransactionInfos;
+			for (auto index : indexes)
+				selectedTransactionInfos.push_back(transactionInfos[index].copy());
+
+			return selectedTransactionInfos;
+		}
+
+		// endregion
+	}
+
+	// region fan out
+
+	TEST(TEST_CLASS, TransactionsAreAnnouncedToAtMostMaxFanOutPeers) {
+		// Arrange:
+		TestContext context(5, 3);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		for (auto i = 0u; i < 3; ++i)
+			QueueAnnouncement(context.Writers.packetIo(i), { 0, 1, 2 });
+
+		// Act:
+		context.Sink(transactionInfos);
+
+		// Assert: only three peers were picked
+		EXPECT_EQ(std::vector<utils::TimeSpan>(3, Default_Timeout), context.Writers.pickOneDurations());
+		for (auto i = 0u; i < 3; ++i) {
+			EXPECT_EQ(2u, context.Writers.packetIo(i).numWrites()) << i;
+			AssertInventoryRequest(context.Writers.packetIo(i), 0, transactionInfos);
+			AssertPush(context.Writers.packetIo(i), 1, transactionInfos);
+		}
+
+		for (auto i = 3u; i < 5; ++i)
+			EXPECT_EQ(0u, context.Writers.packetIo(i).numWrites()) << i;
+	}
+
+	TEST(TEST_CLASS, TransactionsAreAnnouncedToAllPeersWhenMaxFanOutIsGreaterThanNumPeers) {
+		// Arrange:
+		TestContext context(2, 5);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		for (auto i = 0u; i < 2; ++i)
+			QueueAnnouncement(context.Writers.packetIo(i), { 0, 1, 2 });
+
+		// Act:
+		context.Sink(transactionInfos);
+
+		// Assert: all peers were picked
+		EXPECT_EQ(2u, context.Writers.pickOneDurations().size());
+		for (auto i = 0u; i < 2; ++i)
+			EXPECT_EQ(2u, context.Writers.packetIo(i).numWrites()) << i;
+
+		EXPECT_TRUE(context.Writers.broadcastedPayloads().empty());
+	}
+
+	TEST(TEST_CLASS, TransactionsAreBroadcastWhenFewerThanMaxFanOutPeersAreAvailable) {
+		// Arrange: only two of five peers can be picked
+		TestContext context(5, 2, 3, 100);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+
+		// Act:
+		context.Sink(transactionInfos);
+
+		// Assert: the third pick failed, so all transactions were broadcast without any announcements
+		EXPECT_EQ(3u, context.Writers.pickOneDurations().size());
+		for (auto i = 0u; i < 5; ++i)
+			EXPECT_EQ(0u, context.Writers.packetIo(i).numWrites()) << i;
+
+		auto expectedSize = sizeof(ionet::PacketHeader);
+		for (const auto& transactionInfo : transactionInfos)
+			expectedSize += transactionInfo.pEntity->Size;
+
+		ASSERT_EQ(1u, context.Writers.broadcastedPayloads().size());
+		const auto& payload = context.Writers.broadcastedPayloads()[0];
+		test::AssertPacketHeader(payload, expectedSize, ionet::PacketType::Push_Transactions);
+		ASSERT_EQ(3u, payload.buffers().size());
+		for (auto i = 0u; i < 3; ++i)
+			EXPECT_EQ(transactionInfos[i].pEntity.get(), payload.buffers()[i].pData) << i;
+		EXPECT_EQ(0u, context.pInventories->size());
+	}
+
+	// endregion
+
+	// region announce then push
+
+	TEST(TEST_CLASS, OnlyTransactionsUnknownToPeerArePushed) {
+		// Arrange:
+		TestContext context(1, 1);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		QueueAnnouncement(context.Writers.packetIo(0), { 1, 3, 4 });
+
+		// Act:
+		context.Sink(transactionInfos);
+
+		// Assert:
+		const auto& packetIo = context.Writers.packetIo(0);
+		EXPECT_EQ(1u, packetIo.numReads());
+		ASSERT_EQ(2u, packetIo.numWrites());
+		AssertInventoryRequest(packetIo, 0, transactionInfos);
+		AssertPush(packetIo, 1, Select(transactionInfos, { 1, 3, 4 }));
+	}
+
+	TEST(TEST_CLASS, NoTransactionsArePushedWhenAllAreKnownToPeer) {
+		// Arrange:
+		TestContext context(1, 1);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		QueueAnnouncement(context.Writers.packetIo(0), {});
+
+		// Act:
+		context.Sink(transactionInfos);
+
+		// Assert: only the inventory request was sent
+		const auto& packetIo = context.Writers.packetIo(0);
+		EXPECT_EQ(1u, packetIo.numReads());
+		ASSERT_EQ(1u, packetIo.numWrites());
+		AssertInventoryRequest(packetIo, 0, transactionInfos);
+	}
+
+	// endregion
+
+	// region known inventory
+
+	TEST(TEST_CLASS, AnnouncedTransactionsAreAddedToPeerInventory) {
+		// Arrange:
+		TestContext context(1, 1);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		QueueAnnouncement(context.Writers.packetIo(0), { 1, 3 });
+
+		// Act:
+		context.Sink(transactionInfos);
+
+		// Assert: both known and pushed transactions are in the inventory
+		const auto& identity = context.Writers.connectedNodes()[0].identity();
+		EXPECT_EQ(5u, context.pInventories->size(identity));
+		for (const auto& transactionInfo : transactionInfos)
+			EXPECT_TRUE(context.pInventories->contains(identity, transactionInfo.EntityHash));
+	}
+
+	TEST(TEST_CLASS, TransactionsKnownToPeerAreNotAnnouncedAgain) {
+		// Arrange:
+		TestContext context(1, 1);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		QueueAnnouncement(context.Writers.packetIo(0), { 0, 1, 2, 3, 4 });
+		context.Sink(transactionInfos);
+		context.Writers.resetPicks();
+
+		// Act:
+		context.Sink(transactionInfos);
+
+		// Assert: no additional requests were made
+		EXPECT_EQ(1u, context.Writers.packetIo(0).numReads());
+		EXPECT_EQ(2u, context.Writers.packetIo(0).numWrites());
+	}
+
+	TEST(TEST_CLASS, OnlyHashesUnknownToPeerAreAnnounced) {
+		// Arrange:
+		TestContext context(1, 1);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		QueueAnnouncement(context.Writers.packetIo(0), { 0, 1 });
+		context.Sink(Select(transactionInfos, { 0, 1, 2 }));
+		context.Writers.resetPicks();
+
+		// Act:
+		QueueAnnouncement(context.Writers.packetIo(0), { 1 });
+		context.Sink(transactionInfos);
+
+		// Assert: second announcement only contained the last two transactions
+		const auto& packetIo = context.Writers.packetIo(0);
+		EXPECT_EQ(2u, packetIo.numReads());
+		ASSERT_EQ(4u, packetIo.numWrites());
+		AssertInventoryRequest(packetIo, 2, Select(transactionInfos, { 3, 4 }));
+		AssertPush(packetIo, 3, Select(transactionInfos, { 4 }));
+	}
+
+	TEST(TEST_CLASS, PeerInventoryIsNotUpdatedWhenAnnouncementFails) {
+		// Arrange:
+		TestContext context(1, 1);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		auto& packetIo = context.Writers.packetIo(0);
+		packetIo.queueWrite(ionet::SocketOperationCode::Success);
+		packetIo.queueRead(ionet::SocketOperationCode::Read_Error);
+
+		// Act:
+		context.Sink(transactionInfos);
+
+		// Assert: no transactions were pushed
+		EXPECT_EQ(1u, packetIo.numReads());
+		EXPECT_EQ(1u, packetIo.numWrites());
+		EXPECT_EQ(0u, context.pInventories->size());
+	}
+
+	TEST(TEST_CLASS, InventoriesOfDisconnectedPeersAreRemovedDuringAnnouncement) {
+		// Arrange: add an inventory for an unknown peer
+		TestContext context(1, 1);
+		auto identity = model::NodeIdentity{ test::GenerateRandomByteArray<Key>(), "disconnected" };
+		context.pInventories->add(identity, test::GenerateRandomByteArray<Hash256>());
+
+		auto transactionInfos = test::CreateTransactionInfos(2);
+		QueueAnnouncement(context.Writers.packetIo(0), {});
+
+		// Act:
+		context.Sink(transactionInfos);
+
+		// Assert: only the inventory of the connected peer remains
+		EXPECT_EQ(1u, context.pInventories->size());
+		EXPECT_EQ(0u, context.pInventories->size(identity));
+		EXPECT_EQ(2u, context.pInventories->size(context.Writers.connectedNodes()[0].identity()));
+	}
+
+	// endregion
+}}
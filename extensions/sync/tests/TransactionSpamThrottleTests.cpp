@@ -192,13 +192,18 @@ namespace catapult { namespace sync {
 			};
 			auto throttleContext = context.throttleContext(settings.Source);
 			auto transactionInfo = CreateTransactionInfo(signerPublicKey, settings.Fee);
-			auto filter = CreateTransactionSpamThrottle(settings.ThrottleConfig, isBonded);
+			auto pCounters = std::make_shared<SpamThrottleCounters>();
+			auto filter = CreateTransactionSpamThrottle(settings.ThrottleConfig, isBonded, pCounters);
 
 			// Act:
 			auto result = filter(transactionInfo, throttleContext);
 
 			// Assert:
 			EXPECT_EQ(expectedResult, result) << "for importance " << settings.SignerImportance;
+
+			auto isCacheFull = settings.CacheSize >= settings.ThrottleConfig.MaxCacheSize;
+			EXPECT_EQ(expectedResult && isCacheFull ? 1u : 0u, pCounters->NumCacheFullRejections.load());
+			EXPECT_EQ(expectedResult && !isCacheFull ? 1u : 0u, pCounters->NumThrottledRejections.load());
 			auto expectedTransactions =
 					settings.CacheSize >= settings.ThrottleConfig.MaxBlockSize && settings.CacheSize < settings.ThrottleConfig.MaxCacheSize
 					? std::vector<const model::Transaction*>{ transactionInfo.pEntity.get() }
@@ -268,6 +273,209 @@ namespace catapult { namespace sync {
 
 	// endregion
 
+	// region importance caching
+
+	namespace {
+		struct ThrottleRunSettings {
+			Importance SignerImportance;
+			bool HasSignerAccount = true;
+			Height CacheHeight = Height(1);
+			state::AccountType SignerAccountType = state::AccountType::Unlinked;
+			uint32_t CacheSize = 120;
+			TransactionSource Source = TransactionSource::New;
+		};
+
+		void AddSignerAccount(cache::AccountStateCacheDelta& delta, const Key& signerPublicKey, const ThrottleRunSettings& settings) {
+			// signer importance is set at the importance height corresponding to cache height
+			auto importanceHeight = model::ConvertToImportanceHeight(settings.CacheHeight, 100);
+			delta.addAccount(signerPublicKey, Height(1));
+			auto& accountState = delta.find(signerPublicKey).get();
+			accountState.AccountType = settings.SignerAccountType;
+			if (state::AccountType::Remote != settings.SignerAccountType) {
+				accountState.ImportanceSnapshots.set(settings.SignerImportance, importanceHeight);
+				return;
+			}
+
+			// a remote signer is linked to a main account with the signer importance
+			auto mainPublicKey = test::GenerateRandomByteArray<Key>();
+			delta.addAccount(mainPublicKey, Height(1));
+			auto& mainAccountState = delta.find(mainPublicKey).get();
+			mainAccountState.AccountType = state::AccountType::Main;
+			mainAccountState.LinkedAccountKey = signerPublicKey;
+			mainAccountState.ImportanceSnapshots.set(settings.SignerImportance, importanceHeight);
+			accountState.LinkedAccountKey = mainPublicKey;
+		}
+
+		bool RunThrottle(const chain::UtUpdater::Throttle& filter, const Key& signerPublicKey, const ThrottleRunSettings& settings) {
+			// Arrange: prepare account state cache
+			auto catapultCache = CreateCatapultCacheWithImportanceGrouping(100);
+			std::vector<Key> publicKeys;
+			{
+				auto delta = catapultCache.createDelta();
+				auto& accountStateCacheDelta = delta.sub<cache::AccountStateCache>();
+				publicKeys = SeedAccountStateCache(accountStateCacheDelta, settings.CacheSize, Importance(1'000));
+				if (settings.HasSignerAccount)
+					AddSignerAccount(accountStateCacheDelta, signerPublicKey, settings);
+
+				catapultCache.commit(Height(1));
+			}
+
+			TestContext context(std::move(catapultCache), settings.CacheHeight);
+			context.addTransactions(publicKeys);
+
+			// Act:
+			return filter(CreateTransactionInfo(signerPublicKey), context.throttleContext(settings.Source));
+		}
+
+		bool RunThrottle(const chain::UtUpdater::Throttle& filter, const Key& signerPublicKey, Importance signerImportance, Height height) {
+			ThrottleRunSettings settings;
+			settings.SignerImportance = signerImportance;
+			settings.CacheHeight = height;
+			return RunThrottle(filter, signerPublicKey, settings);
+		}
+
+		chain::UtUpdater::Throttle CreateDefaultTransactionSpamThrottle() {
+			auto config = ThrottleTestSettings().ThrottleConfig;
+			return CreateTransactionSpamThrottle(config, [](const auto&) { return false; }, std::make_shared<SpamThrottleCounters>());
+		}
+	}
+
+	TEST(TEST_CLASS, SignerImportanceIsCachedWithinCacheHeight) {
+		// Arrange:
+		auto signerPublicKey = test::GenerateRandomByteArray<Key>();
+		auto filter = CreateDefaultTransactionSpamThrottle();
+
+		// Act: both runs are at the same cache height, so the second importance is never read
+		auto result1 = RunThrottle(filter, signerPublicKey, Importance(1'000), Height(10));
+		auto result2 = RunThrottle(filter, signerPublicKey, Importance(), Height(10));
+
+		// Assert:
+		EXPECT_FALSE(result1);
+		EXPECT_FALSE(result2);
+	}
+
+	TEST(TEST_CLASS, SignerImportanceIsRefreshedWhenCacheHeightChanges) {
+		// Arrange:
+		auto signerPublicKey = test::GenerateRandomByteArray<Key>();
+		auto filter = CreateDefaultTransactionSpamThrottle();
+
+		// Act: both heights map to importance height 1, but the second importance is read
+		auto result1 = RunThrottle(filter, signerPublicKey, Importance(1'000), Height(10));
+		auto result2 = RunThrottle(filter, signerPublicKey, Importance(), Height(11));
+
+		// Assert:
+		EXPECT_FALSE(result1);
+		EXPECT_TRUE(result2);
+	}
+
+	TEST(TEST_CLASS, SignerImportanceIsRefreshedWhenTransactionSourceIsNotNew) {
+		// Arrange:
+		auto signerPublicKey = test::GenerateRandomByteArray<Key>();
+		auto filter = CreateDefaultTransactionSpamThrottle();
+
+		ThrottleRunSettings settings;
+		settings.SignerImportance = Importance(1'000);
+
+		// Act: existing transactions are only applied when rebasing, which invalidates the cached importance
+		auto result1 = RunThrottle(filter, signerPublicKey, settings);
+
+		settings.SignerImportance = Importance();
+		settings.Source = TransactionSource::Existing;
+		auto result2 = RunThrottle(filter, signerPublicKey, settings);
+
+		// Assert:
+		EXPECT_FALSE(result1);
+		EXPECT_TRUE(result2);
+	}
+
+	TEST(TEST_CLASS, SignerImportanceIsRefreshedAfterCacheIsUncongested) {
+		// Arrange:
+		auto signerPublicKey = test::GenerateRandomByteArray<Key>();
+		auto filter = CreateDefaultTransactionSpamThrottle();
+
+		ThrottleRunSettings settings;
+		settings.SignerImportance = Importance(1'000);
+
+		// Act: the second run is below max block size (120), which invalidates the cached importance
+		auto result1 = RunThrottle(filter, signerPublicKey, settings);
+
+		settings.SignerImportance = Importance();
+		settings.CacheSize = 100;
+		auto result2 = RunThrottle(filter, signerPublicKey, settings);
+
+		settings.CacheSize = 120;
+		auto result3 = RunThrottle(filter, signerPublicKey, settings);
+
+		// Assert:
+		EXPECT_FALSE(result1);
+		EXPECT_FALSE(result2);
+		EXPECT_TRUE(result3);
+	}
+
+	TEST(TEST_CLASS, SignerImportanceIsCachedForMainAccount) {
+		// Arrange:
+		auto signerPublicKey = test::GenerateRandomByteArray<Key>();
+		auto filter = CreateDefaultTransactionSpamThrottle();
+
+		ThrottleRunSettings settings;
+		settings.SignerImportance = Importance(1'000);
+		settings.SignerAccountType = state::AccountType::Main;
+
+		// Act: importance of a main account does not depend on its link, so the second importance is never read
+		auto result1 = RunThrottle(filter, signerPublicKey, settings);
+
+		settings.SignerImportance = Importance();
+		settings.SignerAccountType = state::AccountType::Unlinked;
+		auto result2 = RunThrottle(filter, signerPublicKey, settings);
+
+		// Assert:
+		EXPECT_FALSE(result1);
+		EXPECT_FALSE(result2);
+	}
+
+	TEST(TEST_CLASS, SignerImportanceIsNotCachedForRemoteAccount) {
+		// Arrange:
+		auto signerPublicKey = test::GenerateRandomByteArray<Key>();
+		auto filter = CreateDefaultTransactionSpamThrottle();
+
+		ThrottleRunSettings settings;
+		settings.SignerImportance = Importance(1'000);
+		settings.SignerAccountType = state::AccountType::Remote;
+
+		// Act: importance of a remote account changes when it is unlinked, so the second importance is read
+		auto result1 = RunThrottle(filter, signerPublicKey, settings);
+
+		settings.SignerImportance = Importance();
+		settings.SignerAccountType = state::AccountType::Remote_Unlinked;
+		auto result2 = RunThrottle(filter, signerPublicKey, settings);
+
+		// Assert:
+		EXPECT_FALSE(result1);
+		EXPECT_TRUE(result2);
+	}
+
+	TEST(TEST_CLASS, SignerImportanceIsNotCachedForUnknownAccount) {
+		// Arrange:
+		auto signerPublicKey = test::GenerateRandomByteArray<Key>();
+		auto filter = CreateDefaultTransactionSpamThrottle();
+
+		ThrottleRunSettings settings;
+		settings.HasSignerAccount = false;
+
+		// Act: unknown signer has no importance, but it can become a remote account, so the second importance is read
+		auto result1 = RunThrottle(filter, signerPublicKey, settings);
+
+		settings.SignerImportance = Importance(1'000);
+		settings.HasSignerAccount = true;
+		auto result2 = RunThrottle(filter, signerPublicKey, settings);
+
+		// Assert:
+		EXPECT_TRUE(result1);
+		EXPECT_FALSE(result2);
+	}
+
+	// endregion
+
 	// region throttling - single account / multiple accounts
 
 	namespace {
@@ -296,7 +504,8 @@ namespace catapult { namespace sync {
 			auto index = 0u;
 			while (!isFiltered && config.MaxCacheSize > context.transactionsCacheModifier().size()) {
 				auto transactionInfo = CreateTransactionInfo(publicKeys[index], settings.Fee);
-				auto filter = CreateTransactionSpamThrottle(config, [](const auto&) { return false; });
+				auto pCounters = std::make_shared<SpamThrottleCounters>();
+				auto filter = CreateTransactionSpamThrottle(config, [](const auto&) { return false; }, pCounters);
 
 				// Act:
 				isFiltered = filter(transactionInfo, throttleContext);
@@ -37,19 +37,37 @@ namespace catapult { namespace syncsource {
 
 		struct HandlersConfiguration {
 			handlers::BlockRangeHandler PushBlockCallback;
+			GenerationHash NetworkGenerationHash;
+			handlers::CompactBlockTransactionsRetriever CompactBlockTransactionsRetriever;
 			model::ChainScoreSupplier ChainScoreSupplier;
 			handlers::PullBlocksHandlerConfiguration BlocksHandlerConfig;
 			handlers::UtRetriever UtRetriever;
+			handlers::UnknownTransactionHashesRetriever UnknownTransactionHashesRetriever;
 		};
 
 		HandlersConfiguration CreateHandlersConfiguration(const extensions::ServiceState& state) {
 			HandlersConfiguration config;
 			config.PushBlockCallback = extensions::CreateBlockPushEntityCallback(state.hooks());
+			config.NetworkGenerationHash = state.config().BlockChain.Network.GenerationHash;
+			config.CompactBlockTransactionsRetriever = [&cache = state.utCache()](const auto& shortHashes) {
+				return cache.view().findTransactions(shortHashes);
+			};
 
 			config.ChainScoreSupplier = [&chainScore = state.score()]() { return chainScore.get(); };
 			config.UtRetriever = [&cache = state.utCache()](auto minFeeMultiplier, const auto& shortHashes) {
 				return cache.view().unknownTransactions(minFeeMultiplier, shortHashes);
 			};
+			// check confirmed transactions (e.g. hash cache) in addition to unconfirmed transactions
+			auto knownHashPredicate = state.hooks().knownHashPredicate(state.utCache());
+			config.UnknownTransactionHashesRetriever = [knownHashPredicate](const auto& transactions) {
+				std::vector<Hash256> unknownHashes;
+				for (const auto& transaction : transactions) {
+					if (!knownHashPredicate(transaction.Deadline, transaction.EntityHash))
+						unknownHashes.push_back(transaction.EntityHash);
+				}
+
+				return unknownHashes;
+			};
 
 			SetConfig(config.BlocksHandlerConfig, state.config().Node);
 			return config;
@@ -61,6 +79,12 @@ namespace catapult { namespace syncsource {
 				const model::TransactionRegistry& registry,
 				const HandlersConfiguration& config) {
 			handlers::RegisterPushBlockHandler(handlers, registry, config.PushBlockCallback);
+			handlers::RegisterCompactBlockHandler(
+					handlers,
+					registry,
+					config.NetworkGenerationHash,
+					config.CompactBlockTransactionsRetriever,
+					config.PushBlockCallback);
 			handlers::RegisterPullBlockHandler(handlers, storage);
 
 			handlers::RegisterChainInfoHandler(handlers, storage, config.ChainScoreSupplier);
@@ -68,6 +92,7 @@ namespace catapult { namespace syncsource {
 			handlers::RegisterPullBlocksHandler(handlers, storage, config.BlocksHandlerConfig);
 
 			handlers::RegisterPullTransactionsHandler(handlers, config.UtRetriever);
+			handlers::RegisterTransactionInventoryHandler(handlers, config.UnknownTransactionHashesRetriever);
 		}
 
 		class SyncSourceServiceRegistrar : public extensions::ServiceRegistrar {
@@ -19,7 +19,12 @@
 **/
 
 #include "syncsource/src/SyncSourceService.h"
+#include "catapult/api/CompactBlockUtils.h"
+#include "catapult/model/BlockUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/local/ServiceLocatorTestContext.h"
 #include "tests/test/local/ServiceTestUtils.h"
@@ -75,8 +80,9 @@ namespace catapult { namespace syncsource {
 		const auto& handlers = context.testState().state().packetHandlers();
 
 		// Assert:
-		EXPECT_EQ(6u, handlers.size());
+		EXPECT_EQ(8u, handlers.size());
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Push_Block));
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Compact_Block));
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Block));
 
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Chain_Info));
@@ -84,6 +90,7 @@ namespace catapult { namespace syncsource {
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Blocks));
 
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Transactions));
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Transaction_Inventory));
 	}
 
 	// endregion
@@ -114,5 +121,150 @@ namespace catapult { namespace syncsource {
 		AssertBlockPush(false, 0);
 	}
 
+	namespace {
+		std::shared_ptr<ionet::Packet> CreateTransactionInventoryPacket(const std::vector<model::TransactionInfo>& transactionInfos) {
+			auto dataSize = static_cast<uint32_t>(transactionInfos.size() * sizeof(model::AnnouncedTransaction));
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(dataSize);
+			pPacket->Type = ionet::PacketType::Transaction_Inventory;
+
+			auto* pTransaction = reinterpret_cast<model::AnnouncedTransaction*>(pPacket->Data());
+			for (const auto& transactionInfo : transactionInfos) {
+				pTransaction->Deadline = transactionInfo.pEntity->Deadline;
+				pTransaction->EntityHash = transactionInfo.EntityHash;
+				++pTransaction;
+			}
+
+			return pPacket;
+		}
+
+		void AssertTransactionInventoryResponse(
+				TestContext& context,
+				const std::vector<model::TransactionInfo>& transactionInfos,
+				const std::vector<Hash256>& expectedUnknownHashes) {
+			// Act:
+			auto pPacket = CreateTransactionInventoryPacket(transactionInfos);
+			ionet::ServerPacketHandlerContext handlerContext;
+			const auto& handlers = context.testState().state().packetHandlers();
+			handlers.process(*pPacket, handlerContext);
+
+			// Assert:
+			ASSERT_TRUE(handlerContext.hasResponse());
+			auto payload = handlerContext.response();
+			auto expectedSize = sizeof(ionet::PacketHeader) + expectedUnknownHashes.size() * Hash256::Size;
+			test::AssertPacketHeader(payload, expectedSize, ionet::PacketType::Transaction_Inventory);
+			ASSERT_EQ(1u, payload.buffers().size());
+
+			const auto* pUnknownHashes = reinterpret_cast<const Hash256*>(payload.buffers()[0].pData);
+			for (auto i = 0u; i < expectedUnknownHashes.size(); ++i)
+				EXPECT_EQ(expectedUnknownHashes[i], pUnknownHashes[i]) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, TransactionInventoryRespondsWithHashesNotInUtCache) {
+		// Arrange: add two of four transactions to the ut cache
+		TestContext context;
+		context.boot();
+
+		auto transactionInfos = test::CreateTransactionInfos(4);
+		{
+			auto modifier = context.testState().state().utCache().modifier();
+			modifier.add(transactionInfos[0]);
+			modifier.add(transactionInfos[2]);
+		}
+
+		// Act + Assert:
+		AssertTransactionInventoryResponse(context, transactionInfos, { transactionInfos[1].EntityHash, transactionInfos[3].EntityHash });
+	}
+
+	TEST(TEST_CLASS, TransactionInventoryRespondsWithHashesNotKnownByHashPredicates) {
+		// Arrange: mark two of four transactions as confirmed (e.g. in hash cache) when their deadlines match
+		TestContext context;
+		auto transactionInfos = test::CreateTransactionInfos(4);
+		std::vector<std::pair<Timestamp, Hash256>> confirmedPairs;
+		for (auto index : { 1u, 2u })
+			confirmedPairs.emplace_back(transactionInfos[index].pEntity->Deadline, transactionInfos[index].EntityHash);
+
+		context.testState().state().hooks().addKnownHashPredicate([confirmedPairs](auto timestamp, const auto& hash) {
+			return confirmedPairs.cend() != std::find(confirmedPairs.cbegin(), confirmedPairs.cend(), std::make_pair(timestamp, hash));
+		});
+		context.boot();
+
+		// Act + Assert:
+		AssertTransactionInventoryResponse(context, transactionInfos, { transactionInfos[0].EntityHash, transactionInfos[3].EntityHash });
+	}
+
+	namespace {
+		std::shared_ptr<ionet::Packet> CreateCompactBlockPacket(
+				const std::vector<model::TransactionInfo>& transactionInfos,
+				const extensions::ServiceState& state) {
+			model::Transactions transactions;
+			std::vector<utils::ShortHash> shortHashes;
+			for (const auto& transactionInfo : transactionInfos) {
+				transactions.push_back(transactionInfo.pEntity);
+				shortHashes.push_back(utils::ToShortHash(transactionInfo.EntityHash));
+			}
+
+			auto pBlock = model::StitchBlock(*test::GenerateEmptyRandomBlock(), transactions);
+			const auto& registry = state.pluginManager().transactionRegistry();
+			const auto& generationHash = state.config().BlockChain.Network.GenerationHash;
+			pBlock->TransactionsHash = api::CalculateBlockTransactionsHash(*pBlock, registry, generationHash);
+			auto payload = api::CreateCompactBlockPayload(std::move(pBlock), shortHashes, {});
+
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(payload.header().Size - sizeof(ionet::Packet));
+			pPacket->Type = payload.header().Type;
+			auto* pData = pPacket->Data();
+			for (const auto& buffer : payload.buffers()) {
+				std::memcpy(pData, buffer.pData, buffer.Size);
+				pData += buffer.Size;
+			}
+
+			return pPacket;
+		}
+
+		template<typename TAssert>
+		void RunCompactBlockTest(const std::vector<size_t>& utCacheIndexes, TAssert assertResponse) {
+			// Arrange:
+			TestContext context;
+			context.boot();
+
+			auto transactionInfos = test::CreateTransactionInfos(4);
+			{
+				auto modifier = context.testState().state().utCache().modifier();
+				for (auto index : utCacheIndexes)
+					modifier.add(transactionInfos[index]);
+			}
+
+			auto pPacket = CreateCompactBlockPacket(transactionInfos, context.testState().state());
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			const auto& handlers = context.testState().state().packetHandlers();
+			handlers.process(*pPacket, handlerContext);
+
+			// Assert:
+			ASSERT_TRUE(handlerContext.hasResponse());
+			assertResponse(context, handlerContext.response());
+		}
+	}
+
+	TEST(TEST_CLASS, CompactBlockIsReconstructedFromUtCache) {
+		RunCompactBlockTest({ 0, 1, 2, 3 }, [](auto& context, const auto& payload) {
+			test::AssertPacketHeader(payload, sizeof(ionet::PacketHeader), ionet::PacketType::Compact_Block);
+			EXPECT_EQ(1u, context.numPushedBlockElements());
+		});
+	}
+
+	TEST(TEST_CLASS, CompactBlockRespondsWithIndexesOfTransactionsNotInUtCache) {
+		RunCompactBlockTest({ 0, 2 }, [](auto& context, const auto& payload) {
+			test::AssertPacketHeader(payload, sizeof(ionet::PacketHeader) + 2 * sizeof(uint32_t), ionet::PacketType::Compact_Block);
+			ASSERT_EQ(1u, payload.buffers().size());
+
+			const auto* pMissingIndexes = reinterpret_cast<const uint32_t*>(payload.buffers()[0].pData);
+			EXPECT_EQ(1u, pMissingIndexes[0]);
+			EXPECT_EQ(3u, pMissingIndexes[1]);
+			EXPECT_EQ(0u, context.numPushedBlockElements());
+		});
+	}
+
 	// endregion
 }}
@@ -111,47 +111,172 @@ namespace catapult { namespace importance {
 
 	// endregion
 
+	// region AccountSummaryColumns
+
+	void AccountSummaryColumns::reserve(size_t count) {
+		AccountStates.reserve(count);
+		Balances.reserve(count);
+		TotalFeesPaid.reserve(count);
+		BeneficiaryCounts.reserve(count);
+		PreviousImportances.reserve(count);
+	}
+
+	void AccountSummaryColumns::push_back(
+			const AccountActivitySummary& activitySummary,
+			Amount balance,
+			state::AccountState& accountState) {
+		AccountStates.push_back(&accountState);
+		Balances.push_back(balance.unwrap());
+		TotalFeesPaid.push_back(activitySummary.TotalFeesPaid.unwrap());
+		BeneficiaryCounts.push_back(activitySummary.BeneficiaryCount);
+		PreviousImportances.push_back(activitySummary.PreviousImportance.unwrap());
+	}
+
+	size_t AccountSummaryColumns::size() const {
+		return AccountStates.size();
+	}
+
+	// endregion
+
 	// region CalculateImportances
 
+	namespace {
+#ifdef _MSC_VER
+		using Uint128 = boost::multiprecision::uint128_t;
+#else
+		// native 128 bit integers wrap identically to boost::multiprecision::uint128_t but are significantly faster
+		__extension__ typedef unsigned __int128 Uint128;
+#endif
+
+		Uint128 Divide(const Uint128& value, const Uint128& divisor) {
+			if (0 == divisor)
+				CATAPULT_THROW_RUNTIME_ERROR("importance calculation cannot divide by zero");
+
+			return value / divisor;
+		}
+
+		// all configuration and context dependent factors are calculated once and then applied to each account
+		// note that (x / a) / b == x / (a * b) for unsigned integers and a * b cannot overflow for 64 bit a and b
+		class ImportanceKernel {
+		public:
+			ImportanceKernel(const ImportanceCalculationContext& context, const model::BlockChainConfiguration& config) {
+				// note that at least one compiler is known to produce invalid code if you alter calculations in incorrect way
+				auto totalChainImportance = config.TotalChainImportance.unwrap();
+				auto importanceActivityPercentage = config.ImportanceActivityPercentage;
+				auto minHarvesterBalance = config.MinHarvesterBalance.unwrap();
+
+				// 1. stake
+				m_stakeMultiplier = Uint128(totalChainImportance) * (100 - importanceActivityPercentage);
+				m_stakeDivisor = context.ActiveHarvestingMosaics.unwrap() * 100;
+
+				// 2. fees paid: importanceActivityPercentage * (minHarvesterBalance / stake) * 0.8 * feePercentage
+				m_hasFeeImportance = 0 < importanceActivityPercentage && 0u < context.TotalFeesPaid.unwrap();
+				m_feeMultiplier = Uint128(totalChainImportance) * (importanceActivityPercentage * minHarvesterBalance * 8);
+				m_feeDivisor = context.TotalFeesPaid.unwrap() * 1'000;
+
+				// 3. beneficiary count: importanceActivityPercentage * (minHarvesterBalance / stake) * 0.2 * beneficiaryCountPercentage
+				m_hasBeneficiaryCountImportance = 0 < importanceActivityPercentage && 0u < context.TotalBeneficiaryCount;
+				m_beneficiaryCountMultiplier = Uint128(totalChainImportance) * (importanceActivityPercentage * minHarvesterBalance * 2);
+				m_beneficiaryCountDivisor = context.TotalBeneficiaryCount * 1'000;
+			}
+
+		public:
+			Importance::ValueType stakeImportance(Amount::ValueType balance) const {
+				return static_cast<Importance::ValueType>(Divide(m_stakeMultiplier * balance, m_stakeDivisor));
+			}
+
+			Importance::ValueType activityImportance(
+					Amount::ValueType balance,
+					Amount::ValueType totalFeesPaid,
+					uint32_t beneficiaryCount) const {
+				Uint128 feeImportance = 0;
+				if (m_hasFeeImportance)
+					feeImportance = Divide(m_feeMultiplier * totalFeesPaid, Uint128(m_feeDivisor) * balance);
+
+				Uint128 beneficiaryCountImportance = 0;
+				if (m_hasBeneficiaryCountImportance) {
+					auto divisor = Uint128(m_beneficiaryCountDivisor) * balance;
+					beneficiaryCountImportance = Divide(m_beneficiaryCountMultiplier * beneficiaryCount, divisor);
+				}
+
+				return static_cast<Importance::ValueType>(feeImportance + beneficiaryCountImportance);
+			}
+
+		private:
+			Uint128 m_stakeMultiplier;
+			uint64_t m_stakeDivisor;
+
+			bool m_hasFeeImportance;
+			Uint128 m_feeMultiplier;
+			uint64_t m_feeDivisor;
+
+			bool m_hasBeneficiaryCountImportance;
+			Uint128 m_beneficiaryCountMultiplier;
+			uint64_t m_beneficiaryCountDivisor;
+		};
+	}
+
 	void CalculateImportances(
 			AccountSummary& accountSummary,
 			const ImportanceCalculationContext& context,
 			const model::BlockChainConfiguration& config) {
-		// note that at least one compiler is known to produce invalid code if you alter calculations in incorrect way
-		auto totalChainImportance = config.TotalChainImportance;
-		auto mosaicId = config.HarvestingMosaicId;
-		auto importanceActivityPercentage = config.ImportanceActivityPercentage;
-		auto minHarvesterBalance = config.MinHarvesterBalance;
-
-		// 1. stake
-		boost::multiprecision::uint128_t stakeImportance = totalChainImportance.unwrap();
-		stakeImportance *= accountSummary.pAccountState->Balances.get(mosaicId).unwrap();
-		stakeImportance *= (100 - importanceActivityPercentage);
-		stakeImportance /= context.ActiveHarvestingMosaics.unwrap() * 100;
-		accountSummary.StakeImportance = Importance(static_cast<Importance::ValueType>(stakeImportance));
-
-		// 2. fees paid: importanceActivityPercentage * (minHarvesterBalance / stake) * 0.8 * feePercentage
-		boost::multiprecision::uint128_t feeImportance(0);
-		if (0 < importanceActivityPercentage && 0u < context.TotalFeesPaid.unwrap()) {
-			feeImportance = totalChainImportance.unwrap();
-			feeImportance *= accountSummary.ActivitySummary.TotalFeesPaid.unwrap();
-			feeImportance *= (importanceActivityPercentage * minHarvesterBalance.unwrap() * 8);
-			feeImportance /= context.TotalFeesPaid.unwrap() * 1'000;
-			feeImportance /= accountSummary.pAccountState->Balances.get(mosaicId).unwrap();
-		}
+		ImportanceKernel kernel(context, config);
+		auto balance = accountSummary.pAccountState->Balances.get(config.HarvestingMosaicId).unwrap();
+		const auto& activitySummary = accountSummary.ActivitySummary;
+		accountSummary.StakeImportance = Importance(kernel.stakeImportance(balance));
+		accountSummary.ActivityImportance = Importance(kernel.activityImportance(
+				balance,
+				activitySummary.TotalFeesPaid.unwrap(),
+				activitySummary.BeneficiaryCount));
+	}
+
+	ImportanceCalculationContext CreateImportanceCalculationContext(const AccountSummaryColumns& summaries) {
+		// use separate passes over contiguous columns so that each sum can be vectorized
+		Amount::ValueType activeHarvestingMosaics = 0;
+		for (auto balance : summaries.Balances)
+			activeHarvestingMosaics += balance;
+
+		uint64_t totalBeneficiaryCount = 0;
+		for (auto beneficiaryCount : summaries.BeneficiaryCounts)
+			totalBeneficiaryCount += beneficiaryCount;
+
+		Amount::ValueType totalFeesPaid = 0;
+		for (auto feesPaid : summaries.TotalFeesPaid)
+			totalFeesPaid += feesPaid;
+
+		ImportanceCalculationContext context;
+		context.ActiveHarvestingMosaics = Amount(activeHarvestingMosaics);
+		context.TotalBeneficiaryCount = totalBeneficiaryCount;
+		context.TotalFeesPaid = Amount(totalFeesPaid);
+		return context;
+	}
 
-		// 3. beneficiary count: importanceActivityPercentage * (minHarvesterBalance / stake) * 0.2 * beneficiaryCountPercentage
-		boost::multiprecision::uint128_t beneficiaryCountImportance(0);
-		if (0 < importanceActivityPercentage && 0u < context.TotalBeneficiaryCount) {
-			beneficiaryCountImportance = totalChainImportance.unwrap();
-			beneficiaryCountImportance *= accountSummary.ActivitySummary.BeneficiaryCount;
-			beneficiaryCountImportance *= (importanceActivityPercentage * minHarvesterBalance.unwrap() * 2);
-			beneficiaryCountImportance /= context.TotalBeneficiaryCount * 1'000;
-			beneficiaryCountImportance /= accountSummary.pAccountState->Balances.get(mosaicId).unwrap();
+	ImportanceCalculationContext CalculateImportances(
+			AccountSummaryColumns& summaries,
+			const ImportanceCalculationContext& context,
+			const model::BlockChainConfiguration& config) {
+		ImportanceKernel kernel(context, config);
+		auto numAccounts = summaries.size();
+
+		summaries.StakeImportances.resize(numAccounts);
+		for (auto i = 0u; i < numAccounts; ++i)
+			summaries.StakeImportances[i] = kernel.stakeImportance(summaries.Balances[i]);
+
+		summaries.ActivityImportances.resize(numAccounts);
+		for (auto i = 0u; i < numAccounts; ++i) {
+			summaries.ActivityImportances[i] = kernel.activityImportance(
+					summaries.Balances[i],
+					summaries.TotalFeesPaid[i],
+					summaries.BeneficiaryCounts[i]);
 		}
 
-		auto rawActivityImportance = static_cast<Importance::ValueType>(feeImportance + beneficiaryCountImportance);
-		accountSummary.ActivityImportance = Importance(rawActivityImportance);
+		Importance::ValueType totalActivityImportance = 0;
+		for (auto activityImportance : summaries.ActivityImportances)
+			totalActivityImportance += activityImportance;
+
+		auto resultContext = context;
+		resultContext.TotalActivityImportance = Importance(totalActivityImportance);
+		return resultContext;
 	}
 
 	// endregion
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "catapult/model/ImportanceHeight.h"
+#include <vector>
 
 namespace catapult {
 	namespace model { struct BlockChainConfiguration; }
@@ -66,6 +67,41 @@ namespace catapult { namespace importance {
 		Importance ActivityImportance;
 	};
 
+	/// Summarized information of multiple accounts stored in columns, with one element per account in each column.
+	struct AccountSummaryColumns {
+	public:
+		/// Reserves space for \a count accounts.
+		void reserve(size_t count);
+
+		/// Adds an account with \a activitySummary and harvesting mosaic \a balance backed by \a accountState.
+		void push_back(const AccountActivitySummary& activitySummary, Amount balance, state::AccountState& accountState);
+
+		/// Gets the number of accounts.
+		size_t size() const;
+
+	public:
+		/// Account states.
+		std::vector<state::AccountState*> AccountStates;
+
+		/// Harvesting mosaic balances.
+		std::vector<Amount::ValueType> Balances;
+
+		/// Total fees paid.
+		std::vector<Amount::ValueType> TotalFeesPaid;
+
+		/// Beneficiary counts.
+		std::vector<uint32_t> BeneficiaryCounts;
+
+		/// Previous importances.
+		std::vector<Importance::ValueType> PreviousImportances;
+
+		/// Importances due to account stake.
+		std::vector<Importance::ValueType> StakeImportances;
+
+		/// Importances due to account activity.
+		std::vector<Importance::ValueType> ActivityImportances;
+	};
+
 	/// Context for importance calculation.
 	struct ImportanceCalculationContext {
 	public:
@@ -97,4 +133,15 @@ namespace catapult { namespace importance {
 			AccountSummary& accountSummary,
 			const ImportanceCalculationContext& context,
 			const model::BlockChainConfiguration& config);
+
+	/// Creates an importance calculation context by summing the balances, fees paid and beneficiary counts of all \a summaries.
+	ImportanceCalculationContext CreateImportanceCalculationContext(const AccountSummaryColumns& summaries);
+
+	/// Calculates stake and activity importances of all accounts in \a summaries using \a context and \a config
+	/// and stores resulting importances in \a summaries.
+	/// \note Returned context is \a context with TotalActivityImportance set to the sum of all activity importances.
+	ImportanceCalculationContext CalculateImportances(
+			AccountSummaryColumns& summaries,
+			const ImportanceCalculationContext& context,
+			const model::BlockChainConfiguration& config);
 }}
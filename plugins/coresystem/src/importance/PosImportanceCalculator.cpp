@@ -25,9 +25,7 @@
 #include "catapult/model/ImportanceHeight.h"
 #include "catapult/state/AccountImportanceSnapshots.h"
 #include "catapult/utils/StackLogger.h"
-#include <boost/multiprecision/cpp_int.hpp>
 #include <memory>
-#include <vector>
 
 namespace catapult { namespace importance {
 
@@ -41,44 +39,42 @@ namespace catapult { namespace importance {
 			void recalculate(model::ImportanceHeight importanceHeight, cache::AccountStateCacheDelta& cache) const override {
 				utils::StackLogger stopwatch("PosImportanceCalculator::recalculate", utils::LogLevel::Debug);
 
-				// 1. get high value accounts (notice two step lookup because only const iteration is supported)
+				// 1. gather high value account summaries into columns (notice two step lookup because only const iteration is supported)
 				auto highValueAddressesTuple = cache.highValueAddresses();
 				const auto& highValueAddresses = highValueAddressesTuple.Current;
-				std::vector<AccountSummary> accountSummaries;
+				AccountSummaryColumns accountSummaries;
 				accountSummaries.reserve(highValueAddresses.size());
 
-				// 2. calculate sums
 				auto importanceGrouping = m_config.ImportanceGrouping;
-				ImportanceCalculationContext context;
 				auto mosaicId = m_config.HarvestingMosaicId;
 				for (const auto& address : highValueAddresses) {
 					auto accountStateIter = cache.find(address);
 					auto& accountState = accountStateIter.get();
 					const auto& activityBuckets = accountState.ActivityBuckets;
 					auto accountActivitySummary = SummarizeAccountActivity(importanceHeight, importanceGrouping, activityBuckets);
-					accountSummaries.push_back(AccountSummary(accountActivitySummary, accountState));
-					context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + accountState.Balances.get(mosaicId);
-					context.TotalBeneficiaryCount += accountActivitySummary.BeneficiaryCount;
-					context.TotalFeesPaid = context.TotalFeesPaid + accountActivitySummary.TotalFeesPaid;
+					accountSummaries.push_back(accountActivitySummary, accountState.Balances.get(mosaicId), accountState);
 				}
 
+				// 2. calculate sums
+				auto context = CreateImportanceCalculationContext(accountSummaries);
+
 				// 3. calculate importance parts
-				Importance totalActivityImportance;
-				for (auto& accountSummary : accountSummaries) {
-					CalculateImportances(accountSummary, context, m_config);
-					totalActivityImportance = totalActivityImportance + accountSummary.ActivityImportance;
-				}
+				context = CalculateImportances(accountSummaries, context, m_config);
 
-				// 4. calculate the final importance
+				// 4. calculate the final importance and write it back to all accounts in a single pass
 				auto targetActivityImportanceRaw = m_config.TotalChainImportance.unwrap() * m_config.ImportanceActivityPercentage / 100;
-				for (auto& accountSummary : accountSummaries) {
-					auto importance = calculateFinalImportance(accountSummary, totalActivityImportance, targetActivityImportanceRaw);
-					auto& accountState = *accountSummary.pAccountState;
+				for (auto i = 0u; i < accountSummaries.size(); ++i) {
+					auto importance = calculateFinalImportance(
+							Importance(accountSummaries.StakeImportances[i]),
+							Importance(accountSummaries.ActivityImportances[i]),
+							context.TotalActivityImportance,
+							targetActivityImportanceRaw);
+					auto& accountState = *accountSummaries.AccountStates[i];
 					FinalizeAccountActivity(importanceHeight, importance, accountState.ActivityBuckets);
 					auto effectiveImportance = model::ImportanceHeight(1) == importanceHeight
 							? importance
-							: Importance(std::min(importance.unwrap(), accountSummary.ActivitySummary.PreviousImportance.unwrap()));
-					accountSummary.pAccountState->ImportanceSnapshots.set(effectiveImportance, importanceHeight);
+							: Importance(std::min(importance.unwrap(), accountSummaries.PreviousImportances[i]));
+					accountState.ImportanceSnapshots.set(effectiveImportance, importanceHeight);
 				}
 
 				CATAPULT_LOG(debug) << "recalculated importances (" << highValueAddresses.size() << " / " << cache.size() << " eligible)";
@@ -100,17 +96,18 @@ namespace catapult { namespace importance {
 
 		private:
 			Importance calculateFinalImportance(
-					const AccountSummary& accountSummary,
+					Importance stakeImportance,
+					Importance activityImportance,
 					Importance totalActivityImportance,
 					Importance::ValueType targetActivityImportanceRaw) const {
 				if (Importance() == totalActivityImportance) {
 					return 0 < m_config.ImportanceActivityPercentage
-							? Importance(accountSummary.StakeImportance.unwrap() * 100 / (100 - m_config.ImportanceActivityPercentage))
-							: accountSummary.StakeImportance;
+							? Importance(stakeImportance.unwrap() * 100 / (100 - m_config.ImportanceActivityPercentage))
+							: stakeImportance;
 				}
 
-				auto numerator = accountSummary.ActivityImportance.unwrap() * targetActivityImportanceRaw;
-				return accountSummary.StakeImportance + Importance(numerator / totalActivityImportance.unwrap());
+				auto numerator = activityImportance.unwrap() * targetActivityImportanceRaw;
+				return stakeImportance + Importance(numerator / totalActivityImportance.unwrap());
 			}
 
 		private:
@@ -23,6 +23,7 @@
 #include "catapult/state/AccountActivityBuckets.h"
 #include "catapult/state/AccountState.h"
 #include "tests/TestHarness.h"
+#include <boost/multiprecision/cpp_int.hpp>
 
 namespace catapult { namespace importance {
 
@@ -393,4 +394,218 @@ namespace catapult { namespace importance {
 	}
 
 	// endregion
+
+	// region AccountSummaryColumns
+
+	namespace {
+		AccountActivitySummary CreateActivitySummary(Amount totalFeesPaid, uint32_t beneficiaryCount, Importance previousImportance) {
+			AccountActivitySummary activitySummary;
+			activitySummary.TotalFeesPaid = totalFeesPaid;
+			activitySummary.BeneficiaryCount = beneficiaryCount;
+			activitySummary.PreviousImportance = previousImportance;
+			return activitySummary;
+		}
+	}
+
+	TEST(TEST_CLASS, AccountSummaryColumnsAreInitiallyEmpty) {
+		// Act:
+		AccountSummaryColumns summaries;
+
+		// Assert:
+		EXPECT_EQ(0u, summaries.size());
+	}
+
+	TEST(TEST_CLASS, CanAddAccountsToAccountSummaryColumns) {
+		// Arrange:
+		state::AccountState accountState1(test::GenerateRandomByteArray<Address>(), Height());
+		state::AccountState accountState2(test::GenerateRandomByteArray<Address>(), Height());
+		AccountSummaryColumns summaries;
+		summaries.reserve(2);
+
+		// Act:
+		summaries.push_back(CreateActivitySummary(Amount(11), 12, Importance(13)), Amount(14), accountState1);
+		summaries.push_back(CreateActivitySummary(Amount(21), 22, Importance(23)), Amount(24), accountState2);
+
+		// Assert:
+		EXPECT_EQ(2u, summaries.size());
+		EXPECT_EQ(std::vector<state::AccountState*>({ &accountState1, &accountState2 }), summaries.AccountStates);
+		EXPECT_EQ(std::vector<Amount::ValueType>({ 14, 24 }), summaries.Balances);
+		EXPECT_EQ(std::vector<Amount::ValueType>({ 11, 21 }), summaries.TotalFeesPaid);
+		EXPECT_EQ(std::vector<uint32_t>({ 12, 22 }), summaries.BeneficiaryCounts);
+		EXPECT_EQ(std::vector<Importance::ValueType>({ 13, 23 }), summaries.PreviousImportances);
+		EXPECT_TRUE(summaries.StakeImportances.empty());
+		EXPECT_TRUE(summaries.ActivityImportances.empty());
+	}
+
+	// endregion
+
+	// region CreateImportanceCalculationContext
+
+	TEST(TEST_CLASS, CanCreateImportanceCalculationContextFromNoAccounts) {
+		// Act:
+		auto context = CreateImportanceCalculationContext(AccountSummaryColumns());
+
+		// Assert:
+		EXPECT_EQ(Amount(), context.ActiveHarvestingMosaics);
+		EXPECT_EQ(0u, context.TotalBeneficiaryCount);
+		EXPECT_EQ(Amount(), context.TotalFeesPaid);
+		EXPECT_EQ(Importance(), context.TotalActivityImportance);
+	}
+
+	TEST(TEST_CLASS, CanCreateImportanceCalculationContextFromMultipleAccounts) {
+		// Arrange:
+		state::AccountState accountState(test::GenerateRandomByteArray<Address>(), Height());
+		AccountSummaryColumns summaries;
+		summaries.push_back(CreateActivitySummary(Amount(11), 12, Importance(13)), Amount(14), accountState);
+		summaries.push_back(CreateActivitySummary(Amount(21), 22, Importance(23)), Amount(24), accountState);
+		summaries.push_back(CreateActivitySummary(Amount(31), 32, Importance(33)), Amount(34), accountState);
+
+		// Act:
+		auto context = CreateImportanceCalculationContext(summaries);
+
+		// Assert:
+		EXPECT_EQ(Amount(14 + 24 + 34), context.ActiveHarvestingMosaics);
+		EXPECT_EQ(12u + 22 + 32, context.TotalBeneficiaryCount);
+		EXPECT_EQ(Amount(11 + 21 + 31), context.TotalFeesPaid);
+		EXPECT_EQ(Importance(), context.TotalActivityImportance);
+	}
+
+	// endregion
+
+	// region CalculateImportances (columns)
+
+	namespace {
+		// original scalar calculation using boost multiprecision arithmetic
+		std::pair<Importance, Importance> CalculateReferenceImportances(
+				Amount balance,
+				const AccountActivitySummary& activitySummary,
+				const ImportanceCalculationContext& context,
+				const model::BlockChainConfiguration& config) {
+			auto totalChainImportance = config.TotalChainImportance;
+			auto importanceActivityPercentage = config.ImportanceActivityPercentage;
+			auto minHarvesterBalance = config.MinHarvesterBalance;
+
+			boost::multiprecision::uint128_t stakeImportance = totalChainImportance.unwrap();
+			stakeImportance *= balance.unwrap();
+			stakeImportance *= (100 - importanceActivityPercentage);
+			stakeImportance /= context.ActiveHarvestingMosaics.unwrap() * 100;
+
+			boost::multiprecision::uint128_t feeImportance(0);
+			if (0 < importanceActivityPercentage && 0u < context.TotalFeesPaid.unwrap()) {
+				feeImportance = totalChainImportance.unwrap();
+				feeImportance *= activitySummary.TotalFeesPaid.unwrap();
+				feeImportance *= (importanceActivityPercentage * minHarvesterBalance.unwrap() * 8);
+				feeImportance /= context.TotalFeesPaid.unwrap() * 1'000;
+				feeImportance /= balance.unwrap();
+			}
+
+			boost::multiprecision::uint128_t beneficiaryCountImportance(0);
+			if (0 < importanceActivityPercentage && 0u < context.TotalBeneficiaryCount) {
+				beneficiaryCountImportance = totalChainImportance.unwrap();
+				beneficiaryCountImportance *= activitySummary.BeneficiaryCount;
+				beneficiaryCountImportance *= (importanceActivityPercentage * minHarvesterBalance.unwrap() * 2);
+				beneficiaryCountImportance /= context.TotalBeneficiaryCount * 1'000;
+				beneficiaryCountImportance /= balance.unwrap();
+			}
+
+			return std::make_pair(
+					Importance(static_cast<Importance::ValueType>(stakeImportance)),
+					Importance(static_cast<Importance::ValueType>(feeImportance + beneficiaryCountImportance)));
+		}
+	}
+
+	TEST(TEST_CLASS, CanCalculateImportancesOfNoAccounts) {
+		// Arrange:
+		AccountSummaryColumns summaries;
+		auto context = CreateImportanceCalculationContext(summaries);
+
+		// Act:
+		auto resultContext = CalculateImportances(summaries, context, CreateBlockChainConfiguration(25));
+
+		// Assert:
+		EXPECT_TRUE(summaries.StakeImportances.empty());
+		EXPECT_TRUE(summaries.ActivityImportances.empty());
+		EXPECT_EQ(Importance(), resultContext.TotalActivityImportance);
+	}
+
+	TEST(TEST_CLASS, CanCalculateImportancesOfMultipleAccounts) {
+		// Arrange:
+		state::AccountState accountState(test::GenerateRandomByteArray<Address>(), Height());
+		AccountSummaryColumns summaries;
+		summaries.push_back(CreateActivitySummary(Amount(200), 100, Importance()), Amount(500), accountState);
+		summaries.push_back(CreateActivitySummary(Amount(400), 200, Importance()), Amount(500), accountState);
+
+		// Act:
+		auto context = CreateImportanceCalculationContext(summaries);
+		auto resultContext = CalculateImportances(summaries, context, CreateBlockChainConfiguration(25));
+
+		// Assert:    stake importances: 9'000 * (500 / 1'000) * ((100 - 25) / 100) = 3'375
+		//         activity importances: fees (1'200, 2'400) + beneficiary counts (300, 600)
+		EXPECT_EQ(std::vector<Importance::ValueType>({ 3'375, 3'375 }), summaries.StakeImportances);
+		EXPECT_EQ(std::vector<Importance::ValueType>({ 1'500, 3'000 }), summaries.ActivityImportances);
+
+		EXPECT_EQ(Amount(1'000), resultContext.ActiveHarvestingMosaics);
+		EXPECT_EQ(300u, resultContext.TotalBeneficiaryCount);
+		EXPECT_EQ(Amount(600), resultContext.TotalFeesPaid);
+		EXPECT_EQ(Importance(4'500), resultContext.TotalActivityImportance);
+	}
+
+	TEST(TEST_CLASS, CalculateImportancesOfColumnsIsBitExactWithReferenceCalculation) {
+		// Arrange: use large random values so that intermediate results exceed 64 bits (and sometimes wrap)
+		auto config = CreateBlockChainConfiguration(15);
+		config.TotalChainImportance = Importance(8'998'999'998'000'000);
+		config.MinHarvesterBalance = Amount(10'000'000'000);
+
+		std::vector<std::unique_ptr<state::AccountState>> accountStates;
+		std::vector<AccountActivitySummary> activitySummaries;
+		AccountSummaryColumns summaries;
+		for (auto i = 0u; i < 1'000; ++i) {
+			accountStates.push_back(std::make_unique<state::AccountState>(test::GenerateRandomByteArray<Address>(), Height()));
+			activitySummaries.push_back(CreateActivitySummary(
+					Amount(test::Random() >> (test::RandomByte() % 64)),
+					static_cast<uint32_t>(test::Random()),
+					Importance()));
+			auto balance = Amount((test::Random() >> (test::RandomByte() % 56)) + 1);
+			accountStates.back()->Balances.credit(Harvesting_Mosaic_Id, balance);
+			summaries.push_back(activitySummaries.back(), balance, *accountStates.back());
+		}
+
+		auto context = CreateImportanceCalculationContext(summaries);
+
+		// Act:
+		auto resultContext = CalculateImportances(summaries, context, config);
+
+		// Assert:
+		Importance expectedTotalActivityImportance;
+		for (auto i = 0u; i < summaries.size(); ++i) {
+			auto balance = Amount(summaries.Balances[i]);
+			auto expectedImportances = CalculateReferenceImportances(balance, activitySummaries[i], context, config);
+			EXPECT_EQ(expectedImportances.first, Importance(summaries.StakeImportances[i])) << "at " << i;
+			EXPECT_EQ(expectedImportances.second, Importance(summaries.ActivityImportances[i])) << "at " << i;
+
+			// - single account calculation should also match
+			AccountSummary accountSummary(activitySummaries[i], *accountStates[i]);
+			CalculateImportances(accountSummary, context, config);
+			EXPECT_EQ(expectedImportances.first, accountSummary.StakeImportance) << "at " << i;
+			EXPECT_EQ(expectedImportances.second, accountSummary.ActivityImportance) << "at " << i;
+
+			expectedTotalActivityImportance = expectedTotalActivityImportance + expectedImportances.second;
+		}
+
+		EXPECT_EQ(expectedTotalActivityImportance, resultContext.TotalActivityImportance);
+	}
+
+	TEST(TEST_CLASS, CannotCalculateImportancesOfAccountWithZeroBalanceAndActivity) {
+		// Arrange:
+		state::AccountState accountState(test::GenerateRandomByteArray<Address>(), Height());
+		AccountSummaryColumns summaries;
+		summaries.push_back(CreateActivitySummary(Amount(200), 0, Importance()), Amount(500), accountState);
+		summaries.push_back(CreateActivitySummary(Amount(200), 0, Importance()), Amount(0), accountState);
+		auto context = CreateImportanceCalculationContext(summaries);
+
+		// Act + Assert:
+		EXPECT_THROW(CalculateImportances(summaries, context, CreateBlockChainConfiguration(25)), catapult_runtime_error);
+	}
+
+	// endregion
 }}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "TimestampedHashBucketSet.h"
 #include "catapult/cache/CacheDescriptorAdapters.h"
 #include "catapult/cache/SingleSetCacheTypesAdapter.h"
 #include "catapult/state/TimestampedHash.h"
@@ -64,7 +65,10 @@ namespace catapult { namespace cache {
 	};
 
 	/// Hash cache types.
-	struct HashCacheTypes : public SingleSetCacheTypesAdapter<ImmutableOrderedSetAdapter<HashCacheDescriptor>, std::true_type> {
+	/// \note Memory elements are bucketed by timestamp so that pruning can drop whole buckets.
+	struct HashCacheTypes : public SingleSetCacheTypesAdapter<
+			ImmutableOrderedCustomSetAdapter<HashCacheDescriptor, TimestampedHashBucketSet>,
+			std::true_type> {
 		using CacheReadOnlyType = ReadOnlySimpleCache<BasicHashCacheView, BasicHashCacheDelta, state::TimestampedHash>;
 
 		/// Custom sub view options.
@@ -0,0 +1,216 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TimestampedHashBucketSet.h"
+#include <cstring>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr size_t Filter_Bits_Per_Element = 8;
+		constexpr size_t Min_Filter_Words = 1;
+
+		std::pair<uint32_t, uint32_t> GetFilterIndexes(const state::TimestampedHash& timestampedHash, size_t numFilterBits) {
+			// hashes are uniformly distributed, so their leading bytes can be used directly as filter indexes
+			uint32_t indexes[2];
+			std::memcpy(indexes, timestampedHash.Hash.data(), sizeof(indexes));
+
+			auto mask = static_cast<uint32_t>(numFilterBits - 1);
+			return std::make_pair(indexes[0] & mask, indexes[1] & mask);
+		}
+
+		bool IsBitSet(const std::vector<uint64_t>& bits, uint32_t index) {
+			return 0 != (bits[index / 64] & (static_cast<uint64_t>(1) << (index % 64)));
+		}
+
+		void SetBit(std::vector<uint64_t>& bits, uint32_t index) {
+			bits[index / 64] |= static_cast<uint64_t>(1) << (index % 64);
+		}
+	}
+
+	// region Bucket
+
+	bool TimestampedHashBucketSet::Bucket::mayContain(const state::TimestampedHash& timestampedHash) const {
+		auto indexes = GetFilterIndexes(timestampedHash, FilterBits.size() * 64);
+		return IsBitSet(FilterBits, indexes.first) && IsBitSet(FilterBits, indexes.second);
+	}
+
+	void TimestampedHashBucketSet::Bucket::addToFilter(const state::TimestampedHash& timestampedHash) {
+		auto indexes = GetFilterIndexes(timestampedHash, FilterBits.size() * 64);
+		SetBit(FilterBits, indexes.first);
+		SetBit(FilterBits, indexes.second);
+	}
+
+	void TimestampedHashBucketSet::Bucket::reserveFilter() {
+		auto numRequiredWords = std::max<size_t>(Min_Filter_Words, (Elements.size() * Filter_Bits_Per_Element + 63) / 64);
+		if (FilterBits.size() >= numRequiredWords)
+			return;
+
+		// keep the number of filter bits a power of two so that indexes can be masked
+		auto numWords = std::max<size_t>(Min_Filter_Words, FilterBits.size());
+		while (numWords < numRequiredWords)
+			numWords *= 2;
+
+		// rebuilding also clears bits of previously erased elements
+		FilterBits.assign(numWords, 0);
+		for (const auto& element : Elements)
+			addToFilter(element);
+	}
+
+	// endregion
+
+	// region size
+
+	bool TimestampedHashBucketSet::empty() const {
+		return 0 == m_size;
+	}
+
+	size_t TimestampedHashBucketSet::size() const {
+		return m_size;
+	}
+
+	size_t TimestampedHashBucketSet::bucketCount() const {
+		return m_buckets.size();
+	}
+
+	// endregion
+
+	// region iteration / find
+
+	TimestampedHashBucketSet::const_iterator TimestampedHashBucketSet::begin() const {
+		return cbegin();
+	}
+
+	TimestampedHashBucketSet::const_iterator TimestampedHashBucketSet::end() const {
+		return cend();
+	}
+
+	TimestampedHashBucketSet::const_iterator TimestampedHashBucketSet::cbegin() const {
+		return m_buckets.empty()
+				? cend()
+				: const_iterator(m_buckets.cbegin(), m_buckets.cend(), m_buckets.cbegin()->second.Elements.cbegin());
+	}
+
+	TimestampedHashBucketSet::const_iterator TimestampedHashBucketSet::cend() const {
+		return const_iterator(m_buckets.cend(), m_buckets.cend(), BucketElements::const_iterator());
+	}
+
+	TimestampedHashBucketSet::const_iterator TimestampedHashBucketSet::find(const state::TimestampedHash& timestampedHash) const {
+		auto bucketIter = m_buckets.find(GetBucketId(timestampedHash));
+		if (m_buckets.cend() == bucketIter || !bucketIter->second.mayContain(timestampedHash))
+			return cend();
+
+		const auto& elements = bucketIter->second.Elements;
+		auto elementIter = elements.find(timestampedHash);
+		return elements.cend() == elementIter ? cend() : const_iterator(bucketIter, m_buckets.cend(), elementIter);
+	}
+
+	// endregion
+
+	// region modifiers
+
+	std::pair<TimestampedHashBucketSet::const_iterator, bool> TimestampedHashBucketSet::insert(
+			const state::TimestampedHash& timestampedHash) {
+		auto bucketIter = m_buckets.emplace(GetBucketId(timestampedHash), Bucket()).first;
+		auto& bucket = bucketIter->second;
+		auto insertResult = bucket.Elements.insert(timestampedHash);
+		if (insertResult.second) {
+			++m_size;
+			bucket.reserveFilter();
+			bucket.addToFilter(timestampedHash);
+		}
+
+		return std::make_pair(const_iterator(bucketIter, m_buckets.cend(), insertResult.first), insertResult.second);
+	}
+
+	TimestampedHashBucketSet::const_iterator TimestampedHashBucketSet::insert(
+			const_iterator,
+			const state::TimestampedHash& timestampedHash) {
+		return insert(timestampedHash).first;
+	}
+
+	TimestampedHashBucketSet::const_iterator TimestampedHashBucketSet::erase(const_iterator iter) {
+		auto bucketIter = m_buckets.erase(iter.m_bucketIter, iter.m_bucketIter); // converts to mutable iterator
+		auto& elements = bucketIter->second.Elements;
+		auto elementIter = elements.erase(iter.m_elementIter);
+		--m_size;
+
+		if (elements.cend() != elementIter)
+			return const_iterator(bucketIter, m_buckets.cend(), elementIter);
+
+		if (elements.empty())
+			bucketIter = m_buckets.erase(bucketIter);
+		else
+			++bucketIter;
+
+		return m_buckets.cend() == bucketIter
+				? cend()
+				: const_iterator(bucketIter, m_buckets.cend(), bucketIter->second.Elements.cbegin());
+	}
+
+	size_t TimestampedHashBucketSet::erase(const state::TimestampedHash& timestampedHash) {
+		auto iter = find(timestampedHash);
+		if (cend() == iter)
+			return 0;
+
+		erase(iter);
+		return 1;
+	}
+
+	void TimestampedHashBucketSet::clear() {
+		m_buckets.clear();
+		m_size = 0;
+	}
+
+	size_t TimestampedHashBucketSet::prune(const state::TimestampedHash& pruningBoundary) {
+		auto originalSize = m_size;
+
+		// drop all buckets that only contain elements less than the boundary
+		auto boundaryBucketId = GetBucketId(pruningBoundary);
+		auto boundaryBucketIter = m_buckets.lower_bound(boundaryBucketId);
+		for (auto iter = m_buckets.cbegin(); boundaryBucketIter != iter; ++iter)
+			m_size -= iter->second.Elements.size();
+
+		m_buckets.erase(m_buckets.cbegin(), boundaryBucketIter);
+
+		// partially prune the bucket containing the boundary
+		if (m_buckets.cend() != boundaryBucketIter && boundaryBucketId == boundaryBucketIter->first) {
+			auto& elements = boundaryBucketIter->second.Elements;
+			auto elementsSize = elements.size();
+			elements.erase(elements.cbegin(), elements.lower_bound(pruningBoundary));
+			m_size -= elementsSize - elements.size();
+
+			if (elements.empty())
+				m_buckets.erase(boundaryBucketIter);
+		}
+
+		return originalSize - m_size;
+	}
+
+	uint64_t TimestampedHashBucketSet::GetBucketId(const state::TimestampedHash& timestampedHash) {
+		return timestampedHash.Time.unwrap() >> Bucket_Timestamp_Shift;
+	}
+
+	// endregion
+
+	void PruneBaseSet(TimestampedHashBucketSet& elements, const deltaset::PruningBoundary<state::TimestampedHash>& pruningBoundary) {
+		elements.prune(pruningBoundary.value());
+	}
+}}
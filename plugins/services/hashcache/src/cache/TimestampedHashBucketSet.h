@@ -0,0 +1,224 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/deltaset/PruningBoundary.h"
+#include "catapult/state/TimestampedHash.h"
+#include "catapult/utils/traits/StlTraits.h"
+#include <map>
+#include <set>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Ordered set of timestamped hashes that is partitioned into buckets spanning consecutive timestamp ranges.
+	/// \note Each bucket has a membership filter indexed by hash so that most lookups of unknown hashes never probe the bucket.
+	class TimestampedHashBucketSet {
+	public:
+		/// Number of low timestamp bits spanned by a single bucket (bucket covers ~65 seconds).
+		static constexpr uint32_t Bucket_Timestamp_Shift = 16;
+
+	private:
+		using BucketElements = std::set<state::TimestampedHash>;
+
+		struct Bucket {
+		public:
+			/// Bucket elements.
+			BucketElements Elements;
+
+			/// Membership filter bits.
+			std::vector<uint64_t> FilterBits;
+
+		public:
+			/// Returns \c true if the filter indicates \a timestampedHash might be contained in this bucket.
+			bool mayContain(const state::TimestampedHash& timestampedHash) const;
+
+			/// Adds \a timestampedHash to the filter.
+			void addToFilter(const state::TimestampedHash& timestampedHash);
+
+			/// Grows and rebuilds the filter when it is too small for the number of elements.
+			void reserveFilter();
+		};
+
+		using Buckets = std::map<uint64_t, Bucket>;
+
+	public:
+		using value_type = state::TimestampedHash;
+		using key_type = state::TimestampedHash;
+		using key_compare = std::less<state::TimestampedHash>;
+		using size_type = size_t;
+
+		/// Const iterator that visits all elements in order.
+		class const_iterator {
+		public:
+			using difference_type = std::ptrdiff_t;
+			using value_type = const state::TimestampedHash;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using iterator_category = std::forward_iterator_tag;
+
+		public:
+			/// Creates an uninitialized iterator.
+			const_iterator() = default;
+
+			/// Creates an iterator pointing to \a elementIter in \a bucketIter given end bucket iterator \a bucketEnd.
+			const_iterator(
+					Buckets::const_iterator bucketIter,
+					Buckets::const_iterator bucketEnd,
+					BucketElements::const_iterator elementIter)
+					: m_bucketIter(bucketIter)
+					, m_bucketEnd(bucketEnd)
+					, m_elementIter(elementIter)
+			{}
+
+		public:
+			/// Returns \c true if this iterator and \a rhs are equal.
+			bool operator==(const const_iterator& rhs) const {
+				return m_bucketIter == rhs.m_bucketIter && (m_bucketIter == m_bucketEnd || m_elementIter == rhs.m_elementIter);
+			}
+
+			/// Returns \c true if this iterator and \a rhs are not equal.
+			bool operator!=(const const_iterator& rhs) const {
+				return !(*this == rhs);
+			}
+
+		public:
+			/// Advances the iterator to the next position.
+			const_iterator& operator++() {
+				if (m_bucketIter->second.Elements.cend() == ++m_elementIter) {
+					if (m_bucketEnd != ++m_bucketIter)
+						m_elementIter = m_bucketIter->second.Elements.cbegin();
+				}
+
+				return *this;
+			}
+
+			/// Advances the iterator to the next position.
+			const_iterator operator++(int) {
+				auto copy = *this;
+				++*this;
+				return copy;
+			}
+
+		public:
+			/// Gets a reference to the current element.
+			reference operator*() const {
+				return *m_elementIter;
+			}
+
+			/// Gets a pointer to the current element.
+			pointer operator->() const {
+				return &*m_elementIter;
+			}
+
+		private:
+			Buckets::const_iterator m_bucketIter;
+			Buckets::const_iterator m_bucketEnd;
+			BucketElements::const_iterator m_elementIter;
+
+		private:
+			friend class TimestampedHashBucketSet;
+		};
+
+		using iterator = const_iterator;
+
+	public:
+		/// Gets a value indicating whether or not this set is empty.
+		bool empty() const;
+
+		/// Gets the size of this set.
+		size_t size() const;
+
+		/// Gets the number of buckets in this set.
+		size_t bucketCount() const;
+
+	public:
+		/// Gets a const iterator to the first element of this set.
+		const_iterator begin() const;
+
+		/// Gets a const iterator to the element following the last element of this set.
+		const_iterator end() const;
+
+		/// Gets a const iterator to the first element of this set.
+		const_iterator cbegin() const;
+
+		/// Gets a const iterator to the element following the last element of this set.
+		const_iterator cend() const;
+
+		/// Searches for \a timestampedHash in this set.
+		const_iterator find(const state::TimestampedHash& timestampedHash) const;
+
+	public:
+		/// Inserts \a timestampedHash into this set.
+		std::pair<const_iterator, bool> insert(const state::TimestampedHash& timestampedHash);
+
+		/// Inserts \a timestampedHash into this set.
+		/// \note Hint is ignored because bucket placement is determined by timestamp.
+		const_iterator insert(const_iterator, const state::TimestampedHash& timestampedHash);
+
+		/// Inserts all elements in the range [\a first, \a last) into this set.
+		template<typename TInputIterator>
+		void insert(TInputIterator first, TInputIterator last) {
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+		/// Creates an element around \a args and inserts it into this set.
+		template<typename... TArgs>
+		std::pair<const_iterator, bool> emplace(TArgs&&... args) {
+			return insert(state::TimestampedHash(std::forward<TArgs>(args)...));
+		}
+
+		/// Removes the element pointed to by \a iter from this set.
+		const_iterator erase(const_iterator iter);
+
+		/// Removes \a timestampedHash from this set.
+		size_t erase(const state::TimestampedHash& timestampedHash);
+
+		/// Removes all elements from this set.
+		void clear();
+
+		/// Removes all elements less than \a pruningBoundary and returns the number of removed elements.
+		/// \note Buckets that are completely below the boundary are dropped as a whole.
+		size_t prune(const state::TimestampedHash& pruningBoundary);
+
+	private:
+		static uint64_t GetBucketId(const state::TimestampedHash& timestampedHash);
+
+	private:
+		Buckets m_buckets;
+		size_t m_size = 0;
+	};
+
+	/// Optionally prunes \a elements using \a pruningBoundary, which indicates the upper bound of elements to remove.
+	/// \note Specialization for TimestampedHashBucketSet.
+	void PruneBaseSet(TimestampedHashBucketSet& elements, const deltaset::PruningBoundary<state::TimestampedHash>& pruningBoundary);
+}}
+
+namespace catapult { namespace utils { namespace traits {
+
+	/// TimestampedHashBucketSet iterates its elements in order.
+	template<>
+	struct is_ordered<cache::TimestampedHashBucketSet> : std::true_type {};
+
+	/// TimestampedHashBucketSet iterates its elements in order.
+	template<>
+	struct is_ordered<const cache::TimestampedHashBucketSet> : std::true_type {};
+}}}
@@ -119,5 +119,33 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(state::TimestampedHash::HashType(), pruningBoundary.value().Hash);
 	}
 
+	TEST(TEST_CLASS, CommitPrunesElementsBelowPruningBoundary) {
+		// Arrange: spread elements across multiple hours
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(2));
+		std::vector<state::TimestampedHash> timestampedHashes;
+		{
+			auto delta = cache.createDelta();
+			for (auto i = 0u; i < 10; ++i) {
+				timestampedHashes.emplace_back(Timestamp(i * 30 * 60 * 1000 + 1), test::GenerateRandomByteArray<Hash256>());
+				delta->insert(timestampedHashes.back());
+			}
+
+			cache.commit();
+		}
+
+		// Act: prune at 4h 1ms (pruning boundary at 2h 1ms)
+		{
+			auto delta = cache.createDelta();
+			delta->prune(Timestamp(4 * 60 * 60 * 1000 + 1));
+			cache.commit();
+		}
+
+		// Assert: only elements with timestamps at or after boundary remain
+		auto view = cache.createView();
+		EXPECT_EQ(6u, view->size());
+		for (auto i = 0u; i < 10; ++i)
+			EXPECT_EQ(i >= 4, view->contains(timestampedHashes[i])) << i;
+	}
+
 	// endregion
 }}
@@ -0,0 +1,300 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/TimestampedHashBucketSet.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS TimestampedHashBucketSetTests
+
+	namespace {
+		constexpr uint64_t Bucket_Duration = 1ull << TimestampedHashBucketSet::Bucket_Timestamp_Shift;
+
+		state::TimestampedHash CreateTimestampedHash(uint64_t timestamp, uint8_t id) {
+			return state::TimestampedHash(Timestamp(timestamp), Hash256{ { id } });
+		}
+
+		state::TimestampedHash CreateRandomTimestampedHash(uint64_t timestamp) {
+			return state::TimestampedHash(Timestamp(timestamp), test::GenerateRandomByteArray<Hash256>());
+		}
+
+		std::vector<state::TimestampedHash> CreateSeedElements() {
+			// three elements in bucket 1, one element in bucket 2 and two elements in bucket 4
+			return {
+				CreateTimestampedHash(Bucket_Duration + 5, 1),
+				CreateTimestampedHash(Bucket_Duration + 5, 2),
+				CreateTimestampedHash(Bucket_Duration + 100, 1),
+				CreateTimestampedHash(2 * Bucket_Duration, 3),
+				CreateTimestampedHash(4 * Bucket_Duration + 1, 4),
+				CreateTimestampedHash(5 * Bucket_Duration - 1, 5)
+			};
+		}
+
+		TimestampedHashBucketSet CreateSeededSet() {
+			auto elements = CreateSeedElements();
+
+			// insert in reverse order to check that insertion order does not affect iteration order
+			TimestampedHashBucketSet set;
+			set.insert(elements.crbegin(), elements.crend());
+			return set;
+		}
+
+		void AssertElements(const std::vector<state::TimestampedHash>& expected, const TimestampedHashBucketSet& set) {
+			std::vector<state::TimestampedHash> actual(set.cbegin(), set.cend());
+			EXPECT_EQ(expected.size(), set.size());
+			EXPECT_EQ(expected, actual);
+		}
+	}
+
+	// region ctor / insert
+
+	TEST(TEST_CLASS, CanCreateEmptySet) {
+		// Act:
+		TimestampedHashBucketSet set;
+
+		// Assert:
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(0u, set.size());
+		EXPECT_EQ(0u, set.bucketCount());
+		EXPECT_EQ(set.cend(), set.cbegin());
+	}
+
+	TEST(TEST_CLASS, CanInsertElementsIntoBuckets) {
+		// Act:
+		auto set = CreateSeededSet();
+
+		// Assert: iteration visits all elements in order across buckets
+		EXPECT_FALSE(set.empty());
+		EXPECT_EQ(3u, set.bucketCount());
+		AssertElements(CreateSeedElements(), set);
+	}
+
+	TEST(TEST_CLASS, CannotInsertDuplicateElement) {
+		// Arrange:
+		auto set = CreateSeededSet();
+
+		// Act:
+		auto result = set.insert(CreateTimestampedHash(Bucket_Duration + 100, 1));
+
+		// Assert:
+		EXPECT_FALSE(result.second);
+		EXPECT_EQ(CreateTimestampedHash(Bucket_Duration + 100, 1), *result.first);
+		AssertElements(CreateSeedElements(), set);
+	}
+
+	TEST(TEST_CLASS, InsertReturnsIteratorToInsertedElement) {
+		// Arrange:
+		auto set = CreateSeededSet();
+
+		// Act:
+		auto result = set.insert(CreateTimestampedHash(Bucket_Duration + 50, 7));
+
+		// Assert:
+		EXPECT_TRUE(result.second);
+		EXPECT_EQ(CreateTimestampedHash(Bucket_Duration + 50, 7), *result.first);
+		EXPECT_EQ(CreateTimestampedHash(Bucket_Duration + 100, 1), *++result.first);
+		EXPECT_EQ(7u, set.size());
+		EXPECT_EQ(3u, set.bucketCount());
+	}
+
+	// endregion
+
+	// region find
+
+	TEST(TEST_CLASS, CanFindContainedElements) {
+		// Arrange:
+		auto set = CreateSeededSet();
+
+		// Act + Assert:
+		for (const auto& element : CreateSeedElements()) {
+			auto iter = set.find(element);
+			ASSERT_NE(set.cend(), iter) << element;
+			EXPECT_EQ(element, *iter);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotFindUncontainedElements) {
+		// Arrange:
+		auto set = CreateSeededSet();
+
+		// Act + Assert: check unknown hash in known bucket, unknown timestamp in known bucket and unknown bucket
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(Bucket_Duration + 5, 3)));
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(Bucket_Duration + 6, 1)));
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(3 * Bucket_Duration, 1)));
+	}
+
+	TEST(TEST_CLASS, FindIsAccurateWhenBucketContainsManyElements) {
+		// Arrange: force the bucket filter to grow multiple times
+		TimestampedHashBucketSet set;
+		std::vector<state::TimestampedHash> elements;
+		for (auto i = 0u; i < 1000; ++i) {
+			elements.push_back(CreateRandomTimestampedHash(Bucket_Duration + i));
+			set.insert(elements.back());
+		}
+
+		// Act + Assert:
+		EXPECT_EQ(1000u, set.size());
+		EXPECT_EQ(1u, set.bucketCount());
+		for (const auto& element : elements)
+			EXPECT_NE(set.cend(), set.find(element)) << element;
+
+		for (auto i = 0u; i < 1000; ++i)
+			EXPECT_EQ(set.cend(), set.find(CreateRandomTimestampedHash(Bucket_Duration + i)));
+	}
+
+	// endregion
+
+	// region erase
+
+	TEST(TEST_CLASS, CanEraseContainedElement) {
+		// Arrange:
+		auto set = CreateSeededSet();
+
+		// Act:
+		auto numErased = set.erase(CreateTimestampedHash(Bucket_Duration + 5, 2));
+
+		// Assert:
+		EXPECT_EQ(1u, numErased);
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(Bucket_Duration + 5, 2)));
+
+		auto expectedElements = CreateSeedElements();
+		expectedElements.erase(expectedElements.cbegin() + 1);
+		AssertElements(expectedElements, set);
+	}
+
+	TEST(TEST_CLASS, EraseOfUncontainedElementHasNoEffect) {
+		// Arrange:
+		auto set = CreateSeededSet();
+
+		// Act:
+		auto numErased = set.erase(CreateTimestampedHash(Bucket_Duration + 5, 3));
+
+		// Assert:
+		EXPECT_EQ(0u, numErased);
+		AssertElements(CreateSeedElements(), set);
+	}
+
+	TEST(TEST_CLASS, EraseOfLastBucketElementRemovesBucket) {
+		// Arrange:
+		auto set = CreateSeededSet();
+
+		// Act:
+		auto iter = set.erase(set.find(CreateTimestampedHash(2 * Bucket_Duration, 3)));
+
+		// Assert: iterator points to first element in next bucket
+		ASSERT_NE(set.cend(), iter);
+		EXPECT_EQ(CreateTimestampedHash(4 * Bucket_Duration + 1, 4), *iter);
+		EXPECT_EQ(2u, set.bucketCount());
+
+		auto expectedElements = CreateSeedElements();
+		expectedElements.erase(expectedElements.cbegin() + 3);
+		AssertElements(expectedElements, set);
+	}
+
+	TEST(TEST_CLASS, EraseReturnsIteratorToNextElement) {
+		// Arrange:
+		auto set = CreateSeededSet();
+
+		// Act: erase elements at end of bucket, in middle of bucket and at end of set
+		auto iter1 = set.erase(set.find(CreateTimestampedHash(Bucket_Duration + 100, 1)));
+		auto iter2 = set.erase(set.find(CreateTimestampedHash(Bucket_Duration + 5, 1)));
+		auto iter3 = set.erase(set.find(CreateTimestampedHash(5 * Bucket_Duration - 1, 5)));
+
+		// Assert:
+		EXPECT_EQ(CreateTimestampedHash(2 * Bucket_Duration, 3), *iter1);
+		EXPECT_EQ(CreateTimestampedHash(Bucket_Duration + 5, 2), *iter2);
+		EXPECT_EQ(set.cend(), iter3);
+		EXPECT_EQ(3u, set.size());
+		EXPECT_EQ(3u, set.bucketCount());
+	}
+
+	TEST(TEST_CLASS, CanClearSet) {
+		// Arrange:
+		auto set = CreateSeededSet();
+
+		// Act:
+		set.clear();
+
+		// Assert:
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(0u, set.bucketCount());
+		AssertElements({}, set);
+	}
+
+	// endregion
+
+	// region prune
+
+	namespace {
+		void AssertPrune(uint64_t boundaryTimestamp, size_t numExpectedPruned, size_t numExpectedBuckets) {
+			// Arrange:
+			auto set = CreateSeededSet();
+
+			// Act:
+			auto numPruned = set.prune(state::TimestampedHash(Timestamp(boundaryTimestamp)));
+
+			// Assert:
+			EXPECT_EQ(numExpectedPruned, numPruned) << boundaryTimestamp;
+			EXPECT_EQ(numExpectedBuckets, set.bucketCount()) << boundaryTimestamp;
+
+			auto expectedElements = CreateSeedElements();
+			expectedElements.erase(expectedElements.cbegin(), expectedElements.cbegin() + static_cast<long>(numExpectedPruned));
+			AssertElements(expectedElements, set);
+		}
+	}
+
+	TEST(TEST_CLASS, PruneHasNoEffectWhenBoundaryIsBelowAllElements) {
+		AssertPrune(0, 0, 3);
+		AssertPrune(Bucket_Duration + 5, 0, 3);
+	}
+
+	TEST(TEST_CLASS, PruneCanRemovePartialBucket) {
+		AssertPrune(Bucket_Duration + 6, 2, 3);
+		AssertPrune(4 * Bucket_Duration + 2, 5, 1);
+	}
+
+	TEST(TEST_CLASS, PruneCanRemoveWholeBuckets) {
+		AssertPrune(Bucket_Duration + 101, 3, 2);
+		AssertPrune(3 * Bucket_Duration, 4, 1);
+		AssertPrune(4 * Bucket_Duration, 4, 1);
+	}
+
+	TEST(TEST_CLASS, PruneCanRemoveAllElements) {
+		AssertPrune(5 * Bucket_Duration, 6, 0);
+		AssertPrune(100 * Bucket_Duration, 6, 0);
+	}
+
+	TEST(TEST_CLASS, PruneBaseSetDelegatesToPrune) {
+		// Arrange:
+		auto set = CreateSeededSet();
+
+		// Act:
+		PruneBaseSet(set, deltaset::PruningBoundary<state::TimestampedHash>(state::TimestampedHash(Timestamp(3 * Bucket_Duration))));
+
+		// Assert:
+		auto expectedElements = CreateSeedElements();
+		expectedElements.erase(expectedElements.cbegin(), expectedElements.cbegin() + 4);
+		AssertElements(expectedElements, set);
+	}
+
+	// endregion
+}}
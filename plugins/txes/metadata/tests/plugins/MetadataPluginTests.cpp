@@ -57,7 +57,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<ionet::PacketType> GetNonDiagnosticPacketTypes() {
-				return { ionet::PacketType::Metadata_State_Path };
+				return { ionet::PacketType::Metadata_State_Path, ionet::PacketType::Metadata_State_Paths };
 			}
 
 			static std::vector<ionet::PacketType> GetDiagnosticPacketTypes() {
@@ -81,6 +81,23 @@ namespace catapult { namespace extensions {
 			}
 		};
 
+		struct ActiveNodeTrafficTraits {
+		public:
+			using ResultType = model::EntityRange<ionet::PackedNodeTraffic>;
+			static constexpr auto Packet_Type = ionet::PacketType::Active_Node_Traffic;
+			static constexpr auto Friendly_Name = "active node traffic";
+
+			static auto CreateRequestPacketPayload() {
+				return ionet::PacketPayload(Packet_Type);
+			}
+
+		public:
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				result = ionet::ExtractFixedSizeStructuresFromPacket<ionet::PackedNodeTraffic>(packet);
+				return !result.empty() || sizeof(ionet::PacketHeader) == packet.Size;
+			}
+		};
+
 		struct UnlockedAccountsTraits {
 		public:
 			using ResultType = model::EntityRange<Key>;
@@ -162,6 +179,10 @@ namespace catapult { namespace extensions {
 				return m_impl.dispatch(ActiveNodeInfosTraits());
 			}
 
+			FutureType<ActiveNodeTrafficTraits> activeNodeTraffic() const override {
+				return m_impl.dispatch(ActiveNodeTrafficTraits());
+			}
+
 			FutureType<UnlockedAccountsTraits> unlockedAccounts() const override {
 				return m_impl.dispatch(UnlockedAccountsTraits());
 			}
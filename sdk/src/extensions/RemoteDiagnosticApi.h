@@ -51,6 +51,9 @@ namespace catapult { namespace extensions {
 		/// Gets the node infos for all active nodes
 		virtual future<model::EntityRange<ionet::PackedNodeInfo>> activeNodeInfos() const = 0;
 
+		/// Gets the traffic read from all active nodes.
+		virtual future<model::EntityRange<ionet::PackedNodeTraffic>> activeNodeTraffic() const = 0;
+
 		/// Gets the current unlocked accounts.
 		virtual future<model::EntityRange<Key>> unlockedAccounts() const = 0;
 
@@ -195,6 +195,43 @@ namespace catapult { namespace extensions {
 
 		// endregion
 
+		// region ActiveNodeTrafficTraits
+
+		struct ActiveNodeTrafficTraits {
+			static constexpr auto Packet_Type = ionet::PacketType::Active_Node_Traffic;
+			static constexpr auto Num_Node_Traffics = 3u;
+
+			static auto Invoke(const RemoteDiagnosticApi& api) {
+				return api.activeNodeTraffic();
+			}
+
+			static auto CreateValidResponsePacket() {
+				uint32_t payloadSize = Num_Node_Traffics * sizeof(ionet::PackedNodeTraffic);
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = Packet_Type;
+				test::FillWithRandomData({ pResponsePacket->Data(), payloadSize });
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// just change the size because no responses are intrinsically invalid
+				auto pResponsePacket = CreateValidResponsePacket();
+				--pResponsePacket->Size;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_TRUE(ionet::IsPacketValid(packet, Packet_Type));
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const model::EntityRange<ionet::PackedNodeTraffic>& nodeTraffics) {
+				ASSERT_EQ(static_cast<uint32_t>(Num_Node_Traffics), nodeTraffics.size());
+				EXPECT_EQ_MEMORY(response.Data(), nodeTraffics.data(), Num_Node_Traffics * sizeof(ionet::PackedNodeTraffic));
+			}
+		};
+
+		// endregion
+
 		// region UnlockedAccountsTraits
 
 		struct UnlockedAccountsTraits {
@@ -434,6 +471,7 @@ namespace catapult { namespace extensions {
 
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, DiagnosticCounters)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, ActiveNodeInfos)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteDiagnosticApi, ActiveNodeTraffic)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, UnlockedAccounts)
 
 	using DiagnosticAccountInfosTraits = DiagnosticApiTraits<AccountInfosTraits>;
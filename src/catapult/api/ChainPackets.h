@@ -67,5 +67,18 @@ namespace catapult { namespace api {
 		uint32_t NumResponseBytes;
 	};
 
+	/// Compact block request.
+	/// \note Packet is followed by a block header, short hashes of all block transactions, indexes of prefilled transactions
+	///       and prefilled transactions.
+	struct CompactBlockRequest : public ionet::Packet {
+		static constexpr ionet::PacketType Packet_Type = ionet::PacketType::Compact_Block;
+
+		/// Number of block transactions.
+		uint32_t TransactionsCount;
+
+		/// Number of prefilled transactions.
+		uint32_t PrefilledTransactionsCount;
+	};
+
 #pragma pack(pop)
 }}
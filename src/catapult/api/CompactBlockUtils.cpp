@@ -0,0 +1,146 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "CompactBlockUtils.h"
+#include "ChainPackets.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/model/EntityHasher.h"
+#include "catapult/model/TransactionPlugin.h"
+
+namespace catapult { namespace api {
+
+	ionet::PacketPayload CreateCompactBlockPayload(
+			const std::shared_ptr<const model::Block>& pBlock,
+			const std::vector<utils::ShortHash>& shortHashes,
+			const std::vector<uint32_t>& prefilledIndexes) {
+		std::vector<std::shared_ptr<const model::Transaction>> prefilledTransactions;
+		auto prefilledIndexesIter = prefilledIndexes.cbegin();
+		auto index = 0u;
+		for (const auto& transaction : pBlock->Transactions()) {
+			if (prefilledIndexes.cend() == prefilledIndexesIter)
+				break;
+
+			// share ownership with the block instead of copying the transaction
+			if (index++ == *prefilledIndexesIter) {
+				prefilledTransactions.push_back(std::shared_ptr<const model::Transaction>(pBlock, &transaction));
+				++prefilledIndexesIter;
+			}
+		}
+
+		const auto* pBlockHeaderData = reinterpret_cast<const uint8_t*>(pBlock.get());
+		ionet::PacketPayloadBuilder builder(CompactBlockRequest::Packet_Type);
+		builder.appendValue(static_cast<uint32_t>(shortHashes.size()));
+		builder.appendValue(static_cast<uint32_t>(prefilledTransactions.size()));
+		builder.appendValues(std::vector<uint8_t>(pBlockHeaderData, pBlockHeaderData + sizeof(model::BlockHeader)));
+		builder.appendValues(shortHashes);
+		builder.appendValues(std::vector<uint32_t>(prefilledIndexes.cbegin(), prefilledIndexes.cbegin() + prefilledTransactions.size()));
+		builder.appendEntities(prefilledTransactions);
+		return builder.build();
+	}
+
+	namespace {
+		template<typename T>
+		const T* Advance(const uint8_t*& pData, size_t count) {
+			const auto* pValues = reinterpret_cast<const T*>(pData);
+			pData += count * sizeof(T);
+			return pValues;
+		}
+
+		bool AreIndexesValid(const std::vector<uint32_t>& indexes, size_t maxIndex) {
+			for (auto i = 0u; i < indexes.size(); ++i) {
+				if (indexes[i] >= maxIndex || (0 < i && indexes[i - 1] >= indexes[i]))
+					return false;
+			}
+
+			return true;
+		}
+	}
+
+	bool TryParseCompactBlock(const ionet::Packet& packet, const model::TransactionRegistry& registry, CompactBlock& compactBlock) {
+		if (CompactBlockRequest::Packet_Type != packet.Type || packet.Size < sizeof(CompactBlockRequest))
+			return false;
+
+		const auto* pRequest = static_cast<const CompactBlockRequest*>(&packet);
+
+		// check that all fixed size data is present
+		uint64_t fixedDataSize = sizeof(model::BlockHeader);
+		fixedDataSize += static_cast<uint64_t>(pRequest->TransactionsCount) * sizeof(utils::ShortHash);
+		fixedDataSize += static_cast<uint64_t>(pRequest->PrefilledTransactionsCount) * sizeof(uint32_t);
+		auto dataSize = pRequest->Size - sizeof(CompactBlockRequest);
+		if (dataSize < fixedDataSize || pRequest->PrefilledTransactionsCount > pRequest->TransactionsCount)
+			return false;
+
+		const auto* pData = reinterpret_cast<const uint8_t*>(pRequest + 1);
+		const auto* pDataEnd = pData + dataSize;
+		compactBlock.pBlockHeader = Advance<model::BlockHeader>(pData, 1);
+		if (compactBlock.pBlockHeader->Size < sizeof(model::BlockHeader))
+			return false;
+
+		const auto* pShortHashes = Advance<utils::ShortHash>(pData, pRequest->TransactionsCount);
+		compactBlock.ShortHashes.assign(pShortHashes, pShortHashes + pRequest->TransactionsCount);
+
+		const auto* pPrefilledIndexes = Advance<uint32_t>(pData, pRequest->PrefilledTransactionsCount);
+		compactBlock.PrefilledIndexes.assign(pPrefilledIndexes, pPrefilledIndexes + pRequest->PrefilledTransactionsCount);
+		if (!AreIndexesValid(compactBlock.PrefilledIndexes, pRequest->TransactionsCount))
+			return false;
+
+		// prefilled transactions are variable sized and must exactly fill the remainder of the packet
+		compactBlock.PrefilledTransactions.clear();
+		for (auto i = 0u; i < pRequest->PrefilledTransactionsCount; ++i) {
+			auto remainingSize = static_cast<size_t>(pDataEnd - pData);
+			if (remainingSize < sizeof(model::Transaction))
+				return false;
+
+			const auto* pTransaction = reinterpret_cast<const model::Transaction*>(pData);
+			if (remainingSize < pTransaction->Size || !IsSizeValid(*pTransaction, registry))
+				return false;
+
+			compactBlock.PrefilledTransactions.push_back(pTransaction);
+			pData += pTransaction->Size;
+		}
+
+		return pDataEnd == pData;
+	}
+
+	Hash256 CalculateBlockTransactionsHash(
+			const model::Block& block,
+			const model::TransactionRegistry& registry,
+			const GenerationHash& generationHash) {
+		std::vector<model::TransactionInfo> transactionInfos;
+		for (const auto& transaction : block.Transactions()) {
+			const auto& plugin = *registry.findPlugin(transaction.Type);
+			auto entityHash = model::CalculateHash(transaction, generationHash, plugin.dataBuffer(transaction));
+
+			// the hash only depends on merkle component hashes, so the entity does not need to be owned
+			model::TransactionInfo transactionInfo(nullptr, entityHash);
+			transactionInfo.MerkleComponentHash = model::CalculateMerkleComponentHash(transaction, entityHash, registry);
+			transactionInfos.push_back(std::move(transactionInfo));
+		}
+
+		std::vector<const model::TransactionInfo*> transactionInfoPointers;
+		for (const auto& transactionInfo : transactionInfos)
+			transactionInfoPointers.push_back(&transactionInfo);
+
+		Hash256 transactionsHash;
+		model::CalculateBlockTransactionsHash(transactionInfoPointers, transactionsHash);
+		return transactionsHash;
+	}
+}}
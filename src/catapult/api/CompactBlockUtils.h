@@ -0,0 +1,64 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/ionet/PacketPayload.h"
+#include "catapult/model/Block.h"
+#include "catapult/utils/ShortHash.h"
+#include <vector>
+
+namespace catapult { namespace api {
+
+	/// Compact representation of a block.
+	/// \note All pointers reference memory owned by the packet from which the compact block was parsed.
+	struct CompactBlock {
+		/// Block header.
+		const model::BlockHeader* pBlockHeader = nullptr;
+
+		/// Short hashes of all block transactions.
+		std::vector<utils::ShortHash> ShortHashes;
+
+		/// Indexes of prefilled transactions.
+		std::vector<uint32_t> PrefilledIndexes;
+
+		/// Prefilled transactions.
+		std::vector<const model::Transaction*> PrefilledTransactions;
+	};
+
+	/// Creates a compact block payload for \a pBlock with transaction short hashes (\a shortHashes) that prefills
+	/// the transactions at \a prefilledIndexes.
+	/// \note \a prefilledIndexes must be sorted.
+	ionet::PacketPayload CreateCompactBlockPayload(
+			const std::shared_ptr<const model::Block>& pBlock,
+			const std::vector<utils::ShortHash>& shortHashes,
+			const std::vector<uint32_t>& prefilledIndexes);
+
+	/// Tries to parse a compact block from \a packet into \a compactBlock given transaction \a registry
+	/// composed of known transactions.
+	bool TryParseCompactBlock(const ionet::Packet& packet, const model::TransactionRegistry& registry, CompactBlock& compactBlock);
+
+	/// Calculates the transactions hash of all transactions in \a block given transaction \a registry and the network
+	/// \a generationHash.
+	/// \note This is used to detect reconstructed blocks with transactions that only share short hashes with the originals.
+	Hash256 CalculateBlockTransactionsHash(
+			const model::Block& block,
+			const model::TransactionRegistry& registry,
+			const GenerationHash& generationHash);
+}}
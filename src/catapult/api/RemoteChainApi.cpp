@@ -20,6 +20,7 @@
 
 #include "RemoteChainApi.h"
 #include "ChainPackets.h"
+#include "CompactBlockUtils.h"
 #include "RemoteApiUtils.h"
 #include "RemoteRequestDispatcher.h"
 #include "catapult/ionet/PacketEntityUtils.h"
@@ -115,6 +116,26 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct CompactBlockTraits {
+		public:
+			using ResultType = model::EntityRange<uint32_t>;
+			static constexpr auto Packet_Type = ionet::PacketType::Compact_Block;
+			static constexpr auto Friendly_Name = "compact block";
+
+			static auto CreateRequestPacketPayload(
+					const std::shared_ptr<const model::Block>& pBlock,
+					const std::vector<utils::ShortHash>& shortHashes,
+					const std::vector<uint32_t>& prefilledIndexes) {
+				return CreateCompactBlockPayload(pBlock, shortHashes, prefilledIndexes);
+			}
+
+		public:
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				result = ionet::ExtractFixedSizeStructuresFromPacket<uint32_t>(packet);
+				return !result.empty() || sizeof(ionet::PacketHeader) == packet.Size;
+			}
+		};
+
 		// endregion
 
 		class DefaultRemoteChainApi : public RemoteChainApi {
@@ -153,6 +174,13 @@ namespace catapult { namespace api {
 				return m_impl.dispatch(BlocksFromTraits(*m_pRegistry), height, options);
 			}
 
+			FutureType<CompactBlockTraits> compactBlock(
+					const std::shared_ptr<const model::Block>& pBlock,
+					const std::vector<utils::ShortHash>& shortHashes,
+					const std::vector<uint32_t>& prefilledIndexes) const override {
+				return m_impl.dispatch(CompactBlockTraits(), pBlock, shortHashes, prefilledIndexes);
+			}
+
 		private:
 			const model::TransactionRegistry* m_pRegistry;
 			mutable RemoteRequestDispatcher m_impl;
@@ -21,6 +21,7 @@
 #pragma once
 #include "ChainApi.h"
 #include "RemoteApi.h"
+#include "catapult/utils/ShortHash.h"
 
 namespace catapult {
 	namespace ionet { class PacketIo; }
@@ -66,6 +67,14 @@ namespace catapult { namespace api {
 		/// Gets the blocks starting at \a height with the specified \a options.
 		/// \note An empty range will be returned if remote chain height is less than \a height.
 		virtual thread::future<model::BlockRange> blocksFrom(Height height, const BlocksFromOptions& options) const = 0;
+
+		/// Pushes \a pBlock as a compact block composed of transaction short hashes (\a shortHashes) and the transactions at
+		/// \a prefilledIndexes and gets the indexes of all transactions that could not be reconstructed.
+		/// \note An empty range will be returned if the block was reconstructed.
+		virtual thread::future<model::EntityRange<uint32_t>> compactBlock(
+				const std::shared_ptr<const model::Block>& pBlock,
+				const std::vector<utils::ShortHash>& shortHashes,
+				const std::vector<uint32_t>& prefilledIndexes) const = 0;
 	};
 
 	/// Creates a chain api for interacting with a remote node with the specified \a io.
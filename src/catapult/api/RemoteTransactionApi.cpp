@@ -51,6 +51,23 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct TransactionInventoryTraits {
+		public:
+			using ResultType = model::HashRange;
+			static constexpr auto Packet_Type = ionet::PacketType::Transaction_Inventory;
+			static constexpr auto Friendly_Name = "transaction inventory";
+
+			static auto CreateRequestPacketPayload(model::AnnouncedTransactionRange&& transactions) {
+				return ionet::PacketPayloadFactory::FromFixedSizeRange(Packet_Type, std::move(transactions));
+			}
+
+		public:
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				result = ionet::ExtractFixedSizeStructuresFromPacket<Hash256>(packet);
+				return !result.empty() || sizeof(ionet::PacketHeader) == packet.Size;
+			}
+		};
+
 		// endregion
 
 		class DefaultRemoteTransactionApi : public RemoteTransactionApi {
@@ -75,6 +92,11 @@ namespace catapult { namespace api {
 				return m_impl.dispatch(UtTraits(m_registry), minFeeMultiplier, std::move(knownShortHashes));
 			}
 
+			FutureType<TransactionInventoryTraits> unknownTransactionHashes(
+					model::AnnouncedTransactionRange&& transactions) const override {
+				return m_impl.dispatch(TransactionInventoryTraits(), std::move(transactions));
+			}
+
 		private:
 			const model::TransactionRegistry& m_registry;
 			mutable RemoteRequestDispatcher m_impl;
@@ -40,6 +40,9 @@ namespace catapult { namespace api {
 		virtual thread::future<model::TransactionRange> unconfirmedTransactions(
 				BlockFeeMultiplier minFeeMultiplier,
 				model::ShortHashRange&& knownShortHashes) const = 0;
+
+		/// Announces \a transactions to the remote and gets the subset of their hashes that are unknown to the remote.
+		virtual thread::future<model::HashRange> unknownTransactionHashes(model::AnnouncedTransactionRange&& transactions) const = 0;
 	};
 
 	/// Creates a transaction api for interacting with a remote node with the specified \a io and \a remoteIdentity
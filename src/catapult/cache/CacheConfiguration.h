@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/cache_db/DecodedValueCache.h"
 #include "catapult/utils/FileSize.h"
 #include <string>
 
@@ -66,5 +67,8 @@ namespace catapult { namespace cache {
 
 		/// \c true if patricia trees should be stored, \c false otherwise.
 		bool ShouldStorePatriciaTrees;
+
+		/// Settings of caches of values decoded from the cache database.
+		DecodedValueCacheSettings DecodedValueCache;
 	};
 }}
@@ -39,7 +39,8 @@ namespace catapult { namespace cache {
 								config.CacheDatabaseDirectory,
 								GetAdjustedColumnFamilyNames(config, columnFamilyNames),
 								config.MaxCacheDatabaseWriteBatchSize,
-								pruningMode))
+								pruningMode,
+								config.DecodedValueCache))
 						: std::make_unique<CacheDatabase>())
 				, m_containerMode(GetContainerMode(config))
 				, m_hasPatriciaTreeSupport(config.ShouldStorePatriciaTrees)
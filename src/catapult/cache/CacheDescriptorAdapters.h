@@ -153,7 +153,11 @@ namespace catapult { namespace cache {
 
 	namespace detail {
 		/// Defines cache types for an ordered set based cache.
-		template<typename TElementTraits, typename TDescriptor>
+		/// \note \a TMemorySet can be customized to any ordered container that is compatible with std::set.
+		template<
+			typename TElementTraits,
+			typename TDescriptor,
+			typename TMemorySet = std::set<std::remove_const_t<typename TElementTraits::ElementType>>>
 		struct OrderedSetAdapter {
 		private:
 			struct DescriptorAdapter {
@@ -178,9 +182,8 @@ namespace catapult { namespace cache {
 				}
 			};
 
-			using ElementType = std::remove_const_t<typename TElementTraits::ElementType>;
 			using StorageSetType = CacheContainerView<DescriptorAdapter>;
-			using MemorySetType = std::set<ElementType>;
+			using MemorySetType = TMemorySet;
 
 			// workaround for VS truncation
 			using SetStorageTraits = deltaset::SetStorageTraits<
@@ -217,4 +220,11 @@ namespace catapult { namespace cache {
 	using ImmutableOrderedSetAdapter = detail::OrderedSetAdapter<
 		deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>,
 		TDescriptor>;
+
+	/// Defines cache types for an ordered immutable set based cache with custom memory set ( TMemorySet).
+	template<typename TDescriptor, typename TMemorySet>
+	using ImmutableOrderedCustomSetAdapter = detail::OrderedSetAdapter<
+		deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>,
+		TDescriptor,
+		TMemorySet>;
 }}
@@ -62,8 +62,8 @@ namespace catapult { namespace cache {
 		class Impl {
 		public:
 			Impl(CacheDatabase& database, size_t columnId)
-					: m_container(database, columnId)
-					, m_dataSource(m_container)
+					: m_container(database, columnId, GetContainerDecodedValueCacheSettings(database.decodedValueCacheSettings()))
+					, m_dataSource(m_container, database.decodedValueCacheSettings().pPatriciaTreeNodeCache)
 					, m_pTree(std::make_unique<TTree>(m_dataSource)) {
 				Hash256 rootHash;
 				if (!m_container.prop("root", rootHash))
@@ -96,6 +96,12 @@ namespace catapult { namespace cache {
 				m_container.setProp("root", m_pTree->root());
 			}
 
+		private:
+			static DecodedValueCacheSettings GetContainerDecodedValueCacheSettings(const DecodedValueCacheSettings& settings) {
+				// tree nodes are cached by the (shared) node cache instead of the container, when available
+				return settings.pPatriciaTreeNodeCache ? DecodedValueCacheSettings() : settings;
+			}
+
 		private:
 			PatriciaTreeContainer m_container;
 			PatriciaTreeRdbDataSource m_dataSource;
@@ -27,7 +27,10 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NetworkIdentifier.h"
 #include "catapult/state/CatapultState.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
+#include "catapult/utils/Tracing.h"
 
 namespace catapult { namespace cache {
 
@@ -261,6 +264,21 @@ namespace catapult { namespace cache {
 			, m_subCaches(std::move(subCaches))
 	{}
 
+	CatapultCache::CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches, uint32_t maxCommitThreads)
+			: CatapultCache(std::move(subCaches)) {
+		auto numSubCaches = static_cast<uint32_t>(std::count_if(m_subCaches.cbegin(), m_subCaches.cend(), [](const auto& pSubCache) {
+			return !!pSubCache;
+		}));
+
+		// there is no benefit in using more threads than there are sub caches
+		auto numCommitThreads = std::min(maxCommitThreads, numSubCaches);
+		if (numCommitThreads < 2)
+			return;
+
+		m_pCommitPool = thread::CreateIoThreadPool(numCommitThreads, "cache commit");
+		m_pCommitPool->start();
+	}
+
 	CatapultCache::~CatapultCache() = default;
 
 	CatapultCache::CatapultCache(CatapultCache&&) = default;
@@ -293,13 +311,52 @@ namespace catapult { namespace cache {
 		return CatapultCacheDetachableDelta(std::move(pCacheHeightView), *m_pDependentState, std::move(detachedSubViews));
 	}
 
+	namespace {
+		void CommitSubCache(SubCachePlugin& subCache, Height height) {
+			utils::TraceSpan subCacheSpan("cache", subCache.name().c_str());
+			subCacheSpan.setHeight(height);
+			subCache.commit();
+		}
+
+		void CommitSubCaches(thread::IoThreadPool& pool, const std::vector<SubCachePlugin*>& subCaches, Height height) {
+			// sub caches are independent, so each one is committed (and flushed) as a separate work item
+			std::vector<std::exception_ptr> exceptions(subCaches.size());
+			thread::ParallelFor(pool.ioContext(), subCaches, subCaches.size(), [height, &exceptions](auto* pSubCache, auto index) {
+				try {
+					CommitSubCache(*pSubCache, height);
+				} catch (...) {
+					exceptions[index] = std::current_exception();
+				}
+
+				return true;
+			}).get();
+
+			for (const auto& pException : exceptions) {
+				if (pException)
+					std::rethrow_exception(pException);
+			}
+		}
+	}
+
 	void CatapultCache::commit(Height height) {
 		// use the height writer lock to lock the entire cache during commit
 		auto cacheHeightModifier = m_pCacheHeight->modifier();
 
+		utils::TraceSpan span("cache", "commit cache");
+		span.setHeight(height);
+
+		std::vector<SubCachePlugin*> subCaches;
 		for (const auto& pSubCache : m_subCaches) {
 			if (pSubCache)
-				pSubCache->commit();
+				subCaches.push_back(pSubCache.get());
+		}
+
+		if (m_pCommitPool) {
+			// wait for all sub caches to be committed before updating any state visible to readers
+			CommitSubCaches(*m_pCommitPool, subCaches, height);
+		} else {
+			for (auto* pSubCache : subCaches)
+				CommitSubCache(*pSubCache, height);
 		}
 
 		// finally, update the dependent state and cache height
@@ -32,6 +32,7 @@ namespace catapult {
 		class SubCachePlugin;
 	}
 	namespace model { struct BlockChainConfiguration; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace cache {
@@ -42,6 +43,9 @@ namespace catapult { namespace cache {
 		/// Creates a catapult cache around \a subCaches.
 		explicit CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches);
 
+		/// Creates a catapult cache around \a subCaches that commits sub caches concurrently using at most \a maxCommitThreads threads.
+		CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches, uint32_t maxCommitThreads);
+
 		/// Destroys the cache.
 		~CatapultCache();
 
@@ -70,6 +74,7 @@ namespace catapult { namespace cache {
 		CatapultCacheDetachableDelta createDetachableDelta() const;
 
 		/// Commits all pending changes to the underlying storage and sets the cache height to \a height.
+		/// \note Sub caches might be committed concurrently, but the cache height is only set after all of them are committed.
 		void commit(Height height);
 
 	public:
@@ -87,5 +92,6 @@ namespace catapult { namespace cache {
 		std::unique_ptr<state::CatapultState> m_pDependentState; // use a unique_ptr to allow fwd declare
 		std::unique_ptr<state::CatapultState> m_pDependentStateDelta; // backing for (single) outstanding delta
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
+		std::unique_ptr<thread::IoThreadPool> m_pCommitPool; // null when sub caches are committed sequentially
 	};
 }}
@@ -51,6 +51,14 @@ namespace catapult { namespace cache {
 			return CatapultCache(std::move(m_subCaches));
 		}
 
+		/// Builds a catapult cache that commits sub caches concurrently using at most \a maxCommitThreads threads.
+		CatapultCache build(uint32_t maxCommitThreads) {
+			CATAPULT_LOG(debug)
+					<< "creating CatapultCache with " << m_subCaches.size() << " sub caches and at most "
+					<< maxCommitThreads << " commit threads";
+			return CatapultCache(std::move(m_subCaches), maxCommitThreads);
+		}
+
 	private:
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
 	};
@@ -28,11 +28,14 @@ namespace catapult { namespace cache {
 	/// Adds \a identifier with grouping \a key to \a groupedSet.
 	template<typename TGroupedSet, typename TGroupingKey, typename TIdentifier>
 	void AddIdentifierWithGroup(TGroupedSet& groupedSet, const TGroupingKey& key, const TIdentifier& identifier) {
-		if (!groupedSet.contains(key))
-			groupedSet.insert(typename TGroupedSet::ElementType(key));
-
 		auto groupIter = groupedSet.find(key);
 		auto* pGroup = groupIter.get();
+		if (!pGroup) {
+			groupedSet.insert(typename TGroupedSet::ElementType(key));
+			groupIter = groupedSet.find(key);
+			pGroup = groupIter.get();
+		}
+
 		pGroup->add(identifier);
 	}
 
@@ -80,8 +83,9 @@ namespace catapult { namespace cache {
 	}
 
 	/// Finds identifiers of all values in \a set (with grouped view \a groupedSet) that are deactivating at \a height.
+	/// \note When \a set is non-const, all values with grouping \a height are touched.
 	template<typename TSet, typename TGroupedSet, typename TIdentifiers = typename TGroupedSet::ElementType::Identifiers>
-	TIdentifiers FindDeactivatingIdentifiersAtHeight(const TSet& set, const TGroupedSet& groupedSet, Height height) {
+	TIdentifiers FindDeactivatingIdentifiersAtHeight(TSet& set, const TGroupedSet& groupedSet, Height height) {
 		auto groupIter = groupedSet.find(height);
 		const auto* pGroup = groupIter.get();
 		if (!pGroup)
@@ -53,6 +53,15 @@ namespace catapult { namespace cache {
 					: std::make_pair(Hash256(), false);
 		}
 
+		/// Tries to find the values associated with \a keys in the tree and stores a combined proof of existence or not in \a nodes.
+		std::vector<std::pair<Hash256, bool>> tryLookup(
+				const std::vector<typename TTree::KeyType>& keys,
+				std::vector<tree::TreeNode>& nodes) const {
+			return m_pTree
+					? m_pTree->lookup(keys, nodes)
+					: std::vector<std::pair<Hash256, bool>>(keys.size(), std::make_pair(Hash256(), false));
+		}
+
 	private:
 		const TTree* m_pTree;
 	};
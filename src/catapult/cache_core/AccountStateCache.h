@@ -57,10 +57,11 @@ namespace catapult { namespace cache {
 		/// Commits all pending changes to the underlying storage.
 		/// \note This hides AccountStateBasicCache::commit.
 		void commit(const CacheDeltaType& delta) {
-			// high value addresses need to be captured before committing because committing clears the deltas
-			auto highValueAddresses = delta.highValueAddresses().Current;
+			// high value address changes need to be captured before committing because committing clears the deltas
+			// (only changed accounts are inspected, so the cost is proportional to the number of changes)
+			auto highValueAddressChanges = delta.highValueAddressChanges();
 			AccountStateBasicCache::commit(delta);
-			*m_pHighValueAddresses = std::move(highValueAddresses);
+			ApplyHighValueAddressChanges(highValueAddressChanges, *m_pHighValueAddresses);
 		}
 
 	private:
@@ -198,10 +198,10 @@ namespace catapult { namespace cache {
 		public:
 			HighValueAddressesUpdater(
 					const model::AddressSet& originalHighValueAddresses,
-					BasicAccountStateCacheDelta::HighValueAddressesTuple& highValueAddressesTuple)
+					BasicAccountStateCacheDelta::HighValueAddressChanges& highValueAddressChanges)
 					: m_original(originalHighValueAddresses)
-					, m_current(highValueAddressesTuple.Current)
-					, m_removed(highValueAddressesTuple.Removed)
+					, m_updated(highValueAddressChanges.Updated)
+					, m_removed(highValueAddressChanges.Removed)
 			{}
 
 		public:
@@ -210,11 +210,11 @@ namespace catapult { namespace cache {
 					const auto& accountState = pair.second;
 					const auto& address = accountState.Address;
 					if (include(accountState)) {
-						m_current.insert(address);
+						m_updated.insert(address);
 
 						// don't need to modify m_removed because an element can't be in both Added and Copied
 					} else {
-						m_current.erase(address);
+						m_updated.erase(address);
 
 						if (m_original.cend() != m_original.find(address))
 							m_removed.insert(address);
@@ -224,28 +224,45 @@ namespace catapult { namespace cache {
 
 		private:
 			const model::AddressSet& m_original;
-			model::AddressSet& m_current;
+			model::AddressSet& m_updated;
 			model::AddressSet& m_removed;
 		};
 	}
 
 	BasicAccountStateCacheDelta::HighValueAddressesTuple BasicAccountStateCacheDelta::highValueAddresses() const {
-		// 1. copy original high value addresses
+		auto changes = highValueAddressChanges();
+
 		HighValueAddressesTuple highValueAddresses;
 		highValueAddresses.Current = m_highValueAddresses;
+		ApplyHighValueAddressChanges(changes, highValueAddresses.Current);
+		highValueAddresses.Removed = std::move(changes.Removed);
+		return highValueAddresses;
+	}
 
-		// 2. update for changes
+	BasicAccountStateCacheDelta::HighValueAddressChanges BasicAccountStateCacheDelta::highValueAddressChanges() const {
 		auto minBalance = m_options.MinHarvesterBalance;
 		auto harvestingMosaicId = m_options.HarvestingMosaicId;
 		auto hasHighValue = [minBalance, harvestingMosaicId](const auto& accountState) {
 			return accountState.Balances.get(harvestingMosaicId) >= minBalance;
 		};
 
+		HighValueAddressChanges changes;
 		auto deltas = m_pStateByAddress->deltas();
-		HighValueAddressesUpdater updater(m_highValueAddresses, highValueAddresses);
+		HighValueAddressesUpdater updater(m_highValueAddresses, changes);
 		updater.update(deltas.Added, hasHighValue);
 		updater.update(deltas.Copied, hasHighValue);
 		updater.update(deltas.Removed, [](const auto&) { return false; });
-		return highValueAddresses;
+		return changes;
+	}
+
+	void ApplyHighValueAddressChanges(
+			const BasicAccountStateCacheDelta::HighValueAddressChanges& changes,
+			model::AddressSet& highValueAddresses) {
+		// removals need to be applied first because an address can be both removed and (re)updated
+		for (const auto& address : changes.Removed)
+			highValueAddresses.erase(address);
+
+		for (const auto& address : changes.Updated)
+			highValueAddresses.insert(address);
 	}
 }}
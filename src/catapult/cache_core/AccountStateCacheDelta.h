@@ -149,6 +149,19 @@ namespace catapult { namespace cache {
 		/// Gets all high value addresses.
 		HighValueAddressesTuple highValueAddresses() const;
 
+		/// Changes to high value addresses that are returned by highValueAddressChanges.
+		struct HighValueAddressChanges {
+			/// Addresses of changed accounts that are high value after application of all delta changes.
+			model::AddressSet Updated;
+
+			/// Addresses of accounts that were high value but are no longer high value after application of all delta changes.
+			model::AddressSet Removed;
+		};
+
+		/// Gets the changes to high value addresses by only inspecting the accounts changed by this delta.
+		/// \note Original high value addresses are updated by removing all Removed addresses and then inserting all Updated addresses.
+		HighValueAddressChanges highValueAddressChanges() const;
+
 	private:
 		Address getAddress(const Key& publicKey);
 
@@ -184,6 +197,11 @@ namespace catapult { namespace cache {
 		QueuedRemovalSet<Key> m_queuedRemoveByPublicKey;
 	};
 
+	/// Applies high value address \a changes to \a highValueAddresses.
+	void ApplyHighValueAddressChanges(
+			const BasicAccountStateCacheDelta::HighValueAddressChanges& changes,
+			model::AddressSet& highValueAddresses);
+
 	/// Delta on top of the account state cache.
 	class AccountStateCacheDelta : public ReadOnlyViewSupplier<BasicAccountStateCacheDelta> {
 	public:
@@ -0,0 +1,290 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/FileSize.h"
+#include "catapult/utils/SpinLock.h"
+#include "catapult/types.h"
+#include <array>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace catapult { namespace cache { class PatriciaTreeNodeCache; } }
+
+namespace catapult { namespace cache {
+
+	/// Statistics about decoded value cache lookups.
+	struct DecodedValueCacheStatistics {
+	public:
+		/// Creates zeroed statistics.
+		DecodedValueCacheStatistics()
+				: NumHits(0)
+				, NumMisses(0)
+		{}
+
+	public:
+		/// Number of lookups served by a decoded value cache.
+		std::atomic<uint64_t> NumHits;
+
+		/// Number of lookups not served by a decoded value cache.
+		std::atomic<uint64_t> NumMisses;
+	};
+
+	/// Memory budget shared by decoded value caches.
+	class DecodedValueCacheBudget {
+	public:
+		/// Creates a budget of \a maxSize bytes.
+		explicit DecodedValueCacheBudget(utils::FileSize maxSize)
+				: m_maxSize(maxSize.bytes())
+				, m_size(0)
+		{}
+
+	public:
+		/// Gets the maximum number of reservable bytes.
+		size_t maxSize() const {
+			return m_maxSize;
+		}
+
+		/// Gets the number of reserved bytes.
+		size_t size() const {
+			return m_size;
+		}
+
+	public:
+		/// Reserves \a size bytes and returns \c false if the reservation would exceed the budget.
+		bool tryReserve(size_t size) {
+			auto currentSize = m_size.load();
+			do {
+				if (currentSize + size > m_maxSize)
+					return false;
+			} while (!m_size.compare_exchange_weak(currentSize, currentSize + size));
+
+			return true;
+		}
+
+		/// Releases \a size previously reserved bytes.
+		void release(size_t size) {
+			m_size -= size;
+		}
+
+	private:
+		size_t m_maxSize;
+		std::atomic<size_t> m_size;
+	};
+
+	/// Decoded value cache settings.
+	struct DecodedValueCacheSettings {
+	public:
+		/// Maximum (approximate) size of cached decoded values.
+		/// \note Caching is disabled when this is zero.
+		utils::FileSize MaxSize;
+
+		/// Statistics that should be updated by the cache (optional).
+		std::shared_ptr<DecodedValueCacheStatistics> pStatistics;
+
+		/// Budget shared by all caches created with these settings (optional).
+		/// \note When this is not set, each cache has its own budget of \a MaxSize bytes.
+		std::shared_ptr<DecodedValueCacheBudget> pBudget;
+
+		/// Cache of decoded patricia tree nodes shared by all trees (optional).
+		std::shared_ptr<PatriciaTreeNodeCache> pPatriciaTreeNodeCache;
+	};
+
+	/// Bounded, sharded cache of values decoded from a database column with least recently used eviction.
+	/// \note When the (shared) budget is exhausted, a cache can only evict its own values to make room for a new value.
+	template<typename TValue>
+	class DecodedValueCache {
+	public:
+		/// Pointer to a cached value.
+		using ValuePointer = std::shared_ptr<const TValue>;
+
+		/// Number of independently locked shards.
+		static constexpr size_t Num_Shards = 16;
+
+	private:
+		// approximate bookkeeping overhead of a single entry
+		static constexpr size_t Entry_Overhead_Size = 96;
+
+		struct Entry {
+			std::string Key;
+			ValuePointer pValue;
+			size_t Size;
+		};
+
+		using EntryList = std::list<Entry>;
+
+		struct Shard {
+			EntryList Entries; // most recently used first
+			std::unordered_map<std::string, typename EntryList::iterator> Index;
+			size_t Size = 0;
+			utils::SpinLock Lock;
+		};
+
+	public:
+		/// Creates a cache around \a settings.
+		explicit DecodedValueCache(const DecodedValueCacheSettings& settings)
+				: m_pBudget(settings.pBudget ? settings.pBudget : std::make_shared<DecodedValueCacheBudget>(settings.MaxSize))
+				, m_maxShardSize(m_pBudget->maxSize() / Num_Shards)
+				, m_pStatistics(settings.pStatistics)
+				, m_version(0)
+		{}
+
+		/// Destroys the cache and returns its memory to the budget.
+		~DecodedValueCache() {
+			m_pBudget->release(memorySize());
+		}
+
+	public:
+		/// Gets the number of cached values.
+		size_t size() const {
+			size_t size = 0;
+			for (auto& shard : m_shards) {
+				utils::SpinLockGuard guard(shard.Lock);
+				size += shard.Index.size();
+			}
+
+			return size;
+		}
+
+		/// Gets the (approximate) size of all cached values in bytes.
+		size_t memorySize() const {
+			size_t size = 0;
+			for (auto& shard : m_shards) {
+				utils::SpinLockGuard guard(shard.Lock);
+				size += shard.Size;
+			}
+
+			return size;
+		}
+
+		/// Gets the version of the cache, which changes every time a value is invalidated.
+		/// \note Values loaded at an older version are not cached.
+		uint64_t version() const {
+			return m_version;
+		}
+
+	public:
+		/// Finds the value associated with \a key and returns \c nullptr if it is not cached.
+		ValuePointer find(const RawBuffer& key) {
+			auto strKey = ToString(key);
+			auto& shard = m_shards[GetShardIndex(strKey)];
+			ValuePointer pValue;
+			{
+				utils::SpinLockGuard guard(shard.Lock);
+				auto iter = shard.Index.find(strKey);
+				if (shard.Index.end() != iter) {
+					shard.Entries.splice(shard.Entries.begin(), shard.Entries, iter->second);
+					pValue = iter->second->pValue;
+				}
+			}
+
+			if (m_pStatistics)
+				++(pValue ? m_pStatistics->NumHits : m_pStatistics->NumMisses);
+
+			return pValue;
+		}
+
+		/// Caches \a pValue with \a key and (serialized) \a valueSize if the cache is still at \a version.
+		void insert(const std::string& key, const ValuePointer& pValue, size_t valueSize, uint64_t version) {
+			auto entrySize = key.size() + valueSize + sizeof(TValue) + Entry_Overhead_Size;
+			if (entrySize > m_maxShardSize)
+				return;
+
+			auto& shard = m_shards[GetShardIndex(key)];
+			utils::SpinLockGuard guard(shard.Lock);
+			if (version != m_version)
+				return;
+
+			auto iter = shard.Index.find(key);
+			if (shard.Index.end() != iter)
+				return;
+
+			while (shard.Size + entrySize > m_maxShardSize || !m_pBudget->tryReserve(entrySize)) {
+				// the remaining budget is held by other caches
+				if (shard.Entries.empty())
+					return;
+
+				evictLeastRecentlyUsed(shard);
+			}
+
+			shard.Entries.push_front(Entry{ key, pValue, entrySize });
+			shard.Index.emplace(key, shard.Entries.begin());
+			shard.Size += entrySize;
+		}
+
+		/// Invalidates the value associated with \a key.
+		void remove(const RawBuffer& key) {
+			++m_version;
+
+			auto strKey = ToString(key);
+			auto& shard = m_shards[GetShardIndex(strKey)];
+			utils::SpinLockGuard guard(shard.Lock);
+			auto iter = shard.Index.find(strKey);
+			if (shard.Index.end() == iter)
+				return;
+
+			shard.Size -= iter->second->Size;
+			m_pBudget->release(iter->second->Size);
+			shard.Entries.erase(iter->second);
+			shard.Index.erase(iter);
+		}
+
+		/// Invalidates all values.
+		void clear() {
+			++m_version;
+
+			for (auto& shard : m_shards) {
+				utils::SpinLockGuard guard(shard.Lock);
+				m_pBudget->release(shard.Size);
+				shard.Entries.clear();
+				shard.Index.clear();
+				shard.Size = 0;
+			}
+		}
+
+	private:
+		void evictLeastRecentlyUsed(Shard& shard) {
+			const auto& leastRecentlyUsedEntry = shard.Entries.back();
+			shard.Size -= leastRecentlyUsedEntry.Size;
+			m_pBudget->release(leastRecentlyUsedEntry.Size);
+			shard.Index.erase(leastRecentlyUsedEntry.Key);
+			shard.Entries.pop_back();
+		}
+
+	private:
+		static std::string ToString(const RawBuffer& key) {
+			return std::string(reinterpret_cast<const char*>(key.pData), key.Size);
+		}
+
+		static size_t GetShardIndex(const std::string& key) {
+			return std::hash<std::string>()(key) % Num_Shards;
+		}
+
+	private:
+		std::shared_ptr<DecodedValueCacheBudget> m_pBudget;
+		size_t m_maxShardSize;
+		std::shared_ptr<DecodedValueCacheStatistics> m_pStatistics;
+		std::atomic<uint64_t> m_version;
+		mutable std::array<Shard, Num_Shards> m_shards;
+	};
+}}
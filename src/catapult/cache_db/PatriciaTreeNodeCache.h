@@ -0,0 +1,82 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "DecodedValueCache.h"
+#include "catapult/tree/TreeNode.h"
+
+namespace catapult { namespace cache {
+
+	/// Bounded cache of decoded patricia tree nodes keyed by node hash.
+	/// \note Tree nodes are content addressed, so cached nodes never need to be invalidated and can be shared by all trees.
+	class PatriciaTreeNodeCache {
+	public:
+		/// Pointer to a cached tree node.
+		using NodePointer = std::shared_ptr<const tree::TreeNode>;
+
+	public:
+		/// Creates a cache with \a maxSize and optional \a pStatistics.
+		PatriciaTreeNodeCache(utils::FileSize maxSize, const std::shared_ptr<DecodedValueCacheStatistics>& pStatistics)
+				: m_cache(CreateSettings(maxSize, pStatistics))
+		{}
+
+	public:
+		/// Gets the number of cached nodes.
+		size_t size() const {
+			return m_cache.size();
+		}
+
+		/// Gets the (approximate) size of all cached nodes in bytes.
+		size_t memorySize() const {
+			return m_cache.memorySize();
+		}
+
+	public:
+		/// Finds the node with \a hash and returns \c nullptr if it is not cached.
+		NodePointer find(const Hash256& hash) {
+			return m_cache.find(hash);
+		}
+
+		/// Caches \a pNode.
+		void insert(const NodePointer& pNode) {
+			// calculate the hash before publishing the node because branch node hashes are lazily calculated
+			const auto& hash = pNode->hash();
+			m_cache.insert(std::string(reinterpret_cast<const char*>(hash.data()), hash.size()), pNode, GetNodeSize(*pNode), 0);
+		}
+
+	private:
+		static DecodedValueCacheSettings CreateSettings(
+				utils::FileSize maxSize,
+				const std::shared_ptr<DecodedValueCacheStatistics>& pStatistics) {
+			DecodedValueCacheSettings settings;
+			settings.MaxSize = maxSize;
+			settings.pStatistics = pStatistics;
+			return settings;
+		}
+
+		static size_t GetNodeSize(const tree::TreeNode& node) {
+			auto pathSize = node.path().size();
+			return node.isBranch() ? sizeof(tree::BranchTreeNode) + pathSize : sizeof(tree::LeafTreeNode) + pathSize;
+		}
+
+	private:
+		DecodedValueCache<tree::TreeNode> m_cache;
+	};
+}}
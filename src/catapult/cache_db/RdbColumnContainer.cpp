@@ -70,6 +70,10 @@ namespace catapult { namespace cache {
 		m_size = newSize;
 	}
 
+	const DecodedValueCacheSettings& RdbColumnContainer::decodedValueCacheSettings() const {
+		return m_database.decodedValueCacheSettings();
+	}
+
 	void RdbColumnContainer::find(const RawBuffer& key, RdbDataIterator& iterator) const {
 		m_database.get(m_columnId, ToSlice(key), iterator);
 	}
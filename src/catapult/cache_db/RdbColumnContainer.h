@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "DecodedValueCache.h"
 #include "catapult/exceptions.h"
 #include "catapult/functions.h"
 #include "catapult/types.h"
@@ -74,6 +75,9 @@ namespace catapult { namespace cache {
 			return m_database;
 		}
 
+		/// Gets the settings of the cache of decoded column values.
+		const DecodedValueCacheSettings& decodedValueCacheSettings() const;
+
 	protected:
 		/// Finds element with \a key, storing result in \a iterator.
 		void find(const RawBuffer& key, RdbDataIterator& iterator) const;
@@ -28,6 +28,7 @@
 namespace catapult { namespace cache {
 
 	/// Typed container adapter that wraps column.
+	/// \note Decoded values are optionally cached until they are modified.
 	template<typename TDescriptor, typename TContainer = RdbColumnContainer>
 	class RdbTypedColumnContainer : public TContainer {
 	public:
@@ -35,6 +36,9 @@ namespace catapult { namespace cache {
 		using ValueType = typename TDescriptor::ValueType;
 		using StorageType = typename TDescriptor::StorageType;
 
+	private:
+		using DecodedValueCacheType = DecodedValueCache<StorageType>;
+
 	public:
 		/// Typed container iterator that adds descriptor-based deserialization.
 		class const_iterator {
@@ -43,6 +47,11 @@ namespace catapult { namespace cache {
 			using ValueType = typename TDescriptor::ValueType;
 			using StorageType = typename TDescriptor::StorageType;
 
+		public:
+			/// Creates an iterator.
+			const_iterator() : m_decodedValueCacheVersion(0)
+			{}
+
 		public:
 			/// Returns \c true if this iterator and \a rhs are equal.
 			bool operator==(const const_iterator& rhs) const {
@@ -62,7 +71,10 @@ namespace catapult { namespace cache {
 
 				if (!m_pStorage) {
 					auto value = TDescriptor::Serializer::DeserializeValue(m_iterator.buffer());
-					m_pStorage = std::make_unique<StorageType>(TDescriptor::ToStorage(value));
+					m_pStorage = std::make_shared<const StorageType>(TDescriptor::ToStorage(value));
+
+					if (m_pDecodedValueCache)
+						m_pDecodedValueCache->insert(m_key, m_pStorage, m_iterator.buffer().Size, m_decodedValueCacheVersion);
 				}
 
 				return *m_pStorage;
@@ -84,15 +96,45 @@ namespace catapult { namespace cache {
 				return m_iterator;
 			}
 
+		private:
+			void setCachedValue(const typename DecodedValueCacheType::ValuePointer& pValue) {
+				m_iterator.setFound(true);
+				m_pStorage = pValue;
+			}
+
+			void setDecodedValueCache(
+					const std::shared_ptr<DecodedValueCacheType>& pDecodedValueCache,
+					const RawBuffer& key,
+					uint64_t version) {
+				m_pDecodedValueCache = pDecodedValueCache;
+				m_key = std::string(reinterpret_cast<const char*>(key.pData), key.Size);
+				m_decodedValueCacheVersion = version;
+			}
+
 		private:
 			RdbDataIterator m_iterator;
-			mutable std::shared_ptr<StorageType> m_pStorage;
+			mutable std::shared_ptr<const StorageType> m_pStorage;
+
+			std::shared_ptr<DecodedValueCacheType> m_pDecodedValueCache;
+			std::string m_key;
+			uint64_t m_decodedValueCacheVersion;
+
+			friend class RdbTypedColumnContainer;
 		};
 
 	public:
 		/// Creates a container around \a database and \a columnId.
 		template<typename TDatabase = RocksDatabase>
-		RdbTypedColumnContainer(TDatabase& database, size_t columnId) : TContainer(database, columnId)
+		RdbTypedColumnContainer(TDatabase& database, size_t columnId)
+				: TContainer(database, columnId)
+				, m_pDecodedValueCache(CreateDecodedValueCache(TContainer::decodedValueCacheSettings()))
+		{}
+
+		/// Creates a container around \a database and \a columnId with custom \a decodedValueCacheSettings.
+		template<typename TDatabase = RocksDatabase>
+		RdbTypedColumnContainer(TDatabase& database, size_t columnId, const DecodedValueCacheSettings& decodedValueCacheSettings)
+				: TContainer(database, columnId)
+				, m_pDecodedValueCache(CreateDecodedValueCache(decodedValueCacheSettings))
 		{}
 
 	public:
@@ -101,6 +143,11 @@ namespace catapult { namespace cache {
 			return 0 == TContainer::size();
 		}
 
+		/// Gets the number of cached decoded values.
+		size_t numCachedValues() const {
+			return m_pDecodedValueCache ? m_pDecodedValueCache->size() : 0;
+		}
+
 	public:
 
 #if !defined(NDEBUG) && defined(_MSC_VER)
@@ -110,9 +157,11 @@ namespace catapult { namespace cache {
 
 		/// Inserts \a element into container.
 		void insert(const StorageType& element) {
-			TContainer::insert(
-					SerializeKey(TDescriptor::ToKey(element)),
-					TDescriptor::Serializer::SerializeValue(TDescriptor::ToValue(element)));
+			auto key = SerializeKey(TDescriptor::ToKey(element));
+			if (m_pDecodedValueCache)
+				m_pDecodedValueCache->remove(key);
+
+			TContainer::insert(key, TDescriptor::Serializer::SerializeValue(TDescriptor::ToValue(element)));
 		}
 
 #if !defined(NDEBUG) && defined(_MSC_VER)
@@ -122,23 +171,55 @@ namespace catapult { namespace cache {
 		/// Finds element with \a key. Returns cend() if \a key has not been found.
 		const_iterator find(const KeyType& key) const {
 			const_iterator iter;
-			TContainer::find(SerializeKey(key), iter.dbIterator());
+			auto serializedKey = SerializeKey(key);
+			if (!m_pDecodedValueCache) {
+				TContainer::find(serializedKey, iter.dbIterator());
+				return iter;
+			}
+
+			auto pCachedValue = m_pDecodedValueCache->find(serializedKey);
+			if (pCachedValue) {
+				iter.setCachedValue(pCachedValue);
+				return iter;
+			}
+
+			// capture the version before reading from the database so that a value invalidated in the meantime is not cached
+			auto version = m_pDecodedValueCache->version();
+			TContainer::find(serializedKey, iter.dbIterator());
+			if (cend() != iter)
+				iter.setDecodedValueCache(m_pDecodedValueCache, serializedKey, version);
+
 			return iter;
 		}
 
 		/// Prunes elements with keys smaller than \a key. Returns number of pruned elements.
 		size_t prune(const KeyType& key) {
+			if (m_pDecodedValueCache)
+				m_pDecodedValueCache->clear();
+
 			return TContainer::prune(TDescriptor::Serializer::KeyToBoundary(key));
 		}
 
 		/// Removes element with \a key.
 		void remove(const KeyType& key) {
-			TContainer::remove(SerializeKey(key));
+			auto serializedKey = SerializeKey(key);
+			if (m_pDecodedValueCache)
+				m_pDecodedValueCache->remove(serializedKey);
+
+			TContainer::remove(serializedKey);
 		}
 
 		/// Gets an iterator that represents non-existing element.
 		const_iterator cend() const {
 			return const_iterator();
 		}
+
+	private:
+		static std::shared_ptr<DecodedValueCacheType> CreateDecodedValueCache(const DecodedValueCacheSettings& settings) {
+			return 0 == settings.MaxSize.bytes() ? nullptr : std::make_shared<DecodedValueCacheType>(settings);
+		}
+
+	private:
+		std::shared_ptr<DecodedValueCacheType> m_pDecodedValueCache;
 	};
 }}
@@ -85,18 +85,43 @@ namespace catapult { namespace cache {
 			const std::vector<std::string>& columnFamilyNames,
 			utils::FileSize maxDatabaseWriteBatchSize,
 			FilterPruningMode pruningMode)
+			: RocksDatabaseSettings(
+					databaseDirectory,
+					columnFamilyNames,
+					maxDatabaseWriteBatchSize,
+					pruningMode,
+					DecodedValueCacheSettings())
+	{}
+
+	RocksDatabaseSettings::RocksDatabaseSettings(
+			const std::string& databaseDirectory,
+			const std::vector<std::string>& columnFamilyNames,
+			utils::FileSize maxDatabaseWriteBatchSize,
+			FilterPruningMode pruningMode,
+			const DecodedValueCacheSettings& decodedValueCacheSettings)
 			: DatabaseDirectory(databaseDirectory)
 			, ColumnFamilyNames(columnFamilyNames)
 			, MaxDatabaseWriteBatchSize(maxDatabaseWriteBatchSize)
 			, PruningMode(pruningMode)
+			, DecodedValueCache(decodedValueCacheSettings)
 	{}
 
 	// endregion
 
+	namespace {
+		DecodedValueCacheSettings CreateDecodedValueCacheSettings(const DecodedValueCacheSettings& settings) {
+			// all columns of a database share a single budget
+			auto databaseSettings = settings;
+			databaseSettings.pBudget = std::make_shared<DecodedValueCacheBudget>(settings.MaxSize);
+			return databaseSettings;
+		}
+	}
+
 	RocksDatabase::RocksDatabase() = default;
 
 	RocksDatabase::RocksDatabase(const RocksDatabaseSettings& settings)
 			: m_settings(settings)
+			, m_decodedValueCacheSettings(CreateDecodedValueCacheSettings(m_settings.DecodedValueCache))
 			, m_pruningFilter(m_settings.PruningMode)
 			, m_pWriteBatch(std::make_unique<rocksdb::WriteBatch>()) {
 		if (settings.ColumnFamilyNames.empty())
@@ -141,6 +166,10 @@ namespace catapult { namespace cache {
 		return FilterPruningMode::Enabled == m_settings.PruningMode;
 	}
 
+	const DecodedValueCacheSettings& RocksDatabase::decodedValueCacheSettings() const {
+		return m_decodedValueCacheSettings;
+	}
+
 	namespace {
 		[[noreturn]]
 		void ThrowError(const std::string& message, const std::string& columnName, const rocksdb::Slice& key) {
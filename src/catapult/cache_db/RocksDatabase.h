@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "DecodedValueCache.h"
 #include "RocksPruningFilter.h"
 #include "catapult/utils/FileSize.h"
 #include "catapult/types.h"
@@ -98,6 +99,15 @@ namespace catapult { namespace cache {
 				utils::FileSize maxDatabaseWriteBatchSize,
 				FilterPruningMode pruningMode);
 
+		/// Creates database settings around \a databaseDirectory, column names (\a columnFamilyNames),
+		/// maximum size of saved batch (\a maxDatabaseWriteBatchSize), \a pruningMode and \a decodedValueCacheSettings.
+		RocksDatabaseSettings(
+				const std::string& databaseDirectory,
+				const std::vector<std::string>& columnFamilyNames,
+				utils::FileSize maxDatabaseWriteBatchSize,
+				FilterPruningMode pruningMode,
+				const DecodedValueCacheSettings& decodedValueCacheSettings);
+
 	public:
 		/// Database directory.
 		const std::string DatabaseDirectory;
@@ -110,6 +120,9 @@ namespace catapult { namespace cache {
 
 		/// Database pruning mode.
 		const FilterPruningMode PruningMode;
+
+		/// Settings of caches of decoded column values.
+		const DecodedValueCacheSettings DecodedValueCache;
 	};
 
 	/// RocksDb-backed database.
@@ -131,6 +144,10 @@ namespace catapult { namespace cache {
 		/// Returns \c true if pruning is enabled.
 		bool canPrune() const;
 
+		/// Gets the settings of caches of decoded column values.
+		/// \note All caches created with these settings share a single memory budget.
+		const DecodedValueCacheSettings& decodedValueCacheSettings() const;
+
 	public:
 		/// Gets the value associated with \a key from \a columnId and sets \a result.
 		void get(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result);
@@ -152,6 +169,7 @@ namespace catapult { namespace cache {
 
 	private:
 		const RocksDatabaseSettings m_settings;
+		DecodedValueCacheSettings m_decodedValueCacheSettings;
 		RocksPruningFilter m_pruningFilter;
 		std::unique_ptr<rocksdb::WriteBatch> m_pWriteBatch;
 
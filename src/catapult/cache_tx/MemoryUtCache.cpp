@@ -53,10 +53,12 @@ namespace catapult { namespace cache {
 			uint64_t maxResponseSize,
 			const TransactionDataContainer& transactionDataContainer,
 			const IdLookup& idLookup,
+			const ShortHashLookup& shortHashLookup,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
 			, m_idLookup(idLookup)
+			, m_shortHashLookup(shortHashLookup)
 			, m_readLock(std::move(readLock))
 	{}
 
@@ -108,6 +110,24 @@ namespace catapult { namespace cache {
 		return transactions;
 	}
 
+	MemoryUtCacheView::UnknownTransactions MemoryUtCacheView::findTransactions(const std::vector<utils::ShortHash>& shortHashes) const {
+		UnknownTransactions transactions;
+		transactions.reserve(shortHashes.size());
+		for (auto shortHash : shortHashes) {
+			// transactions with ambiguous short hashes are treated as unknown
+			auto range = m_shortHashLookup.equal_range(shortHash);
+			if (range.first == range.second || std::next(range.first) != range.second) {
+				transactions.push_back(nullptr);
+				continue;
+			}
+
+			auto dataIter = m_transactionDataContainer.find(TransactionData(range.first->second));
+			transactions.push_back(dataIter->pEntity);
+		}
+
+		return transactions;
+	}
+
 	// endregion
 
 	// region MemoryUtCacheModifier
@@ -116,6 +136,7 @@ namespace catapult { namespace cache {
 		class MemoryUtCacheModifier : public UtCacheModifier {
 		private:
 			using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
+			using ShortHashLookup = std::unordered_multimap<utils::ShortHash, size_t, utils::ShortHashHasher>;
 
 		public:
 			MemoryUtCacheModifier(
@@ -123,12 +144,14 @@ namespace catapult { namespace cache {
 					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
 					IdLookup& idLookup,
+					ShortHashLookup& shortHashLookup,
 					AccountCounters& counters,
 					utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
 					, m_idLookup(idLookup)
+					, m_shortHashLookup(shortHashLookup)
 					, m_counters(counters)
 					, m_writeLock(std::move(writeLock))
 			{}
@@ -146,6 +169,7 @@ namespace catapult { namespace cache {
 					return false;
 
 				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
+				m_shortHashLookup.emplace(utils::ToShortHash(transactionInfo.EntityHash), m_idSequence);
 				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
 
 				m_counters.increment(transactionInfo.pEntity->SignerPublicKey);
@@ -164,6 +188,12 @@ namespace catapult { namespace cache {
 
 				m_counters.decrement(dataIter->pEntity->SignerPublicKey);
 
+				auto shortHashRange = m_shortHashLookup.equal_range(utils::ToShortHash(hash));
+				auto shortHashIter = std::find_if(shortHashRange.first, shortHashRange.second, [id = iter->second](const auto& pair) {
+					return id == pair.second;
+				});
+				m_shortHashLookup.erase(shortHashIter);
+
 				m_transactionDataContainer.erase(dataIter);
 				m_idLookup.erase(iter);
 				return erasedInfo;
@@ -186,6 +216,7 @@ namespace catapult { namespace cache {
 
 				m_transactionDataContainer.clear();
 				m_idLookup.clear();
+				m_shortHashLookup.clear();
 				m_counters.reset();
 				return transactionInfosCopy;
 			}
@@ -195,6 +226,7 @@ namespace catapult { namespace cache {
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
 			IdLookup& m_idLookup;
+			ShortHashLookup& m_shortHashLookup;
 			AccountCounters& m_counters;
 			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 		};
@@ -207,6 +239,7 @@ namespace catapult { namespace cache {
 	struct MemoryUtCache::Impl {
 		cache::TransactionDataContainer TransactionDataContainer;
 		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
+		std::unordered_multimap<utils::ShortHash, size_t, utils::ShortHashHasher> ShortHashLookup;
 		AccountCounters Counters;
 	};
 
@@ -220,7 +253,12 @@ namespace catapult { namespace cache {
 
 	MemoryUtCacheView MemoryUtCache::view() const {
 		auto readLock = m_lock.acquireReader();
-		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_pImpl->IdLookup, std::move(readLock));
+		return MemoryUtCacheView(
+				m_options.MaxResponseSize,
+				m_pImpl->TransactionDataContainer,
+				m_pImpl->IdLookup,
+				m_pImpl->ShortHashLookup,
+				std::move(readLock));
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
@@ -230,6 +268,7 @@ namespace catapult { namespace cache {
 				m_idSequence,
 				m_pImpl->TransactionDataContainer,
 				m_pImpl->IdLookup,
+				m_pImpl->ShortHashLookup,
 				m_pImpl->Counters,
 				std::move(writeLock)));
 	}
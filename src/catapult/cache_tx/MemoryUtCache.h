@@ -24,6 +24,7 @@
 #include "UtCache.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/utils/Hashers.h"
+#include "catapult/utils/ShortHash.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
 #include <set>
 #include <unordered_map>
@@ -41,15 +42,18 @@ namespace catapult { namespace cache {
 	private:
 		using UnknownTransactions = std::vector<std::shared_ptr<const model::Transaction>>;
 		using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
+		using ShortHashLookup = std::unordered_multimap<utils::ShortHash, size_t, utils::ShortHashHasher>;
 		using TransactionInfoConsumer = predicate<const model::TransactionInfo&>;
 
 	public:
 		/// Creates a view around a maximum response size (\a maxResponseSize), a transaction data container
-		/// (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// (\a transactionDataContainer), an id lookup (\a idLookup) and a short hash lookup (\a shortHashLookup)
+		/// with lock context \a readLock.
 		MemoryUtCacheView(
 				uint64_t maxResponseSize,
 				const TransactionDataContainer& transactionDataContainer,
 				const IdLookup& idLookup,
+				const ShortHashLookup& shortHashLookup,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
@@ -70,10 +74,15 @@ namespace catapult { namespace cache {
 		/// and do not have a short hash in \a knownShortHashes.
 		UnknownTransactions unknownTransactions(BlockFeeMultiplier minFeeMultiplier, const utils::ShortHashesSet& knownShortHashes) const;
 
+		/// Gets the transactions in the cache with short hashes \a shortHashes.
+		/// \note An element is \c nullptr if no transaction or more than one transaction has the corresponding short hash.
+		UnknownTransactions findTransactions(const std::vector<utils::ShortHash>& shortHashes) const;
+
 	private:
 		uint64_t m_maxResponseSize;
 		const TransactionDataContainer& m_transactionDataContainer;
 		const IdLookup& m_idLookup;
+		const ShortHashLookup& m_shortHashLookup;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
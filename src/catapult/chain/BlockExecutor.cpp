@@ -22,6 +22,7 @@
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/model/Block.h"
 #include "catapult/observers/EntityObserver.h"
+#include "catapult/utils/Tracing.h"
 
 namespace catapult { namespace chain {
 
@@ -40,9 +41,17 @@ namespace catapult { namespace chain {
 			for (const auto& entityInfo : entityInfos)
 				observer.notify(entityInfo, context);
 		}
+
+		void AnnotateSpan(utils::TraceSpan& span, const model::BlockElement& blockElement) {
+			span.setHeight(blockElement.Block.Height);
+			span.setHash(blockElement.EntityHash);
+		}
 	}
 
 	void ExecuteBlock(const model::BlockElement& blockElement, const BlockExecutionContext& executionContext) {
+		utils::TraceSpan span("chain", "execute block");
+		AnnotateSpan(span, blockElement);
+
 		model::WeakEntityInfos entityInfos;
 		model::ExtractEntityInfos(blockElement, entityInfos);
 
@@ -51,6 +60,9 @@ namespace catapult { namespace chain {
 	}
 
 	void RollbackBlock(const model::BlockElement& blockElement, const BlockExecutionContext& executionContext) {
+		utils::TraceSpan span("chain", "rollback block");
+		AnnotateSpan(span, blockElement);
+
 		model::WeakEntityInfos entityInfos;
 		model::ExtractEntityInfos(blockElement, entityInfos);
 		std::reverse(entityInfos.begin(), entityInfos.end());
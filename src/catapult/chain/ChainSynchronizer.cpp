@@ -24,6 +24,7 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/SpinLock.h"
+#include "catapult/utils/StackTimer.h"
 #include <queue>
 
 namespace catapult { namespace chain {
@@ -140,12 +141,14 @@ namespace catapult { namespace chain {
 		public:
 			explicit RangeAggregator(const model::NodeIdentity& sourceIdentity)
 					: m_numBlocks(0)
+					, m_numBytes(0)
 					, m_sourceIdentity(sourceIdentity)
 			{}
 
 		public:
 			void add(model::BlockRange&& range) {
 				m_numBlocks += range.size();
+				m_numBytes += range.totalSize();
 				m_ranges.push_back(std::move(range));
 			}
 
@@ -161,15 +164,81 @@ namespace catapult { namespace chain {
 				return m_numBlocks;
 			}
 
+			auto numBytes() const {
+				return m_numBytes;
+			}
+
 		private:
 			size_t m_numBlocks;
+			size_t m_numBytes;
 			model::NodeIdentity m_sourceIdentity;
 			std::vector<model::BlockRange> m_ranges;
 		};
 
-		auto CreateFutureSupplier(const api::RemoteChainApi& remoteChainApi, const api::BlocksFromOptions& options) {
-			return [&remoteChainApi, options](auto height) {
-				return remoteChainApi.blocksFrom(height, options);
+		template<typename TResult, typename TSampleConsumer>
+		thread::future<TResult> RecordLatency(
+				thread::future<TResult>&& future,
+				const std::shared_ptr<utils::LatencyHistogram>& pLatencyHistogram,
+				TSampleConsumer sampleConsumer) {
+			utils::StackTimer stopwatch;
+			return thread::compose(std::move(future), [stopwatch, pLatencyHistogram, sampleConsumer](auto&& completedFuture) {
+				auto elapsedMicros = stopwatch.micros();
+				pLatencyHistogram->record(std::chrono::microseconds(elapsedMicros));
+
+				// only successful calls are reported to the sample consumer (failures rethrow and are propagated by compose)
+				auto result = completedFuture.get();
+				sampleConsumer(result, utils::TimeSpan::FromMilliseconds(elapsedMicros / 1000));
+				return thread::make_ready_future(std::move(result));
+			});
+		}
+
+		// chain api decorator that measures the round trip times of (single request) chain info requests
+		class RoundTripTimingChainApi : public api::ChainApi {
+		public:
+			RoundTripTimingChainApi(
+					const api::RemoteChainApi& remoteChainApi,
+					const consumer<const model::NodeIdentity&, const utils::TimeSpan&>& roundTripTimeConsumer)
+					: m_remoteChainApi(remoteChainApi)
+					, m_roundTripTimeConsumer(roundTripTimeConsumer)
+			{}
+
+		public:
+			thread::future<api::ChainInfo> chainInfo() const override {
+				utils::StackTimer stopwatch;
+				auto identity = m_remoteChainApi.remoteIdentity();
+				auto roundTripTimeConsumer = m_roundTripTimeConsumer;
+				return thread::compose(m_remoteChainApi.chainInfo(), [stopwatch, identity, roundTripTimeConsumer](
+						auto&& chainInfoFuture) {
+					auto elapsedMillis = stopwatch.millis();
+
+					// only successful requests are reported (failures rethrow and are propagated by compose)
+					auto chainInfo = chainInfoFuture.get();
+					roundTripTimeConsumer(identity, utils::TimeSpan::FromMilliseconds(elapsedMillis));
+					return thread::make_ready_future(std::move(chainInfo));
+				});
+			}
+
+			thread::future<model::HashRange> hashesFrom(Height height, uint32_t maxHashes) const override {
+				return m_remoteChainApi.hashesFrom(height, maxHashes);
+			}
+
+		private:
+			const api::RemoteChainApi& m_remoteChainApi;
+			consumer<const model::NodeIdentity&, const utils::TimeSpan&> m_roundTripTimeConsumer;
+		};
+
+		auto CreateFutureSupplier(
+				const api::RemoteChainApi& remoteChainApi,
+				const api::BlocksFromOptions& options,
+				const ChainSynchronizerMonitors& monitors) {
+			return [&remoteChainApi, options, monitors](auto height) {
+				const auto& identity = remoteChainApi.remoteIdentity();
+				return RecordLatency(remoteChainApi.blocksFrom(height, options), monitors.pBlocksFrom, [identity, monitors](
+						const auto& range,
+						const auto& elapsedTime) {
+					if (!range.empty())
+						monitors.ThroughputConsumer(identity, range.totalSize(), elapsedTime);
+				});
 			};
 		}
 
@@ -184,13 +253,32 @@ namespace catapult { namespace chain {
 			return thread::make_ready_future(std::move(addResult));
 		}
 
+		struct ChainBlocksFromLimits {
+			/// Number of blocks that must be pulled in order to resolve a fork.
+			uint64_t ForkDepth;
+
+			/// Number of blocks that should be pulled when the pulled blocks are smaller than MaxNumBytes.
+			uint64_t TargetNumBlocks;
+
+			/// Maximum number of bytes that should be pulled in order to reach TargetNumBlocks.
+			uint64_t MaxNumBytes;
+
+		public:
+			bool isSatisfied(const RangeAggregator& rangeAggregator) const {
+				if (rangeAggregator.numBlocks() < ForkDepth)
+					return false;
+
+				return rangeAggregator.numBlocks() >= TargetNumBlocks || rangeAggregator.numBytes() >= MaxNumBytes;
+			}
+		};
+
 		NodeInteractionFuture ChainBlocksFrom(
 				const std::function<thread::future<model::BlockRange>(Height)>& futureSupplier,
 				Height height,
-				uint64_t forkDepth,
+				const ChainBlocksFromLimits& limits,
 				const std::shared_ptr<RangeAggregator>& pRangeAggregator,
 				UnprocessedElements& unprocessedElements) {
-			return thread::compose(futureSupplier(height), [futureSupplier, forkDepth, pRangeAggregator, &unprocessedElements](
+			return thread::compose(futureSupplier(height), [futureSupplier, limits, pRangeAggregator, &unprocessedElements](
 					auto&& blocksFuture) {
 				try {
 					auto range = blocksFuture.get();
@@ -208,11 +296,11 @@ namespace catapult { namespace chain {
 							<< " blocks (heights " << range.cbegin()->Height << " - " << endHeight << ")";
 
 					pRangeAggregator->add(std::move(range));
-					if (forkDepth <= pRangeAggregator->numBlocks())
+					if (limits.isSatisfied(*pRangeAggregator))
 						return CompleteChainBlocksFrom(*pRangeAggregator, unprocessedElements);
 
 					auto nextHeight = endHeight + Height(1);
-					return ChainBlocksFrom(futureSupplier, nextHeight, forkDepth, pRangeAggregator, unprocessedElements);
+					return ChainBlocksFrom(futureSupplier, nextHeight, limits, pRangeAggregator, unprocessedElements);
 				} catch (const catapult_runtime_error& e) {
 					CATAPULT_LOG(warning) << "exception thrown while requesting blocks: " << e.what();
 					return thread::make_ready_future(ionet::NodeInteractionResultCode::Failure);
@@ -230,13 +318,17 @@ namespace catapult { namespace chain {
 			DefaultChainSynchronizer(
 					const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 					const ChainSynchronizerConfiguration& config,
-					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer)
+					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer,
+					const ChainSynchronizerMonitors& monitors)
 					: m_pLocalChainApi(pLocalChainApi)
 					, m_compareChainOptions(config.MaxBlocksPerSyncAttempt, config.MaxRollbackBlocks)
 					, m_blocksFromOptions(config.MaxBlocksPerSyncAttempt, config.MaxChainBytesPerSyncAttempt)
 					, m_pUnprocessedElements(std::make_shared<UnprocessedElements>(
 							blockRangeConsumer,
 							3 * config.MaxChainBytesPerSyncAttempt))
+					, m_maxChainBytesPerSyncAttempt(config.MaxChainBytesPerSyncAttempt)
+					, m_targetBlocksPerSyncAttemptSupplier(config.TargetBlocksPerSyncAttemptSupplier)
+					, m_monitors(monitors)
 			{}
 
 		public:
@@ -264,8 +356,14 @@ namespace catapult { namespace chain {
 			// in case that there are no unprocessed elements in the disruptor, we do a normal synchronization round
 			// else we bypass chain comparison and expand the existing chain part by pulling more blocks
 			thread::future<CompareChainsResult> compareChains(const RemoteApiType& remoteChainApi) {
-				if (m_pUnprocessedElements->empty())
-					return CompareChains(*m_pLocalChainApi, remoteChainApi, m_compareChainOptions);
+				if (m_pUnprocessedElements->empty()) {
+					// chain comparisons issue multiple requests, so round trip times are only measured for the chain info request
+					auto pTimingChainApi = std::make_shared<RoundTripTimingChainApi>(remoteChainApi, m_monitors.RoundTripTimeConsumer);
+					auto compareChainsFuture = CompareChains(*m_pLocalChainApi, *pTimingChainApi, m_compareChainOptions);
+					return RecordLatency(std::move(compareChainsFuture), m_monitors.pCompareChains, [pTimingChainApi](
+							const auto&,
+							const auto&) {});
+				}
 
 				CompareChainsResult result;
 				result.Code = ChainComparisonCode::Remote_Is_Not_Synced;
@@ -287,13 +385,19 @@ namespace catapult { namespace chain {
 					return thread::make_ready_future(std::move(code));
 				}
 
+				// without a target, a single request is made unless more blocks are needed to resolve a fork
+				ChainBlocksFromLimits limits;
+				limits.ForkDepth = compareResult.ForkDepth;
+				limits.TargetNumBlocks = m_targetBlocksPerSyncAttemptSupplier ? m_targetBlocksPerSyncAttemptSupplier() : 0;
+				limits.MaxNumBytes = m_maxChainBytesPerSyncAttempt;
+
 				CATAPULT_LOG(debug)
 						<< "pulling blocks from remote with common height " << compareResult.CommonBlockHeight
-						<< " (fork depth = " << compareResult.ForkDepth << ")";
+						<< " (fork depth = " << compareResult.ForkDepth << ", target blocks = " << limits.TargetNumBlocks << ")";
 				return ChainBlocksFrom(
-						CreateFutureSupplier(remoteChainApi, m_blocksFromOptions),
+						CreateFutureSupplier(remoteChainApi, m_blocksFromOptions, m_monitors),
 						compareResult.CommonBlockHeight + Height(1),
-						compareResult.ForkDepth,
+						limits,
 						std::make_shared<RangeAggregator>(remoteChainApi.remoteIdentity()),
 						*m_pUnprocessedElements);
 			}
@@ -303,6 +407,9 @@ namespace catapult { namespace chain {
 			CompareChainsOptions m_compareChainOptions;
 			api::BlocksFromOptions m_blocksFromOptions;
 			std::shared_ptr<UnprocessedElements> m_pUnprocessedElements;
+			uint32_t m_maxChainBytesPerSyncAttempt;
+			supplier<uint32_t> m_targetBlocksPerSyncAttemptSupplier;
+			ChainSynchronizerMonitors m_monitors;
 		};
 	}
 
@@ -310,7 +417,20 @@ namespace catapult { namespace chain {
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
-		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(pLocalChainApi, config, blockRangeConsumer);
+		ChainSynchronizerMonitors monitors;
+		monitors.pCompareChains = std::make_shared<utils::LatencyHistogram>();
+		monitors.pBlocksFrom = std::make_shared<utils::LatencyHistogram>();
+		monitors.RoundTripTimeConsumer = [](const auto&, const auto&) {};
+		monitors.ThroughputConsumer = [](const auto&, auto, const auto&) {};
+		return CreateChainSynchronizer(pLocalChainApi, config, blockRangeConsumer, monitors);
+	}
+
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer,
+			const ChainSynchronizerMonitors& monitors) {
+		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(pLocalChainApi, config, blockRangeConsumer, monitors);
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
 }}
@@ -21,8 +21,11 @@
 #pragma once
 #include "RemoteNodeSynchronizer.h"
 #include "catapult/disruptor/DisruptorTypes.h"
+#include "catapult/functions.h"
 #include "catapult/model/AnnotatedEntityRange.h"
 #include "catapult/model/RangeTypes.h"
+#include "catapult/utils/LatencyHistogram.h"
+#include "catapult/utils/TimeSpan.h"
 
 namespace catapult {
 	namespace api {
@@ -52,6 +55,25 @@ namespace catapult { namespace chain {
 
 		/// Maximum number of blocks that can be rolled back.
 		uint32_t MaxRollbackBlocks;
+
+		/// Supplies the number of blocks that a sync attempt should try to pull by chaining requests (optional).
+		/// \note Chained requests stop early when the pulled blocks reach MaxChainBytesPerSyncAttempt.
+		supplier<uint32_t> TargetBlocksPerSyncAttemptSupplier;
+	};
+
+	/// Monitors of remote api calls made by a chain synchronizer.
+	struct ChainSynchronizerMonitors {
+		/// Latencies of chain comparisons.
+		std::shared_ptr<utils::LatencyHistogram> pCompareChains;
+
+		/// Latencies of blocks from requests.
+		std::shared_ptr<utils::LatencyHistogram> pBlocksFrom;
+
+		/// Consumer of round trip times of successful chain info requests per remote node.
+		consumer<const model::NodeIdentity&, const utils::TimeSpan&> RoundTripTimeConsumer;
+
+		/// Consumer of transferred bytes and elapsed times of successful blocks from requests per remote node.
+		consumer<const model::NodeIdentity&, uint64_t, const utils::TimeSpan&> ThroughputConsumer;
 	};
 
 	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), a block chain \a config and
@@ -60,4 +82,12 @@ namespace catapult { namespace chain {
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
+
+	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), a block chain \a config and
+	/// a block range consumer (\a blockRangeConsumer) that reports remote api call measurements to \a monitors.
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer,
+			const ChainSynchronizerMonitors& monitors);
 }}
@@ -46,6 +46,9 @@ namespace catapult { namespace chain {
 		/// Undoes all executions since enableUndo was first called.
 		void undo();
 
+		/// Disables validation of subsequent notifications so that they are only observed.
+		void disableValidation();
+
 	public:
 		void notify(const model::Notification& notification) override;
 
@@ -62,5 +65,6 @@ namespace catapult { namespace chain {
 		ProcessingUndoNotificationSubscriber m_undoNotificationSubscriber;
 		validators::ValidationResult m_aggregateResult;
 		bool m_isUndoEnabled;
+		bool m_isValidationEnabled;
 	};
 }}
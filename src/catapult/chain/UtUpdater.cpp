@@ -27,19 +27,71 @@
 #include "catapult/cache/RelockableDetachedCatapultCache.h"
 #include "catapult/cache_tx/UtCache.h"
 #include "catapult/model/FeeUtils.h"
+#include "catapult/model/TransactionUtils.h"
 #include "catapult/utils/HexFormatter.h"
 
 namespace catapult { namespace chain {
 
 	namespace {
 		struct ApplyState {
-			constexpr ApplyState(cache::UtCacheModifierProxy& modifier, cache::CatapultCacheDelta& unconfirmedCatapultCache)
+			constexpr ApplyState(
+					cache::UtCacheModifierProxy& modifier,
+					cache::CatapultCacheDelta& unconfirmedCatapultCache,
+					const chain::FailedTransactionSink& failedTransactionSink)
 					: Modifier(modifier)
 					, UnconfirmedCatapultCache(unconfirmedCatapultCache)
+					, FailedTransactionSink(failedTransactionSink)
 			{}
 
 			cache::UtCacheModifierProxy& Modifier;
 			cache::CatapultCacheDelta& UnconfirmedCatapultCache;
+			const chain::FailedTransactionSink& FailedTransactionSink;
+		};
+
+		// tracks accounts with state that might differ from the state against which existing transactions were last validated
+		class AffectedAddresses {
+		public:
+			explicit AffectedAddresses(const model::UnresolvedAddressSet& changedAddresses)
+					: m_changedAddresses(changedAddresses)
+					, m_areChangedAddressesResolved(false)
+			{}
+
+		public:
+			bool contains(const model::UnresolvedAddressSet& addresses, const model::ResolverContext& resolvers) {
+				resolveChangedAddresses(resolvers);
+				return std::any_of(addresses.cbegin(), addresses.cend(), [this, &resolvers](const auto& address) {
+					auto resolvedAddress = resolvers.resolve(address);
+
+					// aliased addresses are always affected because alias targets can change between blocks
+					return IsAlias(address, resolvedAddress) || m_addresses.cend() != m_addresses.find(resolvedAddress);
+				});
+			}
+
+			void add(const model::UnresolvedAddressSet& addresses, const model::ResolverContext& resolvers) {
+				resolveChangedAddresses(resolvers);
+				for (const auto& address : addresses)
+					m_addresses.insert(resolvers.resolve(address));
+			}
+
+		private:
+			void resolveChangedAddresses(const model::ResolverContext& resolvers) {
+				if (m_areChangedAddressesResolved)
+					return;
+
+				for (const auto& address : m_changedAddresses)
+					m_addresses.insert(resolvers.resolve(address));
+
+				m_areChangedAddressesResolved = true;
+			}
+
+			static bool IsAlias(const UnresolvedAddress& address, const Address& resolvedAddress) {
+				return 0 != std::memcmp(address.data(), resolvedAddress.data(), Address::Size);
+			}
+
+		private:
+			const model::UnresolvedAddressSet& m_changedAddresses;
+			bool m_areChangedAddressesResolved;
+			model::AddressSet m_addresses;
 		};
 	}
 
@@ -74,16 +126,12 @@ namespace catapult { namespace chain {
 				return;
 			}
 
-			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache);
+			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache, m_failedTransactionSink);
 			apply(applyState, utInfos, TransactionSource::New);
 		}
 
 		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
-			if (!confirmedTransactionHashes.empty() || !utInfos.empty()) {
-				CATAPULT_LOG(debug)
-						<< "confirmed " << confirmedTransactionHashes.size() << " transactions, "
-						<< "reverted " << utInfos.size() << " transactions";
-			}
+			logUpdate(confirmedTransactionHashes, utInfos);
 
 			// 1. lock and clear the UT cache - UT cache must be locked before catapult cache to prevent race condition whereby
 			//    other update overload applies transactions to rebased cache before UT lock is held
@@ -93,30 +141,94 @@ namespace catapult { namespace chain {
 			// 2. lock the catapult cache and rebase the unconfirmed catapult cache
 			auto pUnconfirmedCatapultCache = m_detachedCatapultCache.rebaseAndLock();
 
-			// 3. add back reverted txes
-			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache);
-			apply(applyState, utInfos, TransactionSource::Reverted);
+			// 3. add back reverted and original txes
+			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache, m_failedTransactionSink);
+			rebase(applyState, confirmedTransactionHashes, utInfos, originalTransactionInfos, nullptr);
+		}
 
-			// 4. add back original txes that have not been confirmed
-			apply(applyState, originalTransactionInfos, TransactionSource::Existing, [&confirmedTransactionHashes](const auto& info) {
-				return confirmedTransactionHashes.cend() == confirmedTransactionHashes.find(&info.EntityHash);
-			});
+		void update(
+				const utils::HashPointerSet& confirmedTransactionHashes,
+				const std::vector<model::TransactionInfo>& utInfos,
+				const model::UnresolvedAddressSet& changedAddresses) {
+			logUpdate(confirmedTransactionHashes, utInfos);
+
+			// 1. lock and clear the UT cache (see above)
+			auto modifier = m_transactionsCache.modifier();
+			auto originalTransactionInfos = modifier.removeAll();
+
+			// 2. lock the catapult cache and rebase the unconfirmed catapult cache
+			auto pUnconfirmedCatapultCache = m_detachedCatapultCache.rebaseAndLock();
+
+			// 3. add back reverted and original txes, only revalidating original txes that are affected by changed accounts
+			//    failures raised by the partial rebase must not be raised again by the fallback rebase
+			utils::HashSet failedTransactionHashes;
+			FailedTransactionSink failedTransactionSink = [this, &failedTransactionHashes](
+					const auto& transaction,
+					const auto& hash,
+					auto result) {
+				if (failedTransactionHashes.insert(hash).second)
+					m_failedTransactionSink(transaction, hash, result);
+			};
+
+			try {
+				AffectedAddresses affectedAddresses(changedAddresses);
+				auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache, failedTransactionSink);
+				rebase(applyState, confirmedTransactionHashes, utInfos, originalTransactionInfos, &affectedAddresses);
+				return;
+			} catch (const std::exception& ex) {
+				CATAPULT_LOG(warning) << "incremental rebase failed, falling back to full rebase: " << ex.what();
+			}
+
+			// 4. an unvalidated observer failed, so discard all (partial) changes and revalidate everything
+			modifier.removeAll();
+			pUnconfirmedCatapultCache.reset();
+			pUnconfirmedCatapultCache = m_detachedCatapultCache.rebaseAndLock();
+
+			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache, failedTransactionSink);
+			rebase(applyState, confirmedTransactionHashes, utInfos, originalTransactionInfos, nullptr);
 		}
 
 	private:
+		void logUpdate(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
+			if (confirmedTransactionHashes.empty() && utInfos.empty())
+				return;
+
+			CATAPULT_LOG(debug)
+					<< "confirmed " << confirmedTransactionHashes.size() << " transactions, "
+					<< "reverted " << utInfos.size() << " transactions";
+		}
+
+		void rebase(
+				const ApplyState& applyState,
+				const utils::HashPointerSet& confirmedTransactionHashes,
+				const std::vector<model::TransactionInfo>& revertedTransactionInfos,
+				const std::vector<model::TransactionInfo>& originalTransactionInfos,
+				AffectedAddresses* pAffectedAddresses) {
+			// 1. add back reverted txes
+			apply(applyState, revertedTransactionInfos, TransactionSource::Reverted, [](const auto&) { return true; }, pAffectedAddresses);
+
+			// 2. add back original txes that have not been confirmed
+			auto isUnconfirmed = [&confirmedTransactionHashes](const auto& info) {
+				return confirmedTransactionHashes.cend() == confirmedTransactionHashes.find(&info.EntityHash);
+			};
+			apply(applyState, originalTransactionInfos, TransactionSource::Existing, isUnconfirmed, pAffectedAddresses);
+		}
+
 		void apply(const ApplyState& applyState, const std::vector<model::TransactionInfo>& utInfos, TransactionSource transactionSource) {
-			apply(applyState, utInfos, transactionSource, [](const auto&) { return true; });
+			apply(applyState, utInfos, transactionSource, [](const auto&) { return true; }, nullptr);
 		}
 
 		void apply(
 				const ApplyState& applyState,
 				const std::vector<model::TransactionInfo>& utInfos,
 				TransactionSource transactionSource,
-				const predicate<const model::TransactionInfo&>& filter) {
+				const predicate<const model::TransactionInfo&>& filter,
+				AffectedAddresses* pAffectedAddresses) {
 			// note that the validator and observer context height is one larger than the chain height
 			// since the validation and observation has to be for the *next* block
 			auto effectiveHeight = m_detachedCatapultCache.height() + Height(1);
-			ProcessContextsBuilder contextBuilder(effectiveHeight, m_timeSupplier(), m_executionConfig);
+			auto time = m_timeSupplier();
+			ProcessContextsBuilder contextBuilder(effectiveHeight, time, m_executionConfig);
 			contextBuilder.setCache(applyState.UnconfirmedCatapultCache);
 			auto validatorContext = contextBuilder.buildValidatorContext();
 			auto observerContext = contextBuilder.buildObserverContext();
@@ -128,6 +240,24 @@ namespace catapult { namespace chain {
 				if (!filter(utInfo))
 					continue;
 
+				// when tracking affected accounts, any transaction that is not simply reapplied affects all of its accounts
+				std::shared_ptr<const model::UnresolvedAddressSet> pAddresses;
+				auto requiresValidation = true;
+				auto markAffected = [pAffectedAddresses, &pAddresses, &resolvers = validatorContext.Resolvers]() {
+					if (pAffectedAddresses)
+						pAffectedAddresses->add(*pAddresses, resolvers);
+				};
+
+				if (pAffectedAddresses) {
+					pAddresses = extractAddresses(utInfo);
+					requiresValidation = TransactionSource::Existing != transactionSource
+							|| entity.Deadline < time
+							|| pAffectedAddresses->contains(*pAddresses, validatorContext.Resolvers);
+
+					if (requiresValidation)
+						markAffected();
+				}
+
 				auto minTransactionFee = model::CalculateTransactionFee(m_minFeeMultiplier, entity);
 				if (entity.MaxFee < minTransactionFee) {
 					// don't log reverted transactions that could have been included by harvester with lower min fee multiplier
@@ -137,12 +267,14 @@ namespace catapult { namespace chain {
 								<< " because min fee is " << minTransactionFee;
 					}
 
+					markAffected();
 					continue;
 				}
 
 				if (throttle(utInfo, transactionSource, applyState, validatorContext.Cache)) {
 					CATAPULT_LOG(warning) << "dropping transaction " << entityHash << " due to throttle";
-					m_failedTransactionSink(entity, entityHash, Failure_Chain_Unconfirmed_Cache_Too_Full);
+					applyState.FailedTransactionSink(entity, entityHash, Failure_Chain_Unconfirmed_Cache_Too_Full);
+					markAffected();
 					continue;
 				}
 
@@ -154,6 +286,9 @@ namespace catapult { namespace chain {
 				const auto& observer = *m_executionConfig.pObserver;
 				ProcessingNotificationSubscriber sub(validator, validatorContext, observer, observerContext);
 				sub.enableUndo();
+				if (!requiresValidation)
+					sub.disableValidation();
+
 				auto entityInfo = model::WeakEntityInfo(entity, entityHash);
 				m_executionConfig.pNotificationPublisher->publish(entityInfo, sub);
 				if (!IsValidationResultSuccess(sub.result())) {
@@ -162,7 +297,7 @@ namespace catapult { namespace chain {
 
 					// only forward failure (not neutral) results
 					if (IsValidationResultFailure(sub.result()))
-						m_failedTransactionSink(entity, entityHash, sub.result());
+						applyState.FailedTransactionSink(entity, entityHash, sub.result());
 
 					sub.undo();
 					applyState.Modifier.remove(entityHash);
@@ -179,6 +314,14 @@ namespace catapult { namespace chain {
 			return m_throttle(utInfo, { transactionSource, m_detachedCatapultCache.height(), cache, applyState.Modifier });
 		}
 
+		std::shared_ptr<const model::UnresolvedAddressSet> extractAddresses(const model::TransactionInfo& utInfo) const {
+			if (utInfo.OptionalExtractedAddresses)
+				return utInfo.OptionalExtractedAddresses;
+
+			return std::make_shared<model::UnresolvedAddressSet>(
+					model::ExtractAddresses(*utInfo.pEntity, *m_executionConfig.pNotificationPublisher));
+		}
+
 		void addAll(cache::UtCacheModifierProxy& modifier, const std::vector<model::TransactionInfo>& utInfos) {
 			for (const auto& utInfo : utInfos)
 				modifier.add(utInfo);
@@ -221,4 +364,11 @@ namespace catapult { namespace chain {
 	void UtUpdater::update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
 		m_pImpl->update(confirmedTransactionHashes, utInfos);
 	}
+
+	void UtUpdater::update(
+			const utils::HashPointerSet& confirmedTransactionHashes,
+			const std::vector<model::TransactionInfo>& utInfos,
+			const model::UnresolvedAddressSet& changedAddresses) {
+		m_pImpl->update(confirmedTransactionHashes, utInfos, changedAddresses);
+	}
 }}
@@ -21,6 +21,7 @@
 #pragma once
 #include "ChainFunctions.h"
 #include "ExecutionConfiguration.h"
+#include "catapult/model/ContainerTypes.h"
 #include "catapult/model/EntityInfo.h"
 #include "catapult/observers/ObserverTypes.h"
 #include "catapult/utils/ArraySet.h"
@@ -94,6 +95,14 @@ namespace catapult { namespace chain {
 		/// removing transactions with hashes in \a confirmedTransactionHashes.
 		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos);
 
+		/// Updates this cache by applying new transaction infos in \a utInfos and
+		/// removing transactions with hashes in \a confirmedTransactionHashes.
+		/// Existing transactions that are not affected by any account in \a changedAddresses are reapplied without revalidation.
+		void update(
+				const utils::HashPointerSet& confirmedTransactionHashes,
+				const std::vector<model::TransactionInfo>& utInfos,
+				const model::UnresolvedAddressSet& changedAddresses);
+
 	private:
 		class Impl;
 		std::unique_ptr<Impl> m_pImpl;
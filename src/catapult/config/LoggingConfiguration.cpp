@@ -35,6 +35,8 @@ namespace catapult { namespace config {
 
 		LOAD_CONSOLE_LOGGER_PROPERTY(SinkType);
 		LOAD_CONSOLE_LOGGER_PROPERTY(Level);
+		LOAD_CONSOLE_LOGGER_PROPERTY(QueueCapacity);
+		LOAD_CONSOLE_LOGGER_PROPERTY(OverflowPolicy);
 		LOAD_CONSOLE_LOGGER_PROPERTY(ColorMode);
 
 #undef LOAD_CONSOLE_LOGGER_PROPERTY
@@ -43,6 +45,8 @@ namespace catapult { namespace config {
 
 		LOAD_FILE_LOGGER_PROPERTY(SinkType);
 		LOAD_FILE_LOGGER_PROPERTY(Level);
+		LOAD_FILE_LOGGER_PROPERTY(QueueCapacity);
+		LOAD_FILE_LOGGER_PROPERTY(OverflowPolicy);
 		LOAD_FILE_LOGGER_PROPERTY(Directory);
 		LOAD_FILE_LOGGER_PROPERTY(FilePattern);
 		LOAD_FILE_LOGGER_PROPERTY(RotationSize);
@@ -55,7 +59,7 @@ namespace catapult { namespace config {
 		config.Console.ComponentLevels = bag.getAll<utils::LogLevel>("console.component.levels");
 		config.File.ComponentLevels = bag.getAll<utils::LogLevel>("file.component.levels");
 
-		utils::VerifyBagSizeLte(bag, 10 + config.Console.ComponentLevels.size() + config.File.ComponentLevels.size());
+		utils::VerifyBagSizeLte(bag, 14 + config.Console.ComponentLevels.size() + config.File.ComponentLevels.size());
 		return config;
 	}
 
@@ -65,12 +69,16 @@ namespace catapult { namespace config {
 		utils::BasicLoggerOptions options;
 		options.SinkType = config.SinkType;
 		options.ColorMode = config.ColorMode;
+		options.QueueCapacity = config.QueueCapacity;
+		options.OverflowPolicy = config.OverflowPolicy;
 		return options;
 	}
 
 	utils::FileLoggerOptions GetFileLoggerOptions(const FileLoggerConfiguration& config) {
 		utils::FileLoggerOptions options(config.Directory, config.FilePattern);
 		options.SinkType = config.SinkType;
+		options.QueueCapacity = config.QueueCapacity;
+		options.OverflowPolicy = config.OverflowPolicy;
 
 		options.RotationSize = config.RotationSize.bytes();
 		options.MaxTotalSize = config.MaxTotalSize.bytes();
@@ -36,6 +36,12 @@ namespace catapult { namespace config {
 		/// Log level.
 		utils::LogLevel Level;
 
+		/// Maximum number of records queued by an asynchronous sink.
+		uint32_t QueueCapacity;
+
+		/// Policy applied when the queue of an asynchronous sink is full.
+		utils::LogOverflowPolicy OverflowPolicy;
+
 		/// Custom component log levels.
 		std::unordered_map<std::string, utils::LogLevel> ComponentLevels;
 	};
@@ -43,12 +43,21 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(EnableSingleThreadPool);
 		LOAD_NODE_PROPERTY(EnableCacheDatabaseStorage);
 		LOAD_NODE_PROPERTY(EnableAutoSyncCleanup);
+		LOAD_NODE_PROPERTY(EnableIncrementalUtRebase);
 
 		LOAD_NODE_PROPERTY(EnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
 
+		LOAD_NODE_PROPERTY(EnableTransactionAnnouncements);
+		LOAD_NODE_PROPERTY(MaxTransactionAnnouncementFanOut);
+		LOAD_NODE_PROPERTY(MaxKnownTransactionHashesPerPeer);
+		LOAD_NODE_PROPERTY(EnableCompactBlockRelay);
+
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(EnableAdaptiveSync);
+		LOAD_NODE_PROPERTY(AdaptiveSyncMinDelay);
+		LOAD_NODE_PROPERTY(MaxAdaptiveSyncBatchMultiplier);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -67,6 +76,15 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(SocketWorkingBufferSensitivity);
 		LOAD_NODE_PROPERTY(MaxPacketDataSize);
 
+		LOAD_NODE_PROPERTY(EnableTlsSessionResumption);
+		LOAD_NODE_PROPERTY(MaxTlsSessionCacheSize);
+		LOAD_NODE_PROPERTY(MaxVerifiedCertificateCacheSize);
+
+		LOAD_NODE_PROPERTY(EnableFairShareReads);
+		LOAD_NODE_PROPERTY(FairShareReadInterval);
+		LOAD_NODE_PROPERTY(FairShareReadMinSize);
+		LOAD_NODE_PROPERTY(FairShareReadPriorityWeight);
+
 		LOAD_NODE_PROPERTY(BlockDisruptorSize);
 		LOAD_NODE_PROPERTY(BlockElementTraceInterval);
 		LOAD_NODE_PROPERTY(TransactionDisruptorSize);
@@ -74,8 +92,14 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(EnableDispatcherAbortWhenFull);
 		LOAD_NODE_PROPERTY(EnableDispatcherInputAuditing);
+		LOAD_NODE_PROPERTY(EnableTracing);
 
+		LOAD_NODE_PROPERTY(MaxCacheCommitThreads);
 		LOAD_NODE_PROPERTY(MaxCacheDatabaseWriteBatchSize);
+		LOAD_NODE_PROPERTY(MaxCacheDatabaseDecodedValuesSize);
+		LOAD_NODE_PROPERTY(MaxCacheDatabasePatriciaTreeNodesSize);
+		LOAD_NODE_PROPERTY(MaxStatePathsKeys);
+		LOAD_NODE_PROPERTY(MaxSpoolSegmentSize);
 		LOAD_NODE_PROPERTY(MaxTrackedNodes);
 
 		LOAD_NODE_PROPERTY(BatchVerificationRandomSource);
@@ -126,7 +150,7 @@ namespace catapult { namespace config {
 
 #undef LOAD_BANNING_PROPERTY
 
-		utils::VerifyBagSizeLte(bag, 35 + 4 + 4 + 5 + 7);
+		utils::VerifyBagSizeLte(bag, 56 + 4 + 4 + 5 + 7);
 		return config;
 	}
 
@@ -54,18 +54,42 @@ namespace catapult { namespace config {
 		/// \note This should be \c false if broker process is running.
 		bool EnableAutoSyncCleanup;
 
+		/// \c true if unconfirmed transactions unaffected by new blocks should be reapplied without revalidation.
+		bool EnableIncrementalUtRebase;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool EnableTransactionSpamThrottling;
 
 		/// Maximum fee that will boost a transaction through the spam throttle when spam throttling is enabled.
 		Amount TransactionSpamThrottlingMaxBoostFee;
 
+		/// \c true if new transactions should be announced (by hash) to a subset of peers instead of pushed to all peers.
+		bool EnableTransactionAnnouncements;
+
+		/// Maximum number of peers to which new transactions are announced when announcements are enabled.
+		uint32_t MaxTransactionAnnouncementFanOut;
+
+		/// Maximum number of transaction hashes remembered as known per peer when announcements are enabled.
+		uint32_t MaxKnownTransactionHashesPerPeer;
+
+		/// \c true if new blocks should be relayed as compact blocks that are reconstructed from unconfirmed transactions.
+		bool EnableCompactBlockRelay;
+
 		/// Maximum number of blocks per sync attempt.
 		uint32_t MaxBlocksPerSyncAttempt;
 
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// \c true if the synchronizer interval and batch size should adapt to the gap between the local and network chain heights.
+		bool EnableAdaptiveSync;
+
+		/// Minimum delay between sync attempts when adaptive sync is catching up.
+		utils::TimeSpan AdaptiveSyncMinDelay;
+
+		/// Maximum multiple of MaxBlocksPerSyncAttempt that a sync attempt can pull when adaptive sync is catching up.
+		uint32_t MaxAdaptiveSyncBatchMultiplier;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -106,6 +130,29 @@ namespace catapult { namespace config {
 		/// Maximum packet data size.
 		utils::FileSize MaxPacketDataSize;
 
+		/// \c true if tls sessions should be resumed when reconnecting to peers.
+		bool EnableTlsSessionResumption;
+
+		/// Maximum number of resumable tls sessions cached per connection settings.
+		uint32_t MaxTlsSessionCacheSize;
+
+		/// Maximum number of verified peer certificates cached per connection settings.
+		/// \note \c 0 will disable caching.
+		uint32_t MaxVerifiedCertificateCacheSize;
+
+		/// \c true if reads from peers exceeding their fair share of the read capacity should be deferred.
+		/// \note Per peer read traffic is accounted even when this is disabled.
+		bool EnableFairShareReads;
+
+		/// Duration of a fair share read accounting interval.
+		utils::TimeSpan FairShareReadInterval;
+
+		/// Weighted size that every peer can read within a fair share read accounting interval without being deferred.
+		utils::FileSize FairShareReadMinSize;
+
+		/// Factor by which the fair share read cost of block and sync packets is reduced.
+		uint32_t FairShareReadPriorityWeight;
+
 		/// Size of the block disruptor circular buffer.
 		uint32_t BlockDisruptorSize;
 
@@ -124,9 +171,31 @@ namespace catapult { namespace config {
 		/// \c true if all dispatcher inputs should be audited.
 		bool EnableDispatcherInputAuditing;
 
+		/// \c true if spans should be traced through dispatchers, block execution and cache commits.
+		bool EnableTracing;
+
+		/// Maximum number of threads used to commit sub caches concurrently.
+		/// \note Sub caches are committed sequentially when this is zero or one.
+		uint32_t MaxCacheCommitThreads;
+
 		/// Maximum cache database write batch size.
 		utils::FileSize MaxCacheDatabaseWriteBatchSize;
 
+		/// Maximum size of decoded values cached per sub-cache database (shared by all of its columns).
+		/// \note Decoded values are not cached when this is zero.
+		utils::FileSize MaxCacheDatabaseDecodedValuesSize;
+
+		/// Maximum size of decoded patricia tree nodes cached across all cache databases.
+		/// \note Decoded patricia tree nodes are not cached when this is zero.
+		utils::FileSize MaxCacheDatabasePatriciaTreeNodesSize;
+
+		/// Maximum number of keys in a single state paths request.
+		uint32_t MaxStatePathsKeys;
+
+		/// Maximum size of spool segment files.
+		/// \note When zero, each spooled message is written to a separate file.
+		utils::FileSize MaxSpoolSegmentSize;
+
 		/// Maximum number of nodes to track in memory.
 		uint32_t MaxTrackedNodes;
 
@@ -25,6 +25,7 @@
 #include "catapult/chain/BlockScorer.h"
 #include "catapult/chain/ChainUtils.h"
 #include "catapult/io/BlockStorageCache.h"
+#include "catapult/model/Address.h"
 #include "catapult/model/BlockUtils.h"
 #include "catapult/utils/Casting.h"
 #include "catapult/utils/StackLogger.h"
@@ -38,6 +39,34 @@ namespace catapult { namespace consumers {
 			return disruptor::CompletionStatus::Aborted == result.CompletionStatus;
 		}
 
+		UnresolvedAddress ToUnresolvedAddress(const Key& publicKey, model::NetworkIdentifier networkIdentifier) {
+			auto address = model::PublicKeyToAddress(publicKey, networkIdentifier);
+
+			UnresolvedAddress unresolvedAddress;
+			std::memcpy(unresolvedAddress.data(), address.data(), address.size());
+			return unresolvedAddress;
+		}
+
+		std::unique_ptr<model::UnresolvedAddressSet> CollectChangedAddresses(const BlockElements& elements) {
+			auto pAddresses = std::make_unique<model::UnresolvedAddressSet>();
+			for (const auto& element : elements) {
+				const auto& block = element.Block;
+				pAddresses->insert(ToUnresolvedAddress(block.SignerPublicKey, block.Network));
+				pAddresses->insert(ToUnresolvedAddress(block.BeneficiaryPublicKey, block.Network));
+
+				for (const auto& transactionElement : element.Transactions) {
+					// changes are unknown when addresses have not been extracted
+					if (!transactionElement.OptionalExtractedAddresses)
+						return nullptr;
+
+					const auto& addresses = *transactionElement.OptionalExtractedAddresses;
+					pAddresses->insert(addresses.cbegin(), addresses.cend());
+				}
+			}
+
+			return pAddresses;
+		}
+
 		struct UnwindResult {
 		public:
 			model::ChainScore Score;
@@ -53,9 +82,10 @@ namespace catapult { namespace consumers {
 		public:
 			SyncState() = default;
 
-			explicit SyncState(cache::CatapultCache& cache)
+			SyncState(cache::CatapultCache& cache, Height localChainHeight)
 					: m_pOriginalCache(&cache)
 					, m_pCacheDelta(std::make_unique<cache::CatapultCacheDelta>(cache.createDelta()))
+					, m_localChainHeight(localChainHeight)
 			{}
 
 		public:
@@ -67,6 +97,10 @@ namespace catapult { namespace consumers {
 				return m_pCommonBlockElement->Block.Height;
 			}
 
+			bool hasRollback() const {
+				return commonBlockHeight() != m_localChainHeight;
+			}
+
 			const model::ChainScore& scoreDelta() const {
 				return m_scoreDelta;
 			}
@@ -101,6 +135,7 @@ namespace catapult { namespace consumers {
 		private:
 			cache::CatapultCache* m_pOriginalCache;
 			std::unique_ptr<cache::CatapultCacheDelta> m_pCacheDelta; // unique_ptr to allow explicit release of lock in commit
+			Height m_localChainHeight;
 			std::shared_ptr<const model::BlockElement> m_pCommonBlockElement;
 			model::ChainScore m_scoreDelta;
 			TransactionInfos m_removedTransactionInfos;
@@ -164,7 +199,7 @@ namespace catapult { namespace consumers {
 					return Abort(Failure_Consumer_Remote_Chain_Difficulties_Mismatch);
 
 				// 4. unwind to the common block height and calculate the local chain score
-				syncState = SyncState(m_cache);
+				syncState = SyncState(m_cache, localChainHeight);
 				auto commonBlockHeight = peerStartHeight - Height(1);
 				auto observerState = syncState.observerState();
 				auto unwindResult = unwindLocalChain(localChainHeight, commonBlockHeight, storageView, observerState);
@@ -269,7 +304,8 @@ namespace catapult { namespace consumers {
 				auto revertedTransactionInfos = CollectRevertedTransactionInfos(
 						peerTransactionHashes,
 						syncState.detachRemovedTransactionInfos());
-				m_handlers.TransactionsChange({ peerTransactionHashes, revertedTransactionInfos });
+				auto pChangedAddresses = syncState.hasRollback() ? nullptr : CollectChangedAddresses(elements);
+				m_handlers.TransactionsChange({ peerTransactionHashes, revertedTransactionInfos, pChangedAddresses.get() });
 			}
 
 		private:
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "BlockChainProcessor.h"
+#include "catapult/model/ContainerTypes.h"
 #include "catapult/subscribers/StateChangeInfo.h"
 #include "catapult/utils/ArraySet.h"
 
@@ -37,8 +38,18 @@ namespace catapult { namespace consumers {
 		TransactionsChangeInfo(
 				const utils::HashPointerSet& addedTransactionHashes,
 				const std::vector<model::TransactionInfo>& revertedTransactionInfos)
+				: TransactionsChangeInfo(addedTransactionHashes, revertedTransactionInfos, nullptr)
+		{}
+
+		/// Creates a new transactions change info around \a addedTransactionHashes, \a revertedTransactionInfos
+		/// and (optional) \a pChangedAddresses.
+		TransactionsChangeInfo(
+				const utils::HashPointerSet& addedTransactionHashes,
+				const std::vector<model::TransactionInfo>& revertedTransactionInfos,
+				const model::UnresolvedAddressSet* pChangedAddresses)
 				: AddedTransactionHashes(addedTransactionHashes)
 				, RevertedTransactionInfos(revertedTransactionInfos)
+				, pChangedAddresses(pChangedAddresses)
 		{}
 
 	public:
@@ -47,6 +58,10 @@ namespace catapult { namespace consumers {
 
 		/// Infos of the transactions that were reverted (previously confirmed).
 		const std::vector<model::TransactionInfo>& RevertedTransactionInfos;
+
+		/// Addresses of all accounts touched by the newly confirmed blocks or \c nullptr if they are unknown.
+		/// \note This is only set when the chain was extended without a rollback.
+		const model::UnresolvedAddressSet* pChangedAddresses;
 	};
 
 	/// Type of block passed to undo block handler.
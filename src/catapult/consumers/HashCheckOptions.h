@@ -41,7 +41,7 @@ namespace catapult { namespace consumers {
 		/// Amount of time a hash should be cached.
 		uint64_t CacheDuration;
 
-		/// Minimum amount of time between cache pruning.
+		/// Minimum amount of time between cache pruning (and time span covered by a single expiry bucket).
 		uint64_t PruneInterval;
 
 		/// Maximum size of the cache.
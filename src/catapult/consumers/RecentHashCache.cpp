@@ -19,28 +19,48 @@
 **/
 
 #include "RecentHashCache.h"
-#include "catapult/utils/ContainerHelpers.h"
 #include "catapult/utils/Logging.h"
+#include <algorithm>
 
 namespace catapult { namespace consumers {
 
+	namespace {
+		uint64_t GetBucketDuration(const HashCheckOptions& options) {
+			return std::max<uint64_t>(1, options.PruneInterval);
+		}
+
+		size_t CalculateNumBuckets(const HashCheckOptions& options) {
+			// use enough buckets to fully cover the cache duration in addition to the (partially filled) current bucket
+			auto bucketDuration = GetBucketDuration(options);
+			return static_cast<size_t>((options.CacheDuration + bucketDuration - 1) / bucketDuration + 1);
+		}
+	}
+
 	RecentHashCache::RecentHashCache(const chain::TimeSupplier& timeSupplier, const HashCheckOptions& options)
 			: m_timeSupplier(timeSupplier)
 			, m_options(options)
-			, m_lastPruneTime(m_timeSupplier())
-	{}
+			, m_currentBucketId(toBucketId(m_timeSupplier()))
+			, m_buckets(CalculateNumBuckets(m_options))
+			, m_numBucketEntries(0)
+	{
+		m_buckets[m_currentBucketId % m_buckets.size()].Id = m_currentBucketId;
+	}
 
 	size_t RecentHashCache::size() const {
 		return m_cache.size();
 	}
 
+	size_t RecentHashCache::numBucketEntries() const {
+		return m_numBucketEntries;
+	}
+
 	bool RecentHashCache::add(const Hash256& hash) {
-		auto currentTime = m_timeSupplier();
-		auto isHashKnown = checkAndUpdateExisting(hash, currentTime);
-		pruneCache(currentTime);
+		// check for the hash before pruning so that a hash cannot evict itself
+		auto isHashKnown = contains(hash);
+		pruneCache(m_timeSupplier());
 
-		if (!isHashKnown)
-			tryAddToCache(hash, currentTime);
+		if (!checkAndUpdateExisting(hash))
+			tryAddToCache(hash);
 
 		return !isHashKnown;
 	}
@@ -49,33 +69,83 @@ namespace catapult { namespace consumers {
 		return m_cache.cend() != m_cache.find(hash);
 	}
 
-	bool RecentHashCache::checkAndUpdateExisting(const Hash256& hash, const Timestamp& time) {
+	uint64_t RecentHashCache::toBucketId(const Timestamp& time) const {
+		return time.unwrap() / GetBucketDuration(m_options);
+	}
+
+	bool RecentHashCache::checkAndUpdateExisting(const Hash256& hash) {
 		auto iter = m_cache.find(hash);
-		if (m_cache.end() != iter) {
-			iter->second = time;
-			return true;
+		if (m_cache.end() == iter)
+			return false;
+
+		// move the hash into the current bucket (the stale entry in the old bucket is ignored when that bucket expires)
+		if (m_currentBucketId != iter->second) {
+			iter->second = m_currentBucketId;
+			addToCurrentBucket(hash);
 		}
 
-		return false;
+		return true;
 	}
 
 	void RecentHashCache::pruneCache(const Timestamp& time) {
-		if (time - m_lastPruneTime < Timestamp(m_options.PruneInterval))
+		auto bucketId = toBucketId(time);
+		if (bucketId <= m_currentBucketId)
 			return;
 
-		m_lastPruneTime = time;
-		utils::map_erase_if(m_cache, [duration = m_options.CacheDuration, time](const auto& pair) {
-			return pair.second + Timestamp(duration) < time;
-		});
+		// expire every bucket that is reused by the new bucket range (at most one full rotation is needed)
+		auto numBuckets = m_buckets.size();
+		auto startBucketId = std::max<uint64_t>(m_currentBucketId + 1, bucketId < numBuckets ? 0 : bucketId - numBuckets + 1);
+		for (auto id = startBucketId; id <= bucketId; ++id) {
+			auto& bucket = m_buckets[id % numBuckets];
+			expireBucket(bucket);
+			bucket.Id = id;
+		}
+
+		m_currentBucketId = bucketId;
+	}
+
+	void RecentHashCache::expireBucket(Bucket& bucket) {
+		// only remove hashes that have not been moved into a newer bucket
+		for (const auto& hash : bucket.Hashes) {
+			auto iter = m_cache.find(hash);
+			if (m_cache.end() != iter && bucket.Id == iter->second)
+				m_cache.erase(iter);
+		}
+
+		m_numBucketEntries -= bucket.Hashes.size();
+		bucket.Hashes.clear();
 	}
 
-	void RecentHashCache::tryAddToCache(const Hash256& hash, const Timestamp& time) {
+	void RecentHashCache::tryAddToCache(const Hash256& hash) {
 		// only add the hash if the cache is not full
 		if (m_options.MaxCacheSize <= m_cache.size())
 			return;
 
-		m_cache.emplace(hash, time);
+		m_cache.emplace(hash, m_currentBucketId);
+		addToCurrentBucket(hash);
 		if (m_options.MaxCacheSize == m_cache.size())
 			CATAPULT_LOG(warning) << "short lived hash check cache is full";
 	}
+
+	void RecentHashCache::addToCurrentBucket(const Hash256& hash) {
+		m_buckets[m_currentBucketId % m_buckets.size()].Hashes.push_back(hash);
+		++m_numBucketEntries;
+
+		// every cached hash has exactly one current entry, so compaction removes at least MaxCacheSize stale entries
+		if (2 * m_options.MaxCacheSize < m_numBucketEntries)
+			compactBuckets();
+	}
+
+	void RecentHashCache::compactBuckets() {
+		m_numBucketEntries = 0;
+		for (auto& bucket : m_buckets) {
+			auto staleStartIter = std::remove_if(bucket.Hashes.begin(), bucket.Hashes.end(), [this, &bucket](const auto& hash) {
+				auto iter = m_cache.find(hash);
+				return m_cache.end() == iter || bucket.Id != iter->second;
+			});
+			bucket.Hashes.erase(staleStartIter, bucket.Hashes.end());
+			bucket.Hashes.shrink_to_fit();
+			m_numBucketEntries += bucket.Hashes.size();
+		}
+	}
 }}
@@ -24,10 +24,15 @@
 #include "catapult/utils/Hashers.h"
 #include "catapult/types.h"
 #include <unordered_map>
+#include <vector>
 
 namespace catapult { namespace consumers {
 
 	/// Hash cache that holds recently seen hashes.
+	/// \note Hashes are grouped into time buckets spanning one prune interval each and expire a bucket at a time,
+	///       so every hash is retained for at least the cache duration and at most one additional prune interval.
+	/// \note At most MaxCacheSize hashes are cached. Buckets also keep stale entries of hashes that were seen again,
+	///       but they are compacted whenever they hold more than twice MaxCacheSize entries.
 	class RecentHashCache {
 	public:
 		/// Creates a recent hash cache around \a timeSupplier and \a options.
@@ -37,6 +42,9 @@ namespace catapult { namespace consumers {
 		/// Gets the size of the cache.
 		size_t size() const;
 
+		/// Gets the number of (possibly stale) hash entries held by all buckets.
+		size_t numBucketEntries() const;
+
 	public:
 		/// Checks if \a hash is already in the cache and adds it to the cache if it is unknown.
 		/// \note This also prunes the hash cache.
@@ -46,16 +54,32 @@ namespace catapult { namespace consumers {
 		bool contains(const Hash256& hash) const;
 
 	private:
-		bool checkAndUpdateExisting(const Hash256& hash, const Timestamp& time);
+		struct Bucket {
+			uint64_t Id;
+			std::vector<Hash256> Hashes;
+		};
+
+	private:
+		uint64_t toBucketId(const Timestamp& time) const;
+
+		bool checkAndUpdateExisting(const Hash256& hash);
 
 		void pruneCache(const Timestamp& time);
 
-		void tryAddToCache(const Hash256& hash, const Timestamp& time);
+		void expireBucket(Bucket& bucket);
+
+		void tryAddToCache(const Hash256& hash);
+
+		void addToCurrentBucket(const Hash256& hash);
+
+		void compactBuckets();
 
 	private:
 		chain::TimeSupplier m_timeSupplier;
 		HashCheckOptions m_options;
-		Timestamp m_lastPruneTime;
-		std::unordered_map<Hash256, Timestamp, utils::ArrayHasher<Hash256>> m_cache;
+		uint64_t m_currentBucketId;
+		std::vector<Bucket> m_buckets;
+		size_t m_numBucketEntries;
+		std::unordered_map<Hash256, uint64_t, utils::ArrayHasher<Hash256>> m_cache;
 	};
 }}
@@ -19,6 +19,7 @@
 **/
 
 #include "CatapultCertificateProcessor.h"
+#include "VerifiedCertificateCache.h"
 #include "catapult/utils/Logging.h"
 #include "catapult/exceptions.h"
 
@@ -49,6 +50,20 @@ namespace catapult { namespace crypto {
 #pragma clang diagnostic pop
 #endif
 
+	namespace {
+		bool IsWithinValidityPeriod(const X509& certificate) {
+			return X509_cmp_current_time(X509_get0_notBefore(&certificate)) < 0
+					&& X509_cmp_current_time(X509_get0_notAfter(&certificate)) > 0;
+		}
+	}
+
+	CatapultCertificateProcessor::CatapultCertificateProcessor() : m_pVerifiedCertificateCache(nullptr)
+	{}
+
+	CatapultCertificateProcessor::CatapultCertificateProcessor(VerifiedCertificateCache& verifiedCertificateCache)
+			: m_pVerifiedCertificateCache(&verifiedCertificateCache)
+	{}
+
 	size_t CatapultCertificateProcessor::size() const {
 		return m_certificateInfos.size();
 	}
@@ -94,7 +109,7 @@ namespace catapult { namespace crypto {
 			return false;
 		}
 
-		if (!VerifySelfSigned(certificate)) {
+		if (!verifySelfSigned(certificate)) {
 			CATAPULT_LOG(warning) << "rejecting certificate chain with improperly self-signed root certificate";
 			return false;
 		}
@@ -102,6 +117,26 @@ namespace catapult { namespace crypto {
 		return true;
 	}
 
+	bool CatapultCertificateProcessor::verifySelfSigned(X509& certificate) {
+		if (!m_pVerifiedCertificateCache)
+			return VerifySelfSigned(certificate);
+
+		CertificateInfo certificateInfo;
+		Hash256 certificateHash;
+		if (!TryParseCertificate(certificate, certificateInfo) || !TryCalculateCertificateHash(certificate, certificateHash))
+			return VerifySelfSigned(certificate);
+
+		// the cached result only covers the signature check, so the validity period still needs to be checked
+		if (m_pVerifiedCertificateCache->contains(certificateInfo.PublicKey, certificateHash))
+			return IsWithinValidityPeriod(certificate);
+
+		if (!VerifySelfSigned(certificate))
+			return false;
+
+		m_pVerifiedCertificateCache->add(certificateInfo.PublicKey, certificateHash);
+		return true;
+	}
+
 	bool CatapultCertificateProcessor::push(X509& certificate) {
 		CertificateInfo certificateInfo;
 		if (!TryParseCertificate(certificate, certificateInfo)) {
@@ -23,11 +23,20 @@
 
 struct x509_store_ctx_st;
 
+namespace catapult { namespace crypto { class VerifiedCertificateCache; } }
+
 namespace catapult { namespace crypto {
 
 	/// Catapult-specific certificate processor.
 	/// \note This is specific to processing catapult certificates and is not general purpose.
 	class CatapultCertificateProcessor {
+	public:
+		/// Creates a processor.
+		CatapultCertificateProcessor();
+
+		/// Creates a processor that skips verification of self-signed certificates already in \a verifiedCertificateCache.
+		explicit CatapultCertificateProcessor(VerifiedCertificateCache& verifiedCertificateCache);
+
 	public:
 		/// Gets the number of certificates in the chain.
 		size_t size() const;
@@ -42,8 +51,12 @@ namespace catapult { namespace crypto {
 
 	private:
 		bool verifyUnverifiedRoot(x509_st& certificate, int errorCode);
+		bool verifySelfSigned(x509_st& certificate);
 		bool push(x509_st& certificate);
 
+	private:
+		VerifiedCertificateCache* m_pVerifiedCertificateCache;
+
 	public:
 		std::vector<CertificateInfo> m_certificateInfos;
 	};
@@ -130,4 +130,9 @@ namespace catapult { namespace crypto {
 		X509_STORE_CTX_set_flags(pCertificateStoreContext.get(), X509_V_FLAG_CHECK_SS_SIGNATURE);
 		return 1 == X509_verify_cert(pCertificateStoreContext.get());
 	}
+
+	bool TryCalculateCertificateHash(const X509& certificate, Hash256& hash) {
+		auto hashSize = static_cast<unsigned int>(hash.size());
+		return X509_digest(&certificate, EVP_sha256(), hash.data(), &hashSize) && Hash256::Size == hashSize;
+	}
 }}
@@ -39,4 +39,7 @@ namespace catapult { namespace crypto {
 
 	/// Returns \c true if self-signed \a certificate signature is correct.
 	bool VerifySelfSigned(x509_st& certificate);
+
+	/// Tries to calculate the hash of the encoded \a certificate into \a hash.
+	bool TryCalculateCertificateHash(const x509_st& certificate, Hash256& hash);
 }}
@@ -0,0 +1,58 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "VerifiedCertificateCache.h"
+
+namespace catapult { namespace crypto {
+
+	VerifiedCertificateCache::VerifiedCertificateCache(size_t maxSize) : m_maxSize(maxSize)
+	{}
+
+	size_t VerifiedCertificateCache::size() const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		return m_certificateHashes.size();
+	}
+
+	bool VerifiedCertificateCache::contains(const Key& publicKey, const Hash256& certificateHash) const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto iter = m_certificateHashes.find(publicKey);
+		return m_certificateHashes.cend() != iter && certificateHash == iter->second;
+	}
+
+	void VerifiedCertificateCache::add(const Key& publicKey, const Hash256& certificateHash) {
+		if (0 == m_maxSize)
+			return;
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto iter = m_certificateHashes.find(publicKey);
+		if (m_certificateHashes.end() != iter) {
+			iter->second = certificateHash;
+			return;
+		}
+
+		if (m_maxSize == m_certificateHashes.size()) {
+			m_certificateHashes.erase(m_publicKeys.front());
+			m_publicKeys.pop_front();
+		}
+
+		m_certificateHashes.emplace(publicKey, certificateHash);
+		m_publicKeys.push_back(publicKey);
+	}
+}}
@@ -0,0 +1,55 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/Hashers.h"
+#include "catapult/types.h"
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace catapult { namespace crypto {
+
+	/// Thread-safe cache of successfully verified self-signed certificates keyed by certificate public key.
+	/// \note Each public key is associated with the hash of the last certificate verified for it.
+	class VerifiedCertificateCache {
+	public:
+		/// Creates a cache that holds at most \a maxSize certificates.
+		explicit VerifiedCertificateCache(size_t maxSize);
+
+	public:
+		/// Gets the number of cached certificates.
+		size_t size() const;
+
+		/// Returns \c true if a certificate with \a publicKey and \a certificateHash has been verified.
+		bool contains(const Key& publicKey, const Hash256& certificateHash) const;
+
+	public:
+		/// Adds a verified certificate with \a publicKey and \a certificateHash.
+		/// \note When the cache is full, the least recently added public key is evicted.
+		void add(const Key& publicKey, const Hash256& certificateHash);
+
+	private:
+		size_t m_maxSize;
+		std::unordered_map<Key, Hash256, utils::ArrayHasher<Key>> m_certificateHashes;
+		std::deque<Key> m_publicKeys;
+		mutable std::mutex m_mutex;
+	};
+}}
@@ -22,6 +22,8 @@
 #include "ConsumerEntry.h"
 #include "catapult/thread/ThreadInfo.h"
 #include "catapult/utils/Functional.h"
+#include "catapult/utils/StackTimer.h"
+#include "catapult/utils/Tracing.h"
 #include <thread>
 
 namespace catapult { namespace disruptor {
@@ -44,6 +46,15 @@ namespace catapult { namespace disruptor {
 					<< "completing processing of " << element
 					<< ", last consumer is " << (maxPosition - minPosition) << " elements behind";
 		}
+
+		void AnnotateSpan(utils::TraceSpan& span, const ConsumerInput& input) {
+			if (!input.hasBlocks())
+				return;
+
+			const auto& blockElement = input.blocks()[0];
+			span.setHeight(blockElement.Block.Height);
+			span.setHash(blockElement.EntityHash);
+		}
 	}
 
 	ConsumerDispatcher::ConsumerDispatcher(const ConsumerDispatcherOptions& options, const std::vector<DisruptorConsumer>& consumers)
@@ -65,8 +76,12 @@ namespace catapult { namespace disruptor {
 		auto currentLevel = 0u;
 		for (const auto& consumer : consumers) {
 			ConsumerEntry consumerEntry(currentLevel++);
-			m_threads.create_thread([pThis = this, consumerEntry, consumer]() mutable {
-				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
+			// each consumer records latencies only from its own thread
+			auto pLatencyHistogram = std::make_shared<utils::LatencyHistogram>(utils::LatencyHistogramPolicy::Unsynchronized);
+			m_consumerLatencyHistograms.push_back(pLatencyHistogram);
+			m_threads.create_thread([pThis = this, consumerEntry, consumer, pLatencyHistogram]() mutable {
+				auto consumerName = std::to_string(consumerEntry.level()) + " " + pThis->name();
+				thread::SetThreadName(consumerName);
 				while (pThis->m_keepRunning) {
 					auto* pDisruptorElement = pThis->tryNext(consumerEntry);
 					if (!pDisruptorElement) {
@@ -74,7 +89,13 @@ namespace catapult { namespace disruptor {
 						continue;
 					}
 
-					auto result = consumer(pDisruptorElement->input());
+					auto& input = pDisruptorElement->input();
+					utils::TraceSpan span("disruptor", consumerName.c_str());
+					AnnotateSpan(span, input);
+
+					utils::StackTimer stopwatch;
+					auto result = consumer(input);
+					pLatencyHistogram->record(std::chrono::microseconds(stopwatch.micros()));
 					if (CompletionStatus::Aborted == result.CompletionStatus)
 						pThis->m_disruptor.markSkipped(consumerEntry.position(), result);
 
@@ -111,6 +132,10 @@ namespace catapult { namespace disruptor {
 		return m_numActiveElements.load();
 	}
 
+	std::shared_ptr<const utils::LatencyHistogram> ConsumerDispatcher::consumerLatencyHistogram(size_t consumerIndex) const {
+		return m_consumerLatencyHistograms[consumerIndex];
+	}
+
 	DisruptorElement* ConsumerDispatcher::tryNext(ConsumerEntry& consumerEntry) {
 		while (true) {
 			auto consumerBarrierPosition = m_barriers[consumerEntry.level()].position();
@@ -23,6 +23,7 @@
 #include "Disruptor.h"
 #include "DisruptorConsumer.h"
 #include "DisruptorInspector.h"
+#include "catapult/utils/LatencyHistogram.h"
 #include "catapult/utils/NamedObject.h"
 #include <boost/thread.hpp>
 #include <atomic>
@@ -70,6 +71,9 @@ namespace catapult { namespace disruptor {
 		/// Gets the number of elements currently in the disruptor.
 		size_t numActiveElements() const;
 
+		/// Gets the histogram of processing latencies of the consumer at \a consumerIndex.
+		std::shared_ptr<const utils::LatencyHistogram> consumerLatencyHistogram(size_t consumerIndex) const;
+
 	private:
 		DisruptorElement* tryNext(ConsumerEntry& consumerEntry);
 
@@ -88,6 +92,7 @@ namespace catapult { namespace disruptor {
 		DisruptorInspector m_inspector;
 		boost::thread_group m_threads;
 		std::atomic<size_t> m_numActiveElements;
+		std::vector<std::shared_ptr<utils::LatencyHistogram>> m_consumerLatencyHistograms;
 
 		utils::SpinLock m_addSpinLock; // lock to serialize access to Disruptor::add
 	};
@@ -49,6 +49,15 @@ namespace catapult { namespace extensions {
 		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " ELEM ACT", [](const auto& dispatcher) {
 			return dispatcher.numActiveElements();
 		});
+
+		auto histogramId = utils::DiagnosticCounterId(counterPrefix + " CONSUMER");
+		locator.registerServiceHistograms<ConsumerDispatcher>(dispatcherName, [histogramId](const auto& dispatcher) {
+			utils::DiagnosticHistograms histograms;
+			for (auto i = 0u; i < dispatcher.size(); ++i)
+				histograms.emplace_back(histogramId, i, dispatcher.consumerLatencyHistogram(i));
+
+			return histograms;
+		});
 	}
 
 	thread::Task CreateBatchTransactionTask(TransactionBatchRangeDispatcher& dispatcher, const std::string& name) {
@@ -38,7 +38,8 @@ namespace catapult { namespace extensions {
 	/// Converts \a subscriber to a sink.
 	chain::FailedTransactionSink SubscriberToSink(subscribers::TransactionStatusSubscriber& subscriber);
 
-	/// Adds dispatcher counters with prefix \a counterPrefix to \a locator for a dispatcher named \a dispatcherName.
+	/// Adds dispatcher counters and consumer latency histograms with prefix \a counterPrefix to \a locator
+	/// for a dispatcher named \a dispatcherName.
 	void AddDispatcherCounters(ServiceLocator& locator, const std::string& dispatcherName, const std::string& counterPrefix);
 
 	/// Transaction batch range dispatcher.
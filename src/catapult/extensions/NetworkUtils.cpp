@@ -51,8 +51,9 @@ namespace catapult { namespace extensions {
 		settings.SocketWorkingBufferSensitivity = config.Node.SocketWorkingBufferSensitivity;
 		settings.MaxPacketDataSize = config.Node.MaxPacketDataSize;
 
-		settings.SslOptions.ContextSupplier = ionet::CreateSslContextSupplier(config.User.CertificateDirectory);
-		settings.SslOptions.VerifyCallbackSupplier = ionet::CreateSslVerifyCallbackSupplier();
+		auto maxResumableSessions = config.Node.EnableTlsSessionResumption ? config.Node.MaxTlsSessionCacheSize : 0u;
+		settings.SslOptions.ContextSupplier = ionet::CreateSslContextSupplier(config.User.CertificateDirectory, maxResumableSessions);
+		settings.SslOptions.VerifyCallbackSupplier = ionet::CreateSslVerifyCallbackSupplier(config.Node.MaxVerifiedCertificateCacheSize);
 		return settings;
 	}
 
@@ -20,6 +20,7 @@
 
 #include "NodeSelector.h"
 #include "catapult/ionet/NodeContainer.h"
+#include <algorithm>
 
 namespace catapult { namespace extensions {
 
@@ -37,14 +38,50 @@ namespace catapult { namespace extensions {
 			}
 		}
 
-		using NodeScorePairs = std::vector<std::pair<ionet::Node, uint32_t>>;
+		struct ActiveNode {
+			ionet::Node Node;
+			uint32_t Age;
+			uint32_t PerformanceMultiplier;
+		};
+
+		using ActiveNodes = std::vector<ActiveNode>;
 
 		struct ServiceNodesInfo {
-			NodeScorePairs Actives; // node to age pairs
+			ActiveNodes Actives;
 			WeightedCandidates Candidates; // candidate nodes with weight
 			uint64_t TotalCandidateWeight = 0;
 		};
 
+		uint64_t FindMedian(std::vector<uint64_t>& values) {
+			if (values.empty())
+				return 0;
+
+			auto medianIter = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+			std::nth_element(values.begin(), medianIter, values.end());
+			return *medianIter;
+		}
+
+		ionet::NodePerformance CalculateReferencePerformance(const ionet::NodeContainerView& nodes, ionet::ServiceIdentifier serviceId) {
+			std::vector<uint64_t> roundTripTimes;
+			std::vector<uint64_t> bytesPerSecondValues;
+			nodes.forEach([serviceId, &roundTripTimes, &bytesPerSecondValues](const auto&, const auto& nodeInfo) {
+				if (!nodeInfo.getConnectionState(serviceId))
+					return;
+
+				const auto& performance = nodeInfo.performance();
+				if (0 != performance.RoundTripTime.millis())
+					roundTripTimes.push_back(performance.RoundTripTime.millis());
+
+				if (0 != performance.BytesPerSecond)
+					bytesPerSecondValues.push_back(performance.BytesPerSecond);
+			});
+
+			ionet::NodePerformance referencePerformance;
+			referencePerformance.RoundTripTime = utils::TimeSpan::FromMilliseconds(FindMedian(roundTripTimes));
+			referencePerformance.BytesPerSecond = FindMedian(bytesPerSecondValues);
+			return referencePerformance;
+		}
+
 		ServiceNodesInfo FindServiceNodes(
 				const ionet::NodeContainerView& nodes,
 				ionet::ServiceIdentifier serviceId,
@@ -52,8 +89,9 @@ namespace catapult { namespace extensions {
 				const ImportanceRetriever& importanceRetriever) {
 			ServiceNodesInfo nodesInfo;
 			auto timestamp = nodes.time();
+			auto referencePerformance = CalculateReferencePerformance(nodes, serviceId);
 			WeightPolicyGenerator generator;
-			nodes.forEach([serviceId, requiredRole, importanceRetriever, &generator, timestamp, &nodesInfo](
+			nodes.forEach([serviceId, requiredRole, importanceRetriever, &generator, timestamp, &referencePerformance, &nodesInfo](
 					const auto& node,
 					const auto& nodeInfo) {
 				auto weightMultiplier = GetWeightMultipler(nodeInfo.source());
@@ -67,14 +105,16 @@ namespace catapult { namespace extensions {
 					return;
 
 				// if the node is associated with the current service, mark it as either active or candidate
+				auto performanceMultiplier = CalculatePerformanceMultiplier(nodeInfo.performance(), referencePerformance);
 				if (pConnectionState->Age > 0) {
-					nodesInfo.Actives.emplace_back(node, pConnectionState->Age);
+					nodesInfo.Actives.push_back({ node, pConnectionState->Age, performanceMultiplier });
 				} else {
 					auto interactions = nodeInfo.interactions(timestamp);
 					auto weight = CalculateWeight(interactions, generator(), [importanceRetriever, &node]() {
 						return importanceRetriever(node.identity().PublicKey);
 					});
-					nodesInfo.Candidates.emplace_back(node, weight * weightMultiplier);
+					auto adjustedWeight = static_cast<uint64_t>(weight) * weightMultiplier * performanceMultiplier / 1'000;
+					nodesInfo.Candidates.emplace_back(node, adjustedWeight);
 					nodesInfo.TotalCandidateWeight += nodesInfo.Candidates.back().Weight;
 				}
 			});
@@ -82,22 +122,31 @@ namespace catapult { namespace extensions {
 			return nodesInfo;
 		}
 
-		model::NodeIdentitySet FindRemoveCandidates(const NodeScorePairs& nodePairs, uint32_t maxConnections, uint32_t maxConnectionAge) {
+		model::NodeIdentitySet FindRemoveCandidates(const ActiveNodes& activeNodes, uint32_t maxConnections, uint32_t maxConnectionAge) {
 			// never remove the last connection
 			auto removeCandidates = model::CreateNodeIdentitySet(model::NodeIdentityEqualityStrategy::Key_And_Host);
-			if (nodePairs.size() <= 1)
+			if (activeNodes.size() <= 1)
 				return removeCandidates;
 
+			// prefer removing the worst performing connections
+			std::vector<const ActiveNode*> sortedActiveNodes;
+			for (const auto& activeNode : activeNodes)
+				sortedActiveNodes.push_back(&activeNode);
+
+			std::stable_sort(sortedActiveNodes.begin(), sortedActiveNodes.end(), [](const auto* pLhs, const auto* pRhs) {
+				return pLhs->PerformanceMultiplier < pRhs->PerformanceMultiplier;
+			});
+
 			// 1. only remove nodes with sufficient age
 			// 2. always remove all connections above `maxConnections`
 			// 3. always remove at least one connection to force reconnection of zombies
-			auto maxNodesToRemove = (nodePairs.size() >= maxConnections ? nodePairs.size() - maxConnections : 0) + 1;
-			for (const auto& pair : nodePairs) {
+			auto maxNodesToRemove = (activeNodes.size() >= maxConnections ? activeNodes.size() - maxConnections : 0) + 1;
+			for (const auto* pActiveNode : sortedActiveNodes) {
 				if (removeCandidates.size() == maxNodesToRemove)
 					break;
 
-				if (pair.second >= maxConnectionAge)
-					removeCandidates.emplace(pair.first.identity());
+				if (pActiveNode->Age >= maxConnectionAge)
+					removeCandidates.emplace(pActiveNode->Node.identity());
 			}
 
 			return removeCandidates;
@@ -140,6 +189,26 @@ namespace catapult { namespace extensions {
 		}
 	}
 
+	uint32_t CalculatePerformanceMultiplier(const ionet::NodePerformance& performance, const ionet::NodePerformance& referencePerformance) {
+		auto clampFactor = [](uint64_t factor) {
+			return std::max<uint64_t>(500, std::min<uint64_t>(2'000, factor));
+		};
+
+		// faster round trips increase the multiplier
+		uint64_t roundTripTimeFactor = 1'000;
+		auto roundTripTime = performance.RoundTripTime.millis();
+		auto referenceRoundTripTime = referencePerformance.RoundTripTime.millis();
+		if (0 != roundTripTime && 0 != referenceRoundTripTime)
+			roundTripTimeFactor = clampFactor(referenceRoundTripTime * 1'000 / roundTripTime);
+
+		// higher throughputs increase the multiplier
+		uint64_t throughputFactor = 1'000;
+		if (0 != performance.BytesPerSecond && 0 != referencePerformance.BytesPerSecond)
+			throughputFactor = clampFactor(performance.BytesPerSecond * 1'000 / referencePerformance.BytesPerSecond);
+
+		return static_cast<uint32_t>(roundTripTimeFactor * throughputFactor / 1'000);
+	}
+
 	ionet::NodeSet SelectCandidatesBasedOnWeight(
 			const WeightedCandidates& candidates,
 			uint64_t totalCandidateWeight,
@@ -134,6 +134,11 @@ namespace catapult { namespace extensions {
 			WeightPolicy weightPolicy,
 			const supplier<ImportanceDescriptor>& importanceSupplier);
 
+	/// Calculates a weight multiplier (in per mille) from node \a performance relative to \a referencePerformance.
+	/// \note Round trip time and throughput each contribute a factor in range 500..2'000 (1'000 when unknown),
+	///       so the multiplier is in range 250..4'000.
+	uint32_t CalculatePerformanceMultiplier(const ionet::NodePerformance& performance, const ionet::NodePerformance& referencePerformance);
+
 	/// Finds at most \a maxCandidates add candidates from container \a candidates given a
 	/// total candidate weight (\a totalCandidateWeight).
 	ionet::NodeSet SelectCandidatesBasedOnWeight(
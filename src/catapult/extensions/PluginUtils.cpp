@@ -32,6 +32,10 @@ namespace catapult { namespace extensions {
 		storageConfig.PreferCacheDatabase = config.Node.EnableCacheDatabaseStorage;
 		storageConfig.CacheDatabaseDirectory = (boost::filesystem::path(config.User.DataDirectory) / "statedb").generic_string();
 		storageConfig.MaxCacheDatabaseWriteBatchSize = config.Node.MaxCacheDatabaseWriteBatchSize;
+		storageConfig.MaxCacheDatabaseDecodedValuesSize = config.Node.MaxCacheDatabaseDecodedValuesSize;
+		storageConfig.MaxCacheDatabasePatriciaTreeNodesSize = config.Node.MaxCacheDatabasePatriciaTreeNodesSize;
+		storageConfig.MaxCacheCommitThreads = config.Node.MaxCacheCommitThreads;
+		storageConfig.MaxStatePathsKeys = config.Node.MaxStatePathsKeys;
 		return storageConfig;
 	}
 
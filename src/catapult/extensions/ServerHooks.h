@@ -71,6 +71,9 @@ namespace catapult { namespace extensions {
 	/// Predicate for determining if a chain is synced.
 	using ChainSyncedPredicate = predicate<>;
 
+	/// Supplier that returns the (estimated) network chain height.
+	using NetworkChainHeightSupplier = supplier<Height>;
+
 	/// Predicate for determining if a hash is known.
 	using KnownHashPredicate = chain::KnownHashPredicate;
 
@@ -134,6 +137,11 @@ namespace catapult { namespace extensions {
 			SetOnce(m_chainSyncedPredicate, predicate);
 		}
 
+		/// Sets the network chain height \a supplier.
+		void setNetworkChainHeightSupplier(const NetworkChainHeightSupplier& supplier) {
+			SetOnce(m_networkChainHeightSupplier, supplier);
+		}
+
 		/// Adds a known hash \a predicate.
 		void addKnownHashPredicate(const KnownHashPredicate& predicate) {
 			m_knownHashPredicates.push_back(predicate);
@@ -195,6 +203,12 @@ namespace catapult { namespace extensions {
 			return m_chainSyncedPredicate ? m_chainSyncedPredicate : []() { return true; };
 		}
 
+		/// Gets the network chain height supplier.
+		/// \note The default supplier returns zero, which indicates an unknown network chain height.
+		auto networkChainHeightSupplier() const {
+			return m_networkChainHeightSupplier ? m_networkChainHeightSupplier : []() { return Height(0); };
+		}
+
 		/// Gets the known hash predicate augmented with a check in \a utCache.
 		KnownHashPredicate knownHashPredicate(const cache::ReadWriteUtCache& utCache) const {
 			return [&utCache, knownHashPredicates = m_knownHashPredicates](auto timestamp, const auto& hash) {
@@ -224,6 +238,7 @@ namespace catapult { namespace extensions {
 
 		RemoteChainHeightsRetriever m_remoteChainHeightsRetriever;
 		ChainSyncedPredicate m_chainSyncedPredicate;
+		NetworkChainHeightSupplier m_networkChainHeightSupplier;
 		std::vector<KnownHashPredicate> m_knownHashPredicates;
 	};
 }}
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/DiagnosticHistogram.h"
 #include "catapult/exceptions.h"
 #include <memory>
 #include <unordered_map>
@@ -64,6 +65,17 @@ namespace catapult { namespace extensions {
 			return m_counters;
 		}
 
+		/// Gets the diagnostic histograms of all registered services that are available.
+		utils::DiagnosticHistograms histograms() const {
+			utils::DiagnosticHistograms histograms;
+			for (const auto& histogramsSupplier : m_histogramsSuppliers) {
+				auto serviceHistograms = histogramsSupplier();
+				histograms.insert(histograms.end(), serviceHistograms.cbegin(), serviceHistograms.cend());
+			}
+
+			return histograms;
+		}
+
 		/// Gets the number of registered services.
 		size_t numServices() const {
 			return m_services.size();
@@ -102,6 +114,24 @@ namespace catapult { namespace extensions {
 			});
 		}
 
+		/// Adds service-dependent histograms for service \a serviceName given \a supplier.
+		/// \note No histograms are returned when the service is unavailable.
+		template<typename TService, typename TSupplier>
+		void registerServiceHistograms(const std::string& serviceName, TSupplier supplier) {
+			m_histogramsSuppliers.push_back([this, serviceName, supplier]() {
+				std::shared_ptr<TService> pService;
+				this->tryGetService(serviceName, pService);
+				return pService ? supplier(*pService) : utils::DiagnosticHistograms();
+			});
+		}
+
+		/// Adds a service-independent \a histogram.
+		void registerHistogram(const utils::DiagnosticHistogram& histogram) {
+			m_histogramsSuppliers.push_back([histogram]() {
+				return utils::DiagnosticHistograms{ histogram };
+			});
+		}
+
 	private:
 		template<typename TService>
 		bool tryGetService(const std::string& serviceName, std::shared_ptr<TService>& pService) const {
@@ -117,6 +147,7 @@ namespace catapult { namespace extensions {
 	private:
 		const config::CatapultKeys& m_keys;
 		std::vector<utils::DiagnosticCounter> m_counters;
+		std::vector<supplier<utils::DiagnosticHistograms>> m_histogramsSuppliers;
 		std::unordered_map<std::string, std::weak_ptr<void>> m_services;
 		std::vector<std::pair<std::string, std::shared_ptr<void>>> m_rootedServices;
 	};
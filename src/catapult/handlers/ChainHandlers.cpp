@@ -22,11 +22,14 @@
 #include "HandlerUtils.h"
 #include "HeightRequestProcessor.h"
 #include "catapult/api/ChainPackets.h"
+#include "catapult/api/CompactBlockUtils.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/model/Block.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/utils/MemoryUtils.h"
+#include <cstring>
 
 namespace catapult { namespace handlers {
 
@@ -37,6 +40,99 @@ namespace catapult { namespace handlers {
 		handlers.registerHandler(ionet::PacketType::Push_Block, CreatePushEntityHandler<model::Block>(registry, blockRangeHandler));
 	}
 
+	namespace {
+		std::shared_ptr<const model::Transaction> CopyTransaction(const model::Transaction& transaction) {
+			auto pTransaction = utils::MakeSharedWithSize<model::Transaction>(transaction.Size);
+			std::memcpy(static_cast<void*>(pTransaction.get()), &transaction, transaction.Size);
+			return pTransaction;
+		}
+
+		ionet::PacketPayload CreateMissingIndexesPayload(const std::vector<uint32_t>& missingIndexes) {
+			auto indexes = model::EntityRange<uint32_t>::CopyFixed(
+					reinterpret_cast<const uint8_t*>(missingIndexes.data()),
+					missingIndexes.size());
+			return ionet::PacketPayloadFactory::FromFixedSizeRange(ionet::PacketType::Compact_Block, std::move(indexes));
+		}
+
+		auto CreateCompactBlockHandler(
+				const model::TransactionRegistry& registry,
+				const GenerationHash& generationHash,
+				const CompactBlockTransactionsRetriever& transactionsRetriever,
+				const BlockRangeHandler& blockRangeHandler) {
+			return [&registry, generationHash, transactionsRetriever, blockRangeHandler](const auto& packet, auto& context) {
+				api::CompactBlock compactBlock;
+				if (!api::TryParseCompactBlock(packet, registry, compactBlock)) {
+					CATAPULT_LOG(warning) << "rejecting malformed compact block: " << packet;
+					return;
+				}
+
+				// use prefilled transactions and look up all others by short hash
+				model::Transactions transactions(compactBlock.ShortHashes.size());
+				for (auto i = 0u; i < compactBlock.PrefilledIndexes.size(); ++i)
+					transactions[compactBlock.PrefilledIndexes[i]] = CopyTransaction(*compactBlock.PrefilledTransactions[i]);
+
+				std::vector<uint32_t> lookupIndexes;
+				std::vector<utils::ShortHash> lookupShortHashes;
+				for (auto i = 0u; i < transactions.size(); ++i) {
+					if (transactions[i])
+						continue;
+
+					lookupIndexes.push_back(i);
+					lookupShortHashes.push_back(compactBlock.ShortHashes[i]);
+				}
+
+				std::vector<uint32_t> missingIndexes;
+				if (!lookupShortHashes.empty()) {
+					auto foundTransactions = transactionsRetriever(lookupShortHashes);
+					for (auto i = 0u; i < lookupIndexes.size(); ++i) {
+						if (i < foundTransactions.size() && foundTransactions[i])
+							transactions[lookupIndexes[i]] = foundTransactions[i];
+						else
+							missingIndexes.push_back(lookupIndexes[i]);
+					}
+				}
+
+				if (!missingIndexes.empty()) {
+					CATAPULT_LOG(debug)
+							<< "compact block at height " << compactBlock.pBlockHeader->Height << " is missing "
+							<< missingIndexes.size() << " of " << transactions.size() << " transactions";
+					context.response(CreateMissingIndexesPayload(missingIndexes));
+					return;
+				}
+
+				// a size mismatch indicates that a looked up transaction is not the original, so request all of them
+				auto pBlock = model::StitchBlock(*compactBlock.pBlockHeader, transactions);
+				if (compactBlock.pBlockHeader->Size != pBlock->Size || !IsSizeValid(*pBlock, registry)) {
+					CATAPULT_LOG(warning) << "reconstructed compact block at height " << pBlock->Height << " has unexpected size";
+					context.response(CreateMissingIndexesPayload(lookupIndexes));
+					return;
+				}
+
+				// a transactions hash mismatch indicates a short hash collision, so request all looked up transactions
+				if (pBlock->TransactionsHash != api::CalculateBlockTransactionsHash(*pBlock, registry, generationHash)) {
+					CATAPULT_LOG(warning)
+							<< "reconstructed compact block at height " << pBlock->Height << " has unexpected transactions hash";
+					context.response(CreateMissingIndexesPayload(lookupIndexes));
+					return;
+				}
+
+				CATAPULT_LOG(trace) << "reconstructed compact block at height " << pBlock->Height;
+				blockRangeHandler({ model::BlockRange::FromEntity(std::move(pBlock)), { context.key(), context.host() } });
+				context.response(ionet::PacketPayload(ionet::PacketType::Compact_Block));
+			};
+		}
+	}
+
+	void RegisterCompactBlockHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const model::TransactionRegistry& registry,
+			const GenerationHash& generationHash,
+			const CompactBlockTransactionsRetriever& transactionsRetriever,
+			const BlockRangeHandler& blockRangeHandler) {
+		auto handler = CreateCompactBlockHandler(registry, generationHash, transactionsRetriever, blockRangeHandler);
+		handlers.registerHandler(ionet::PacketType::Compact_Block, handler);
+	}
+
 	namespace {
 		auto CreatePullBlockHandler(const io::BlockStorageCache& storage) {
 			return [&storage](const auto& packet, auto& context) {
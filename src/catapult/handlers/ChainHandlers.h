@@ -22,7 +22,9 @@
 #include "HandlerTypes.h"
 #include "catapult/ionet/PacketHandlers.h"
 #include "catapult/model/ChainScore.h"
+#include "catapult/model/BlockUtils.h"
 #include "catapult/model/RangeTypes.h"
+#include "catapult/utils/ShortHash.h"
 
 namespace catapult { namespace io { class BlockStorageCache; } }
 
@@ -35,6 +37,21 @@ namespace catapult { namespace handlers {
 			const model::TransactionRegistry& registry,
 			const BlockRangeHandler& blockRangeHandler);
 
+	/// Retrieves the transactions with the specified short hashes.
+	/// \note An element is \c nullptr if the corresponding transaction is unknown or not uniquely identified by its short hash.
+	using CompactBlockTransactionsRetriever = std::function<model::Transactions (const std::vector<utils::ShortHash>&)>;
+
+	/// Registers a compact block handler in \a handlers that reconstructs blocks from transactions returned by
+	/// \a transactionsRetriever and, if valid, forwards them to \a blockRangeHandler given a transaction \a registry
+	/// composed of known transactions and the network \a generationHash.
+	/// \note The response contains the indexes of all block transactions that could not be reconstructed.
+	void RegisterCompactBlockHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const model::TransactionRegistry& registry,
+			const GenerationHash& generationHash,
+			const CompactBlockTransactionsRetriever& transactionsRetriever,
+			const BlockRangeHandler& blockRangeHandler);
+
 	/// Registers a pull block handler in \a handlers that responds with a block in \a storage.
 	void RegisterPullBlockHandler(ionet::ServerPacketHandlers& handlers, const io::BlockStorageCache& storage);
 
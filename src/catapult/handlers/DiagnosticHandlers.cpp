@@ -23,11 +23,15 @@
 #include "HandlerFactory.h"
 #include "HeightRequestProcessor.h"
 #include "catapult/api/ChainPackets.h"
+#include "catapult/io/RawFile.h"
 #include "catapult/ionet/NodeContainer.h"
 #include "catapult/ionet/PackedNodeInfo.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DiagnosticHistogramValue.h"
 #include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/Tracing.h"
+#include <sstream>
 
 namespace catapult { namespace handlers {
 
@@ -61,6 +65,79 @@ namespace catapult { namespace handlers {
 
 	// endregion
 
+	// region DiagnosticHistogramsHandler
+
+	namespace {
+		uint64_t PercentileMicros(const utils::LatencyHistogram::Snapshot& snapshot, double percentile) {
+			return static_cast<uint64_t>(snapshot.percentile(percentile).count());
+		}
+
+		auto CreateDiagnosticHistogramsHandler(const supplier<utils::DiagnosticHistograms>& histogramsSupplier) {
+			return [histogramsSupplier](const auto& packet, auto& context) {
+				if (!ionet::IsPacketValid(packet, ionet::PacketType::Diagnostic_Histograms))
+					return;
+
+				auto histograms = histogramsSupplier();
+				auto payloadSize = utils::checked_cast<size_t, uint32_t>(histograms.size() * sizeof(model::DiagnosticHistogramValue));
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = ionet::PacketType::Diagnostic_Histograms;
+
+				auto* pHistogramValue = reinterpret_cast<model::DiagnosticHistogramValue*>(pResponsePacket->Data());
+				for (const auto& histogram : histograms) {
+					auto snapshot = histogram.snapshot();
+					pHistogramValue->Id = histogram.id().value();
+					pHistogramValue->Tag = histogram.tag();
+					pHistogramValue->Count = snapshot.count();
+					pHistogramValue->P50 = PercentileMicros(snapshot, 50);
+					pHistogramValue->P90 = PercentileMicros(snapshot, 90);
+					pHistogramValue->P99 = PercentileMicros(snapshot, 99);
+					pHistogramValue->P999 = PercentileMicros(snapshot, 99.9);
+					pHistogramValue->Max = static_cast<uint64_t>(snapshot.max().count());
+					++pHistogramValue;
+				}
+
+				context.response(ionet::PacketPayload(pResponsePacket));
+			};
+		}
+	}
+
+	void RegisterDiagnosticHistogramsHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const supplier<utils::DiagnosticHistograms>& histogramsSupplier) {
+		handlers.registerHandler(ionet::PacketType::Diagnostic_Histograms, CreateDiagnosticHistogramsHandler(histogramsSupplier));
+	}
+
+	// endregion
+
+	// region DiagnosticTraceEventsHandler
+
+	namespace {
+		auto CreateDiagnosticTraceEventsHandler(const std::string& traceFilename) {
+			return [traceFilename](const auto& packet, auto& context) {
+				if (!ionet::IsPacketValid(packet, ionet::PacketType::Diagnostic_Trace_Events))
+					return;
+
+				std::ostringstream out;
+				utils::WriteTraceEvents(out);
+				auto traceEvents = out.str();
+
+				io::RawFile traceFile(traceFilename, io::OpenMode::Read_Write);
+				traceFile.write({ reinterpret_cast<const uint8_t*>(traceEvents.data()), traceEvents.size() });
+				CATAPULT_LOG(info) << "wrote " << traceEvents.size() << " bytes of trace events to " << traceFilename;
+
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>();
+				pResponsePacket->Type = ionet::PacketType::Diagnostic_Trace_Events;
+				context.response(ionet::PacketPayload(pResponsePacket));
+			};
+		}
+	}
+
+	void RegisterDiagnosticTraceEventsHandler(ionet::ServerPacketHandlers& handlers, const std::string& traceFilename) {
+		handlers.registerHandler(ionet::PacketType::Diagnostic_Trace_Events, CreateDiagnosticTraceEventsHandler(traceFilename));
+	}
+
+	// endregion
+
 	// region DiagnosticNodesHandler
 
 	namespace {
@@ -118,6 +195,38 @@ namespace catapult { namespace handlers {
 
 	// endregion
 
+	// region DiagnosticNodeTrafficHandler
+
+	namespace {
+		auto CreateDiagnosticNodeTrafficHandler(const ionet::NodeContainer& nodeContainer) {
+			return [&nodeContainer](const auto& packet, auto& context) {
+				if (!ionet::IsPacketValid(packet, ionet::PacketType::Active_Node_Traffic))
+					return;
+
+				auto view = nodeContainer.view();
+				auto nodes = ionet::FindAllActiveNodes(view);
+				auto payloadSize = utils::checked_cast<size_t, uint32_t>(nodes.size() * sizeof(ionet::PackedNodeTraffic));
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = ionet::PacketType::Active_Node_Traffic;
+
+				auto* pNodeTraffic = reinterpret_cast<ionet::PackedNodeTraffic*>(pResponsePacket->Data());
+				for (const auto& node : nodes) {
+					pNodeTraffic->IdentityKey = node.identity().PublicKey;
+					pNodeTraffic->Update(view.getNodeInfo(node.identity()).traffic());
+					++pNodeTraffic;
+				}
+
+				context.response(ionet::PacketPayload(pResponsePacket));
+			};
+		}
+	}
+
+	void RegisterDiagnosticNodeTrafficHandler(ionet::ServerPacketHandlers& handlers, const ionet::NodeContainer& nodeContainer) {
+		handlers.registerHandler(ionet::PacketType::Active_Node_Traffic, CreateDiagnosticNodeTrafficHandler(nodeContainer));
+	}
+
+	// endregion
+
 	// region DiagnosticBlockStatementHandler
 
 	namespace {
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "catapult/ionet/PacketHandlers.h"
+#include "catapult/utils/DiagnosticHistogram.h"
 #include <vector>
 
 namespace catapult {
@@ -33,9 +34,22 @@ namespace catapult { namespace handlers {
 	/// Registers a diagnostic counters handler in \a handlers that responds with the current values of \a counters.
 	void RegisterDiagnosticCountersHandler(ionet::ServerPacketHandlers& handlers, const std::vector<utils::DiagnosticCounter>& counters);
 
+	/// Registers a diagnostic histograms handler in \a handlers that responds with the current values of all histograms
+	/// returned by \a histogramsSupplier.
+	void RegisterDiagnosticHistogramsHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const supplier<utils::DiagnosticHistograms>& histogramsSupplier);
+
+	/// Registers a diagnostic trace events handler in \a handlers that writes all retained trace events to \a traceFilename.
+	void RegisterDiagnosticTraceEventsHandler(ionet::ServerPacketHandlers& handlers, const std::string& traceFilename);
+
 	/// Registers a diagnostic nodes handler in \a handlers that responds with info about all (active) partner nodes in \a nodeContainer.
 	void RegisterDiagnosticNodesHandler(ionet::ServerPacketHandlers& handlers, const ionet::NodeContainer& nodeContainer);
 
+	/// Registers a diagnostic node traffic handler in \a handlers that responds with the traffic read from all (active)
+	/// partner nodes in \a nodeContainer.
+	void RegisterDiagnosticNodeTrafficHandler(ionet::ServerPacketHandlers& handlers, const ionet::NodeContainer& nodeContainer);
+
 	/// Registers a diagnostic block statement handler in \a handlers that responds with data from \a storage.
 	void RegisterDiagnosticBlockStatementHandler(ionet::ServerPacketHandlers& handlers, const io::BlockStorageCache& storage);
 }}
@@ -20,12 +20,34 @@
 
 #pragma once
 #include "catapult/ionet/Packet.h"
+#include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketHandlers.h"
 #include "catapult/tree/PatriciaTreeSerializer.h"
 #include "catapult/utils/Casting.h"
+#include "catapult/utils/Logging.h"
 
 namespace catapult { namespace handlers {
 
+	namespace detail {
+		/// Creates a response packet with \a type containing serialized state \a nodes.
+		inline std::shared_ptr<ionet::Packet> CreateStatePathResponsePacket(
+				ionet::PacketType type,
+				const std::vector<tree::TreeNode>& nodes) {
+			std::vector<uint8_t> serializedPath;
+			for (const auto& node : nodes) {
+				auto serializedNode = tree::PatriciaTreeSerializer::SerializeValue(node);
+				const auto* pData = reinterpret_cast<const uint8_t*>(serializedNode.data());
+				serializedPath.insert(serializedPath.end(), pData, pData + serializedNode.size());
+			}
+
+			auto payloadSize = utils::checked_cast<size_t, uint32_t>(serializedPath.size());
+			auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+			pResponsePacket->Type = type;
+			utils::memcpy_cond(pResponsePacket->Data(), serializedPath.data(), serializedPath.size());
+			return pResponsePacket;
+		}
+	}
+
 	/// Registers a handler in \a handlers that responds with serialized state path produced by querying \a cache.
 	template<typename TPacket, typename TCache>
 	void RegisterStatePathHandler(ionet::ServerPacketHandlers& handlers, const TCache& cache) {
@@ -34,22 +56,55 @@ namespace catapult { namespace handlers {
 			if (!pRequest)
 				return;
 
-			auto view = cache.createView();
+			// release the cache view before serializing the path
 			std::vector<tree::TreeNode> path;
-			view->tryLookup(pRequest->Key, path);
+			{
+				auto view = cache.createView();
+				view->tryLookup(pRequest->Key, path);
+			}
 
 			// serialize path even if lookup failed (to provide proof that key does not exist in state)
-			std::vector<uint8_t> serializedPath;
-			for (const auto& node : path) {
-				auto serializedNode = tree::PatriciaTreeSerializer::SerializeValue(node);
-				const auto* pData = reinterpret_cast<const uint8_t*>(serializedNode.data());
-				serializedPath.insert(serializedPath.end(), pData, pData + serializedNode.size());
+			context.response(ionet::PacketPayload(detail::CreateStatePathResponsePacket(TPacket::Packet_Type, path)));
+		});
+	}
+
+	/// Registers a handler in \a handlers that responds with a serialized combined state path (multiproof) of multiple keys
+	/// produced by querying \a cache. Requests containing more than \a maxKeys keys are rejected.
+	/// \note Request packets of type \a TRequestTraits::Packet_Type contain an array of keys.
+	///        Nodes shared by paths of multiple keys are only sent once.
+	template<typename TRequestTraits, typename TCache>
+	void RegisterStatePathsHandler(ionet::ServerPacketHandlers& handlers, const TCache& cache, uint32_t maxKeys) {
+		auto maxPacketDataSize = handlers.maxPacketDataSize();
+		handlers.registerHandler(TRequestTraits::Packet_Type, [&cache, maxKeys, maxPacketDataSize](const auto& packet, auto& context) {
+			using KeyType = typename TRequestTraits::RequestStructureType;
+			if (TRequestTraits::Packet_Type != packet.Type)
+				return;
+
+			auto keyRange = ionet::ExtractFixedSizeStructuresFromPacket<KeyType>(packet);
+			if (keyRange.empty())
+				return;
+
+			if (keyRange.size() > maxKeys) {
+				CATAPULT_LOG(warning) << "dropping state paths request with " << keyRange.size() << " keys (max " << maxKeys << ")";
+				return;
+			}
+
+			std::vector<KeyType> keys(keyRange.cbegin(), keyRange.cend());
+
+			// release the cache view before serializing the nodes
+			std::vector<tree::TreeNode> nodes;
+			{
+				auto view = cache.createView();
+				view->tryLookup(keys, nodes);
+			}
+
+			// serialize nodes even if lookups failed (to provide proof that keys do not exist in state)
+			auto pResponsePacket = detail::CreateStatePathResponsePacket(TRequestTraits::Packet_Type, nodes);
+			if (pResponsePacket->Size - sizeof(ionet::PacketHeader) > maxPacketDataSize) {
+				CATAPULT_LOG(warning) << "dropping state paths request with " << keys.size() << " keys that exceeds max response size";
+				return;
 			}
 
-			auto payloadSize = utils::checked_cast<size_t, uint32_t>(serializedPath.size());
-			auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
-			pResponsePacket->Type = TPacket::Packet_Type;
-			utils::memcpy_cond(pResponsePacket->Data(), serializedPath.data(), serializedPath.size());
 			context.response(ionet::PacketPayload(pResponsePacket));
 		});
 	}
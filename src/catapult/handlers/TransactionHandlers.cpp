@@ -88,4 +88,27 @@ namespace catapult { namespace handlers {
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever) {
 		handlers.registerHandler(ionet::PacketType::Pull_Transactions, CreatePullTransactionsHandler(utRetriever));
 	}
+
+	namespace {
+		auto CreateTransactionInventoryHandler(const UnknownTransactionHashesRetriever& unknownTransactionHashesRetriever) {
+			return [unknownTransactionHashesRetriever](const auto& packet, auto& context) {
+				auto transactions = ionet::ExtractFixedSizeStructuresFromPacket<model::AnnouncedTransaction>(packet);
+				if (transactions.empty())
+					return;
+
+				auto unknownHashes = unknownTransactionHashesRetriever(transactions);
+				auto hashRange = model::HashRange::CopyFixed(reinterpret_cast<const uint8_t*>(unknownHashes.data()), unknownHashes.size());
+				auto packetType = ionet::PacketType::Transaction_Inventory;
+				context.response(ionet::PacketPayloadFactory::FromFixedSizeRange(packetType, std::move(hashRange)));
+			};
+		}
+	}
+
+	void RegisterTransactionInventoryHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const UnknownTransactionHashesRetriever& unknownTransactionHashesRetriever) {
+		handlers.registerHandler(
+				ionet::PacketType::Transaction_Inventory,
+				CreateTransactionInventoryHandler(unknownTransactionHashesRetriever));
+	}
 }}
@@ -44,4 +44,13 @@ namespace catapult { namespace handlers {
 	/// Registers a pull transactions handler in \a handlers that responds with unconfirmed transactions
 	/// returned by the retriever (\a utRetriever).
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever);
+
+	/// Prototype for a function that retrieves the hashes of the announced transactions that are unknown.
+	using UnknownTransactionHashesRetriever = std::function<std::vector<Hash256> (const model::AnnouncedTransactionRange&)>;
+
+	/// Registers a transaction inventory handler in \a handlers that responds with the hashes of the announced transactions
+	/// returned by the retriever (\a unknownTransactionHashesRetriever).
+	void RegisterTransactionInventoryHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const UnknownTransactionHashesRetriever& unknownTransactionHashesRetriever);
 }}
@@ -38,6 +38,10 @@ namespace catapult { namespace io {
 				m_pStorage->dropBlocksAfter(height);
 			}
 
+			void flush() override {
+				// empty because storage completes all writes before returning
+			}
+
 		private:
 			std::unique_ptr<LightBlockStorage> m_pStorage;
 		};
@@ -19,14 +19,30 @@
 **/
 
 #include "FileQueue.h"
+#include "PodIoUtils.h"
 #include "catapult/utils/HexFormatter.h"
+#include "catapult/utils/Logging.h"
 #include "catapult/exceptions.h"
 #include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
 #include <sstream>
 
+#ifdef __linux__
+#include <sys/stat.h>
+#endif
+
 namespace catapult { namespace io {
 
 	namespace {
+		constexpr auto Message_File_Extension = ".dat";
+		constexpr auto Segment_File_Extension = ".seg";
+		constexpr auto Reader_Position_File_Extension = ".pos";
+
+		// segment records are composed of a size (uint32_t), a write time (uint64_t) and a payload
+		constexpr size_t Segment_Record_Header_Size = sizeof(uint32_t) + sizeof(uint64_t);
+
 		const boost::filesystem::path& CreateDirectory(const boost::filesystem::path& directory) {
 			if (!boost::filesystem::exists(directory))
 				boost::filesystem::create_directory(directory);
@@ -42,11 +58,41 @@ namespace catapult { namespace io {
 			return true;
 		}
 
-		std::string GetFilename(uint64_t value) {
+		std::string GetFilename(uint64_t value, const char* extension) {
 			std::ostringstream out;
-			out << utils::HexFormat(value) << ".dat";
+			out << utils::HexFormat(value) << extension;
 			return out.str();
 		}
+
+		std::string GetFilename(uint64_t value) {
+			return GetFilename(value, Message_File_Extension);
+		}
+
+		bool TryParseFilename(const boost::filesystem::path& path, const char* extension, uint64_t& value) {
+			auto stem = path.stem().generic_string();
+			if (path.extension() != extension || 2 * sizeof(uint64_t) != stem.size())
+				return false;
+
+			if (!std::all_of(stem.cbegin(), stem.cend(), [](auto ch) { return std::isxdigit(static_cast<unsigned char>(ch)); }))
+				return false;
+
+			value = std::stoull(stem, nullptr, 16);
+			return true;
+		}
+
+		template<typename TAction>
+		void ForEachFile(const boost::filesystem::path& directory, const char* extension, TAction action) {
+			for (const auto& entry : boost::filesystem::directory_iterator(directory)) {
+				uint64_t value;
+				if (TryParseFilename(entry.path(), extension, value))
+					action(entry.path(), value);
+			}
+		}
+
+		uint64_t GetMillisSinceEpoch(std::chrono::system_clock::time_point timePoint) {
+			auto duration = timePoint.time_since_epoch();
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count());
+		}
 	}
 
 	// region FileQueueWriter
@@ -55,12 +101,42 @@ namespace catapult { namespace io {
 	{}
 
 	FileQueueWriter::FileQueueWriter(const std::string& directory, const std::string& indexFilename)
+			: FileQueueWriter(directory, indexFilename, utils::FileSize())
+	{}
+
+	FileQueueWriter::FileQueueWriter(const std::string& directory, const std::string& indexFilename, utils::FileSize maxSegmentSize)
 			: m_directory(CreateDirectory(directory))
 			, m_indexFile((m_directory / indexFilename).generic_string(), LockMode::None)
 			, m_indexValue(CreateIfNotExists(m_indexFile) ? 0 : m_indexFile.get())
-	{}
+			, m_maxSegmentSize(maxSegmentSize) {
+		if (utils::FileSize() == m_maxSegmentSize)
+			return;
+
+		// messages at or after the writer index were never made visible to readers (e.g. after recovery), so they can be discarded;
+		// this prevents readers, which prefer message files and the most recent segment, from picking up stale data
+		std::vector<boost::filesystem::path> stalePaths;
+		auto collectStalePaths = [indexValue = m_indexValue, &stalePaths](const auto& path, auto value) {
+			if (value >= indexValue)
+				stalePaths.push_back(path);
+		};
+		ForEachFile(m_directory, Message_File_Extension, collectStalePaths);
+		ForEachFile(m_directory, Segment_File_Extension, collectStalePaths);
+
+		for (const auto& path : stalePaths)
+			boost::filesystem::remove(path);
+	}
+
+	FileQueueWriter::~FileQueueWriter() = default;
 
 	void FileQueueWriter::write(const RawBuffer& buffer) {
+		if (utils::FileSize() != m_maxSegmentSize) {
+			if (m_segmentRecordBuffer.empty())
+				m_segmentRecordBuffer.resize(Segment_Record_Header_Size);
+
+			m_segmentRecordBuffer.insert(m_segmentRecordBuffer.end(), buffer.pData, buffer.pData + buffer.Size);
+			return;
+		}
+
 		if (!m_pOutputStream) {
 			auto filename = (m_directory / GetFilename(m_indexValue)).generic_string();
 			RawFile outputFile(filename, OpenMode::Read_Write);
@@ -71,6 +147,16 @@ namespace catapult { namespace io {
 	}
 
 	void FileQueueWriter::flush() {
+		if (utils::FileSize() != m_maxSegmentSize) {
+			if (m_segmentRecordBuffer.empty())
+				return;
+
+			appendToSegment();
+			m_segmentRecordBuffer.clear();
+			m_indexValue = m_indexFile.increment();
+			return;
+		}
+
 		if (!m_pOutputStream)
 			return;
 
@@ -79,6 +165,23 @@ namespace catapult { namespace io {
 		m_indexValue = m_indexFile.increment();
 	}
 
+	void FileQueueWriter::appendToSegment() {
+		auto payloadSize = static_cast<uint32_t>(m_segmentRecordBuffer.size() - Segment_Record_Header_Size);
+		auto writeTime = GetMillisSinceEpoch(std::chrono::system_clock::now());
+		std::memcpy(m_segmentRecordBuffer.data(), &payloadSize, sizeof(uint32_t));
+		std::memcpy(m_segmentRecordBuffer.data() + sizeof(uint32_t), &writeTime, sizeof(uint64_t));
+
+		// start a new segment when there is none or the current one is full (a segment always contains at least one record)
+		if (!m_pSegmentFile || m_pSegmentFile->position() + m_segmentRecordBuffer.size() > m_maxSegmentSize.bytes()) {
+			auto segmentFilename = (m_directory / GetFilename(m_indexValue, Segment_File_Extension)).generic_string();
+			m_pSegmentFile.reset();
+			m_pSegmentFile = std::make_unique<RawFile>(segmentFilename, OpenMode::Read_Write, LockMode::None);
+		}
+
+		// readers never read past the writer index, so a partially written record is never observed
+		m_pSegmentFile->write(m_segmentRecordBuffer);
+	}
+
 	// endregion
 
 	// region FileQueueReader
@@ -90,6 +193,101 @@ namespace catapult { namespace io {
 			outputFile.read(buffer);
 			return buffer;
 		}
+
+		std::chrono::system_clock::time_point GetLastWriteTime(const std::string& filename) {
+#ifdef __linux__
+			// prefer stat because it provides sub-second resolution
+			struct stat fileStat;
+			if (0 == ::stat(filename.c_str(), &fileStat)) {
+				auto duration = std::chrono::seconds(fileStat.st_mtim.tv_sec) + std::chrono::nanoseconds(fileStat.st_mtim.tv_nsec);
+				return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(duration));
+			}
+#endif
+
+			return std::chrono::system_clock::from_time_t(boost::filesystem::last_write_time(filename));
+		}
+
+		// region segment utils
+
+		struct ReaderPosition {
+			uint64_t IndexValue;
+			uint64_t SegmentId;
+			uint64_t Offset;
+		};
+
+		bool TryLoadReaderPosition(const boost::filesystem::path& filename, ReaderPosition& position) {
+			if (!boost::filesystem::exists(filename))
+				return false;
+
+			RawFile positionFile(filename.generic_string(), OpenMode::Read_Only, LockMode::None);
+			if (sizeof(ReaderPosition) != positionFile.size())
+				return false;
+
+			position.IndexValue = Read64(positionFile);
+			position.SegmentId = Read64(positionFile);
+			position.Offset = Read64(positionFile);
+			return true;
+		}
+
+		void SaveReaderPosition(RawFile& positionFile, const ReaderPosition& position) {
+			positionFile.seek(0);
+			Write64(positionFile, position.IndexValue);
+			Write64(positionFile, position.SegmentId);
+			Write64(positionFile, position.Offset);
+		}
+
+		std::vector<uint64_t> FindSegments(const boost::filesystem::path& directory) {
+			std::vector<uint64_t> segmentIds;
+			ForEachFile(directory, Segment_File_Extension, [&segmentIds](const auto&, auto value) {
+				segmentIds.push_back(value);
+			});
+
+			std::sort(segmentIds.begin(), segmentIds.end());
+			return segmentIds;
+		}
+
+		struct SegmentRecordHeader {
+			uint32_t PayloadSize;
+			uint64_t WriteTime;
+		};
+
+		SegmentRecordHeader ReadSegmentRecordHeader(RawFile& segmentFile) {
+			if (segmentFile.position() + Segment_Record_Header_Size > segmentFile.size())
+				CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to truncated segment", segmentFile.position());
+
+			SegmentRecordHeader header;
+			header.PayloadSize = Read32(segmentFile);
+			header.WriteTime = Read64(segmentFile);
+			if (segmentFile.position() + header.PayloadSize > segmentFile.size())
+				CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to truncated record", segmentFile.position());
+
+			return header;
+		}
+
+		// returns false when the record at the current position is not (completely) contained in the segment as of when it was opened
+		bool TryReadSegmentRecord(RawFile& segmentFile, std::vector<uint8_t>& buffer, uint64_t& writeTime) {
+			auto recordPosition = segmentFile.position();
+			if (recordPosition + Segment_Record_Header_Size > segmentFile.size())
+				return false;
+
+			auto payloadSize = Read32(segmentFile);
+			writeTime = Read64(segmentFile);
+			if (segmentFile.position() + payloadSize > segmentFile.size()) {
+				segmentFile.seek(recordPosition);
+				return false;
+			}
+
+			buffer.resize(payloadSize);
+			segmentFile.read(buffer);
+			return true;
+		}
+
+		std::unique_ptr<RawFile> OpenSegment(const boost::filesystem::path& directory, uint64_t segmentId) {
+			auto segmentFilename = (directory / GetFilename(segmentId, Segment_File_Extension)).generic_string();
+			return std::make_unique<RawFile>(segmentFilename, OpenMode::Read_Only, LockMode::None);
+		}
+
+		// endregion
 	}
 
 	FileQueueReader::FileQueueReader(const std::string& directory) : FileQueueReader(directory, "index_reader.dat", "index.dat")
@@ -101,10 +299,16 @@ namespace catapult { namespace io {
 			const std::string& writerIndexFilename)
 			: m_directory(CreateDirectory(directory))
 			, m_readerIndexFile((m_directory / readerIndexFilename).generic_string())
-			, m_writerIndexFile((m_directory / writerIndexFilename).generic_string(), LockMode::None) {
+			, m_writerIndexFile((m_directory / writerIndexFilename).generic_string(), LockMode::None)
+			, m_readerPositionFilename(m_directory / (boost::filesystem::path(readerIndexFilename).stem().generic_string()
+					+ Reader_Position_File_Extension))
+			, m_segmentId(0)
+			, m_segmentIndexValue(0) {
 		CreateIfNotExists(m_readerIndexFile);
 	}
 
+	FileQueueReader::~FileQueueReader() = default;
+
 	size_t FileQueueReader::pending() const {
 		auto writerIndexValue = m_writerIndexFile.exists() ? m_writerIndexFile.get() : 0;
 		auto readerIndexValue = m_readerIndexFile.get();
@@ -112,31 +316,145 @@ namespace catapult { namespace io {
 	}
 
 	bool FileQueueReader::tryReadNextMessage(const consumer<const std::vector<uint8_t>&>& consumer) {
-		return process([consumer](const auto& nextMessageFilename) {
-			auto buffer = ReadAllContents(nextMessageFilename);
+		return process([consumer](const auto& buffer, auto) {
 			consumer(buffer);
 		});
 	}
 
+	bool FileQueueReader::tryReadNextTimedMessage(
+			const consumer<const std::vector<uint8_t>&, std::chrono::system_clock::time_point>& consumer) {
+		return process(consumer);
+	}
+
+	size_t FileQueueReader::readNextTimedMessages(
+			size_t maxMessages,
+			const consumer<const std::vector<uint8_t>&, std::chrono::system_clock::time_point>& consumer,
+			const action& commit) {
+		return process(maxMessages, consumer, commit);
+	}
+
 	void FileQueueReader::skip(uint32_t count) {
 		for (auto i = 0u; i < count; ++i)
-			process([](const auto&) {});
+			process([](const auto&, auto) {});
+	}
+
+	bool FileQueueReader::process(const MessageConsumer& consumer) {
+		return 0 != process(1, consumer, []() {});
 	}
 
-	bool FileQueueReader::process(const consumer<const std::string&>& processFilename) {
+	size_t FileQueueReader::process(size_t maxMessages, const MessageConsumer& consumer, const action& commit) {
 		auto readerIndexValue = m_readerIndexFile.get();
-		if (!m_writerIndexFile.exists() || readerIndexValue >= m_writerIndexFile.get())
-			return false;
+		auto writerIndexValue = m_writerIndexFile.exists() ? m_writerIndexFile.get() : 0;
+		if (readerIndexValue >= writerIndexValue)
+			return 0;
+
+		auto numMessages = static_cast<size_t>(std::min<uint64_t>(maxMessages, writerIndexValue - readerIndexValue));
+		std::vector<boost::filesystem::path> messageFilenames;
+		auto hasSegmentRecords = false;
+		for (auto i = 0u; i < numMessages; ++i) {
+			// message files take precedence over segments so that queues written before segmentation was enabled are drained first
+			auto messageFilename = m_directory / GetFilename(readerIndexValue + i);
+			if (!boost::filesystem::exists(messageFilename)) {
+				processSegmentRecord(readerIndexValue + i, consumer);
+				hasSegmentRecords = true;
+				continue;
+			}
 
-		auto nextMessageFilename = m_directory / GetFilename(readerIndexValue);
-		if (!boost::filesystem::exists(nextMessageFilename))
+			auto writeTime = GetLastWriteTime(messageFilename.generic_string());
+			consumer(ReadAllContents(messageFilename.generic_string()), writeTime);
+			messageFilenames.push_back(messageFilename);
+		}
+
+		commit();
+
+		if (hasSegmentRecords)
+			saveReaderPosition();
+
+		m_readerIndexFile.set(readerIndexValue + numMessages);
+		for (const auto& messageFilename : messageFilenames)
+			boost::filesystem::remove(messageFilename);
+
+		return numMessages;
+	}
+
+	void FileQueueReader::processSegmentRecord(uint64_t readerIndexValue, const MessageConsumer& consumer) {
+		// the open segment can only be reused when it is positioned at the next message
+		if (!m_pSegmentFile || readerIndexValue != m_segmentIndexValue)
+			openSegment(readerIndexValue);
+
+		std::vector<uint8_t> buffer;
+		uint64_t writeTime;
+		if (!TryReadSegmentRecord(*m_pSegmentFile, buffer, writeTime)) {
+			reopenSegment(readerIndexValue);
+			if (!TryReadSegmentRecord(*m_pSegmentFile, buffer, writeTime))
+				CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to truncated segment", m_segmentId);
+		}
+
+		// if the consumer (or commit) throws, the open segment will not match the reader index and will be repositioned by the next read
+		++m_segmentIndexValue;
+		consumer(buffer, std::chrono::system_clock::time_point(std::chrono::milliseconds(writeTime)));
+	}
+
+	void FileQueueReader::openSegment(uint64_t readerIndexValue) {
+		// the segment containing a message is the most recent one starting at or before it
+		auto segmentIds = FindSegments(m_directory);
+		auto segmentIter = std::upper_bound(segmentIds.cbegin(), segmentIds.cend(), readerIndexValue);
+		if (segmentIds.cbegin() == segmentIter) {
+			auto nextMessageFilename = m_directory / GetFilename(readerIndexValue);
 			CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", nextMessageFilename);
+		}
 
-		processFilename(nextMessageFilename.generic_string());
+		m_segmentId = *--segmentIter;
+		m_segmentIndexValue = readerIndexValue;
+		m_pSegmentFile = OpenSegment(m_directory, m_segmentId);
+
+		// use the saved position when it matches, otherwise skip over all preceding records in the segment
+		ReaderPosition position;
+		if (TryLoadReaderPosition(m_readerPositionFilename, position)
+				&& readerIndexValue == position.IndexValue
+				&& m_segmentId == position.SegmentId) {
+			m_pSegmentFile->seek(position.Offset);
+		} else {
+			for (auto i = m_segmentId; i < readerIndexValue; ++i) {
+				auto header = ReadSegmentRecordHeader(*m_pSegmentFile);
+				m_pSegmentFile->seek(m_pSegmentFile->position() + header.PayloadSize);
+			}
+		}
+
+		// all messages in segments preceding the one containing the committed reader index have been consumed
+		// (messages read by an uncommitted batch might still need to be read again)
+		auto committedSegmentIter = std::upper_bound(segmentIds.cbegin(), segmentIds.cend(), m_readerIndexFile.get());
+		if (segmentIds.cbegin() != committedSegmentIter)
+			--committedSegmentIter;
+
+		for (auto iter = segmentIds.cbegin(); committedSegmentIter != iter; ++iter) {
+			auto consumedSegmentFilename = m_directory / GetFilename(*iter, Segment_File_Extension);
+			CATAPULT_LOG(debug) << "removing consumed file queue segment " << consumedSegmentFilename;
+			boost::filesystem::remove(consumedSegmentFilename);
+		}
+	}
+
+	void FileQueueReader::reopenSegment(uint64_t readerIndexValue) {
+		// the size of an open segment is fixed, so reopen it in order to pick up records appended since it was opened
+		auto offset = m_pSegmentFile->position();
+		m_pSegmentFile = OpenSegment(m_directory, m_segmentId);
+		if (offset < m_pSegmentFile->size()) {
+			m_pSegmentFile->seek(offset);
+			return;
+		}
+
+		// the open segment is exhausted, so the message must be in a newer segment
+		m_pSegmentFile.reset();
+		openSegment(readerIndexValue);
+	}
+
+	void FileQueueReader::saveReaderPosition() {
+		if (!m_pReaderPositionFile) {
+			auto positionFilename = m_readerPositionFilename.generic_string();
+			m_pReaderPositionFile = std::make_unique<RawFile>(positionFilename, OpenMode::Read_Append, LockMode::None);
+		}
 
-		m_readerIndexFile.increment();
-		boost::filesystem::remove(nextMessageFilename);
-		return true;
+		SaveReaderPosition(*m_pReaderPositionFile, { m_segmentIndexValue, m_segmentId, m_pSegmentFile->position() });
 	}
 
 	// endregion
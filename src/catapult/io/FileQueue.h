@@ -21,13 +21,16 @@
 #pragma once
 #include "BufferedFileStream.h"
 #include "IndexFile.h"
+#include "catapult/utils/FileSize.h"
 #include "catapult/functions.h"
 #include <boost/filesystem/path.hpp>
+#include <chrono>
 
 namespace catapult { namespace io {
 
 	/// File based queue writer where each message is represented by a file (with incrementing names) in a directory.
-	/// \note Each call to flush will additionally create a new file.
+	/// Alternatively, messages can be appended as length prefixed records to segment files named after their first message.
+	/// \note Each call to flush will additionally create a new message.
 	class FileQueueWriter final : public OutputStream {
 	public:
 		/// Creates a file queue writer around \a directory.
@@ -36,18 +39,35 @@ namespace catapult { namespace io {
 		/// Creates a file queue writer around \a directory containing a (writer) index file (\a indexFilename).
 		FileQueueWriter(const std::string& directory, const std::string& indexFilename);
 
+		/// Creates a segmented file queue writer around \a directory containing a (writer) index file (\a indexFilename).
+		/// A new segment is started whenever a message would grow the current segment beyond \a maxSegmentSize.
+		/// \note When \a maxSegmentSize is zero, each message is written to a separate file.
+		FileQueueWriter(const std::string& directory, const std::string& indexFilename, utils::FileSize maxSegmentSize);
+
+		/// Destroys the writer.
+		~FileQueueWriter() override;
+
 	public:
 		void write(const RawBuffer& buffer) override;
 		void flush() override;
 
+	private:
+		void appendToSegment();
+
 	private:
 		boost::filesystem::path m_directory;
 		IndexFile m_indexFile;
 		uint64_t m_indexValue;
 		std::unique_ptr<BufferedOutputFileStream> m_pOutputStream;
+
+		utils::FileSize m_maxSegmentSize;
+		std::vector<uint8_t> m_segmentRecordBuffer;
+		std::unique_ptr<RawFile> m_pSegmentFile;
 	};
 
-	/// File based queue reader where each message is represented by a file (with incrementing names) in a directory.
+	/// File based queue reader where each message is represented by a file (with incrementing names) in a directory
+	/// or by a record in a segment file.
+	/// \note Segment files are removed once the reader has moved past them.
 	class FileQueueReader final {
 	public:
 		/// Creates a file queue reader around \a directory.
@@ -57,6 +77,9 @@ namespace catapult { namespace io {
 		/// (\a readerIndexFilename, \a writerIndexFilename).
 		FileQueueReader(const std::string& directory, const std::string& readerIndexFilename, const std::string& writerIndexFilename);
 
+		/// Destroys the reader.
+		~FileQueueReader();
+
 	public:
 		/// Gets the number of pending messages.
 		size_t pending() const;
@@ -65,15 +88,40 @@ namespace catapult { namespace io {
 		/// Tries to read the next message and forwards it to \a consumer if successful.
 		bool tryReadNextMessage(const consumer<const std::vector<uint8_t>&>& consumer);
 
+		/// Tries to read the next message and forwards it and the time it was written to \a consumer if successful.
+		bool tryReadNextTimedMessage(const consumer<const std::vector<uint8_t>&, std::chrono::system_clock::time_point>& consumer);
+
+		/// Tries to read at most \a maxMessages messages and forwards each one and the time it was written to \a consumer.
+		/// The messages are only removed from the queue after \a commit returns, so they are read again if it is not reached.
+		/// Returns the number of messages that were read.
+		size_t readNextTimedMessages(
+				size_t maxMessages,
+				const consumer<const std::vector<uint8_t>&, std::chrono::system_clock::time_point>& consumer,
+				const action& commit);
+
 		/// Skips at most the next \a count messages.
 		void skip(uint32_t count);
 
 	private:
-		bool process(const consumer<const std::string&>& processFilename);
+		using MessageConsumer = consumer<const std::vector<uint8_t>&, std::chrono::system_clock::time_point>;
+
+		bool process(const MessageConsumer& consumer);
+		size_t process(size_t maxMessages, const MessageConsumer& consumer, const action& commit);
+		void processSegmentRecord(uint64_t readerIndexValue, const MessageConsumer& consumer);
+		void openSegment(uint64_t readerIndexValue);
+		void reopenSegment(uint64_t readerIndexValue);
+		void saveReaderPosition();
 
 	private:
 		boost::filesystem::path m_directory;
 		IndexFile m_readerIndexFile;
 		IndexFile m_writerIndexFile;
+		boost::filesystem::path m_readerPositionFilename;
+
+		// open segment positioned at the record with index m_segmentIndexValue
+		std::unique_ptr<RawFile> m_pSegmentFile;
+		uint64_t m_segmentId;
+		uint64_t m_segmentIndexValue;
+		std::unique_ptr<RawFile> m_pReaderPositionFile;
 	};
 }}
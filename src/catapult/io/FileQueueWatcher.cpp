@@ -0,0 +1,112 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "FileQueueWatcher.h"
+#include "catapult/utils/Logging.h"
+#include <thread>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace catapult { namespace io {
+
+#ifdef __linux__
+	namespace {
+		constexpr int Invalid_Descriptor = -1;
+
+		int CreateInotifyDescriptor(const std::string& directory) {
+			auto fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+			if (Invalid_Descriptor == fd) {
+				CATAPULT_LOG(warning) << "inotify_init1 failed (" << errno << "), falling back to polling " << directory;
+				return Invalid_Descriptor;
+			}
+
+			// index files are rewritten in place, so closing after write indicates that new messages are available
+			if (0 > ::inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO)) {
+				CATAPULT_LOG(warning) << "inotify_add_watch failed (" << errno << "), falling back to polling " << directory;
+				::close(fd);
+				return Invalid_Descriptor;
+			}
+
+			return fd;
+		}
+	}
+
+	FileQueueWatcher::FileQueueWatcher(const std::string& directory, const std::string& indexFilename)
+			: m_indexFilename(indexFilename)
+			, m_fd(CreateInotifyDescriptor(directory))
+	{}
+
+	FileQueueWatcher::~FileQueueWatcher() {
+		if (Invalid_Descriptor != m_fd)
+			::close(m_fd);
+	}
+
+	bool FileQueueWatcher::isEventDriven() const {
+		return Invalid_Descriptor != m_fd;
+	}
+
+	bool FileQueueWatcher::wait(const utils::TimeSpan& timeout) {
+		if (!isEventDriven()) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(timeout.millis()));
+			return false;
+		}
+
+		pollfd pollDescriptor{ m_fd, POLLIN, 0 };
+		if (0 >= ::poll(&pollDescriptor, 1, static_cast<int>(timeout.millis())))
+			return false;
+
+		// drain all pending events because multiple writes can be coalesced into a single wakeup
+		alignas(inotify_event) char buffer[4096];
+		auto isIndexChanged = false;
+		ssize_t numBytes;
+		while (0 < (numBytes = ::read(m_fd, buffer, sizeof(buffer)))) {
+			for (auto offset = 0; offset < numBytes;) {
+				const auto& event = reinterpret_cast<const inotify_event&>(buffer[offset]);
+				if (0 != event.len && m_indexFilename == event.name)
+					isIndexChanged = true;
+
+				offset += static_cast<int>(sizeof(inotify_event) + event.len);
+			}
+		}
+
+		return isIndexChanged;
+	}
+#else
+	FileQueueWatcher::FileQueueWatcher(const std::string&, const std::string& indexFilename)
+			: m_indexFilename(indexFilename)
+			, m_fd(-1)
+	{}
+
+	FileQueueWatcher::~FileQueueWatcher() = default;
+
+	bool FileQueueWatcher::isEventDriven() const {
+		return false;
+	}
+
+	bool FileQueueWatcher::wait(const utils::TimeSpan& timeout) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(timeout.millis()));
+		return false;
+	}
+#endif
+}}
@@ -0,0 +1,50 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/NonCopyable.h"
+#include "catapult/utils/TimeSpan.h"
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// Watches a file queue directory for changes to its (writer) index file.
+	/// \note When change notifications are not supported by the platform, waits always time out.
+	class FileQueueWatcher final : public utils::NonCopyable {
+	public:
+		/// Creates a watcher around \a directory containing a (writer) index file (\a indexFilename).
+		FileQueueWatcher(const std::string& directory, const std::string& indexFilename);
+
+		/// Destroys the watcher.
+		~FileQueueWatcher();
+
+	public:
+		/// Returns \c true if the watcher is notified of changes instead of relying on timeouts.
+		bool isEventDriven() const;
+
+		/// Waits at most \a timeout for the index file to change.
+		/// Returns \c true if a change was detected before the timeout expired.
+		bool wait(const utils::TimeSpan& timeout);
+
+	private:
+		std::string m_indexFilename;
+		int m_fd;
+	};
+}}
@@ -206,6 +206,18 @@ namespace catapult { namespace ionet {
 		incrementInteraction(identity, [timestamp](auto& nodeInfo) { nodeInfo.incrementFailures(timestamp); });
 	}
 
+	void NodeContainerModifier::addRoundTripTime(const model::NodeIdentity& identity, const utils::TimeSpan& roundTripTime) {
+		incrementInteraction(identity, [roundTripTime](auto& nodeInfo) { nodeInfo.addRoundTripTime(roundTripTime); });
+	}
+
+	void NodeContainerModifier::addThroughput(const model::NodeIdentity& identity, uint64_t numBytes, const utils::TimeSpan& elapsedTime) {
+		incrementInteraction(identity, [numBytes, elapsedTime](auto& nodeInfo) { nodeInfo.addThroughput(numBytes, elapsedTime); });
+	}
+
+	void NodeContainerModifier::addReadTraffic(const model::NodeIdentity& identity, uint64_t numBytes, uint64_t numPackets) {
+		incrementInteraction(identity, [numBytes, numPackets](auto& nodeInfo) { nodeInfo.addReadTraffic(numBytes, numPackets); });
+	}
+
 	void NodeContainerModifier::ban(const model::NodeIdentity& identity, uint32_t reason) {
 		m_bannedNodes.add(identity, reason);
 	}
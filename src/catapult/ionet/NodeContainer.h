@@ -109,6 +109,15 @@ namespace catapult { namespace ionet {
 		/// Increments the number of failed interactions for the node identified by \a identity.
 		void incrementFailures(const model::NodeIdentity& identity);
 
+		/// Adds a \a roundTripTime sample for the node identified by \a identity.
+		void addRoundTripTime(const model::NodeIdentity& identity, const utils::TimeSpan& roundTripTime);
+
+		/// Adds a throughput sample of \a numBytes received in \a elapsedTime for the node identified by \a identity.
+		void addThroughput(const model::NodeIdentity& identity, uint64_t numBytes, const utils::TimeSpan& elapsedTime);
+
+		/// Adds \a numBytes and \a numPackets to the traffic read from the node identified by \a identity.
+		void addReadTraffic(const model::NodeIdentity& identity, uint64_t numBytes, uint64_t numPackets);
+
 		/// Bans \a identity due to \a reason.
 		void ban(const model::NodeIdentity& identity, uint32_t reason);
 
@@ -39,6 +39,17 @@ namespace catapult { namespace ionet {
 
 			return end == iter ? nullptr : &iter->second;
 		}
+
+		// exponentially weighted moving average with a weight of 1 / 2^Smoothing_Shift for new samples
+		constexpr auto Smoothing_Shift = 3u;
+
+		uint64_t Smooth(uint64_t estimate, uint64_t sample) {
+			if (0 == estimate)
+				return std::max<uint64_t>(1, sample);
+
+			auto delta = static_cast<int64_t>(sample) - static_cast<int64_t>(estimate);
+			return std::max<uint64_t>(1, static_cast<uint64_t>(static_cast<int64_t>(estimate) + delta / (1 << Smoothing_Shift)));
+		}
 	}
 
 	NodeInfo::NodeInfo(NodeSource source) : m_source(source)
@@ -52,6 +63,14 @@ namespace catapult { namespace ionet {
 		return m_interactions.interactions(timestamp);
 	}
 
+	const NodePerformance& NodeInfo::performance() const {
+		return m_performance;
+	}
+
+	const NodeTraffic& NodeInfo::traffic() const {
+		return m_traffic;
+	}
+
 	size_t NodeInfo::numConnectionStates() const {
 		return m_connectionStates.size();
 	}
@@ -88,6 +107,21 @@ namespace catapult { namespace ionet {
 		m_interactions.pruneBuckets(timestamp);
 	}
 
+	void NodeInfo::addRoundTripTime(const utils::TimeSpan& roundTripTime) {
+		auto millis = Smooth(m_performance.RoundTripTime.millis(), roundTripTime.millis());
+		m_performance.RoundTripTime = utils::TimeSpan::FromMilliseconds(millis);
+	}
+
+	void NodeInfo::addThroughput(uint64_t numBytes, const utils::TimeSpan& elapsedTime) {
+		auto bytesPerSecond = numBytes * 1000 / std::max<uint64_t>(1, elapsedTime.millis());
+		m_performance.BytesPerSecond = Smooth(m_performance.BytesPerSecond, bytesPerSecond);
+	}
+
+	void NodeInfo::addReadTraffic(uint64_t numBytes, uint64_t numPackets) {
+		m_traffic.NumReadBytes += numBytes;
+		m_traffic.NumReadPackets += numPackets;
+	}
+
 	ConnectionState& NodeInfo::provisionConnectionState(ServiceIdentifier serviceId) {
 		auto* pConnectionState = FindByIdentifier(m_connectionStates.begin(), m_connectionStates.end(), serviceId);
 		if (pConnectionState)
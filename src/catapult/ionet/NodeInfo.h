@@ -78,6 +78,40 @@ namespace catapult { namespace ionet {
 		uint32_t BanAge;
 	};
 
+	/// Smoothed performance estimates of a node.
+	struct NodePerformance {
+	public:
+		/// Creates unknown estimates.
+		NodePerformance() : BytesPerSecond(0)
+		{}
+
+	public:
+		/// Smoothed round trip time.
+		/// \c 0 if unknown.
+		utils::TimeSpan RoundTripTime;
+
+		/// Smoothed throughput of data received from the node (in bytes per second).
+		/// \c 0 if unknown.
+		uint64_t BytesPerSecond;
+	};
+
+	/// Cumulative traffic read from a node.
+	struct NodeTraffic {
+	public:
+		/// Creates zeroed traffic.
+		NodeTraffic()
+				: NumReadBytes(0)
+				, NumReadPackets(0)
+		{}
+
+	public:
+		/// Number of bytes read from the node.
+		uint64_t NumReadBytes;
+
+		/// Number of packets read from the node.
+		uint64_t NumReadPackets;
+	};
+
 	/// Information about a node and its interactions.
 	struct NodeInfo {
 	public:
@@ -95,6 +129,12 @@ namespace catapult { namespace ionet {
 		/// Gets the node interactions at \a timestamp.
 		NodeInteractions interactions(Timestamp timestamp) const;
 
+		/// Gets the node performance estimates.
+		const NodePerformance& performance() const;
+
+		/// Gets the traffic read from the node.
+		const NodeTraffic& traffic() const;
+
 		/// Gets the number of connection states.
 		size_t numConnectionStates() const;
 
@@ -117,6 +157,15 @@ namespace catapult { namespace ionet {
 		/// Increments the number of failed interactions at \a timestamp.
 		void incrementFailures(Timestamp timestamp);
 
+		/// Adds a \a roundTripTime sample to the performance estimates.
+		void addRoundTripTime(const utils::TimeSpan& roundTripTime);
+
+		/// Adds a throughput sample of \a numBytes received in \a elapsedTime to the performance estimates.
+		void addThroughput(uint64_t numBytes, const utils::TimeSpan& elapsedTime);
+
+		/// Adds \a numBytes and \a numPackets to the traffic read from the node.
+		void addReadTraffic(uint64_t numBytes, uint64_t numPackets);
+
 		/// Gets the connection state for the service identified by \a serviceId and creates zeroed state if no state exists.
 		ConnectionState& provisionConnectionState(ServiceIdentifier serviceId);
 
@@ -130,6 +179,8 @@ namespace catapult { namespace ionet {
 	private:
 		NodeSource m_source;
 		NodeInteractionsContainer m_interactions;
+		NodePerformance m_performance;
+		NodeTraffic m_traffic;
 		std::vector<std::pair<ServiceIdentifier, ConnectionState>> m_connectionStates;
 	};
 }}
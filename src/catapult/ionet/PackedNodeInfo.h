@@ -69,6 +69,27 @@ namespace catapult { namespace ionet {
 		}
 	};
 
+	/// Traffic read from a node.
+	/// \note This is returned by a separate diagnostic request in order to preserve the PackedNodeInfo layout.
+	struct PackedNodeTraffic {
+	public:
+		/// Node unique identifier.
+		Key IdentityKey;
+
+		/// Number of bytes read from the node.
+		uint64_t NumReadBytes;
+
+		/// Number of packets read from the node.
+		uint64_t NumReadPackets;
+
+	public:
+		/// Updates values with corresponding values from \a traffic.
+		void Update(const NodeTraffic& traffic) {
+			NumReadBytes = traffic.NumReadBytes;
+			NumReadPackets = traffic.NumReadPackets;
+		}
+	};
+
 	/// Information about a node and its interactions.
 	struct PackedNodeInfo : public model::TrailingVariableDataLayout<PackedNodeInfo, PackedConnectionState> {
 	public:
@@ -20,6 +20,7 @@
 
 #include "PacketHandlers.h"
 #include "catapult/utils/Casting.h"
+#include "catapult/utils/StackTimer.h"
 
 namespace catapult { namespace ionet {
 
@@ -116,10 +117,23 @@ namespace catapult { namespace ionet {
 		}
 
 		CATAPULT_LOG(trace) << "processing " << packet;
+		utils::StackTimer stopwatch;
 		pDescriptor->Handler(packet, context);
+		pDescriptor->pLatencyHistogram->record(std::chrono::microseconds(stopwatch.micros()));
 		return true;
 	}
 
+	utils::DiagnosticHistograms ServerPacketHandlers::histograms() const {
+		utils::DiagnosticHistograms histograms;
+		for (auto i = 0u; i < m_descriptors.size(); ++i) {
+			const auto& descriptor = m_descriptors[i];
+			if (descriptor.Handler)
+				histograms.emplace_back(utils::DiagnosticCounterId("PKT HANDLER"), i, descriptor.pLatencyHistogram);
+		}
+
+		return histograms;
+	}
+
 	void ServerPacketHandlers::setAllowedHosts(const std::unordered_set<std::string>& hosts) {
 		m_activeAllowedHosts = hosts;
 	}
@@ -132,7 +146,7 @@ namespace catapult { namespace ionet {
 		if (m_descriptors[rawType].Handler)
 			CATAPULT_THROW_RUNTIME_ERROR_1("handler for type is already registered", rawType);
 
-		m_descriptors[rawType] = { handler, m_activeAllowedHosts };
+		m_descriptors[rawType] = { handler, m_activeAllowedHosts, std::make_shared<utils::LatencyHistogram>() };
 	}
 
 	const ServerPacketHandlers::PacketHandlerDescriptor* ServerPacketHandlers::findDescriptor(const Packet& packet) const {
@@ -21,6 +21,7 @@
 #pragma once
 #include "IoTypes.h"
 #include "PacketPayload.h"
+#include "catapult/utils/DiagnosticHistogram.h"
 #include "catapult/utils/NonCopyable.h"
 #include "catapult/functions.h"
 #include "catapult/types.h"
@@ -95,6 +96,9 @@ namespace catapult { namespace ionet {
 		/// packet was processed.
 		bool process(const Packet& packet, ContextType& context) const;
 
+		/// Gets the processing latency histograms of all registered handlers tagged with their packet types.
+		utils::DiagnosticHistograms histograms() const;
+
 	public:
 		/// Sets the \a hosts that are allowed to access subsequently registered handlers.
 		void setAllowedHosts(const std::unordered_set<std::string>& hosts);
@@ -106,6 +110,7 @@ namespace catapult { namespace ionet {
 		struct PacketHandlerDescriptor {
 			PacketHandler Handler;
 			std::unordered_set<std::string> AllowedHosts;
+			std::shared_ptr<utils::LatencyHistogram> pLatencyHistogram;
 		};
 
 	private:
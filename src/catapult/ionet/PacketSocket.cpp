@@ -21,6 +21,7 @@
 #include "PacketSocket.h"
 #include "BufferedPacketIo.h"
 #include "Node.h"
+#include "SslSessionCache.h"
 #include "WorkingBuffer.h"
 #include "catapult/thread/StrandOwnerLifetimeExtender.h"
 #include "catapult/utils/StackTimer.h"
@@ -430,6 +431,8 @@ namespace catapult { namespace ionet {
 			}
 
 			void markOpen() {
+				// resumed handshakes skip certificate verification, so the peer public key needs to be restored from the session
+				TryGetResumedSessionPublicKey(*m_socket.native_handle(), m_publicKey);
 				m_pSocketGuard->markOpen();
 			}
 
@@ -741,6 +744,7 @@ namespace catapult { namespace ionet {
 							std::make_shared<SocketGuard>(ioContext, options.SslOptions.ContextSupplier()),
 							options))
 					, m_resolver(ioContext)
+					, m_requestedEndpoint(endpoint)
 					, m_host(endpoint.Host)
 					, m_query(m_host, std::to_string(endpoint.Port))
 					, m_isCancelled(false)
@@ -779,6 +783,7 @@ namespace catapult { namespace ionet {
 				if (shouldAbort(ec, "connecting to"))
 					return invokeCallback(ConnectResult::Connect_Error);
 
+				PrepareSslSessionResumption(*m_pSocket->impl().native_handle(), m_requestedEndpoint);
 				m_pSocket->impl().async_handshake(Socket::client, m_wrapper.wrap([this](const auto& handshakeEc) {
 					this->handleHandshake(handshakeEc);
 				}));
@@ -820,6 +825,7 @@ namespace catapult { namespace ionet {
 
 			std::shared_ptr<StrandedPacketSocket> m_pSocket;
 			Resolver m_resolver;
+			NodeEndpoint m_requestedEndpoint;
 			std::string m_host;
 			Resolver::query m_query;
 			bool m_isCancelled;
@@ -19,7 +19,9 @@
 **/
 
 #include "PacketSocketOptions.h"
+#include "SslSessionCache.h"
 #include "catapult/crypto/CatapultCertificateProcessor.h"
+#include "catapult/crypto/VerifiedCertificateCache.h"
 #include "catapult/exceptions.h"
 #include <boost/asio/ssl.hpp>
 
@@ -80,9 +82,23 @@ namespace catapult { namespace ionet {
 		};
 	}
 
-	supplier<predicate<PacketSocketSslVerifyContext&>> CreateSslVerifyCallbackSupplier() {
-		return []() {
-			crypto::CatapultCertificateProcessor processor;
+	supplier<boost::asio::ssl::context&> CreateSslContextSupplier(
+			const boost::filesystem::path& certificateDirectory,
+			size_t maxResumableSessions) {
+		auto sslContextSupplier = CreateSslContextSupplier(certificateDirectory);
+		if (0 == maxResumableSessions)
+			return sslContextSupplier;
+
+		auto pSessionCache = std::make_shared<SslSessionCache>(maxResumableSessions);
+		EnableSslSessionResumption(sslContextSupplier(), *pSessionCache);
+
+		return [sslContextSupplier, pSessionCache]() -> boost::asio::ssl::context& {
+			return sslContextSupplier();
+		};
+	}
+
+	namespace {
+		predicate<PacketSocketSslVerifyContext&> CreateSslVerifyCallback(crypto::CatapultCertificateProcessor processor) {
 			return [processor](auto& verifyContext) mutable {
 				if (!processor.verify(verifyContext.preverified(), *verifyContext.asioVerifyContext().native_handle()))
 					return false;
@@ -92,6 +108,23 @@ namespace catapult { namespace ionet {
 
 				return true;
 			};
+		}
+	}
+
+	supplier<predicate<PacketSocketSslVerifyContext&>> CreateSslVerifyCallbackSupplier() {
+		return []() {
+			return CreateSslVerifyCallback(crypto::CatapultCertificateProcessor());
+		};
+	}
+
+	supplier<predicate<PacketSocketSslVerifyContext&>> CreateSslVerifyCallbackSupplier(size_t maxVerifiedCertificates) {
+		auto pVerifiedCertificateCache = std::make_shared<crypto::VerifiedCertificateCache>(maxVerifiedCertificates);
+		return [pVerifiedCertificateCache]() {
+			// processor only holds a raw pointer to the cache, so extend its lifetime along with the callback
+			auto verifyCallback = CreateSslVerifyCallback(crypto::CatapultCertificateProcessor(*pVerifiedCertificateCache));
+			return predicate<PacketSocketSslVerifyContext&>([verifyCallback, pVerifiedCertificateCache](auto& verifyContext) {
+				return verifyCallback(verifyContext);
+			});
 		};
 	}
 }}
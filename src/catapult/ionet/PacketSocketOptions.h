@@ -90,6 +90,16 @@ namespace catapult { namespace ionet {
 	/// Creates an ssl context supplier given the specified certificates in \a certificateDirectory.
 	supplier<boost::asio::ssl::context&> CreateSslContextSupplier(const boost::filesystem::path& certificateDirectory);
 
+	/// Creates an ssl context supplier given the specified certificates in \a certificateDirectory
+	/// that caches up to \a maxResumableSessions client sessions for resumption.
+	/// \note Session resumption is disabled when \a maxResumableSessions is zero.
+	supplier<boost::asio::ssl::context&> CreateSslContextSupplier(
+			const boost::filesystem::path& certificateDirectory,
+			size_t maxResumableSessions);
+
 	/// Creates an ssl verify callback supplier.
 	supplier<predicate<PacketSocketSslVerifyContext&>> CreateSslVerifyCallbackSupplier();
+
+	/// Creates an ssl verify callback supplier that shares a cache of up to \a maxVerifiedCertificates verified root certificates.
+	supplier<predicate<PacketSocketSslVerifyContext&>> CreateSslVerifyCallbackSupplier(size_t maxVerifiedCertificates);
 }}
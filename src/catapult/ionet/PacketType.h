@@ -66,6 +66,12 @@ namespace catapult { namespace ionet {
 	/* Sub cache merkle roots have been requested. */ \
 	ENUM_VALUE(Sub_Cache_Merkle_Roots, 12) \
 	\
+	/* Transaction hashes have been announced by a peer (the response contains the unknown hashes). */ \
+	ENUM_VALUE(Transaction_Inventory, 13) \
+	\
+	/* Compact block has been pushed by a peer (the response contains the indexes of unknown transactions). */ \
+	ENUM_VALUE(Compact_Block, 14) \
+	\
 	/* api only packets have types [500, 600) */ \
 	\
 	/* Partial aggregate transactions have been pushed by an api-node. */ \
@@ -125,6 +131,33 @@ namespace catapult { namespace ionet {
 	/* Mosaic restrictions state path has been requested by a client. */ \
 	ENUM_VALUE(Mosaic_Restrictions_State_Path, FACILITY_BASED_CODE(800, RestrictionMosaic)) \
 	\
+	/* Account state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Account_State_Paths, FACILITY_BASED_CODE(900, Core)) \
+	\
+	/* Hash lock state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Hash_Lock_State_Paths, FACILITY_BASED_CODE(900, LockHash)) \
+	\
+	/* Secret lock state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Secret_Lock_State_Paths, FACILITY_BASED_CODE(900, LockSecret)) \
+	\
+	/* Metadata state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Metadata_State_Paths, FACILITY_BASED_CODE(900, Metadata)) \
+	\
+	/* Mosaic state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Mosaic_State_Paths, FACILITY_BASED_CODE(900, Mosaic)) \
+	\
+	/* Multisig state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Multisig_State_Paths, FACILITY_BASED_CODE(900, Multisig)) \
+	\
+	/* Namespace state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Namespace_State_Paths, FACILITY_BASED_CODE(900, Namespace)) \
+	\
+	/* Account restrictions state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Account_Restrictions_State_Paths, FACILITY_BASED_CODE(900, RestrictionAccount)) \
+	\
+	/* Mosaic restrictions state paths of multiple keys have been requested by a client. */ \
+	ENUM_VALUE(Mosaic_Restrictions_State_Paths, FACILITY_BASED_CODE(900, RestrictionMosaic)) \
+	\
 	/* diagnostic packets have types [1100, 2000) - ordered by facility code name */ \
 	\
 	/* Request for the current diagnostic counter values. */ \
@@ -142,6 +175,15 @@ namespace catapult { namespace ionet {
 	/* Unlocked accounts have been requested by a client. */ \
 	ENUM_VALUE(Unlocked_Accounts, 1104) \
 	\
+	/* Request for the current diagnostic histogram values. */ \
+	ENUM_VALUE(Diagnostic_Histograms, 1105) \
+	\
+	/* Request to write all retained trace events to a file. */ \
+	ENUM_VALUE(Diagnostic_Trace_Events, 1106) \
+	\
+	/* Read traffic of active nodes has been requested. */ \
+	ENUM_VALUE(Active_Node_Traffic, 1107) \
+	\
 	/* Account infos have been requested by a client. */ \
 	ENUM_VALUE(Account_Infos, FACILITY_BASED_CODE(1200, Core)) \
 	\
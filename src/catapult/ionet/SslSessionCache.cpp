@@ -0,0 +1,257 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SslSessionCache.h"
+#include "catapult/crypto/CertificateUtils.h"
+#include "catapult/exceptions.h"
+#include <boost/asio/ssl.hpp>
+#include <cstring>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		constexpr auto Session_Id_Context = "catapult";
+
+		std::string ToEndpointKey(const NodeEndpoint& endpoint) {
+			return endpoint.Host + ":" + std::to_string(endpoint.Port);
+		}
+
+		// region ex data
+
+		void FreeEndpoint(void*, void* pData, CRYPTO_EX_DATA*, int, long, void*) {
+			delete static_cast<NodeEndpoint*>(pData);
+		}
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wold-style-cast"
+#endif
+
+		int GetSslContextSessionCacheIndex() {
+			static auto index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+			return index;
+		}
+
+		int GetSslEndpointIndex() {
+			static auto index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, FreeEndpoint);
+			return index;
+		}
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+		SslSessionCache* GetSessionCache(SSL& ssl) {
+			return static_cast<SslSessionCache*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(&ssl), GetSslContextSessionCacheIndex()));
+		}
+
+		// endregion
+
+		// region peer public key
+
+		bool TryGetSessionPublicKey(SSL_SESSION& session, Key& publicKey) {
+			void* pData;
+			size_t dataSize;
+			if (!SSL_SESSION_get0_ticket_appdata(&session, &pData, &dataSize) || Key::Size != dataSize)
+				return false;
+
+			std::memcpy(publicKey.data(), pData, Key::Size);
+			return true;
+		}
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wused-but-marked-unused"
+#endif
+
+		bool TryGetPeerPublicKey(SSL& ssl, Key& publicKey) {
+			if (SSL_session_reused(&ssl))
+				return TryGetSessionPublicKey(*SSL_get_session(&ssl), publicKey);
+
+			// verified catapult chains are composed of the node certificate followed by the (self-signed) root certificate
+			auto* pChain = SSL_get0_verified_chain(&ssl);
+			if (!pChain || 2 != sk_X509_num(pChain))
+				return false;
+
+			crypto::CertificateInfo certificateInfo;
+			if (!crypto::TryParseCertificate(*sk_X509_value(pChain, 1), certificateInfo))
+				return false;
+
+			publicKey = certificateInfo.PublicKey;
+			return true;
+		}
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+		bool TryStorePeerPublicKey(SSL& ssl, SSL_SESSION& session) {
+			Key publicKey;
+			return TryGetPeerPublicKey(ssl, publicKey) && SSL_SESSION_set1_ticket_appdata(&session, publicKey.data(), publicKey.size());
+		}
+
+		// endregion
+
+		// region callbacks
+
+		int GenerateTicket(SSL* pSsl, void*) {
+			// tickets without a peer public key are issued but will be ignored when presented
+			TryStorePeerPublicKey(*pSsl, *SSL_get_session(pSsl));
+			return 1;
+		}
+
+		SSL_TICKET_RETURN DecryptTicket(SSL*, SSL_SESSION* pSession, const unsigned char*, size_t, SSL_TICKET_STATUS status, void*) {
+			switch (status) {
+			case SSL_TICKET_SUCCESS:
+			case SSL_TICKET_SUCCESS_RENEW: {
+				Key publicKey;
+				if (!TryGetSessionPublicKey(*pSession, publicKey))
+					return SSL_TICKET_RETURN_IGNORE_RENEW;
+
+				return SSL_TICKET_SUCCESS == status ? SSL_TICKET_RETURN_USE : SSL_TICKET_RETURN_USE_RENEW;
+			}
+
+			case SSL_TICKET_FATAL_ERR_MALLOC:
+			case SSL_TICKET_FATAL_ERR_OTHER:
+				return SSL_TICKET_RETURN_ABORT;
+
+			default:
+				return SSL_TICKET_RETURN_IGNORE_RENEW;
+			}
+		}
+
+		int SaveClientSession(SSL* pSsl, SSL_SESSION* pSession) {
+			auto* pSessionCache = GetSessionCache(*pSsl);
+			const auto* pEndpoint = static_cast<const NodeEndpoint*>(SSL_get_ex_data(pSsl, GetSslEndpointIndex()));
+			if (SSL_is_server(pSsl) || !pSessionCache || !pEndpoint || !TryStorePeerPublicKey(*pSsl, *pSession))
+				return 0;
+
+			// cache a copy because freeing a connection that was not shut down cleanly marks its session as not resumable
+			auto* pSessionCopy = SSL_SESSION_dup(pSession);
+			if (!pSessionCopy)
+				return 0;
+
+			pSessionCache->add(*pEndpoint, *pSessionCopy);
+			return 0;
+		}
+
+		// endregion
+	}
+
+	// region SslSessionCache
+
+	SslSessionCache::SslSessionCache(size_t maxSize) : m_maxSize(maxSize)
+	{}
+
+	SslSessionCache::~SslSessionCache() {
+		for (const auto& pair : m_sessions)
+			SSL_SESSION_free(pair.second);
+	}
+
+	size_t SslSessionCache::size() const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		return m_sessions.size();
+	}
+
+	void SslSessionCache::add(const NodeEndpoint& endpoint, SSL_SESSION& session) {
+		if (0 == m_maxSize) {
+			SSL_SESSION_free(&session);
+			return;
+		}
+
+		auto endpointKey = ToEndpointKey(endpoint);
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto iter = m_sessionsByEndpoint.find(endpointKey);
+		if (m_sessionsByEndpoint.end() != iter) {
+			SSL_SESSION_free(iter->second->second);
+			m_sessions.erase(iter->second);
+			m_sessionsByEndpoint.erase(iter);
+		} else if (m_maxSize == m_sessions.size()) {
+			SSL_SESSION_free(m_sessions.front().second);
+			m_sessionsByEndpoint.erase(m_sessions.front().first);
+			m_sessions.pop_front();
+		}
+
+		m_sessions.emplace_back(endpointKey, &session);
+		m_sessionsByEndpoint.emplace(endpointKey, --m_sessions.end());
+	}
+
+	bool SslSessionCache::tryResume(const NodeEndpoint& endpoint, SSL& ssl) {
+		SSL_SESSION* pSession;
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto iter = m_sessionsByEndpoint.find(ToEndpointKey(endpoint));
+			if (m_sessionsByEndpoint.end() == iter)
+				return false;
+
+			pSession = iter->second->second;
+			m_sessions.erase(iter->second);
+			m_sessionsByEndpoint.erase(iter);
+		}
+
+		auto isAttached = SSL_SESSION_is_resumable(pSession) && SSL_set_session(&ssl, pSession);
+		SSL_SESSION_free(pSession);
+		return isAttached;
+	}
+
+	// endregion
+
+	// region resumption
+
+	void EnableSslSessionResumption(boost::asio::ssl::context& sslContext, SslSessionCache& sessionCache) {
+		auto* pSslContext = sslContext.native_handle();
+		if (!SSL_CTX_set_ex_data(pSslContext, GetSslContextSessionCacheIndex(), &sessionCache))
+			CATAPULT_THROW_RUNTIME_ERROR("failed to attach the session cache");
+
+		if (!SSL_CTX_set_num_tickets(pSslContext, 1))
+			CATAPULT_THROW_RUNTIME_ERROR("failed to set the number of server tickets");
+
+		const auto* pSessionIdContext = reinterpret_cast<const unsigned char*>(Session_Id_Context);
+		if (!SSL_CTX_set_session_id_context(pSslContext, pSessionIdContext, static_cast<unsigned int>(strlen(Session_Id_Context))))
+			CATAPULT_THROW_RUNTIME_ERROR("failed to set the session id context");
+
+		if (!SSL_CTX_set_session_ticket_cb(pSslContext, GenerateTicket, DecryptTicket, nullptr))
+			CATAPULT_THROW_RUNTIME_ERROR("failed to set the session ticket callbacks");
+
+		// client sessions are only stored in the external cache; server sessions are carried by stateless tickets
+		SSL_CTX_set_session_cache_mode(pSslContext, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+		SSL_CTX_sess_set_new_cb(pSslContext, SaveClientSession);
+	}
+
+	void PrepareSslSessionResumption(SSL& ssl, const NodeEndpoint& endpoint) {
+		auto* pSessionCache = GetSessionCache(ssl);
+		if (!pSessionCache)
+			return;
+
+		auto pEndpoint = std::make_unique<NodeEndpoint>(endpoint);
+		if (!SSL_set_ex_data(&ssl, GetSslEndpointIndex(), pEndpoint.get()))
+			return;
+
+		pEndpoint.release();
+		pSessionCache->tryResume(endpoint, ssl);
+	}
+
+	bool TryGetResumedSessionPublicKey(SSL& ssl, Key& publicKey) {
+		return SSL_session_reused(&ssl) && TryGetSessionPublicKey(*SSL_get_session(&ssl), publicKey);
+	}
+
+	// endregion
+}}
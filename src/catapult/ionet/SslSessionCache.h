@@ -0,0 +1,76 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "Node.h"
+#include "catapult/utils/NonCopyable.h"
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+struct ssl_session_st;
+struct ssl_st;
+
+namespace boost { namespace asio { namespace ssl { class context; } } }
+
+namespace catapult { namespace ionet {
+
+	/// Thread-safe cache of resumable client tls sessions keyed by remote endpoint.
+	class SslSessionCache : public utils::NonCopyable {
+	public:
+		/// Creates a cache that holds at most \a maxSize sessions.
+		explicit SslSessionCache(size_t maxSize);
+
+		/// Destroys the cache and releases all cached sessions.
+		~SslSessionCache();
+
+	public:
+		/// Gets the number of cached sessions.
+		size_t size() const;
+
+	public:
+		/// Adds \a session for \a endpoint and takes ownership of one reference to it.
+		/// \note When the cache is full, the least recently added session is evicted.
+		void add(const NodeEndpoint& endpoint, ssl_session_st& session);
+
+		/// Removes the session cached for \a endpoint and tries to attach it to \a ssl for resumption.
+		/// \note Sessions are removed because tls 1.3 tickets should not be reused.
+		bool tryResume(const NodeEndpoint& endpoint, ssl_st& ssl);
+
+	private:
+		using SessionList = std::list<std::pair<std::string, ssl_session_st*>>;
+
+		size_t m_maxSize;
+		SessionList m_sessions;
+		std::unordered_map<std::string, SessionList::iterator> m_sessionsByEndpoint;
+		mutable std::mutex m_mutex;
+	};
+
+	/// Enables tls session resumption for \a sslContext and stores resumable client sessions in \a sessionCache.
+	/// \note Resumed handshakes skip certificate verification, so each session carries the verified peer public key.
+	void EnableSslSessionResumption(boost::asio::ssl::context& sslContext, SslSessionCache& sessionCache);
+
+	/// Prepares client \a ssl connecting to \a endpoint for session resumption.
+	/// \note This has no effect when session resumption is not enabled for the context of \a ssl.
+	void PrepareSslSessionResumption(ssl_st& ssl, const NodeEndpoint& endpoint);
+
+	/// Tries to extract the peer public key from the session of \a ssl into \a publicKey when the session was resumed.
+	bool TryGetResumedSessionPublicKey(ssl_st& ssl, Key& publicKey);
+}}
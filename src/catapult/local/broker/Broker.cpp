@@ -22,6 +22,7 @@
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/io/FileQueue.h"
+#include "catapult/io/FileQueueWatcher.h"
 #include "catapult/local/HostUtils.h"
 #include "catapult/subscribers/BlockChangeReader.h"
 #include "catapult/subscribers/BrokerMessageReaders.h"
@@ -29,12 +30,87 @@
 #include "catapult/subscribers/StateChangeReader.h"
 #include "catapult/subscribers/TransactionStatusReader.h"
 #include "catapult/subscribers/UtChangeReader.h"
-#include "catapult/thread/Scheduler.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/utils/LatencyHistogram.h"
 #include "catapult/utils/StackLogger.h"
+#include "catapult/utils/StackTimer.h"
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/filesystem.hpp>
 
 namespace catapult { namespace local {
 
 	namespace {
+		constexpr size_t Num_Queues = 5;
+		constexpr auto Polling_Interval = utils::TimeSpan::FromMilliseconds(500);
+		constexpr auto Latency_Logging_Interval = utils::TimeSpan::FromMinutes(1);
+
+		// subscribers are flushed (and messages are removed from spool queues) in batches so that writes of
+		// consecutive messages can overlap during catch-up
+		constexpr size_t Max_Messages_Per_Flush = 64;
+
+		// region IngestionService
+
+		// drains each spool queue on a dedicated thread as soon as it changes
+		class IngestionService {
+		public:
+			IngestionService()
+					: m_pPool(thread::CreateIoThreadPool(Num_Queues, "ingestion"))
+					, m_isShutdown(false) {
+				m_pPool->start();
+			}
+
+		public:
+			template<typename TSubscriber, typename TMessageReader>
+			void start(
+					const std::string& queueName,
+					const std::string& queuePath,
+					TSubscriber& subscriber,
+					TMessageReader readNextMessage) {
+				boost::asio::post(m_pPool->ioContext(), [this, queueName, queuePath, &subscriber, readNextMessage]() {
+					// create the queue directory before watching it so that no changes are missed
+					boost::filesystem::create_directories(queuePath);
+					io::FileQueueWatcher watcher(queuePath, "index.dat");
+					CATAPULT_LOG(info)
+							<< "starting " << (watcher.isEventDriven() ? "event driven" : "polling") << " ingestion of " << queueName;
+
+					// latencies are only recorded by this thread
+					utils::LatencyHistogram histogram(utils::LatencyHistogramPolicy::Unsynchronized);
+					utils::StackTimer histogramTimer;
+					auto recordLatency = [&histogram](const auto& latency) {
+						histogram.record(std::chrono::milliseconds(latency.millis()));
+					};
+					while (!m_isShutdown) {
+						subscribers::MessageQueueDescriptor descriptor{ queuePath, "index_broker_r.dat", "index.dat" };
+						subscribers::ReadAll(descriptor, subscriber, readNextMessage, Max_Messages_Per_Flush, recordLatency);
+
+						if (histogramTimer.millis() >= Latency_Logging_Interval.millis()) {
+							auto snapshot = histogram.snapshot();
+							if (0 != snapshot.count())
+								CATAPULT_LOG(info) << queueName << " ingestion latencies: " << snapshot;
+
+							histogram.reset();
+							histogramTimer = utils::StackTimer();
+						}
+
+						// fall back to polling when no change notification is received
+						watcher.wait(Polling_Interval);
+					}
+				});
+			}
+
+			void shutdown() {
+				m_isShutdown = true;
+				m_pPool->join();
+			}
+
+		private:
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			std::atomic<bool> m_isShutdown;
+		};
+
+		// endregion
+
 		class DefaultBroker final : public Broker {
 		public:
 			explicit DefaultBroker(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper)
@@ -76,33 +152,26 @@ namespace catapult { namespace local {
 			void startIngestion() {
 				using namespace catapult::subscribers;
 
-				auto pServiceGroup = m_pBootstrapper->pool().pushServiceGroup("scheduler");
-				auto pScheduler = pServiceGroup->pushService(thread::CreateScheduler);
-				pScheduler->addTask(createIngestionTask("block_change", *m_pBlockChangeSubscriber, ReadNextBlockChange));
-				pScheduler->addTask(createIngestionTask("unconfirmed_transactions_change", *m_pUtChangeSubscriber, ReadNextUtChange));
-				pScheduler->addTask(createIngestionTask("partial_transactions_change", *m_pPtChangeSubscriber, ReadNextPtChange));
-				pScheduler->addTask(createIngestionTask("transaction_status", *m_pTransactionStatusSubscriber, ReadNextTransactionStatus));
-				pScheduler->addTask(createIngestionTask("state_change", *m_pStateChangeSubscriber, [&catapultCache = m_catapultCache](
+				auto pServiceGroup = m_pBootstrapper->pool().pushServiceGroup("ingestion");
+				auto pIngestionService = pServiceGroup->registerService(std::make_shared<IngestionService>());
+				startIngestion(*pIngestionService, "block_change", *m_pBlockChangeSubscriber, ReadNextBlockChange);
+				startIngestion(*pIngestionService, "unconfirmed_transactions_change", *m_pUtChangeSubscriber, ReadNextUtChange);
+				startIngestion(*pIngestionService, "partial_transactions_change", *m_pPtChangeSubscriber, ReadNextPtChange);
+				startIngestion(*pIngestionService, "transaction_status", *m_pTransactionStatusSubscriber, ReadNextTransactionStatus);
+				startIngestion(*pIngestionService, "state_change", *m_pStateChangeSubscriber, [&catapultCache = m_catapultCache](
 						auto& inputStream,
 						auto& subscriber) {
 					return ReadNextStateChange(inputStream, catapultCache.changesStorages(), subscriber);
-				}));
+				});
 			}
 
 			template<typename TSubscriber, typename TMessageReader>
-			thread::Task createIngestionTask(const std::string& queueName, TSubscriber& subscriber, TMessageReader readNextMessage) {
-				thread::Task task;
-				task.StartDelay = utils::TimeSpan::FromMilliseconds(100);
-				task.NextDelay = thread::CreateUniformDelayGenerator(utils::TimeSpan::FromMilliseconds(500));
-				task.Name = queueName;
-
-				auto queuePath = m_dataDirectory.spoolDir(queueName).str();
-				task.Callback = [&subscriber, readNextMessage, queuePath]() {
-					subscribers::ReadAll({ queuePath, "index_broker_r.dat", "index.dat" }, subscriber, readNextMessage);
-					return thread::make_ready_future(thread::TaskResult::Continue);
-				};
-
-				return task;
+			void startIngestion(
+					IngestionService& ingestionService,
+					const std::string& queueName,
+					TSubscriber& subscriber,
+					TMessageReader readNextMessage) {
+				ingestionService.start(queueName, m_dataDirectory.spoolDir(queueName).str(), subscriber, readNextMessage);
 			}
 
 		private:
@@ -52,9 +52,11 @@ namespace catapult { namespace local {
 		std::unique_ptr<subscribers::StateChangeSubscriber> CreateStateChangeSubscriber(
 				subscribers::SubscriptionManager& subscriptionManager,
 				const cache::CatapultCache& catapultCache,
-				const config::CatapultDataDirectory& dataDirectory) {
+				const config::CatapultDataDirectory& dataDirectory,
+				utils::FileSize maxSpoolSegmentSize) {
+			auto stateChangeDirectory = dataDirectory.spoolDir("state_change").str();
 			subscriptionManager.addStateChangeSubscriber(CreateFileStateChangeStorage(
-					std::make_unique<io::FileQueueWriter>(dataDirectory.spoolDir("state_change").str(), "index_server.dat"),
+					std::make_unique<io::FileQueueWriter>(stateChangeDirectory, "index_server.dat", maxSpoolSegmentSize),
 					[&catapultCache]() { return catapultCache.changesStorages(); }));
 			return subscriptionManager.createStateChangeSubscriber();
 		}
@@ -102,7 +104,8 @@ namespace catapult { namespace local {
 					, m_pStateChangeSubscriber(CreateStateChangeSubscriber(
 							m_pBootstrapper->subscriptionManager(),
 							m_catapultCache,
-							m_dataDirectory))
+							m_dataDirectory,
+							m_config.Node.MaxSpoolSegmentSize))
 					, m_pNodeSubscriber(CreateNodeSubscriber(
 							m_pBootstrapper->subscriptionManager(),
 							m_nodes,
@@ -0,0 +1,57 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <stdint.h>
+
+namespace catapult { namespace model {
+
+#pragma pack(push, 1)
+
+	/// Diagnostic histogram value.
+	/// \note All latencies are in microseconds.
+	struct DiagnosticHistogramValue {
+		/// Histogram id.
+		uint64_t Id;
+
+		/// Histogram tag.
+		uint32_t Tag;
+
+		/// Number of recorded latencies.
+		uint64_t Count;
+
+		/// Upper bound of median latency.
+		uint64_t P50;
+
+		/// Upper bound of 90th percentile latency.
+		uint64_t P90;
+
+		/// Upper bound of 99th percentile latency.
+		uint64_t P99;
+
+		/// Upper bound of 99.9th percentile latency.
+		uint64_t P999;
+
+		/// Maximum latency.
+		uint64_t Max;
+	};
+
+#pragma pack(pop)
+}}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "AnnouncedTransaction.h"
 #include "Block.h"
 #include "EntityRange.h"
 #include "catapult/utils/ShortHash.h"
@@ -39,4 +40,7 @@ namespace catapult { namespace model {
 
 	/// Entity range composed of addresses.
 	using AddressRange = EntityRange<Address>;
+
+	/// Entity range composed of announced transactions.
+	using AnnouncedTransactionRange = EntityRange<AnnouncedTransaction>;
 }}
@@ -19,6 +19,7 @@
 **/
 
 #include "ChainedSocketReader.h"
+#include "FairShareReadScheduler.h"
 #include "catapult/ionet/BufferedPacketIo.h"
 #include "catapult/ionet/PacketSocket.h"
 #include "catapult/ionet/SocketReader.h"
@@ -31,6 +32,45 @@ namespace catapult { namespace net {
 			return ionet::SocketOperationCode::Closed == code ? utils::LogLevel::Debug : utils::LogLevel::Warning;
 		}
 
+		class ScheduledBatchPacketReader : public ionet::BatchPacketReader {
+		public:
+			ScheduledBatchPacketReader(
+					const std::shared_ptr<ionet::BatchPacketReader>& pReader,
+					const model::NodeIdentity& identity,
+					const std::shared_ptr<FairShareReadScheduler>& pReadScheduler)
+					: m_pReader(pReader)
+					, m_identity(identity)
+					, m_pReadScheduler(pReadScheduler)
+			{}
+
+		public:
+			void readMultiple(const ionet::PacketIo::ReadCallback& callback) override {
+				m_pReader->readMultiple([identity = m_identity, pReadScheduler = m_pReadScheduler, callback](
+						auto code,
+						const auto* pPacket) {
+					if (pPacket)
+						pReadScheduler->recordPacket(identity, *pPacket);
+
+					callback(code, pPacket);
+				});
+			}
+
+		private:
+			std::shared_ptr<ionet::BatchPacketReader> m_pReader;
+			model::NodeIdentity m_identity;
+			std::shared_ptr<FairShareReadScheduler> m_pReadScheduler;
+		};
+
+		std::shared_ptr<ionet::BatchPacketReader> CreateBatchPacketReader(
+				const std::shared_ptr<ionet::PacketSocket>& pPacketSocket,
+				const model::NodeIdentity& identity,
+				const std::shared_ptr<FairShareReadScheduler>& pReadScheduler) {
+			if (!pReadScheduler)
+				return pPacketSocket;
+
+			return std::make_shared<ScheduledBatchPacketReader>(pPacketSocket, identity, pReadScheduler);
+		}
+
 		class DefaultChainedSocketReader
 				: public ChainedSocketReader
 				, public std::enable_shared_from_this<DefaultChainedSocketReader> {
@@ -39,11 +79,17 @@ namespace catapult { namespace net {
 					const std::shared_ptr<ionet::PacketSocket>& pPacketSocket,
 					const ionet::ServerPacketHandlers& serverHandlers,
 					const model::NodeIdentity& identity,
-					const ChainedSocketReader::CompletionHandler& completionHandler)
+					const ChainedSocketReader::CompletionHandler& completionHandler,
+					const std::shared_ptr<FairShareReadScheduler>& pReadScheduler)
 					: m_pPacketSocket(pPacketSocket)
 					, m_identity(identity)
 					, m_completionHandler(completionHandler)
-					, m_pReader(CreateSocketReader(m_pPacketSocket, m_pPacketSocket->buffered(), serverHandlers, identity))
+					, m_pReadScheduler(pReadScheduler)
+					, m_pReader(CreateSocketReader(
+							CreateBatchPacketReader(m_pPacketSocket, identity, m_pReadScheduler),
+							m_pPacketSocket->buffered(),
+							serverHandlers,
+							identity))
 			{}
 
 		public:
@@ -64,7 +110,10 @@ namespace catapult { namespace net {
 				case ionet::SocketOperationCode::Insufficient_Data:
 					// Insufficient_Data signals the definitive end of a (successful) batch operation,
 					// whereas Success can be returned multiple times
-					return start();
+					if (!m_pReadScheduler)
+						return start();
+
+					return m_pReadScheduler->scheduleRead(m_identity, [pThis = shared_from_this()]() { pThis->start(); });
 
 				default:
 					CATAPULT_LOG_LEVEL(MapToLogLevel(code)) << m_identity << " read completed with error: " << code;
@@ -76,6 +125,7 @@ namespace catapult { namespace net {
 			std::shared_ptr<ionet::PacketSocket> m_pPacketSocket;
 			model::NodeIdentity m_identity;
 			ChainedSocketReader::CompletionHandler m_completionHandler;
+			std::shared_ptr<FairShareReadScheduler> m_pReadScheduler;
 			std::unique_ptr<ionet::SocketReader> m_pReader;
 		};
 	}
@@ -92,6 +142,15 @@ namespace catapult { namespace net {
 			const ionet::ServerPacketHandlers& serverHandlers,
 			const model::NodeIdentity& identity,
 			const ChainedSocketReader::CompletionHandler& completionHandler) {
-		return std::make_shared<DefaultChainedSocketReader>(pPacketSocket, serverHandlers, identity, completionHandler);
+		return CreateChainedSocketReader(pPacketSocket, serverHandlers, identity, completionHandler, nullptr);
+	}
+
+	std::shared_ptr<ChainedSocketReader> CreateChainedSocketReader(
+			const std::shared_ptr<ionet::PacketSocket>& pPacketSocket,
+			const ionet::ServerPacketHandlers& serverHandlers,
+			const model::NodeIdentity& identity,
+			const ChainedSocketReader::CompletionHandler& completionHandler,
+			const std::shared_ptr<FairShareReadScheduler>& pReadScheduler) {
+		return std::make_shared<DefaultChainedSocketReader>(pPacketSocket, serverHandlers, identity, completionHandler, pReadScheduler);
 	}
 }}
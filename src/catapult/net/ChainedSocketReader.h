@@ -27,6 +27,7 @@
 namespace catapult {
 	namespace ionet { class PacketSocket; }
 	namespace model { struct NodeIdentity; }
+	namespace net { class FairShareReadScheduler; }
 }
 
 namespace catapult { namespace net {
@@ -63,4 +64,14 @@ namespace catapult { namespace net {
 			const ionet::ServerPacketHandlers& serverHandlers,
 			const model::NodeIdentity& identity,
 			const ChainedSocketReader::CompletionHandler& completionHandler);
+
+	/// Creates a chained socket reader around \a pPacketSocket and \a serverHandlers with a custom completion
+	/// handler (\a completionHandler) given reader \a identity.
+	/// All read packets are recorded by \a pReadScheduler, which schedules the next read of every chain (optional).
+	std::shared_ptr<ChainedSocketReader> CreateChainedSocketReader(
+			const std::shared_ptr<ionet::PacketSocket>& pPacketSocket,
+			const ionet::ServerPacketHandlers& serverHandlers,
+			const model::NodeIdentity& identity,
+			const ChainedSocketReader::CompletionHandler& completionHandler,
+			const std::shared_ptr<FairShareReadScheduler>& pReadScheduler);
 }}
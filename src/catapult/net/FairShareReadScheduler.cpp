@@ -0,0 +1,228 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "FairShareReadScheduler.h"
+#include "catapult/ionet/PacketHeader.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/utils/SpinLock.h"
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <vector>
+
+namespace catapult { namespace net {
+
+	bool IsPrioritizedReadPacketType(ionet::PacketType type) {
+		switch (type) {
+		case ionet::PacketType::Push_Block:
+		case ionet::PacketType::Compact_Block:
+		case ionet::PacketType::Pull_Block:
+		case ionet::PacketType::Chain_Info:
+		case ionet::PacketType::Block_Hashes:
+		case ionet::PacketType::Pull_Blocks:
+		case ionet::PacketType::Sub_Cache_Merkle_Roots:
+			return true;
+
+		default:
+			return false;
+		}
+	}
+
+	namespace {
+		struct PeerState {
+		public:
+			PeerState()
+					: WeightedSize(0)
+					, NumPendingBytes(0)
+					, NumPendingPackets(0)
+			{}
+
+		public:
+			// weighted size read in the current accounting interval
+			uint64_t WeightedSize;
+
+			// traffic read in the current read batch
+			uint64_t NumPendingBytes;
+			uint64_t NumPendingPackets;
+		};
+
+		class DefaultFairShareReadScheduler
+				: public FairShareReadScheduler
+				, public std::enable_shared_from_this<DefaultFairShareReadScheduler> {
+		public:
+			DefaultFairShareReadScheduler(
+					const std::shared_ptr<thread::IoThreadPool>& pPool,
+					const FairShareReadSchedulerSettings& settings,
+					model::NodeIdentityEqualityStrategy equalityStrategy)
+					: m_pPool(pPool)
+					, m_settings(settings)
+					, m_peerStates(model::CreateNodeIdentityMap<PeerState>(equalityStrategy))
+					, m_totalWeightedSize(0)
+					, m_numActivePeers(0)
+					, m_timer(pPool->ioContext())
+					, m_isTimerArmed(false)
+					, m_isShutdown(false)
+			{}
+
+		public:
+			size_t numDeferredReads() const override {
+				utils::SpinLockGuard guard(m_lock);
+				return m_deferredReads.size();
+			}
+
+		public:
+			void recordPacket(const model::NodeIdentity& identity, const ionet::PacketHeader& header) override {
+				auto weightedSize = static_cast<uint64_t>(header.Size);
+				if (IsPrioritizedReadPacketType(header.Type))
+					weightedSize = std::max<uint64_t>(1, weightedSize / std::max<uint32_t>(1, m_settings.PriorityWeight));
+
+				utils::SpinLockGuard guard(m_lock);
+				auto& peerState = m_peerStates[identity];
+				peerState.NumPendingBytes += header.Size;
+				++peerState.NumPendingPackets;
+
+				// without fair share, traffic is only accounted and never weighted
+				if (!m_settings.EnableFairShare)
+					return;
+
+				if (0 == peerState.WeightedSize)
+					++m_numActivePeers;
+
+				peerState.WeightedSize += weightedSize;
+				m_totalWeightedSize += weightedSize;
+				armTimer();
+			}
+
+			void scheduleRead(const model::NodeIdentity& identity, const action& read) override {
+				uint64_t numBytes = 0;
+				uint64_t numPackets = 0;
+				auto shouldDefer = false;
+				{
+					utils::SpinLockGuard guard(m_lock);
+					if (m_isShutdown)
+						return;
+
+					auto iter = m_peerStates.find(identity);
+					if (m_peerStates.end() != iter) {
+						auto& peerState = iter->second;
+						numBytes = peerState.NumPendingBytes;
+						numPackets = peerState.NumPendingPackets;
+						peerState.NumPendingBytes = 0;
+						peerState.NumPendingPackets = 0;
+
+						if (m_settings.EnableFairShare)
+							shouldDefer = peerState.WeightedSize > fairShareSize();
+						else
+							m_peerStates.erase(iter);
+					}
+
+					if (shouldDefer)
+						m_deferredReads.push_back(read);
+				}
+
+				if (0 != numPackets && m_settings.TrafficConsumer)
+					m_settings.TrafficConsumer(identity, numBytes, numPackets);
+
+				if (shouldDefer) {
+					CATAPULT_LOG(trace) << "deferring read from " << identity << " because it exceeded its fair share";
+					return;
+				}
+
+				read();
+			}
+
+			void shutdown() override {
+				utils::SpinLockGuard guard(m_lock);
+				m_isShutdown = true;
+				m_deferredReads.clear();
+				m_timer.cancel();
+			}
+
+		private:
+			uint64_t fairShareSize() const {
+				auto fairShareSize = 0 == m_numActivePeers ? 0 : m_totalWeightedSize / m_numActivePeers;
+				return std::max<uint64_t>(m_settings.MinShareSize.bytes(), fairShareSize);
+			}
+
+			void armTimer() {
+				if (m_isTimerArmed || m_isShutdown)
+					return;
+
+				m_isTimerArmed = true;
+				m_timer.expires_from_now(std::chrono::milliseconds(m_settings.Interval.millis()));
+				m_timer.async_wait([pThisWeak = weak_from_this()](const auto& ec) {
+					auto pThis = pThisWeak.lock();
+					if (!pThis || ec)
+						return;
+
+					pThis->startNextInterval();
+				});
+			}
+
+			void startNextInterval() {
+				std::vector<action> deferredReads;
+				{
+					utils::SpinLockGuard guard(m_lock);
+					m_isTimerArmed = false;
+					if (m_isShutdown)
+						return;
+
+					// prune peers that were idle for a full interval (peers with a read batch spanning intervals are kept)
+					for (auto iter = m_peerStates.begin(); m_peerStates.end() != iter;) {
+						if (0 == iter->second.WeightedSize) {
+							iter = m_peerStates.erase(iter);
+						} else {
+							iter->second.WeightedSize = 0;
+							++iter;
+						}
+					}
+
+					m_totalWeightedSize = 0;
+					m_numActivePeers = 0;
+					deferredReads.swap(m_deferredReads);
+				}
+
+				for (const auto& read : deferredReads)
+					boost::asio::post(m_pPool->ioContext(), read);
+			}
+
+		private:
+			std::shared_ptr<thread::IoThreadPool> m_pPool;
+			FairShareReadSchedulerSettings m_settings;
+
+			model::NodeIdentityMap<PeerState> m_peerStates;
+			uint64_t m_totalWeightedSize;
+			size_t m_numActivePeers;
+			std::vector<action> m_deferredReads;
+
+			boost::asio::steady_timer m_timer;
+			bool m_isTimerArmed;
+			bool m_isShutdown;
+			mutable utils::SpinLock m_lock;
+		};
+	}
+
+	std::shared_ptr<FairShareReadScheduler> CreateFairShareReadScheduler(
+			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const FairShareReadSchedulerSettings& settings,
+			model::NodeIdentityEqualityStrategy equalityStrategy) {
+		return std::make_shared<DefaultFairShareReadScheduler>(pPool, settings, equalityStrategy);
+	}
+}}
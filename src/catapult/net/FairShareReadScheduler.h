@@ -0,0 +1,100 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/ionet/PacketType.h"
+#include "catapult/model/NodeIdentity.h"
+#include "catapult/utils/FileSize.h"
+#include "catapult/utils/TimeSpan.h"
+#include "catapult/functions.h"
+#include <memory>
+
+namespace catapult {
+	namespace ionet { struct PacketHeader; }
+	namespace thread { class IoThreadPool; }
+}
+
+namespace catapult { namespace net {
+
+	/// Consumer of the number of bytes and packets read from a peer.
+	using ReadTrafficConsumer = consumer<const model::NodeIdentity&, uint64_t, uint64_t>;
+
+	/// Settings used to configure a fair share read scheduler.
+	struct FairShareReadSchedulerSettings {
+	public:
+		/// Creates default settings.
+		FairShareReadSchedulerSettings()
+				: EnableFairShare(false)
+				, Interval(utils::TimeSpan::FromSeconds(1))
+				, MinShareSize(utils::FileSize::FromMegabytes(1))
+				, PriorityWeight(8)
+		{}
+
+	public:
+		/// \c true if reads from peers that exceed their fair share should be deferred.
+		bool EnableFairShare;
+
+		/// Duration of an accounting interval.
+		utils::TimeSpan Interval;
+
+		/// Weighted size that every peer can read within an accounting interval without being deferred.
+		utils::FileSize MinShareSize;
+
+		/// Factor by which the cost of prioritized (block and sync) packets is reduced.
+		uint32_t PriorityWeight;
+
+		/// Consumer of the traffic read from peers, which is called once per read batch (optional).
+		/// \note Traffic is accounted even when fair share is disabled.
+		ReadTrafficConsumer TrafficConsumer;
+	};
+
+	/// Returns \c true if packets of \a type are prioritized by fair share read scheduling.
+	bool IsPrioritizedReadPacketType(ionet::PacketType type);
+
+	/// Schedules reads of packet readers so that peers fairly share the read capacity of a node.
+	/// \note Packet costs are weighted, so peers sending blocks or sync requests are
+	///       favored over peers pushing transactions.
+	class FairShareReadScheduler {
+	public:
+		virtual ~FairShareReadScheduler() = default;
+
+	public:
+		/// Gets the number of deferred reads.
+		virtual size_t numDeferredReads() const = 0;
+
+	public:
+		/// Records a packet with \a header read from the peer identified by \a identity.
+		virtual void recordPacket(const model::NodeIdentity& identity, const ionet::PacketHeader& header) = 0;
+
+		/// Schedules the next \a read from the peer identified by \a identity.
+		/// \note The read is deferred until the next accounting interval if the peer exceeded its fair share.
+		virtual void scheduleRead(const model::NodeIdentity& identity, const action& read) = 0;
+
+		/// Shuts down the scheduler and drops all deferred reads.
+		virtual void shutdown() = 0;
+	};
+
+	/// Creates a fair share read scheduler using \a pPool configured with \a settings and
+	/// comparing peers using \a equalityStrategy.
+	std::shared_ptr<FairShareReadScheduler> CreateFairShareReadScheduler(
+			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const FairShareReadSchedulerSettings& settings,
+			model::NodeIdentityEqualityStrategy equalityStrategy);
+}}
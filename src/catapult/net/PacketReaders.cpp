@@ -183,6 +183,17 @@ namespace catapult { namespace net {
 			mutable utils::SpinLock m_lock;
 		};
 
+		std::shared_ptr<FairShareReadScheduler> CreateReadSchedulerIfRequired(
+				const std::shared_ptr<thread::IoThreadPool>& pPool,
+				const FairShareReadSchedulerSettings& readSchedulerSettings,
+				model::NodeIdentityEqualityStrategy equalityStrategy) {
+			// a scheduler is required to defer reads or to account traffic
+			if (!readSchedulerSettings.EnableFairShare && !readSchedulerSettings.TrafficConsumer)
+				return nullptr;
+
+			return CreateFairShareReadScheduler(pPool, readSchedulerSettings, equalityStrategy);
+		}
+
 		class DefaultPacketReaders : public PacketReaders, public std::enable_shared_from_this<DefaultPacketReaders> {
 		public:
 			DefaultPacketReaders(
@@ -190,9 +201,11 @@ namespace catapult { namespace net {
 					const ionet::ServerPacketHandlers& handlers,
 					const Key& serverPublicKey,
 					const ConnectionSettings& settings,
-					uint32_t maxConnectionsPerIdentity)
+					uint32_t maxConnectionsPerIdentity,
+					const FairShareReadSchedulerSettings& readSchedulerSettings)
 					: m_handlers(handlers)
 					, m_pClientConnector(CreateClientConnector(pPool, serverPublicKey, settings, "readers"))
+					, m_pReadScheduler(CreateReadSchedulerIfRequired(pPool, readSchedulerSettings, settings.NodeIdentityEqualityStrategy))
 					, m_readers(maxConnectionsPerIdentity, settings.NodeIdentityEqualityStrategy)
 			{}
 
@@ -235,6 +248,9 @@ namespace catapult { namespace net {
 			void shutdown() override {
 				CATAPULT_LOG(info) << "closing all connections in PacketReaders";
 				m_pClientConnector->shutdown();
+				if (m_pReadScheduler)
+					m_pReadScheduler->shutdown();
+
 				m_readers.clear();
 			}
 
@@ -250,19 +266,21 @@ namespace catapult { namespace net {
 					const PacketSocketPointer& pSocket,
 					const model::NodeIdentity& identity,
 					uint32_t id) {
-				return CreateChainedSocketReader(pSocket, m_handlers, identity, [pThis = shared_from_this(), identity, id](auto code) {
+				auto completionHandler = [pThis = shared_from_this(), identity, id](auto code) {
 					// if the socket is closed cleanly, just remove the closed socket
 					// if the socket errored, remove all sockets with the same identity
 					if (ionet::SocketOperationCode::Closed == code)
 						pThis->m_readers.close(identity, id);
 					else
 						pThis->m_readers.close(identity);
-				});
+				};
+				return CreateChainedSocketReader(pSocket, m_handlers, identity, completionHandler, m_pReadScheduler);
 			}
 
 		private:
 			ionet::ServerPacketHandlers m_handlers;
 			std::shared_ptr<ClientConnector> m_pClientConnector;
+			std::shared_ptr<FairShareReadScheduler> m_pReadScheduler;
 			ReaderContainer m_readers;
 		};
 	}
@@ -273,6 +291,22 @@ namespace catapult { namespace net {
 			const Key& serverPublicKey,
 			const ConnectionSettings& settings,
 			uint32_t maxConnectionsPerIdentity) {
-		return std::make_shared<DefaultPacketReaders>(pPool, handlers, serverPublicKey, settings, maxConnectionsPerIdentity);
+		return CreatePacketReaders(pPool, handlers, serverPublicKey, settings, maxConnectionsPerIdentity, FairShareReadSchedulerSettings());
+	}
+
+	std::shared_ptr<PacketReaders> CreatePacketReaders(
+			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const ionet::ServerPacketHandlers& handlers,
+			const Key& serverPublicKey,
+			const ConnectionSettings& settings,
+			uint32_t maxConnectionsPerIdentity,
+			const FairShareReadSchedulerSettings& readSchedulerSettings) {
+		return std::make_shared<DefaultPacketReaders>(
+				pPool,
+				handlers,
+				serverPublicKey,
+				settings,
+				maxConnectionsPerIdentity,
+				readSchedulerSettings);
 	}
 }}
@@ -21,6 +21,7 @@
 #pragma once
 #include "ConnectionContainer.h"
 #include "ConnectionSettings.h"
+#include "FairShareReadScheduler.h"
 #include "PeerConnectResult.h"
 #include "catapult/ionet/PacketHandlers.h"
 #include <functional>
@@ -56,4 +57,16 @@ namespace catapult { namespace net {
 			const Key& serverPublicKey,
 			const ConnectionSettings& settings,
 			uint32_t maxConnectionsPerIdentity);
+
+	/// Creates a packet readers container for a server with specified \a serverPublicKey using \a pPool and \a handlers,
+	/// configured with \a settings and allowing \a maxConnectionsPerIdentity.
+	/// Reads are scheduled and accounted according to \a readSchedulerSettings.
+	/// \note Reads are only deferred when fair share reads are enabled, but traffic is always accounted when a consumer is set.
+	std::shared_ptr<PacketReaders> CreatePacketReaders(
+			const std::shared_ptr<thread::IoThreadPool>& pPool,
+			const ionet::ServerPacketHandlers& handlers,
+			const Key& serverPublicKey,
+			const ConnectionSettings& settings,
+			uint32_t maxConnectionsPerIdentity,
+			const FairShareReadSchedulerSettings& readSchedulerSettings);
 }}
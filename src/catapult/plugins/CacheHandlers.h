@@ -37,9 +37,13 @@ namespace catapult { namespace plugins {
 			using CacheType = typename TCacheDescriptor::CacheType;
 			using CachePacketTypes = CachePacketTypesT<FacilityCode>;
 
-			pluginManager.addHandlerHook([](auto& handlers, const cache::CatapultCache& cache) {
+			auto maxStatePathsKeys = pluginManager.storageConfig().MaxStatePathsKeys;
+			pluginManager.addHandlerHook([maxStatePathsKeys](auto& handlers, const cache::CatapultCache& cache) {
 				using PacketType = StatePathRequestPacket<CachePacketTypes::State_Path, KeyType>;
 				handlers::RegisterStatePathHandler<PacketType>(handlers, cache.sub<CacheType>());
+
+				using RequestTraits = BatchHandlerFactoryTraits<CachePacketTypes::State_Paths, KeyType>;
+				handlers::RegisterStatePathsHandler<RequestTraits>(handlers, cache.sub<CacheType>(), maxStatePathsKeys);
 			});
 
 			pluginManager.addDiagnosticHandlerHook([](auto& handlers, const cache::CatapultCache& cache) {
@@ -54,6 +58,7 @@ namespace catapult { namespace plugins {
 		template<model::FacilityCode FacilityCode>
 		struct CachePacketTypesT {
 			static constexpr auto State_Path = static_cast<ionet::PacketType>(800 + static_cast<uint8_t>(FacilityCode));
+			static constexpr auto State_Paths = static_cast<ionet::PacketType>(900 + static_cast<uint8_t>(FacilityCode));
 			static constexpr auto Diagnostic_Infos = static_cast<ionet::PacketType>(1200 + static_cast<uint8_t>(FacilityCode));
 		};
 
@@ -19,6 +19,7 @@
 **/
 
 #include "PluginManager.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
 #include <boost/filesystem/path.hpp>
 
 namespace catapult { namespace plugins {
@@ -31,8 +32,18 @@ namespace catapult { namespace plugins {
 			: m_config(config)
 			, m_storageConfig(storageConfig)
 			, m_userConfig(userConfig)
-			, m_inflationConfig(inflationConfig)
-	{}
+			, m_inflationConfig(inflationConfig) {
+		if (m_storageConfig.PreferCacheDatabase && 0 != m_storageConfig.MaxCacheDatabaseDecodedValuesSize.bytes())
+			m_pDecodedValueCacheStatistics = std::make_shared<cache::DecodedValueCacheStatistics>();
+
+		if (m_storageConfig.PreferCacheDatabase && m_config.EnableVerifiableState
+				&& 0 != m_storageConfig.MaxCacheDatabasePatriciaTreeNodesSize.bytes()) {
+			m_pPatriciaTreeNodeCacheStatistics = std::make_shared<cache::DecodedValueCacheStatistics>();
+			m_pPatriciaTreeNodeCache = std::make_shared<cache::PatriciaTreeNodeCache>(
+					m_storageConfig.MaxCacheDatabasePatriciaTreeNodesSize,
+					m_pPatriciaTreeNodeCacheStatistics);
+		}
+	}
 
 	// region config
 
@@ -56,10 +67,14 @@ namespace catapult { namespace plugins {
 		if (!m_storageConfig.PreferCacheDatabase)
 			return cache::CacheConfiguration();
 
-		return cache::CacheConfiguration(
+		auto cacheConfig = cache::CacheConfiguration(
 				(boost::filesystem::path(m_storageConfig.CacheDatabaseDirectory) / name).generic_string(),
 				m_storageConfig.MaxCacheDatabaseWriteBatchSize,
 				m_config.EnableVerifiableState ? cache::PatriciaTreeStorageMode::Enabled : cache::PatriciaTreeStorageMode::Disabled);
+		cacheConfig.DecodedValueCache.MaxSize = m_storageConfig.MaxCacheDatabaseDecodedValuesSize;
+		cacheConfig.DecodedValueCache.pStatistics = m_pDecodedValueCacheStatistics;
+		cacheConfig.DecodedValueCache.pPatriciaTreeNodeCache = m_pPatriciaTreeNodeCache;
+		return cacheConfig;
 	}
 
 	// endregion
@@ -83,7 +98,7 @@ namespace catapult { namespace plugins {
 	}
 
 	cache::CatapultCache PluginManager::createCache() {
-		return m_cacheBuilder.build();
+		return m_cacheBuilder.build(m_storageConfig.MaxCacheCommitThreads);
 	}
 
 	// endregion
@@ -129,8 +144,25 @@ namespace catapult { namespace plugins {
 		ApplyAll(handlers, m_diagnosticHandlerHooks, cache);
 	}
 
+	namespace {
+		void AddCacheStatisticsCounters(
+				std::vector<utils::DiagnosticCounter>& counters,
+				const std::string& prefix,
+				const std::shared_ptr<cache::DecodedValueCacheStatistics>& pStatistics) {
+			if (!pStatistics)
+				return;
+
+			const auto& statistics = *pStatistics;
+			counters.emplace_back(utils::DiagnosticCounterId(prefix + " HIT"), [&statistics]() { return statistics.NumHits.load(); });
+			counters.emplace_back(utils::DiagnosticCounterId(prefix + " MISS"), [&statistics]() { return statistics.NumMisses.load(); });
+		}
+	}
+
 	void PluginManager::addDiagnosticCounters(std::vector<utils::DiagnosticCounter>& counters, const cache::CatapultCache& cache) const {
 		ApplyAll(counters, m_diagnosticCounterHooks, cache);
+
+		AddCacheStatisticsCounters(counters, "DECODED", m_pDecodedValueCacheStatistics);
+		AddCacheStatisticsCounters(counters, "PT NODE", m_pPatriciaTreeNodeCacheStatistics);
 	}
 
 	// endregion
@@ -46,6 +46,18 @@ namespace catapult { namespace plugins {
 
 		/// Maximum cache database write batch size.
 		utils::FileSize MaxCacheDatabaseWriteBatchSize;
+
+		/// Maximum size of decoded values cached per sub-cache database (shared by all of its columns).
+		utils::FileSize MaxCacheDatabaseDecodedValuesSize;
+
+		/// Maximum size of decoded patricia tree nodes cached across all cache databases.
+		utils::FileSize MaxCacheDatabasePatriciaTreeNodesSize;
+
+		/// Maximum number of threads used to commit sub caches concurrently.
+		uint32_t MaxCacheCommitThreads = 0;
+
+		/// Maximum number of keys in a single state paths request.
+		uint32_t MaxStatePathsKeys = std::numeric_limits<uint32_t>::max();
 	};
 
 	/// Manager for registering plugins.
@@ -218,6 +230,9 @@ namespace catapult { namespace plugins {
 		config::InflationConfiguration m_inflationConfig;
 		model::TransactionRegistry m_transactionRegistry;
 		cache::CatapultCacheBuilder m_cacheBuilder;
+		std::shared_ptr<cache::DecodedValueCacheStatistics> m_pDecodedValueCacheStatistics;
+		std::shared_ptr<cache::DecodedValueCacheStatistics> m_pPatriciaTreeNodeCacheStatistics;
+		std::shared_ptr<cache::PatriciaTreeNodeCache> m_pPatriciaTreeNodeCache;
 
 		std::vector<HandlerHook> m_nonDiagnosticHandlerHooks;
 		std::vector<HandlerHook> m_diagnosticHandlerHooks;
@@ -30,20 +30,11 @@ namespace catapult { namespace state {
 
 	AccountBalances::AccountBalances() = default;
 
-	AccountBalances::AccountBalances(const AccountBalances& accountBalances) {
-		*this = accountBalances;
-	}
+	AccountBalances::AccountBalances(const AccountBalances& accountBalances) = default;
 
 	AccountBalances::AccountBalances(AccountBalances&& accountBalances) = default;
 
-	AccountBalances& AccountBalances::operator=(const AccountBalances& accountBalances) {
-		m_optimizedMosaicId = accountBalances.optimizedMosaicId();
-		m_balances.optimize(m_optimizedMosaicId);
-		for (const auto& pair : accountBalances)
-			m_balances.insert(pair);
-
-		return *this;
-	}
+	AccountBalances& AccountBalances::operator=(const AccountBalances& accountBalances) = default;
 
 	AccountBalances& AccountBalances::operator=(AccountBalances&& accountBalances) = default;
 
@@ -33,14 +33,16 @@ namespace catapult { namespace state {
 		/// Creates an empty account balances.
 		AccountBalances();
 
-		/// Copy constructor that makes a deep copy of \a accountBalances.
+		/// Copy constructor that makes a copy of \a accountBalances.
+		/// \note Balances are shared with \a accountBalances until either is modified.
 		AccountBalances(const AccountBalances& accountBalances);
 
 		/// Move constructor that move constructs an account balances from \a accountBalances.
 		AccountBalances(AccountBalances&& accountBalances);
 
 	public:
-		/// Assignment operator that makes a deep copy of \a accountBalances.
+		/// Assignment operator that makes a copy of \a accountBalances.
+		/// \note Balances are shared with \a accountBalances until either is modified.
 		AccountBalances& operator=(const AccountBalances& accountBalances);
 
 		/// Move assignment operator that assigns \a accountBalances.
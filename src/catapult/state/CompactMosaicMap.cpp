@@ -23,6 +23,78 @@
 
 namespace catapult { namespace state {
 
+	// region SecondLevelStoragePointer
+
+	CompactMosaicMap::SecondLevelStoragePointer::SecondLevelStoragePointer() : SecondLevelStoragePointer(nullptr)
+	{}
+
+	CompactMosaicMap::SecondLevelStoragePointer::SecondLevelStoragePointer(const SecondLevelStoragePointer& pointer)
+			: SecondLevelStoragePointer(pointer.m_pStorage) {
+		if (m_pStorage)
+			m_pStorage->ReferenceCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	CompactMosaicMap::SecondLevelStoragePointer::SecondLevelStoragePointer(SecondLevelStoragePointer&& pointer)
+			: SecondLevelStoragePointer(pointer.m_pStorage) {
+		pointer.m_pStorage = nullptr;
+	}
+
+	CompactMosaicMap::SecondLevelStoragePointer::SecondLevelStoragePointer(SecondLevelStorage* pStorage) : m_pStorage(pStorage)
+	{}
+
+	CompactMosaicMap::SecondLevelStoragePointer::~SecondLevelStoragePointer() {
+		reset();
+	}
+
+	CompactMosaicMap::SecondLevelStoragePointer& CompactMosaicMap::SecondLevelStoragePointer::operator=(
+			const SecondLevelStoragePointer& pointer) {
+		SecondLevelStoragePointer copy(pointer);
+		std::swap(m_pStorage, copy.m_pStorage);
+		return *this;
+	}
+
+	CompactMosaicMap::SecondLevelStoragePointer& CompactMosaicMap::SecondLevelStoragePointer::operator=(
+			SecondLevelStoragePointer&& pointer) {
+		if (this == &pointer)
+			return *this;
+
+		std::swap(m_pStorage, pointer.m_pStorage);
+		pointer.reset();
+		return *this;
+	}
+
+	CompactMosaicMap::SecondLevelStoragePointer CompactMosaicMap::SecondLevelStoragePointer::Create() {
+		auto pStorage = std::make_unique<SecondLevelStorage>();
+		pStorage->ReferenceCount = 1;
+		return SecondLevelStoragePointer(pStorage.release());
+	}
+
+	CompactMosaicMap::SecondLevelStoragePointer::operator bool() const {
+		return !!m_pStorage;
+	}
+
+	CompactMosaicMap::SecondLevelStorage* CompactMosaicMap::SecondLevelStoragePointer::operator->() const {
+		return m_pStorage;
+	}
+
+	bool CompactMosaicMap::SecondLevelStoragePointer::operator==(const SecondLevelStoragePointer& rhs) const {
+		return m_pStorage == rhs.m_pStorage;
+	}
+
+	bool CompactMosaicMap::SecondLevelStoragePointer::isUnique() const {
+		// acquire pairs with the release of other owners so that all of their accesses happen before any modification
+		return 1 == m_pStorage->ReferenceCount.load(std::memory_order_acquire);
+	}
+
+	void CompactMosaicMap::SecondLevelStoragePointer::reset() {
+		if (m_pStorage && 1 == m_pStorage->ReferenceCount.fetch_sub(1, std::memory_order_acq_rel))
+			delete m_pStorage;
+
+		m_pStorage = nullptr;
+	}
+
+	// endregion
+
 	// region FirstLevelStorage
 
 	bool CompactMosaicMap::FirstLevelStorage::hasValue() const {
@@ -162,6 +234,28 @@ namespace catapult { namespace state {
 
 	// endregion
 
+	// region constructors
+
+	CompactMosaicMap::CompactMosaicMap() = default;
+
+	CompactMosaicMap::CompactMosaicMap(const CompactMosaicMap& map) {
+		*this = map;
+	}
+
+	CompactMosaicMap::CompactMosaicMap(CompactMosaicMap&& map) = default;
+
+	CompactMosaicMap& CompactMosaicMap::operator=(const CompactMosaicMap& map) {
+		// only share second level storage, which is detached before it is modified
+		m_storage.Value.Mosaic = map.m_storage.Value.ConstMosaic;
+		m_storage.pNextStorage = map.m_storage.pNextStorage;
+		m_optimizedMosaicId = map.m_optimizedMosaicId;
+		return *this;
+	}
+
+	CompactMosaicMap& CompactMosaicMap::operator=(CompactMosaicMap&& map) = default;
+
+	// endregion
+
 	CompactMosaicMap::const_iterator CompactMosaicMap::begin() const {
 		return const_iterator(const_cast<FirstLevelStorage&>(m_storage), const_iterator::Stage::Start);
 	}
@@ -171,6 +265,7 @@ namespace catapult { namespace state {
 	}
 
 	CompactMosaicMap::iterator CompactMosaicMap::begin() {
+		detach();
 		return iterator(m_storage, const_iterator::Stage::Start);
 	}
 
@@ -202,6 +297,8 @@ namespace catapult { namespace state {
 	}
 
 	CompactMosaicMap::iterator CompactMosaicMap::find(MosaicId id) {
+		detach();
+
 		MosaicLocation location;
 		return find(id, location) ? iterator(m_storage, location) : end();
 	}
@@ -232,8 +329,9 @@ namespace catapult { namespace state {
 		}
 
 		// use insertion sort to insert into array
+		detach();
 		if (!m_storage.hasArray())
-			m_storage.pNextStorage = std::make_unique<SecondLevelStorage>();
+			m_storage.pNextStorage = SecondLevelStoragePointer::Create();
 
 		if (IsLessThan(m_optimizedMosaicId, pair.first, m_storage.Value.ConstMosaic.first)) {
 			insertIntoArray(0, m_storage.Value.ConstMosaic);
@@ -257,6 +355,8 @@ namespace catapult { namespace state {
 	}
 
 	void CompactMosaicMap::erase(MosaicId id) {
+		detach();
+
 		MosaicLocation location;
 		if (!find(id, location))
 			return;
@@ -301,6 +401,10 @@ namespace catapult { namespace state {
 		insert(mosaicCopy);
 	}
 
+	bool CompactMosaicMap::sharesStorageWith(const CompactMosaicMap& map) const {
+		return m_storage.hasArray() && m_storage.pNextStorage == map.m_storage.pNextStorage;
+	}
+
 	bool CompactMosaicMap::find(MosaicId id, MosaicLocation& location) const {
 		if (empty())
 			return false;
@@ -332,6 +436,22 @@ namespace catapult { namespace state {
 		return false;
 	}
 
+	void CompactMosaicMap::detach() {
+		// storage is only modified in place when no other map is sharing it
+		if (!m_storage.hasArray() || m_storage.pNextStorage.isUnique())
+			return;
+
+		auto pStorage = SecondLevelStoragePointer::Create();
+		for (auto i = 0u; i < m_storage.arraySize(); ++i)
+			pStorage->ArrayStorage[i].Mosaic = m_storage.array()[i].ConstMosaic;
+
+		pStorage->ArraySize = m_storage.arraySize();
+		if (m_storage.hasMap())
+			pStorage->pMapStorage = std::make_unique<MosaicMap>(m_storage.map());
+
+		m_storage.pNextStorage = std::move(pStorage);
+	}
+
 	void CompactMosaicMap::insertIntoArray(size_t index, const Mosaic& pair) {
 		// move the last array value into the map
 		if (Array_Size == m_storage.arraySize())
@@ -20,9 +20,9 @@
 
 #pragma once
 #include "catapult/utils/Hashers.h"
-#include "catapult/utils/NonCopyable.h"
 #include "catapult/exceptions.h"
 #include "catapult/types.h"
+#include <atomic>
 #include <map>
 
 namespace catapult { namespace state {
@@ -30,7 +30,8 @@ namespace catapult { namespace state {
 	/// Mosaic (ordered) map that is optimized for storage of a small number of elements.
 	/// \note This map assumes that MosaicId(0) is not a valid mosaic.
 	///       This is acceptable for mosaics stored in AccountBalances but not for a general purpose map.
-	class CompactMosaicMap : utils::MoveOnly {
+	/// \note Copies share all mosaics not stored in the first level until either the original or the copy is modified.
+	class CompactMosaicMap {
 	private:
 		static constexpr auto Array_Size = 5;
 
@@ -68,12 +69,51 @@ namespace catapult { namespace state {
 			MosaicArray ArrayStorage;
 			uint8_t ArraySize;
 			std::unique_ptr<MosaicMap> pMapStorage;
+			std::atomic<uint32_t> ReferenceCount;
+		};
+
+		// intrusively reference counted pointer to second level storage
+		class SecondLevelStoragePointer {
+		public:
+			SecondLevelStoragePointer();
+
+			SecondLevelStoragePointer(const SecondLevelStoragePointer& pointer);
+
+			SecondLevelStoragePointer(SecondLevelStoragePointer&& pointer);
+
+			~SecondLevelStoragePointer();
+
+		private:
+			explicit SecondLevelStoragePointer(SecondLevelStorage* pStorage);
+
+		public:
+			SecondLevelStoragePointer& operator=(const SecondLevelStoragePointer& pointer);
+
+			SecondLevelStoragePointer& operator=(SecondLevelStoragePointer&& pointer);
+
+		public:
+			static SecondLevelStoragePointer Create();
+
+		public:
+			explicit operator bool() const;
+
+			SecondLevelStorage* operator->() const;
+
+			bool operator==(const SecondLevelStoragePointer& rhs) const;
+
+		public:
+			bool isUnique() const;
+
+			void reset();
+
+		private:
+			SecondLevelStorage* m_pStorage;
 		};
 
 		struct FirstLevelStorage {
 		public:
 			MosaicUnion Value;
-			std::unique_ptr<SecondLevelStorage> pNextStorage;
+			SecondLevelStoragePointer pNextStorage;
 
 		public:
 			bool hasValue() const;
@@ -196,6 +236,23 @@ namespace catapult { namespace state {
 		/// Mosaic non-const iterator.
 		using iterator = basic_iterator_t<Mosaic>;
 
+	public:
+		/// Creates an empty map.
+		CompactMosaicMap();
+
+		/// Copy constructor that makes a shallow copy of \a map.
+		CompactMosaicMap(const CompactMosaicMap& map);
+
+		/// Move constructor that move constructs a map from \a map.
+		CompactMosaicMap(CompactMosaicMap&& map);
+
+	public:
+		/// Assignment operator that makes a shallow copy of \a map.
+		CompactMosaicMap& operator=(const CompactMosaicMap& map);
+
+		/// Move assignment operator that assigns \a map.
+		CompactMosaicMap& operator=(CompactMosaicMap&& map);
+
 	public:
 		/// Gets a const iterator to the first element of the underlying container.
 		const_iterator begin() const;
@@ -231,9 +288,15 @@ namespace catapult { namespace state {
 		/// Optimizes access of the mosaic with \a id.
 		void optimize(MosaicId id);
 
+	public:
+		/// Returns \c true if this map shares storage with \a map.
+		bool sharesStorageWith(const CompactMosaicMap& map) const;
+
 	private:
 		bool find(MosaicId id, MosaicLocation& location) const;
 
+		void detach();
+
 		void insertIntoArray(size_t index, const Mosaic& pair);
 
 		void insertIntoMap(const Mosaic& pair);
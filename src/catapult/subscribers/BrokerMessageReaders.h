@@ -21,6 +21,7 @@
 #pragma once
 #include "catapult/io/BufferInputStreamAdapter.h"
 #include "catapult/io/FileQueue.h"
+#include "catapult/utils/TimeSpan.h"
 #include "catapult/utils/traits/Traits.h"
 
 namespace catapult { namespace subscribers {
@@ -44,25 +45,72 @@ namespace catapult { namespace subscribers {
 
 	// endregion
 
+	/// Function for recording the latency of a processed message.
+	using LatencyRecorder = consumer<const utils::TimeSpan&>;
+
+	namespace detail {
+		template<typename TSubscriber, typename TMessageReader>
+		void ReadAllMessages(io::InputStream& inputStream, TSubscriber& subscriber, TMessageReader readNextMessage) {
+			while (!inputStream.eof())
+				readNextMessage(inputStream, subscriber);
+		}
+	}
+
 	/// Reads all messages from \a inputStream into \a subscriber using \a readNextMessage.
 	template<typename TSubscriber, typename TMessageReader>
 	void ReadAll(io::InputStream& inputStream, TSubscriber& subscriber, TMessageReader readNextMessage) {
-		while (!inputStream.eof())
-			readNextMessage(inputStream, subscriber);
-
+		detail::ReadAllMessages(inputStream, subscriber, readNextMessage);
 		detail::Flusher<TSubscriber>::Flush(subscriber);
 	}
 
+	/// Reads all messages from \a reader into \a subscriber using \a readNextMessage.
+	/// \a subscriber is flushed after at most \a maxMessagesPerFlush messages and before they are removed from \a reader.
+	/// The time elapsed between writing and completely processing (and flushing) each message is passed to \a recordLatency.
+	template<typename TSubscriber, typename TMessageReader>
+	void ReadAll(
+			io::FileQueueReader& reader,
+			TSubscriber& subscriber,
+			TMessageReader readNextMessage,
+			size_t maxMessagesPerFlush,
+			const LatencyRecorder& recordLatency) {
+		std::vector<std::chrono::system_clock::time_point> writeTimes;
+		auto consumeMessage = [&subscriber, readNextMessage, &writeTimes](const auto& buffer, auto writeTime) {
+			io::BufferInputStreamAdapter<std::vector<uint8_t>> inputStream(buffer);
+			detail::ReadAllMessages(inputStream, subscriber, readNextMessage);
+			writeTimes.push_back(writeTime);
+		};
+		auto commit = [&subscriber, &writeTimes, &recordLatency]() {
+			detail::Flusher<TSubscriber>::Flush(subscriber);
+
+			auto now = std::chrono::system_clock::now();
+			for (auto writeTime : writeTimes) {
+				// clock adjustments can move the current time before the write time
+				auto elapsedMillis = std::chrono::duration_cast<std::chrono::milliseconds>(now - writeTime).count();
+				recordLatency(utils::TimeSpan::FromMilliseconds(static_cast<uint64_t>(std::max<int64_t>(0, elapsedMillis))));
+			}
+		};
+
+		// messages of a failed batch are read again, so their write times must be discarded too
+		do {
+			writeTimes.clear();
+		} while (0 != reader.readNextTimedMessages(maxMessagesPerFlush, consumeMessage, commit));
+	}
+
+	/// Reads all messages from \a reader into \a subscriber using \a readNextMessage.
+	/// The time elapsed between writing and completely processing each message is passed to \a recordLatency.
+	template<typename TSubscriber, typename TMessageReader>
+	void ReadAll(
+			io::FileQueueReader& reader,
+			TSubscriber& subscriber,
+			TMessageReader readNextMessage,
+			const LatencyRecorder& recordLatency) {
+		ReadAll(reader, subscriber, readNextMessage, 1, recordLatency);
+	}
+
 	/// Reads all messages from \a reader into \a subscriber using \a readNextMessage.
 	template<typename TSubscriber, typename TMessageReader>
 	void ReadAll(io::FileQueueReader& reader, TSubscriber& subscriber, TMessageReader readNextMessage) {
-		bool shouldContinue = true;
-		while (shouldContinue) {
-			shouldContinue = reader.tryReadNextMessage([&subscriber, readNextMessage](const auto& buffer) {
-				io::BufferInputStreamAdapter<std::vector<uint8_t>> inputStream(buffer);
-				ReadAll(inputStream, subscriber, readNextMessage);
-			});
-		}
+		ReadAll(reader, subscriber, readNextMessage, [](const auto&) {});
 	}
 
 	/// Describes a message queue.
@@ -89,4 +137,35 @@ namespace catapult { namespace subscribers {
 		CATAPULT_LOG(debug) << "preparing to process " << numPendingMessages << " messages from " << descriptor.QueuePath;
 		subscribers::ReadAll(reader, subscriber, readNextMessage);
 	}
+
+	/// Reads all messages from queue described by \a descriptor into \a subscriber using \a readNextMessage.
+	/// \a subscriber is flushed after at most \a maxMessagesPerFlush messages and before they are removed from the queue.
+	/// The time elapsed between writing and completely processing (and flushing) each message is passed to \a recordLatency.
+	template<typename TSubscriber, typename TMessageReader>
+	void ReadAll(
+			const MessageQueueDescriptor& descriptor,
+			TSubscriber& subscriber,
+			TMessageReader readNextMessage,
+			size_t maxMessagesPerFlush,
+			const LatencyRecorder& recordLatency) {
+		io::FileQueueReader reader(descriptor.QueuePath, descriptor.IndexReaderFilename, descriptor.IndexWriterFilename);
+
+		auto numPendingMessages = reader.pending();
+		if (0 == numPendingMessages)
+			return;
+
+		CATAPULT_LOG(debug) << "preparing to process " << numPendingMessages << " messages from " << descriptor.QueuePath;
+		subscribers::ReadAll(reader, subscriber, readNextMessage, maxMessagesPerFlush, recordLatency);
+	}
+
+	/// Reads all messages from queue described by \a descriptor into \a subscriber using \a readNextMessage.
+	/// The time elapsed between writing and completely processing each message is passed to \a recordLatency.
+	template<typename TSubscriber, typename TMessageReader>
+	void ReadAll(
+			const MessageQueueDescriptor& descriptor,
+			TSubscriber& subscriber,
+			TMessageReader readNextMessage,
+			const LatencyRecorder& recordLatency) {
+		ReadAll(descriptor, subscriber, readNextMessage, 1, recordLatency);
+	}
 }}
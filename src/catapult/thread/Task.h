@@ -41,6 +41,9 @@ namespace catapult { namespace thread {
 	/// Supplier that generates delays.
 	using DelayGenerator = supplier<utils::TimeSpan>;
 
+	/// Adjusts a generated delay before it is applied.
+	using DelayAdjuster = std::function<utils::TimeSpan (const utils::TimeSpan&)>;
+
 	/// Task that can be dispatched to a scheduler.
 	struct Task {
 		/// Delay until the first execution of the task.
@@ -54,6 +57,10 @@ namespace catapult { namespace thread {
 
 		/// Friendly name of the task (optional).
 		std::string Name;
+
+		/// Adjusts the delays generated by the configured delay generator (optional).
+		/// \note This allows a task to shorten or lengthen its configured delays based on runtime state.
+		DelayAdjuster AdjustDelay;
 	};
 
 	/// Creates a uniform delay generator that always returns \a delay.
@@ -57,6 +57,11 @@ namespace catapult { namespace tree {
 			return m_tree.lookup(key, nodePath);
 		}
 
+		/// Tries to find the values associated with \a keys in the tree and stores a combined proof of existence or not in \a nodes.
+		std::vector<std::pair<Hash256, bool>> lookup(const std::vector<KeyType>& keys, std::vector<TreeNode>& nodes) const {
+			return m_tree.lookup(keys, nodes);
+		}
+
 	public:
 		/// Gets a delta based on the same data source as this tree.
 		std::shared_ptr<DeltaType> rebase() {
@@ -253,6 +253,65 @@ namespace catapult { namespace tree {
 			return std::make_pair(Hash256(), false);
 		}
 
+	public:
+		/// Tries to find the values associated with \a keys in the tree and stores a combined proof of existence or not in \a nodes.
+		/// \note The tree is traversed once, each proof node is stored once and nodes are stored in depth-first order.
+		std::vector<std::pair<Hash256, bool>> lookup(const std::vector<KeyType>& keys, std::vector<TreeNode>& nodes) const {
+			std::vector<IndexedKeyPath> keyPaths;
+			keyPaths.reserve(keys.size());
+			for (auto i = 0u; i < keys.size(); ++i)
+				keyPaths.push_back({ i, TreeNodePath(TEncoder::EncodeKey(keys[i])) });
+
+			std::vector<std::pair<Hash256, bool>> results(keys.size(), LookupNotFoundResult());
+			lookup(m_rootNode, keyPaths, nodes, results);
+			return results;
+		}
+
+	private:
+		struct IndexedKeyPath {
+			size_t Index;
+			TreeNodePath Path;
+		};
+
+		void lookup(
+				const TreeNode& node,
+				const std::vector<IndexedKeyPath>& keyPaths,
+				std::vector<TreeNode>& nodes,
+				std::vector<std::pair<Hash256, bool>>& results) const {
+			// if the node is empty, there is nothing to do
+			if (node.empty())
+				return;
+
+			nodes.push_back(node.copy());
+			if (!node.isBranch()) {
+				// if the node is a leaf, it must fully match a key path for the key to be in the tree
+				for (const auto& keyPath : keyPaths) {
+					if (FindFirstDifferenceIndex(node.path(), keyPath.Path) == keyPath.Path.size())
+						results[keyPath.Index] = std::make_pair(node.asLeafNode().value(), true);
+				}
+
+				return;
+			}
+
+			// group key paths by the branch link connecting with them, so that every linked node is visited at most once
+			std::array<std::vector<IndexedKeyPath>, BranchTreeNode::Max_Links> linkKeyPaths;
+			for (const auto& keyPath : keyPaths) {
+				auto differenceIndex = FindFirstDifferenceIndex(node.path(), keyPath.Path);
+				auto nodeLinkIndex = keyPath.Path.nibbleAt(differenceIndex);
+				linkKeyPaths[nodeLinkIndex].push_back({ keyPath.Index, keyPath.Path.subpath(differenceIndex + 1) });
+			}
+
+			const auto& branchNode = node.asBranchNode();
+			for (auto i = 0u; i < BranchTreeNode::Max_Links; ++i) {
+				if (linkKeyPaths[i].empty())
+					continue;
+
+				auto pNextNode = getLinkedNode(branchNode, i);
+				if (pNextNode)
+					lookup(*pNextNode, linkKeyPaths[i], nodes, results);
+			}
+		}
+
 		// endregion
 
 		// region tryLoad + setRoot + clear
@@ -321,10 +380,10 @@ namespace catapult { namespace tree {
 	private:
 		// region links
 
-		std::unique_ptr<const TreeNode> getLinkedNode(const BranchTreeNode& branchNode, size_t index) const {
-			// copy from memory, if available; otherwise, copy from data source
-			auto pLinkedNode = branchNode.linkedNode(index);
-			return pLinkedNode ? std::move(pLinkedNode) : m_dataSource.get(branchNode.link(index));
+		std::shared_ptr<const TreeNode> getLinkedNode(const BranchTreeNode& branchNode, size_t index) const {
+			// copy from memory, if available; otherwise, get (possibly shared) node from data source
+			std::shared_ptr<const TreeNode> pLinkedNode = branchNode.linkedNode(index);
+			return pLinkedNode ? pLinkedNode : m_dataSource.get(branchNode.link(index));
 		}
 
 		void setLink(BranchTreeNode& branchNode, const TreeNode& node, size_t index) {
@@ -51,6 +51,11 @@ namespace catapult { namespace utils {
 			{ std::make_pair("None", LogColorMode::None) }
 		}};
 
+		const std::array<std::pair<const char*, LogOverflowPolicy>, 2> String_To_LogOverflowPolicy_Pairs{{
+			{ std::make_pair("Block", LogOverflowPolicy::Block) },
+			{ std::make_pair("Drop", LogOverflowPolicy::Drop) }
+		}};
+
 		const std::array<std::pair<const char*, bool>, 2> String_To_Boolean_Pairs{{
 			{ std::make_pair("true", true) },
 			{ std::make_pair("false", false) }
@@ -69,6 +74,10 @@ namespace catapult { namespace utils {
 		return TryParseEnumValue(String_To_LogColorMode_Pairs, str, parsedValue);
 	}
 
+	bool TryParseValue(const std::string& str, LogOverflowPolicy& parsedValue) {
+		return TryParseEnumValue(String_To_LogOverflowPolicy_Pairs, str, parsedValue);
+	}
+
 	bool TryParseValue(const std::string& str, bool& parsedValue) {
 		return TryParseEnumValue(String_To_Boolean_Pairs, str, parsedValue);
 	}
@@ -43,6 +43,9 @@ namespace catapult { namespace utils {
 	/// Tries to parse \a str into a log color mode (\a parsedValue).
 	bool TryParseValue(const std::string& str, LogColorMode& parsedValue);
 
+	/// Tries to parse \a str into a log overflow policy (\a parsedValue).
+	bool TryParseValue(const std::string& str, LogOverflowPolicy& parsedValue);
+
 	/// Tries to parse \a str into a boolean (\a parsedValue).
 	bool TryParseValue(const std::string& str, bool& parsedValue);
 
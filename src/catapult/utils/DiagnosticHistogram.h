@@ -0,0 +1,66 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "LatencyHistogram.h"
+#include "DiagnosticCounterId.h"
+#include <vector>
+
+namespace catapult { namespace utils {
+
+	/// Diagnostic latency histogram.
+	class DiagnosticHistogram {
+	public:
+		/// Creates a histogram view around \a id, \a tag and \a pHistogram.
+		/// \note \a tag distinguishes histograms with the same \a id (e.g. consumer index or packet type).
+		DiagnosticHistogram(
+				const DiagnosticCounterId& id,
+				uint32_t tag,
+				const std::shared_ptr<const LatencyHistogram>& pHistogram)
+				: m_id(id)
+				, m_tag(tag)
+				, m_pHistogram(pHistogram)
+		{}
+
+	public:
+		/// Gets the id.
+		const DiagnosticCounterId& id() const {
+			return m_id;
+		}
+
+		/// Gets the tag.
+		uint32_t tag() const {
+			return m_tag;
+		}
+
+		/// Gets a snapshot of the current values.
+		LatencyHistogram::Snapshot snapshot() const {
+			return m_pHistogram->snapshot();
+		}
+
+	private:
+		DiagnosticCounterId m_id;
+		uint32_t m_tag;
+		std::shared_ptr<const LatencyHistogram> m_pHistogram;
+	};
+
+	/// Container of diagnostic histograms.
+	using DiagnosticHistograms = std::vector<DiagnosticHistogram>;
+}}
@@ -0,0 +1,184 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "LatencyHistogram.h"
+#include "IntegerMath.h"
+#include <algorithm>
+#include <ostream>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		constexpr auto Sub_Bucket_Bits = Log2<uint64_t>(LatencyHistogram::Num_Sub_Buckets);
+
+		size_t GetBucketIndex(uint64_t micros) {
+			if (micros < LatencyHistogram::Num_Sub_Buckets)
+				return micros;
+
+			auto shift = Log2(micros) - Sub_Bucket_Bits;
+			auto subBucketIndex = (micros >> shift) - LatencyHistogram::Num_Sub_Buckets;
+			auto bucketIndex = (shift + 1) * LatencyHistogram::Num_Sub_Buckets + subBucketIndex;
+			return std::min<size_t>(bucketIndex, LatencyHistogram::Num_Buckets - 1);
+		}
+
+		uint64_t GetBucketUpperBound(size_t bucketIndex) {
+			if (bucketIndex < LatencyHistogram::Num_Sub_Buckets)
+				return bucketIndex;
+
+			auto shift = bucketIndex / LatencyHistogram::Num_Sub_Buckets - 1;
+			auto subBucketIndex = bucketIndex % LatencyHistogram::Num_Sub_Buckets;
+			auto lowerBound = (LatencyHistogram::Num_Sub_Buckets + subBucketIndex) << shift;
+			return lowerBound + (1ull << shift) - 1;
+		}
+
+		size_t GetStripeIndex() {
+			// assign stripes to threads round robin so that concurrently recording threads rarely share cache lines
+			static std::atomic<size_t> nextStripeIndex(0);
+			thread_local auto stripeIndex = nextStripeIndex++ % LatencyHistogram::Num_Stripes;
+			return stripeIndex;
+		}
+	}
+
+	// region Snapshot
+
+	LatencyHistogram::Snapshot::Snapshot()
+			: m_count(0)
+			, m_maxMicros(0) {
+		m_buckets.fill(0);
+	}
+
+	uint64_t LatencyHistogram::Snapshot::count() const {
+		return m_count;
+	}
+
+	std::chrono::microseconds LatencyHistogram::Snapshot::max() const {
+		return std::chrono::microseconds(m_maxMicros);
+	}
+
+	uint64_t LatencyHistogram::Snapshot::bucketCount(size_t bucketIndex) const {
+		return m_buckets[bucketIndex];
+	}
+
+	std::chrono::microseconds LatencyHistogram::Snapshot::percentile(double percentile) const {
+		if (0 == m_count)
+			return std::chrono::microseconds(0);
+
+		auto threshold = static_cast<uint64_t>(static_cast<double>(m_count) * std::min(percentile, 100.0) / 100.0);
+		threshold = std::max<uint64_t>(1, threshold);
+
+		uint64_t cumulativeCount = 0;
+		for (auto i = 0u; i < Num_Buckets; ++i) {
+			cumulativeCount += m_buckets[i];
+			if (cumulativeCount >= threshold)
+				return std::chrono::microseconds(std::min(GetBucketUpperBound(i), m_maxMicros));
+		}
+
+		return max();
+	}
+
+	void LatencyHistogram::Snapshot::merge(const Snapshot& snapshot) {
+		for (auto i = 0u; i < Num_Buckets; ++i)
+			m_buckets[i] += snapshot.m_buckets[i];
+
+		m_count += snapshot.m_count;
+		m_maxMicros = std::max(m_maxMicros, snapshot.m_maxMicros);
+	}
+
+	// endregion
+
+	// region LatencyHistogram
+
+	// align stripes to (typical) cache lines in order to prevent false sharing between threads
+	struct alignas(64) LatencyHistogram::Stripe {
+		std::array<std::atomic<uint64_t>, Num_Buckets> Buckets;
+		std::atomic<uint64_t> MaxMicros;
+	};
+
+	LatencyHistogram::LatencyHistogram(LatencyHistogramPolicy policy)
+			: m_policy(policy)
+			, m_numStripes(LatencyHistogramPolicy::Atomic == policy ? Num_Stripes : 1)
+			, m_pStripes(new Stripe[m_numStripes]) {
+		reset();
+	}
+
+	LatencyHistogram::~LatencyHistogram() = default;
+
+	LatencyHistogramPolicy LatencyHistogram::policy() const {
+		return m_policy;
+	}
+
+	void LatencyHistogram::record(std::chrono::microseconds latency) {
+		auto micros = static_cast<uint64_t>(std::max<int64_t>(0, latency.count()));
+		if (LatencyHistogramPolicy::Unsynchronized == m_policy) {
+			// single writer, so plain (non read-modify-write) relaxed stores are sufficient and snapshot can still read
+			auto& stripe = m_pStripes[0];
+			auto& bucket = stripe.Buckets[GetBucketIndex(micros)];
+			bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			if (stripe.MaxMicros.load(std::memory_order_relaxed) < micros)
+				stripe.MaxMicros.store(micros, std::memory_order_relaxed);
+
+			return;
+		}
+
+		auto& stripe = m_pStripes[GetStripeIndex()];
+		stripe.Buckets[GetBucketIndex(micros)].fetch_add(1, std::memory_order_relaxed);
+
+		auto maxMicros = stripe.MaxMicros.load(std::memory_order_relaxed);
+		while (maxMicros < micros && !stripe.MaxMicros.compare_exchange_weak(maxMicros, micros, std::memory_order_relaxed))
+		{}
+	}
+
+	LatencyHistogram::Snapshot LatencyHistogram::snapshot() const {
+		Snapshot snapshot;
+		for (auto i = 0u; i < m_numStripes; ++i) {
+			const auto& stripe = m_pStripes[i];
+			for (auto j = 0u; j < Num_Buckets; ++j) {
+				auto bucketCount = stripe.Buckets[j].load(std::memory_order_relaxed);
+				snapshot.m_buckets[j] += bucketCount;
+				snapshot.m_count += bucketCount;
+			}
+
+			snapshot.m_maxMicros = std::max(snapshot.m_maxMicros, stripe.MaxMicros.load(std::memory_order_relaxed));
+		}
+
+		return snapshot;
+	}
+
+	void LatencyHistogram::reset() {
+		for (auto i = 0u; i < m_numStripes; ++i) {
+			for (auto& bucket : m_pStripes[i].Buckets)
+				bucket.store(0, std::memory_order_relaxed);
+
+			m_pStripes[i].MaxMicros.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	// endregion
+
+	std::ostream& operator<<(std::ostream& out, const LatencyHistogram::Snapshot& snapshot) {
+		out
+				<< "count = " << snapshot.count()
+				<< ", p50 <= " << snapshot.percentile(50).count() << "us"
+				<< ", p99 <= " << snapshot.percentile(99).count() << "us"
+				<< ", p999 <= " << snapshot.percentile(99.9).count() << "us"
+				<< ", max = " << snapshot.max().count() << "us";
+		return out;
+	}
+}}
@@ -0,0 +1,120 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <memory>
+
+namespace catapult { namespace utils {
+
+	/// Possible latency histogram recording policies.
+	enum class LatencyHistogramPolicy {
+		/// Latencies are recorded by at most one thread at a time into a single set of buckets.
+		Unsynchronized,
+
+		/// Latencies can be recorded by multiple threads concurrently; each thread records into one of several stripes
+		/// of atomic buckets that are merged by snapshot.
+		Atomic
+	};
+
+	/// Histogram of microsecond latencies with logarithmic buckets that are linearly subdivided (HDR-style).
+	/// \note Recording is lock-free with both policies; only snapshot is allowed to run concurrently with record.
+	class LatencyHistogram : public NonCopyable {
+	public:
+		/// Number of linear sub-buckets per power of two.
+		static constexpr size_t Num_Sub_Buckets = 8;
+
+		/// Number of buckets.
+		/// \note Latencies less than Num_Sub_Buckets have their own buckets, all other buckets have a relative width of at most
+		///       1 / Num_Sub_Buckets. The last bucket additionally contains all latencies that are too large for the other buckets.
+		static constexpr size_t Num_Buckets = 30 * Num_Sub_Buckets;
+
+		/// Number of recording stripes used by the atomic policy.
+		static constexpr size_t Num_Stripes = 8;
+
+	public:
+		/// Merged (point in time) view of a histogram.
+		class Snapshot {
+		public:
+			/// Creates an empty snapshot.
+			Snapshot();
+
+		public:
+			/// Gets the number of recorded latencies.
+			uint64_t count() const;
+
+			/// Gets the largest recorded latency.
+			std::chrono::microseconds max() const;
+
+			/// Gets the number of latencies recorded in the bucket with index \a bucketIndex.
+			uint64_t bucketCount(size_t bucketIndex) const;
+
+			/// Gets an upper bound of the latency that is not exceeded by \a percentile percent of all recorded latencies.
+			std::chrono::microseconds percentile(double percentile) const;
+
+		public:
+			/// Merges all latencies recorded in \a snapshot into this snapshot.
+			void merge(const Snapshot& snapshot);
+
+		private:
+			std::array<uint64_t, Num_Buckets> m_buckets;
+			uint64_t m_count;
+			uint64_t m_maxMicros;
+
+			friend class LatencyHistogram;
+		};
+
+	public:
+		/// Creates an empty histogram with recording \a policy.
+		explicit LatencyHistogram(LatencyHistogramPolicy policy = LatencyHistogramPolicy::Atomic);
+
+		/// Destroys the histogram.
+		~LatencyHistogram();
+
+	public:
+		/// Gets the recording policy.
+		LatencyHistogramPolicy policy() const;
+
+	public:
+		/// Records \a latency.
+		void record(std::chrono::microseconds latency);
+
+		/// Merges all stripes into a snapshot.
+		Snapshot snapshot() const;
+
+		/// Removes all recorded latencies.
+		/// \note This must not be called concurrently with record.
+		void reset();
+
+	private:
+		struct Stripe;
+
+		LatencyHistogramPolicy m_policy;
+		size_t m_numStripes;
+		std::unique_ptr<Stripe[]> m_pStripes;
+	};
+
+	/// Insertion operator for outputting \a snapshot to \a out.
+	std::ostream& operator<<(std::ostream& out, const LatencyHistogram::Snapshot& snapshot);
+}}
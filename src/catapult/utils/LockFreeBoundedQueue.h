@@ -0,0 +1,134 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include <atomic>
+#include <memory>
+#include <stddef.h>
+
+namespace catapult { namespace utils {
+
+	/// Bounded multi-producer multi-consumer queue that never takes a lock.
+	/// \note Each slot carries a sequence number that tells producers and consumers whether it is free or filled,
+	///       so contention is limited to a single compare-exchange on the enqueue or dequeue position.
+	template<typename T>
+	class LockFreeBoundedQueue : public NonCopyable {
+	private:
+		struct Slot {
+			std::atomic<size_t> Sequence;
+			T Value;
+		};
+
+	public:
+		/// Creates a queue that can hold at least \a capacity elements.
+		/// \note Capacity is rounded up to the next power of two (and at least two).
+		explicit LockFreeBoundedQueue(size_t capacity)
+				: m_capacity(RoundUpCapacity(capacity))
+				, m_pSlots(std::make_unique<Slot[]>(m_capacity))
+				, m_enqueuePosition(0)
+				, m_dequeuePosition(0) {
+			for (auto i = 0u; i < m_capacity; ++i)
+				m_pSlots[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+
+	public:
+		/// Gets the capacity of the queue.
+		size_t capacity() const {
+			return m_capacity;
+		}
+
+		/// Gets the (approximate) number of elements in the queue.
+		size_t size() const {
+			auto enqueuePosition = m_enqueuePosition.load(std::memory_order_relaxed);
+			auto dequeuePosition = m_dequeuePosition.load(std::memory_order_relaxed);
+			return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+		}
+
+	public:
+		/// Tries to push \a value onto the queue and returns \c false if the queue is full.
+		bool tryPush(const T& value) {
+			return tryPushWith([&value](auto& slotValue) { slotValue = value; });
+		}
+
+		/// Tries to push \a value onto the queue and returns \c false if the queue is full.
+		bool tryPush(T&& value) {
+			return tryPushWith([&value](auto& slotValue) { slotValue = std::move(value); });
+		}
+
+		/// Tries to pop the oldest element from the queue into \a value and returns \c false if the queue is empty.
+		bool tryPop(T& value) {
+			auto position = m_dequeuePosition.load(std::memory_order_relaxed);
+			for (;;) {
+				auto& slot = m_pSlots[position & (m_capacity - 1)];
+				auto sequence = slot.Sequence.load(std::memory_order_acquire);
+				auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+				if (0 == difference) {
+					if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+						value = std::move(slot.Value);
+						slot.Value = T();
+						slot.Sequence.store(position + m_capacity, std::memory_order_release);
+						return true;
+					}
+				} else if (difference < 0) {
+					return false;
+				} else {
+					position = m_dequeuePosition.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+	private:
+		template<typename TAssign>
+		bool tryPushWith(TAssign assign) {
+			auto position = m_enqueuePosition.load(std::memory_order_relaxed);
+			for (;;) {
+				auto& slot = m_pSlots[position & (m_capacity - 1)];
+				auto sequence = slot.Sequence.load(std::memory_order_acquire);
+				auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+				if (0 == difference) {
+					if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+						assign(slot.Value);
+						slot.Sequence.store(position + 1, std::memory_order_release);
+						return true;
+					}
+				} else if (difference < 0) {
+					return false;
+				} else {
+					position = m_enqueuePosition.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		static size_t RoundUpCapacity(size_t capacity) {
+			size_t roundedCapacity = 2;
+			while (roundedCapacity < capacity)
+				roundedCapacity <<= 1;
+
+			return roundedCapacity;
+		}
+
+	private:
+		const size_t m_capacity;
+		std::unique_ptr<Slot[]> m_pSlots;
+		alignas(64) std::atomic<size_t> m_enqueuePosition;
+		alignas(64) std::atomic<size_t> m_dequeuePosition;
+	};
+}}
@@ -20,6 +20,7 @@
 
 #include "Logging.h"
 #include "BitwiseEnum.h"
+#include "LockFreeBoundedQueue.h"
 #include "catapult/types.h"
 #include <boost/core/null_deleter.hpp>
 #include <boost/log/attributes.hpp>
@@ -28,6 +29,8 @@
 #include <boost/log/sinks.hpp>
 #include <boost/log/support/date_time.hpp>
 #include <boost/phoenix.hpp>
+#include <condition_variable>
+#include <mutex>
 #include <unordered_map>
 
 namespace catapult { namespace utils {
@@ -157,6 +160,139 @@ namespace catapult { namespace utils {
 				return ShouldLog(severity, defaultLevel);
 			}, boost::log::trivial::severity.or_throw(), subcomponent_tag.or_throw());
 		}
+
+		// region LockFreeRecordQueue
+
+		namespace keywords {
+			BOOST_PARAMETER_KEYWORD(tag, queue_capacity)
+			BOOST_PARAMETER_KEYWORD(tag, overflow_policy)
+		}
+
+		// record queueing strategy for asynchronous sinks that does not lock when a record is enqueued into a non-full queue
+		// (the mutex is only used to park the feeding thread while the queue is empty and blocked producers while it is full)
+		class LockFreeRecordQueue {
+		protected:
+			template<typename TArgs>
+			explicit LockFreeRecordQueue(const TArgs& args)
+					: m_queue(args[keywords::queue_capacity])
+					, m_overflowPolicy(args[keywords::overflow_policy])
+					, m_isConsumerWaiting(false)
+					, m_numProducersWaiting(0)
+					, m_isInterruptRequested(false)
+			{}
+
+		protected:
+			void enqueue(const boost::log::record_view& record) {
+				if (!m_queue.tryPush(record)) {
+					if (LogOverflowPolicy::Drop == m_overflowPolicy)
+						return;
+
+					pushBlocking(record);
+				}
+
+				notifyConsumer();
+			}
+
+			bool try_enqueue(const boost::log::record_view& record) {
+				if (!m_queue.tryPush(record))
+					return false;
+
+				notifyConsumer();
+				return true;
+			}
+
+			bool try_dequeue_ready(boost::log::record_view& record) {
+				return try_dequeue(record);
+			}
+
+			bool try_dequeue(boost::log::record_view& record) {
+				if (!m_queue.tryPop(record))
+					return false;
+
+				notifyProducers();
+				return true;
+			}
+
+			bool dequeue_ready(boost::log::record_view& record) {
+				for (;;) {
+					if (try_dequeue(record))
+						return true;
+
+					std::unique_lock<std::mutex> lock(m_mutex);
+					if (m_isInterruptRequested) {
+						m_isInterruptRequested = false;
+						return false;
+					}
+
+					// the flag is set before the queue is checked again, so a producer either sees the flag or its record is popped
+					m_isConsumerWaiting = true;
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					if (m_queue.tryPop(record)) {
+						m_isConsumerWaiting = false;
+						lock.unlock();
+						notifyProducers();
+						return true;
+					}
+
+					m_consumerCondition.wait(lock, [this]() { return !m_isConsumerWaiting || m_isInterruptRequested; });
+					m_isConsumerWaiting = false;
+				}
+			}
+
+			void interrupt_dequeue() {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_isInterruptRequested = true;
+				m_consumerCondition.notify_one();
+			}
+
+		private:
+			void pushBlocking(const boost::log::record_view& record) {
+				std::unique_lock<std::mutex> lock(m_mutex);
+				++m_numProducersWaiting;
+
+				// the counter is incremented before the queue is checked again, so the consumer either sees it or space is available
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				while (!m_queue.tryPush(record))
+					m_producersCondition.wait(lock);
+
+				--m_numProducersWaiting;
+			}
+
+			void notifyConsumer() {
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (!m_isConsumerWaiting.load(std::memory_order_relaxed))
+					return;
+
+				// the flag is cleared under the lock so that exactly one producer wakes the consumer
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (!m_isConsumerWaiting)
+					return;
+
+				m_isConsumerWaiting = false;
+				m_consumerCondition.notify_one();
+			}
+
+			void notifyProducers() {
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (0 == m_numProducersWaiting.load(std::memory_order_relaxed))
+					return;
+
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_producersCondition.notify_all();
+			}
+
+		private:
+			LockFreeBoundedQueue<boost::log::record_view> m_queue;
+			LogOverflowPolicy m_overflowPolicy;
+			std::atomic<bool> m_isConsumerWaiting;
+			std::atomic<size_t> m_numProducersWaiting;
+			bool m_isInterruptRequested;
+			std::mutex m_mutex;
+			std::condition_variable m_consumerCondition;
+			std::condition_variable m_producersCondition;
+		};
+
+		// endregion
 	}
 
 	// region LogFilter::Impl
@@ -220,7 +356,13 @@ namespace catapult { namespace utils {
 
 			switch (options.SinkType) {
 			case LogSinkType::Async:
-				return addSink(boost::make_shared<asynchronous_sink<TBackend>>(pBackend), options.ColorMode, filter);
+				return addSink(
+						boost::make_shared<asynchronous_sink<TBackend, LockFreeRecordQueue>>(
+								pBackend,
+								keywords::queue_capacity = options.QueueCapacity,
+								keywords::overflow_policy = options.OverflowPolicy),
+						options.ColorMode,
+						filter);
 
 			default:
 				return addSink(boost::make_shared<synchronous_sink<TBackend>>(pBackend), options.ColorMode, filter);
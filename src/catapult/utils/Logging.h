@@ -74,6 +74,19 @@ namespace catapult { namespace utils {
 
 	// endregion
 
+	// region LogOverflowPolicy
+
+	/// Policies applied by asynchronous sinks when their queues are full.
+	enum class LogOverflowPolicy {
+		/// Block the logging thread until there is space in the queue.
+		Block,
+
+		/// Drop the log record.
+		Drop
+	};
+
+	// endregion
+
 	// region LogColorMode
 
 	/// Catapult (console) log color modes.
@@ -125,6 +138,8 @@ namespace catapult { namespace utils {
 		BasicLoggerOptions()
 				: SinkType(LogSinkType::Async)
 				, ColorMode(LogColorMode::None)
+				, QueueCapacity(64 * 1024)
+				, OverflowPolicy(LogOverflowPolicy::Block)
 		{}
 
 		/// Log sink type.
@@ -132,6 +147,12 @@ namespace catapult { namespace utils {
 
 		/// Log color mode.
 		LogColorMode ColorMode;
+
+		/// Maximum number of records queued by an asynchronous sink.
+		uint32_t QueueCapacity;
+
+		/// Policy applied when the queue of an asynchronous sink is full.
+		LogOverflowPolicy OverflowPolicy;
 	};
 
 	/// File logger options.
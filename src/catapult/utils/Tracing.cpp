@@ -0,0 +1,250 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Tracing.h"
+#include "SpinLock.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		// region TraceEvent / ThreadTraceBuffer
+
+		struct TraceEvent {
+			/// Span name.
+			/// \note std::array instead of std::string to avoid allocations when recording.
+			std::array<char, 32> Name;
+			const char* Category;
+			uint64_t StartMicros;
+			uint64_t DurationMicros;
+			Height BlockHeight;
+			Hash256 BlockHash;
+			bool HasBlockHash;
+		};
+
+		struct ThreadTraceBuffer {
+		public:
+			explicit ThreadTraceBuffer(uint32_t threadId)
+					: ThreadId(threadId)
+					, NextIndex(0)
+					, Size(0) {
+				Events.resize(Max_Trace_Events_Per_Thread);
+			}
+
+		public:
+			uint32_t ThreadId;
+			std::vector<TraceEvent> Events;
+			size_t NextIndex;
+			size_t Size;
+			SpinLock Lock; // only contended when events are written out or cleared
+		};
+
+		// endregion
+
+		// region TraceBufferRegistry
+
+		class TraceBufferRegistry {
+		public:
+			TraceBufferRegistry() : m_origin(std::chrono::steady_clock::now())
+			{}
+
+		public:
+			uint64_t toMicros(std::chrono::steady_clock::time_point timePoint) const {
+				auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(timePoint - m_origin);
+				return static_cast<uint64_t>(std::max<int64_t>(0, elapsed.count()));
+			}
+
+			std::shared_ptr<ThreadTraceBuffer> createBuffer() {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				auto pBuffer = std::make_shared<ThreadTraceBuffer>(static_cast<uint32_t>(++m_numCreatedBuffers));
+				m_buffers.push_back(pBuffer);
+				return pBuffer;
+			}
+
+			template<typename TAction>
+			void forEach(TAction action) {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				for (const auto& pBuffer : m_buffers)
+					action(*pBuffer);
+			}
+
+			void clear() {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				for (const auto& pBuffer : m_buffers) {
+					SpinLockGuard bufferGuard(pBuffer->Lock);
+					pBuffer->NextIndex = 0;
+					pBuffer->Size = 0;
+				}
+
+				// buffers only referenced by the registry belong to threads that have exited
+				m_buffers.erase(std::remove_if(m_buffers.begin(), m_buffers.end(), [](const auto& pBuffer) {
+					return 1 == pBuffer.use_count();
+				}), m_buffers.end());
+			}
+
+		private:
+			std::chrono::steady_clock::time_point m_origin;
+			std::mutex m_mutex;
+			std::vector<std::shared_ptr<ThreadTraceBuffer>> m_buffers;
+			size_t m_numCreatedBuffers = 0;
+		};
+
+		std::atomic_bool& GetTracingEnabledFlag() {
+			static std::atomic_bool isEnabled(false);
+			return isEnabled;
+		}
+
+		TraceBufferRegistry& GetRegistry() {
+			static TraceBufferRegistry registry;
+			return registry;
+		}
+
+		ThreadTraceBuffer& GetThreadBuffer() {
+			thread_local auto pBuffer = GetRegistry().createBuffer();
+			return *pBuffer;
+		}
+
+		// endregion
+
+		// region json output
+
+		void WriteJsonString(std::ostream& out, const char* str) {
+			out << '"';
+			for (; *str; ++str) {
+				if ('"' == *str || '\\' == *str)
+					out << '\\' << *str;
+				else if (static_cast<unsigned char>(*str) >= 0x20)
+					out << *str;
+			}
+
+			out << '"';
+		}
+
+		void WriteJsonEvent(std::ostream& out, uint32_t threadId, const TraceEvent& event) {
+			out << "{\"name\":";
+			WriteJsonString(out, event.Name.data());
+			out << ",\"cat\":";
+			WriteJsonString(out, event.Category);
+			out
+					<< ",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadId
+					<< ",\"ts\":" << event.StartMicros
+					<< ",\"dur\":" << event.DurationMicros
+					<< ",\"args\":{";
+
+			if (Height() != event.BlockHeight)
+				out << "\"height\":" << event.BlockHeight;
+
+			if (event.HasBlockHash)
+				out << (Height() != event.BlockHeight ? "," : "") << "\"hash\":\"" << event.BlockHash << "\"";
+
+			out << "}}";
+		}
+
+		// endregion
+	}
+
+	bool IsTracingEnabled() {
+		return GetTracingEnabledFlag().load(std::memory_order_relaxed);
+	}
+
+	void SetTracingEnabled(bool isEnabled) {
+		// create the registry before any span is started so that all span timestamps are relative to its origin
+		GetRegistry();
+		GetTracingEnabledFlag() = isEnabled;
+	}
+
+	void WriteTraceEvents(std::ostream& out) {
+		out << "{\"traceEvents\":[";
+
+		auto isFirstEvent = true;
+		GetRegistry().forEach([&out, &isFirstEvent](auto& buffer) {
+			SpinLockGuard guard(buffer.Lock);
+			auto startIndex = (buffer.NextIndex + Max_Trace_Events_Per_Thread - buffer.Size) % Max_Trace_Events_Per_Thread;
+			for (auto i = 0u; i < buffer.Size; ++i) {
+				if (!isFirstEvent)
+					out << ",";
+
+				WriteJsonEvent(out, buffer.ThreadId, buffer.Events[(startIndex + i) % Max_Trace_Events_Per_Thread]);
+				isFirstEvent = false;
+			}
+		});
+
+		out << "],\"displayTimeUnit\":\"ms\"}";
+	}
+
+	void ClearTraceEvents() {
+		GetRegistry().clear();
+	}
+
+	// region TraceSpan
+
+	TraceSpan::TraceSpan(const char* category, const char* name)
+			: m_isEnabled(IsTracingEnabled())
+			, m_category(category)
+			, m_name(name)
+			, m_hasHash(false) {
+		if (m_isEnabled)
+			m_start = std::chrono::steady_clock::now();
+	}
+
+	TraceSpan::~TraceSpan() {
+		if (!m_isEnabled)
+			return;
+
+		const auto& registry = GetRegistry();
+		auto end = std::chrono::steady_clock::now();
+		auto& buffer = GetThreadBuffer();
+
+		SpinLockGuard guard(buffer.Lock);
+		auto& event = buffer.Events[buffer.NextIndex];
+		event.Name.fill(0);
+		std::strncpy(event.Name.data(), m_name, event.Name.size() - 1);
+		event.Category = m_category;
+		event.StartMicros = registry.toMicros(m_start);
+		event.DurationMicros = registry.toMicros(end) - event.StartMicros;
+		event.BlockHeight = m_height;
+		event.BlockHash = m_hash;
+		event.HasBlockHash = m_hasHash;
+
+		buffer.NextIndex = (buffer.NextIndex + 1) % Max_Trace_Events_Per_Thread;
+		buffer.Size = std::min(buffer.Size + 1, Max_Trace_Events_Per_Thread);
+	}
+
+	void TraceSpan::setHeight(Height height) {
+		m_height = height;
+	}
+
+	void TraceSpan::setHash(const Hash256& hash) {
+		if (!m_isEnabled)
+			return;
+
+		m_hash = hash;
+		m_hasHash = true;
+	}
+
+	// endregion
+}}
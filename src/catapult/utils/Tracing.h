@@ -0,0 +1,73 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include "catapult/types.h"
+#include <chrono>
+#include <iosfwd>
+
+namespace catapult { namespace utils {
+
+	/// Maximum number of trace events retained per thread.
+	/// \note When more events are recorded, the oldest events are overwritten.
+	constexpr size_t Max_Trace_Events_Per_Thread = 4096;
+
+	/// Returns \c true if span tracing is enabled.
+	bool IsTracingEnabled();
+
+	/// Enables span tracing when \a isEnabled is \c true and disables it otherwise.
+	void SetTracingEnabled(bool isEnabled);
+
+	/// Writes all retained trace events in Chrome trace event (JSON) format to \a out.
+	/// \note Output can be loaded by chrome://tracing and Perfetto.
+	void WriteTraceEvents(std::ostream& out);
+
+	/// Removes all retained trace events.
+	void ClearTraceEvents();
+
+	/// Span that is recorded as a trace event in a thread-local ring buffer when it is destroyed.
+	/// \note When tracing is disabled at construction, the span does nothing.
+	class TraceSpan : public NonCopyable {
+	public:
+		/// Creates a span with \a name in \a category.
+		/// \note \a category must be a string literal and \a name must outlive the span.
+		TraceSpan(const char* category, const char* name);
+
+		/// Destroys the span and records it.
+		~TraceSpan();
+
+	public:
+		/// Attaches block \a height to the span.
+		void setHeight(Height height);
+
+		/// Attaches block \a hash to the span.
+		void setHash(const Hash256& hash);
+
+	private:
+		bool m_isEnabled;
+		const char* m_category;
+		const char* m_name;
+		std::chrono::steady_clock::time_point m_start;
+		Height m_height;
+		Hash256 m_hash;
+		bool m_hasHash;
+	};
+}}
@@ -0,0 +1,295 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/api/CompactBlockUtils.h"
+#include "catapult/api/ChainPackets.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace api {
+
+#define TEST_CLASS CompactBlockUtilsTests
+
+	namespace {
+		std::shared_ptr<const model::Block> GenerateBlock(size_t numTransactions) {
+			return test::GenerateBlockWithTransactions(numTransactions, Height(234));
+		}
+
+		std::vector<utils::ShortHash> GenerateShortHashes(size_t count) {
+			std::vector<utils::ShortHash> shortHashes;
+			for (auto i = 0u; i < count; ++i)
+				shortHashes.push_back(test::GenerateRandomValue<utils::ShortHash>());
+
+			return shortHashes;
+		}
+
+		std::vector<const model::Transaction*> GetTransactions(const model::Block& block) {
+			std::vector<const model::Transaction*> transactions;
+			for (const auto& transaction : block.Transactions())
+				transactions.push_back(&transaction);
+
+			return transactions;
+		}
+
+		std::shared_ptr<ionet::Packet> PayloadToPacket(const ionet::PacketPayload& payload) {
+			const auto& header = payload.header();
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(header.Size - sizeof(ionet::Packet));
+			pPacket->Type = header.Type;
+
+			size_t dataOffset = 0;
+			for (const auto& buffer : payload.buffers()) {
+				std::memcpy(pPacket->Data() + dataOffset, buffer.pData, buffer.Size);
+				dataOffset += buffer.Size;
+			}
+
+			return pPacket;
+		}
+
+		size_t CalculatePrefilledSize(const model::Block& block, const std::vector<uint32_t>& prefilledIndexes) {
+			auto transactions = GetTransactions(block);
+			size_t size = 0;
+			for (auto index : prefilledIndexes)
+				size += transactions[index]->Size;
+
+			return size;
+		}
+
+		std::shared_ptr<ionet::Packet> CreateCompactBlockPacket(
+				const std::shared_ptr<const model::Block>& pBlock,
+				const std::vector<utils::ShortHash>& shortHashes,
+				const std::vector<uint32_t>& prefilledIndexes) {
+			return PayloadToPacket(CreateCompactBlockPayload(pBlock, shortHashes, prefilledIndexes));
+		}
+
+		void AssertCompactBlock(
+				const model::Block& block,
+				const std::vector<utils::ShortHash>& expectedShortHashes,
+				const std::vector<uint32_t>& expectedPrefilledIndexes,
+				const CompactBlock& compactBlock) {
+			ASSERT_TRUE(!!compactBlock.pBlockHeader);
+			EXPECT_EQ_MEMORY(&block, compactBlock.pBlockHeader, sizeof(model::BlockHeader));
+			EXPECT_EQ(expectedShortHashes, compactBlock.ShortHashes);
+			EXPECT_EQ(expectedPrefilledIndexes, compactBlock.PrefilledIndexes);
+
+			auto transactions = GetTransactions(block);
+			ASSERT_EQ(expectedPrefilledIndexes.size(), compactBlock.PrefilledTransactions.size());
+			for (auto i = 0u; i < expectedPrefilledIndexes.size(); ++i)
+				EXPECT_EQ(*transactions[expectedPrefilledIndexes[i]], *compactBlock.PrefilledTransactions[i]) << "transaction at " << i;
+		}
+	}
+
+	// region CreateCompactBlockPayload
+
+	TEST(TEST_CLASS, CanCreatePayloadWithoutPrefilledTransactions) {
+		// Arrange:
+		auto pBlock = GenerateBlock(5);
+		auto shortHashes = GenerateShortHashes(5);
+
+		// Act:
+		auto pPacket = CreateCompactBlockPacket(pBlock, shortHashes, {});
+
+		// Assert:
+		ASSERT_EQ(sizeof(CompactBlockRequest) + sizeof(model::BlockHeader) + 5 * sizeof(utils::ShortHash), pPacket->Size);
+		const auto& request = static_cast<const CompactBlockRequest&>(*pPacket);
+		EXPECT_EQ(ionet::PacketType::Compact_Block, request.Type);
+		EXPECT_EQ(5u, request.TransactionsCount);
+		EXPECT_EQ(0u, request.PrefilledTransactionsCount);
+
+		const auto* pData = reinterpret_cast<const uint8_t*>(&request + 1);
+		EXPECT_EQ_MEMORY(pBlock.get(), pData, sizeof(model::BlockHeader));
+		EXPECT_EQ_MEMORY(shortHashes.data(), pData + sizeof(model::BlockHeader), 5 * sizeof(utils::ShortHash));
+	}
+
+	TEST(TEST_CLASS, CanCreatePayloadWithPrefilledTransactions) {
+		// Arrange:
+		auto pBlock = GenerateBlock(5);
+		auto shortHashes = GenerateShortHashes(5);
+
+		// Act:
+		auto pPacket = CreateCompactBlockPacket(pBlock, shortHashes, { 1, 4 });
+
+		// Assert:
+		auto expectedSize = sizeof(CompactBlockRequest) + sizeof(model::BlockHeader) + 5 * sizeof(utils::ShortHash) + 2 * sizeof(uint32_t);
+		expectedSize += CalculatePrefilledSize(*pBlock, { 1, 4 });
+		ASSERT_EQ(expectedSize, pPacket->Size);
+
+		const auto& request = static_cast<const CompactBlockRequest&>(*pPacket);
+		EXPECT_EQ(5u, request.TransactionsCount);
+		EXPECT_EQ(2u, request.PrefilledTransactionsCount);
+
+		const auto* pData = reinterpret_cast<const uint8_t*>(&request + 1) + sizeof(model::BlockHeader) + 5 * sizeof(utils::ShortHash);
+		const auto* pPrefilledIndexes = reinterpret_cast<const uint32_t*>(pData);
+		EXPECT_EQ(1u, pPrefilledIndexes[0]);
+		EXPECT_EQ(4u, pPrefilledIndexes[1]);
+
+		auto transactions = GetTransactions(*pBlock);
+		pData += 2 * sizeof(uint32_t);
+		EXPECT_EQ_MEMORY(transactions[1], pData, transactions[1]->Size);
+		EXPECT_EQ_MEMORY(transactions[4], pData + transactions[1]->Size, transactions[4]->Size);
+	}
+
+	TEST(TEST_CLASS, CreatePayloadIgnoresPrefilledIndexesOutOfRange) {
+		// Arrange:
+		auto pBlock = GenerateBlock(3);
+		auto shortHashes = GenerateShortHashes(3);
+
+		// Act:
+		auto pPacket = CreateCompactBlockPacket(pBlock, shortHashes, { 2, 3, 7 });
+
+		// Assert: only the transaction at index 2 was prefilled
+		const auto& request = static_cast<const CompactBlockRequest&>(*pPacket);
+		EXPECT_EQ(3u, request.TransactionsCount);
+		EXPECT_EQ(1u, request.PrefilledTransactionsCount);
+
+		auto expectedSize = sizeof(CompactBlockRequest) + sizeof(model::BlockHeader) + 3 * sizeof(utils::ShortHash) + sizeof(uint32_t);
+		expectedSize += CalculatePrefilledSize(*pBlock, { 2 });
+		EXPECT_EQ(expectedSize, pPacket->Size);
+	}
+
+	// endregion
+
+	// region TryParseCompactBlock - success
+
+	namespace {
+		void AssertCanRoundtrip(size_t numTransactions, const std::vector<uint32_t>& prefilledIndexes) {
+			// Arrange:
+			auto pBlock = GenerateBlock(numTransactions);
+			auto shortHashes = GenerateShortHashes(numTransactions);
+			auto pPacket = CreateCompactBlockPacket(pBlock, shortHashes, prefilledIndexes);
+
+			// Act:
+			CompactBlock compactBlock;
+			auto result = TryParseCompactBlock(*pPacket, mocks::CreateDefaultTransactionRegistry(), compactBlock);
+
+			// Assert:
+			ASSERT_TRUE(result);
+			AssertCompactBlock(*pBlock, shortHashes, prefilledIndexes, compactBlock);
+		}
+	}
+
+	TEST(TEST_CLASS, CanParseCompactBlockWithoutTransactions) {
+		AssertCanRoundtrip(0, {});
+	}
+
+	TEST(TEST_CLASS, CanParseCompactBlockWithoutPrefilledTransactions) {
+		AssertCanRoundtrip(5, {});
+	}
+
+	TEST(TEST_CLASS, CanParseCompactBlockWithSomePrefilledTransactions) {
+		AssertCanRoundtrip(5, { 0, 2, 3 });
+	}
+
+	TEST(TEST_CLASS, CanParseCompactBlockWithAllPrefilledTransactions) {
+		AssertCanRoundtrip(5, { 0, 1, 2, 3, 4 });
+	}
+
+	// endregion
+
+	// region TryParseCompactBlock - failure
+
+	namespace {
+		template<typename TMutator>
+		void AssertCannotParse(const std::vector<uint32_t>& prefilledIndexes, TMutator mutator) {
+			// Arrange:
+			auto pBlock = GenerateBlock(5);
+			auto pPacket = CreateCompactBlockPacket(pBlock, GenerateShortHashes(5), prefilledIndexes);
+			mutator(static_cast<CompactBlockRequest&>(*pPacket));
+
+			// Act:
+			CompactBlock compactBlock;
+			auto result = TryParseCompactBlock(*pPacket, mocks::CreateDefaultTransactionRegistry(), compactBlock);
+
+			// Assert:
+			EXPECT_FALSE(result);
+		}
+
+		uint32_t* GetPrefilledIndexes(CompactBlockRequest& request) {
+			auto* pData = reinterpret_cast<uint8_t*>(&request + 1) + sizeof(model::BlockHeader);
+			return reinterpret_cast<uint32_t*>(pData + request.TransactionsCount * sizeof(utils::ShortHash));
+		}
+	}
+
+	TEST(TEST_CLASS, CannotParsePacketWithWrongType) {
+		AssertCannotParse({}, [](auto& request) { request.Type = ionet::PacketType::Push_Block; });
+	}
+
+	TEST(TEST_CLASS, CannotParsePacketTooSmallForBlockHeader) {
+		AssertCannotParse({}, [](auto& request) {
+			request.TransactionsCount = 0;
+			request.Size = sizeof(CompactBlockRequest) + sizeof(model::BlockHeader) - 1;
+		});
+	}
+
+	TEST(TEST_CLASS, CannotParsePacketTooSmallForShortHashes) {
+		AssertCannotParse({}, [](auto& request) { ++request.TransactionsCount; });
+	}
+
+	TEST(TEST_CLASS, CannotParsePacketWithMorePrefilledTransactionsThanTransactions) {
+		AssertCannotParse({ 0, 1, 2, 3, 4 }, [](auto& request) { request.TransactionsCount = 4; });
+	}
+
+	TEST(TEST_CLASS, CannotParsePacketWithBlockHeaderTooSmall) {
+		AssertCannotParse({}, [](auto& request) {
+			reinterpret_cast<model::BlockHeader&>(*(&request + 1)).Size = sizeof(model::BlockHeader) - 1;
+		});
+	}
+
+	TEST(TEST_CLASS, CannotParsePacketWithPrefilledIndexOutOfRange) {
+		AssertCannotParse({ 1, 4 }, [](auto& request) { GetPrefilledIndexes(request)[1] = 5; });
+	}
+
+	TEST(TEST_CLASS, CannotParsePacketWithUnsortedPrefilledIndexes) {
+		AssertCannotParse({ 1, 4 }, [](auto& request) { std::swap(GetPrefilledIndexes(request)[0], GetPrefilledIndexes(request)[1]); });
+	}
+
+	TEST(TEST_CLASS, CannotParsePacketWithDuplicatePrefilledIndexes) {
+		AssertCannotParse({ 1, 4 }, [](auto& request) { GetPrefilledIndexes(request)[1] = 1; });
+	}
+
+	TEST(TEST_CLASS, CannotParsePacketWithTruncatedPrefilledTransaction) {
+		AssertCannotParse({ 1, 4 }, [](auto& request) { --request.Size; });
+	}
+
+	TEST(TEST_CLASS, CannotParsePacketWithTrailingData) {
+		// Arrange:
+		auto pBlock = GenerateBlock(5);
+		auto pValidPacket = CreateCompactBlockPacket(pBlock, GenerateShortHashes(5), { 1, 4 });
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(pValidPacket->Size - sizeof(ionet::Packet) + 8);
+		std::memcpy(static_cast<void*>(pPacket.get()), pValidPacket.get(), pValidPacket->Size);
+		pPacket->Size = pValidPacket->Size + 8;
+
+		// Act:
+		CompactBlock compactBlock;
+		auto result = TryParseCompactBlock(*pPacket, mocks::CreateDefaultTransactionRegistry(), compactBlock);
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
+
+	TEST(TEST_CLASS, CannotParsePacketWithPrefilledTransactionOfUnknownType) {
+		AssertCannotParse({ 1, 4 }, [](auto& request) {
+			auto* pTransaction = reinterpret_cast<model::Transaction*>(GetPrefilledIndexes(request) + 2);
+			pTransaction->Type = static_cast<model::EntityType>(0xFFFF);
+		});
+	}
+
+	// endregion
+}}
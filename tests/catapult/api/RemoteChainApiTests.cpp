@@ -21,6 +21,7 @@
 #include "catapult/api/RemoteChainApi.h"
 #include "catapult/api/ChainPackets.h"
 #include "catapult/model/TransactionPlugin.h"
+#include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/other/RemoteApiFactory.h"
 #include "tests/test/other/RemoteApiTestUtils.h"
 #include "tests/TestHarness.h"
@@ -208,6 +209,46 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct CompactBlockTraits {
+			static auto Invoke(const RemoteChainApi& api) {
+				auto pBlock = std::shared_ptr<const model::Block>(test::GenerateBlockWithTransactions(3, Height(917)));
+				return api.compactBlock(pBlock, { utils::ShortHash(1), utils::ShortHash(2), utils::ShortHash(3) }, { 1 });
+			}
+
+			static auto CreateValidResponsePacket(uint32_t payloadSize = 2u * sizeof(uint32_t)) {
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = ionet::PacketType::Compact_Block;
+				test::FillWithRandomData({ pResponsePacket->Data(), payloadSize });
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains a partial index
+				return CreateValidResponsePacket(2 * sizeof(uint32_t) - 1);
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				ASSERT_LE(sizeof(CompactBlockRequest) + sizeof(model::BlockHeader), packet.Size);
+				EXPECT_EQ(ionet::PacketType::Compact_Block, packet.Type);
+
+				const auto* pRequest = static_cast<const CompactBlockRequest*>(&packet);
+				EXPECT_EQ(3u, pRequest->TransactionsCount);
+				EXPECT_EQ(1u, pRequest->PrefilledTransactionsCount);
+
+				const auto& blockHeader = reinterpret_cast<const model::BlockHeader&>(*(pRequest + 1));
+				EXPECT_EQ(Height(917), blockHeader.Height);
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const model::EntityRange<uint32_t>& indexes) {
+				ASSERT_EQ(2u, indexes.size());
+
+				const auto* pExpectedIndexes = reinterpret_cast<const uint32_t*>(response.Data());
+				auto iter = indexes.cbegin();
+				for (auto i = 0u; i < indexes.size(); ++i, ++iter)
+					EXPECT_EQ(pExpectedIndexes[i], *iter) << "comparing indexes at " << i;
+			}
+		};
+
 		struct RemoteChainApiBlocklessTraits {
 			static auto Create(ionet::PacketIo& packetIo) {
 				return CreateRemoteChainApiWithoutRegistry(packetIo);
@@ -234,4 +275,5 @@ namespace catapult { namespace api {
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteChainApi, BlockLast)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteChainApi, BlockAt)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteChainApi, BlocksFrom)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteChainApi, CompactBlock)
 }}
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/api/RemoteTransactionApi.h"
+#include "tests/test/core/HashTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/other/RemoteApiFactory.h"
 #include "tests/test/other/RemoteApiTestUtils.h"
@@ -108,6 +109,44 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct TransactionInventoryTraits {
+			static constexpr uint32_t Request_Data_Size = 3 * sizeof(model::AnnouncedTransaction);
+
+			static auto Invoke(const RemoteTransactionApi& api) {
+				auto transactions = model::AnnouncedTransactionRange::PrepareFixed(3);
+				test::FillWithRandomData({ reinterpret_cast<uint8_t*>(transactions.data()), Request_Data_Size });
+				return api.unknownTransactionHashes(std::move(transactions));
+			}
+
+			static auto CreateValidResponsePacket(uint32_t payloadSize = 2u * sizeof(Hash256)) {
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = ionet::PacketType::Transaction_Inventory;
+				test::FillWithRandomData({ pResponsePacket->Data(), payloadSize });
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains a partial hash
+				return CreateValidResponsePacket(3 * sizeof(Hash256) / 2);
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_EQ(ionet::PacketType::Transaction_Inventory, packet.Type);
+				EXPECT_EQ(sizeof(ionet::Packet) + Request_Data_Size, packet.Size);
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const model::HashRange& hashes) {
+				ASSERT_EQ(2u, hashes.size());
+
+				auto iter = hashes.cbegin();
+				for (auto i = 0u; i < hashes.size(); ++i) {
+					auto pExpectedHash = response.Data() + i * sizeof(Hash256);
+					EXPECT_EQ_MEMORY(pExpectedHash, iter->data(), sizeof(Hash256)) << "comparing hashes at " << i;
+					++iter;
+				}
+			}
+		};
+
 		struct RemoteTransactionApiTraits {
 			static auto Create(ionet::PacketIo& packetIo, const model::NodeIdentity& remoteIdentity) {
 				auto registry = mocks::CreateDefaultTransactionRegistry();
@@ -122,4 +161,5 @@ namespace catapult { namespace api {
 
 	DEFINE_REMOTE_API_TESTS(RemoteTransactionApi)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, Ut)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, TransactionInventory)
 }}
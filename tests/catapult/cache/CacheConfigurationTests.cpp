@@ -34,6 +34,8 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
 		EXPECT_EQ(utils::FileSize(), config.MaxCacheDatabaseWriteBatchSize);
 		EXPECT_FALSE(config.ShouldStorePatriciaTrees);
+		EXPECT_EQ(utils::FileSize(), config.DecodedValueCache.MaxSize);
+		EXPECT_FALSE(!!config.DecodedValueCache.pStatistics);
 	}
 
 	TEST(TEST_CLASS, CanCreateConfigurationWithPathButNotPatriciaTreeStorage) {
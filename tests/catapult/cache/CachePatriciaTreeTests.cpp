@@ -86,12 +86,13 @@ namespace catapult { namespace cache {
 	namespace {
 		class CacheDatabaseHolder {
 		public:
-			CacheDatabaseHolder()
+			explicit CacheDatabaseHolder(const DecodedValueCacheSettings& decodedValueCacheSettings = DecodedValueCacheSettings())
 					: m_database(CacheDatabaseSettings(
 							m_dbDirGuard.name(),
 							{ "default", "patricia_tree" },
 							utils::FileSize(),
-							FilterPruningMode::Disabled))
+							FilterPruningMode::Disabled,
+							decodedValueCacheSettings))
 			{}
 
 		public:
@@ -202,6 +203,32 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(rootHash, tree.get()->root());
 	}
 
+	TEST(TEST_CLASS, Enabled_CanInitializeWithRootHashInDbThroughNodeCache) {
+		// Arrange:
+		auto pNodeCache = std::make_shared<PatriciaTreeNodeCache>(utils::FileSize::FromMegabytes(1), nullptr);
+
+		DecodedValueCacheSettings decodedValueCacheSettings;
+		decodedValueCacheSettings.MaxSize = utils::FileSize::FromMegabytes(1);
+		decodedValueCacheSettings.pPatriciaTreeNodeCache = pNodeCache;
+		CacheDatabaseHolder holder(decodedValueCacheSettings);
+
+		tree::LeafTreeNode leafNode(tree::TreeNodePath(0x01'23'4A'B6'78), test::GenerateRandomByteArray<Hash256>());
+		auto rootHash = leafNode.hash();
+		auto serializedLeafNode = tree::PatriciaTreeSerializer::SerializeValue(tree::TreeNode(leafNode));
+
+		holder.database().put(1, "root", HashToString(rootHash));
+		holder.database().put(1, HashToString(rootHash), serializedLeafNode);
+
+		// Act:
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1);
+
+		// Assert: root node was loaded through (and cached by) the shared node cache
+		ASSERT_TRUE(!!tree.get());
+		EXPECT_EQ(rootHash, tree.get()->root());
+
+		EXPECT_EQ(1u, pNodeCache->size());
+	}
+
 	TEST(TEST_CLASS, Enabled_CannotInitializeWithUnknownRootHashInDb) {
 		// Arrange:
 		CacheDatabaseHolder holder;
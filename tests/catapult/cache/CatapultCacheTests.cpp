@@ -62,6 +62,14 @@ namespace catapult { namespace cache {
 			AddSubCacheWithId<4>(builder);
 			return builder.build();
 		}
+
+		CatapultCache CreateSimpleCatapultCache(uint32_t maxCommitThreads) {
+			CatapultCacheBuilder builder;
+			AddSubCacheWithId<2>(builder);
+			AddSubCacheWithId<6>(builder);
+			AddSubCacheWithId<4>(builder);
+			return builder.build(maxCommitThreads);
+		}
 	}
 
 	// region ctor
@@ -269,6 +277,34 @@ namespace catapult { namespace cache {
 		AssertSubCacheSizes(delta, 1);
 	}
 
+	namespace {
+		void AssertCommitDelegatesToSubCaches(uint32_t maxCommitThreads) {
+			// Arrange:
+			auto cache = CreateSimpleCatapultCache(maxCommitThreads);
+
+			// Act: commit multiple times to ensure commit thread pool can be reused
+			for (auto i = 0u; i < 3; ++i)
+				CommitChangeToAllSubCaches(cache);
+
+			auto view = cache.createView();
+
+			// Assert:
+			AssertSubCacheSizes(view, 3);
+		}
+	}
+
+	TEST(TEST_CLASS, CommitDelegatesToSubCaches_SingleCommitThread) {
+		AssertCommitDelegatesToSubCaches(1);
+	}
+
+	TEST(TEST_CLASS, CommitDelegatesToSubCaches_MultipleCommitThreads) {
+		AssertCommitDelegatesToSubCaches(2);
+	}
+
+	TEST(TEST_CLASS, CommitDelegatesToSubCaches_MoreCommitThreadsThanSubCaches) {
+		AssertCommitDelegatesToSubCaches(10);
+	}
+
 	TEST(TEST_CLASS, CommitOfSubCacheInvalidatesDetachedDelta) {
 		// Arrange:
 		auto cache = CreateSimpleCatapultCache();
@@ -319,6 +355,16 @@ namespace catapult { namespace cache {
 				[&cache]() { CommitWithNoChanges(cache); });
 	}
 
+	TEST(TEST_CLASS, ReadLockBlocksConcurrentCommitOfSubCaches) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache(3);
+
+		// Assert:
+		test::AssertExclusiveLocks(
+				[&cache]() { return CatapultCacheView(cache.createView()); },
+				[&cache]() { CommitWithNoChanges(cache); });
+	}
+
 	TEST(TEST_CLASS, DetachableDeltaBlocksCommitOfSubCache) {
 		// Arrange:
 		auto cache = CreateSimpleCatapultCache();
@@ -370,6 +416,22 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(Height(123), cache.createDetachableDelta().height());
 	}
 
+	TEST(TEST_CLASS, CommitUpdatesCacheHeightAfterConcurrentCommitOfAllSubCaches) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache(3);
+		{
+			// Act:
+			auto delta = cache.createDelta();
+			IncrementAllSubCaches(delta);
+			cache.commit(Height(123));
+		}
+
+		// Assert:
+		auto view = cache.createView();
+		EXPECT_EQ(Height(123), view.height());
+		AssertSubCacheSizes(view, 1);
+	}
+
 	// endregion
 
 	// region dependent state
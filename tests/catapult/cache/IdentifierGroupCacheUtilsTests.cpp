@@ -21,6 +21,7 @@
 #include "catapult/cache/IdentifierGroupCacheUtils.h"
 #include "tests/test/cache/TestCacheTypes.h"
 #include "tests/TestHarness.h"
+#include <set>
 
 namespace catapult { namespace cache {
 
@@ -384,5 +385,62 @@ namespace catapult { namespace cache {
 		});
 	}
 
+	namespace {
+		template<typename TAction>
+		void RunCommittedHeightGroupedTest(TAction action) {
+			// Arrange: commit all values so that touching them is observable
+			BaseSetType set;
+			auto pDelta = set.rebase();
+			pDelta->insert(TestCacheDescriptor::ValueType("a", Height(6)));
+			pDelta->insert(TestCacheDescriptor::ValueType("xyz", Height(6)));
+			pDelta->insert(TestCacheDescriptor::ValueType(std::string(9, 'c'), Height(6)));
+			pDelta->insert(TestCacheDescriptor::ValueType(std::string(100, 'z'), Height(6)));
+			set.commit();
+
+			HeightGroupedBaseSetType groupedSet;
+			auto pGroupedDelta = groupedSet.rebase();
+			pGroupedDelta->insert(AddValues(TestIdentifierGroup(Height(6)), { 1, 3, 9 }));
+
+			// Act + Assert:
+			action(*pDelta, *pGroupedDelta);
+		}
+
+		template<typename TDelta>
+		std::set<int> GetCopiedIdentifiers(const TDelta& delta) {
+			std::set<int> identifiers;
+			for (const auto& pair : delta.deltas().Copied)
+				identifiers.insert(pair.first);
+
+			return identifiers;
+		}
+	}
+
+	TEST(TEST_CLASS, FindDeactivatingIdentifiersAtHeight_TouchesAllValuesInGroupWhenSetIsNonConst) {
+		// Arrange:
+		RunCommittedHeightGroupedTest([](auto& delta, auto& groupedDelta) {
+			// Act:
+			auto identifiers = FindDeactivatingIdentifiersAtHeight(delta, groupedDelta, Height(6));
+
+			// Assert: all values in the group were touched but the group was not
+			EXPECT_EQ(3u, identifiers.size());
+			EXPECT_EQ(std::set<int>({ 1, 3, 9 }), GetCopiedIdentifiers(delta));
+			EXPECT_TRUE(groupedDelta.deltas().Copied.empty());
+		});
+	}
+
+	TEST(TEST_CLASS, FindDeactivatingIdentifiersAtHeight_DoesNotTouchValuesWhenSetIsConst) {
+		// Arrange:
+		RunCommittedHeightGroupedTest([](auto& delta, auto& groupedDelta) {
+			// Act:
+			const auto& constDelta = delta;
+			auto identifiers = FindDeactivatingIdentifiersAtHeight(constDelta, groupedDelta, Height(6));
+
+			// Assert:
+			EXPECT_EQ(3u, identifiers.size());
+			EXPECT_TRUE(GetCopiedIdentifiers(delta).empty());
+			EXPECT_TRUE(groupedDelta.deltas().Copied.empty());
+		});
+	}
+
 	// endregion
 }}
@@ -156,6 +156,51 @@ namespace catapult { namespace cache {
 		EXPECT_NE(nodePathLeaf.value(), result.first);
 	}
 
+	TEST(TEST_CLASS, ViewMixin_BatchLookupReturnsFalseWhenTreeIsNullptr) {
+		// Arrange:
+		auto mixin = PatriciaTreeMixin<MemoryPatriciaTree>(nullptr);
+
+		// Act:
+		std::vector<tree::TreeNode> nodes;
+		auto results = mixin.tryLookup(std::vector<uint32_t>{ 0x64'6F'67'65, 0x64'6F'67'64 }, nodes);
+
+		// Assert:
+		ASSERT_EQ(2u, results.size());
+		for (const auto& result : results) {
+			EXPECT_FALSE(result.second);
+			EXPECT_EQ(Hash256(), result.first);
+		}
+
+		EXPECT_TRUE(nodes.empty());
+	}
+
+	TEST(TEST_CLASS, ViewMixin_BatchLookupForwardsToUnderlyingTreeWhenTreeIsValid) {
+		// Arrange:
+		tree::MemoryDataSource dataSource;
+		MemoryPatriciaTree tree(dataSource);
+		test::SeedTreeWithFourNodes(tree);
+
+		auto mixin = PatriciaTreeMixin<MemoryPatriciaTree>(&tree);
+
+		// Act:
+		std::vector<tree::TreeNode> nodes;
+		auto results = mixin.tryLookup(std::vector<uint32_t>{ 0x64'6F'67'65, 0x64'6F'67'64 }, nodes);
+
+		// Assert:
+		ASSERT_EQ(2u, results.size());
+		EXPECT_TRUE(results[0].second);
+		EXPECT_NE(Hash256(), results[0].first);
+		EXPECT_FALSE(results[1].second);
+		EXPECT_EQ(Hash256(), results[1].first);
+
+		// - both keys share the same path, so the combined proof is the same as the proof of either key
+		std::vector<tree::TreeNode> nodePath;
+		tree.lookup(0x64'6F'67'65, nodePath);
+		ASSERT_EQ(nodePath.size(), nodes.size());
+		for (auto i = 0u; i < nodes.size(); ++i)
+			EXPECT_EQ(nodePath[i].hash(), nodes[i].hash()) << "node at " << i;
+	}
+
 	// endregion
 
 	// region PatriciaTreeDeltaMixin - supportsMerkleRoot
@@ -1250,6 +1250,99 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(model::AddressSet({ addresses[0], addresses[2], addresses[4] }), cache.createView()->highValueAddresses());
 	}
 
+	namespace {
+		std::vector<Address> MakeHighValueAddressChanges(
+				AccountStateCacheDelta& delta,
+				const std::vector<Address>& addresses) {
+			// - add 2/3 accounts with sufficient balance (uncommitted) [5 match]
+			auto uncommittedAddresses = AddAccountsWithBalances(delta, { Amount(1'100'000), Amount(900'000), Amount(1'000'000) });
+
+			// - modify two [5 match]
+			delta.find(addresses[1]).get().Balances.credit(Harvesting_Mosaic_Id, Amount(100'000));
+			delta.find(addresses[4]).get().Balances.debit(Harvesting_Mosaic_Id, Amount(200'001));
+
+			// - delete two [3 match]
+			delta.queueRemove(addresses[2], Height(1));
+			delta.queueRemove(uncommittedAddresses[0], Height(1));
+			delta.commitRemovals();
+			return uncommittedAddresses;
+		}
+	}
+
+	TEST(TEST_CLASS, HighValueAddressChangesOnlyContainChangedAccounts) {
+		// Arrange:
+		auto deltaAction = [](const auto& addresses, auto& delta) {
+			auto uncommittedAddresses = MakeHighValueAddressChanges(*delta, addresses);
+
+			// Act:
+			auto changes = delta->highValueAddressChanges();
+
+			// Assert: unchanged high value account (addresses[0]) is not included
+			EXPECT_EQ(model::AddressSet({ addresses[1], uncommittedAddresses[2] }), changes.Updated);
+			EXPECT_EQ(model::AddressSet({ addresses[2], addresses[4] }), changes.Removed);
+		};
+		auto viewAction = [](const auto& addresses, const auto& view) {
+			// Act + Assert:
+			EXPECT_EQ(model::AddressSet({ addresses[0], addresses[2], addresses[4] }), view->highValueAddresses());
+		};
+
+		// - add 3/5 accounts with sufficient balance [3 match]
+		auto balances = std::vector<Amount>{ Amount(1'100'000), Amount(900'000), Amount(1'000'000), Amount(800'000), Amount(1'200'000) };
+		RunHighValueAddressesTest(balances, deltaAction, viewAction);
+	}
+
+	TEST(TEST_CLASS, HighValueAddressChangesAreEmptyWhenNoAccountsAreChanged) {
+		// Arrange:
+		auto deltaAction = [](const auto&, const auto& delta) {
+			// Act:
+			auto changes = delta->highValueAddressChanges();
+
+			// Assert:
+			EXPECT_TRUE(changes.Updated.empty());
+			EXPECT_TRUE(changes.Removed.empty());
+		};
+		auto viewAction = [](const auto& addresses, const auto& view) {
+			// Act + Assert:
+			EXPECT_EQ(model::AddressSet({ addresses[0], addresses[2] }), view->highValueAddresses());
+		};
+
+		// - add 2/3 accounts with sufficient balance
+		auto balances = std::vector<Amount>{ Amount(1'100'000), Amount(900'000), Amount(1'000'000) };
+		RunHighValueAddressesTest(balances, deltaAction, viewAction);
+	}
+
+	TEST(TEST_CLASS, CommitAppliesHighValueAddressChanges) {
+		// Arrange: set min balance to 1M
+		auto options = Default_Cache_Options;
+		options.MinHarvesterBalance = Amount(1'000'000);
+		AccountStateCache cache(CacheConfiguration(), options);
+
+		std::vector<Address> addresses;
+		std::vector<Address> uncommittedAddresses;
+		{
+			// - add 3/5 accounts with sufficient balance [3 match]
+			auto delta = cache.createDelta();
+			addresses = AddAccountsWithBalances(*delta, {
+				Amount(1'100'000), Amount(900'000), Amount(1'000'000), Amount(800'000), Amount(1'200'000)
+			});
+			cache.commit();
+
+			// - make changes to delta [3 match]
+			uncommittedAddresses = MakeHighValueAddressChanges(*delta, addresses);
+
+			// Act:
+			cache.commit();
+		}
+
+		// Assert:
+		auto expectedAddresses = model::AddressSet({ addresses[0], addresses[1], uncommittedAddresses[2] });
+		EXPECT_EQ(expectedAddresses, cache.createView()->highValueAddresses());
+
+		auto highValueAddresses = cache.createDelta()->highValueAddresses();
+		EXPECT_EQ(expectedAddresses, highValueAddresses.Current);
+		EXPECT_TRUE(highValueAddresses.Removed.empty());
+	}
+
 	// endregion
 
 	// region cache init
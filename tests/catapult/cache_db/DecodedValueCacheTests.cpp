@@ -0,0 +1,380 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/DecodedValueCache.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS DecodedValueCacheTests
+
+	namespace {
+		using CacheType = DecodedValueCache<uint64_t>;
+
+		// entries have a size of at least 96 (overhead) + 8 (value) + key size + value size
+		constexpr auto Entry_Size = 96u + 8 + 5 + 100;
+
+		DecodedValueCacheSettings CreateSettings(size_t maxEntriesPerShard) {
+			DecodedValueCacheSettings settings;
+			settings.MaxSize = utils::FileSize::FromBytes(maxEntriesPerShard * Entry_Size * CacheType::Num_Shards);
+			settings.pStatistics = std::make_shared<DecodedValueCacheStatistics>();
+			return settings;
+		}
+
+		RawBuffer ToBuffer(const std::string& key) {
+			return { reinterpret_cast<const uint8_t*>(key.data()), key.size() };
+		}
+
+		void Insert(CacheType& cache, const std::string& key, uint64_t value) {
+			cache.insert(key, std::make_shared<const uint64_t>(value), 100, cache.version());
+		}
+
+		// generates \a count (five character) keys that map to the same shard
+		std::vector<std::string> GenerateSameShardKeys(size_t count) {
+			std::vector<std::string> keys;
+			auto shardIndex = std::hash<std::string>()("k1000") % CacheType::Num_Shards;
+			for (auto i = 1000u; keys.size() < count; ++i) {
+				auto key = "k" + std::to_string(i);
+				if (shardIndex == std::hash<std::string>()(key) % CacheType::Num_Shards)
+					keys.push_back(key);
+			}
+
+			return keys;
+		}
+
+		DecodedValueCacheSettings CreateSharedBudgetSettings(size_t maxEntriesPerShard) {
+			auto settings = CreateSettings(maxEntriesPerShard);
+			settings.pBudget = std::make_shared<DecodedValueCacheBudget>(settings.MaxSize);
+			return settings;
+		}
+
+		// inserts (five character) filler keys until \a cache cannot cache any more values
+		void Fill(CacheType& cache) {
+			for (auto i = 1000u; i < 10000; ++i)
+				Insert(cache, "f" + std::to_string(i), i);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		CacheType cache(CreateSettings(10));
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(0u, cache.memorySize());
+		EXPECT_EQ(0u, cache.version());
+	}
+
+	// endregion
+
+	// region insert / find
+
+	TEST(TEST_CLASS, CanFindInsertedValue) {
+		// Arrange:
+		auto settings = CreateSettings(10);
+		CacheType cache(settings);
+		Insert(cache, "alpha", 123);
+		Insert(cache, "gamma", 777);
+
+		// Act:
+		auto pValue1 = cache.find(ToBuffer("alpha"));
+		auto pValue2 = cache.find(ToBuffer("gamma"));
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_EQ(2 * Entry_Size, cache.memorySize());
+
+		ASSERT_TRUE(!!pValue1);
+		ASSERT_TRUE(!!pValue2);
+		EXPECT_EQ(123u, *pValue1);
+		EXPECT_EQ(777u, *pValue2);
+
+		EXPECT_EQ(2u, settings.pStatistics->NumHits);
+		EXPECT_EQ(0u, settings.pStatistics->NumMisses);
+	}
+
+	TEST(TEST_CLASS, CannotFindUnknownValue) {
+		// Arrange:
+		auto settings = CreateSettings(10);
+		CacheType cache(settings);
+		Insert(cache, "alpha", 123);
+
+		// Act:
+		auto pValue = cache.find(ToBuffer("gamma"));
+
+		// Assert:
+		EXPECT_FALSE(!!pValue);
+
+		EXPECT_EQ(0u, settings.pStatistics->NumHits);
+		EXPECT_EQ(1u, settings.pStatistics->NumMisses);
+	}
+
+	TEST(TEST_CLASS, InsertDoesNotReplaceCachedValue) {
+		// Arrange:
+		CacheType cache(CreateSettings(10));
+		Insert(cache, "alpha", 123);
+
+		// Act:
+		Insert(cache, "alpha", 456);
+		auto pValue = cache.find(ToBuffer("alpha"));
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		ASSERT_TRUE(!!pValue);
+		EXPECT_EQ(123u, *pValue);
+	}
+
+	TEST(TEST_CLASS, InsertIgnoresValueLoadedAtPreviousVersion) {
+		// Arrange:
+		CacheType cache(CreateSettings(10));
+		auto version = cache.version();
+		cache.remove(ToBuffer("gamma"));
+
+		// Act:
+		cache.insert("alpha", std::make_shared<const uint64_t>(123), 100, version);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_FALSE(!!cache.find(ToBuffer("alpha")));
+	}
+
+	TEST(TEST_CLASS, InsertIgnoresValueLargerThanShardBudget) {
+		// Arrange:
+		CacheType cache(CreateSettings(1));
+
+		// Act:
+		cache.insert("alpha", std::make_shared<const uint64_t>(123), 101, cache.version());
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+	}
+
+	TEST(TEST_CLASS, InsertIsNoOpWhenCacheHasNoBudget) {
+		// Arrange:
+		CacheType cache(CreateSettings(0));
+
+		// Act:
+		Insert(cache, "alpha", 123);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+	}
+
+	// endregion
+
+	// region eviction
+
+	TEST(TEST_CLASS, LeastRecentlyInsertedValueIsEvictedWhenBudgetIsExceeded) {
+		// Arrange:
+		CacheType cache(CreateSettings(3));
+		auto keys = GenerateSameShardKeys(4);
+		for (auto i = 0u; i < 3; ++i)
+			Insert(cache, keys[i], i);
+
+		// Act:
+		Insert(cache, keys[3], 3);
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		EXPECT_EQ(3 * Entry_Size, cache.memorySize());
+		EXPECT_FALSE(!!cache.find(ToBuffer(keys[0])));
+		EXPECT_TRUE(!!cache.find(ToBuffer(keys[1])));
+		EXPECT_TRUE(!!cache.find(ToBuffer(keys[2])));
+		EXPECT_TRUE(!!cache.find(ToBuffer(keys[3])));
+	}
+
+	TEST(TEST_CLASS, LeastRecentlyUsedValueIsEvictedWhenBudgetIsExceeded) {
+		// Arrange:
+		CacheType cache(CreateSettings(3));
+		auto keys = GenerateSameShardKeys(4);
+		for (auto i = 0u; i < 3; ++i)
+			Insert(cache, keys[i], i);
+
+		// - touch the first value
+		cache.find(ToBuffer(keys[0]));
+
+		// Act:
+		Insert(cache, keys[3], 3);
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		EXPECT_TRUE(!!cache.find(ToBuffer(keys[0])));
+		EXPECT_FALSE(!!cache.find(ToBuffer(keys[1])));
+		EXPECT_TRUE(!!cache.find(ToBuffer(keys[2])));
+		EXPECT_TRUE(!!cache.find(ToBuffer(keys[3])));
+	}
+
+	// endregion
+
+	// region remove / clear
+
+	TEST(TEST_CLASS, RemoveInvalidatesValue) {
+		// Arrange:
+		CacheType cache(CreateSettings(10));
+		Insert(cache, "alpha", 123);
+		Insert(cache, "gamma", 777);
+
+		// Act:
+		cache.remove(ToBuffer("alpha"));
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(Entry_Size, cache.memorySize());
+		EXPECT_EQ(1u, cache.version());
+		EXPECT_FALSE(!!cache.find(ToBuffer("alpha")));
+		EXPECT_TRUE(!!cache.find(ToBuffer("gamma")));
+	}
+
+	TEST(TEST_CLASS, RemoveChangesVersionWhenValueIsNotCached) {
+		// Arrange:
+		CacheType cache(CreateSettings(10));
+		Insert(cache, "alpha", 123);
+
+		// Act:
+		cache.remove(ToBuffer("gamma"));
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(1u, cache.version());
+	}
+
+	TEST(TEST_CLASS, ClearInvalidatesAllValues) {
+		// Arrange:
+		CacheType cache(CreateSettings(10));
+		Insert(cache, "alpha", 123);
+		Insert(cache, "gamma", 777);
+
+		// Act:
+		cache.clear();
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(0u, cache.memorySize());
+		EXPECT_EQ(1u, cache.version());
+	}
+
+	TEST(TEST_CLASS, InvalidatedValueRemainsValidForHolders) {
+		// Arrange:
+		CacheType cache(CreateSettings(10));
+		Insert(cache, "alpha", 123);
+		auto pValue = cache.find(ToBuffer("alpha"));
+
+		// Act:
+		cache.clear();
+
+		// Assert:
+		ASSERT_TRUE(!!pValue);
+		EXPECT_EQ(123u, *pValue);
+	}
+
+	TEST(TEST_CLASS, RemoveAndClearReleaseBudget) {
+		// Arrange:
+		auto settings = CreateSharedBudgetSettings(10);
+		CacheType cache(settings);
+		Insert(cache, "alpha", 123);
+		Insert(cache, "gamma", 777);
+		Insert(cache, "omega", 555);
+
+		// Act + Assert:
+		cache.remove(ToBuffer("alpha"));
+		EXPECT_EQ(2 * Entry_Size, settings.pBudget->size());
+
+		cache.clear();
+		EXPECT_EQ(0u, settings.pBudget->size());
+	}
+
+	// endregion
+
+	// region shared budget
+
+	TEST(TEST_CLASS, CachesSharingBudgetReserveMemoryFromBudget) {
+		// Arrange:
+		auto settings = CreateSharedBudgetSettings(10);
+		CacheType cache1(settings);
+		CacheType cache2(settings);
+
+		// Act:
+		Insert(cache1, "alpha", 123);
+		Insert(cache2, "gamma", 777);
+		Insert(cache2, "omega", 555);
+
+		// Assert:
+		EXPECT_EQ(Entry_Size, cache1.memorySize());
+		EXPECT_EQ(2 * Entry_Size, cache2.memorySize());
+		EXPECT_EQ(3 * Entry_Size, settings.pBudget->size());
+	}
+
+	TEST(TEST_CLASS, CachesSharingBudgetCannotExceedBudget) {
+		// Arrange:
+		auto settings = CreateSharedBudgetSettings(3);
+		CacheType cache1(settings);
+		CacheType cache2(settings);
+
+		// Act: the first cache holds the entire budget
+		Fill(cache1);
+		Fill(cache2);
+
+		// Assert:
+		EXPECT_EQ(3 * CacheType::Num_Shards, cache1.size());
+		EXPECT_EQ(0u, cache2.size());
+		EXPECT_EQ(settings.MaxSize.bytes(), settings.pBudget->size());
+	}
+
+	TEST(TEST_CLASS, InsertEvictsOwnValueWhenSharedBudgetIsExhausted) {
+		// Arrange: cache a single value in the second cache and let the first cache use the remaining budget
+		auto settings = CreateSharedBudgetSettings(3);
+		CacheType cache1(settings);
+		CacheType cache2(settings);
+		auto keys = GenerateSameShardKeys(2);
+		Insert(cache2, keys[0], 0);
+		Fill(cache1);
+
+		// Act:
+		Insert(cache2, keys[1], 1);
+
+		// Assert: the second cache replaced its own value because the first cache's values are not evictable by it
+		EXPECT_EQ(3 * CacheType::Num_Shards - 1, cache1.size());
+		EXPECT_EQ(1u, cache2.size());
+		EXPECT_FALSE(!!cache2.find(ToBuffer(keys[0])));
+		EXPECT_TRUE(!!cache2.find(ToBuffer(keys[1])));
+		EXPECT_EQ(settings.MaxSize.bytes(), settings.pBudget->size());
+	}
+
+	TEST(TEST_CLASS, DestroyingCacheReleasesBudget) {
+		// Arrange:
+		auto settings = CreateSharedBudgetSettings(3);
+		CacheType cache1(settings);
+		{
+			CacheType cache2(settings);
+			Fill(cache2);
+		}
+
+		// Act:
+		Fill(cache1);
+
+		// Assert:
+		EXPECT_EQ(3 * CacheType::Num_Shards, cache1.size());
+		EXPECT_EQ(settings.MaxSize.bytes(), settings.pBudget->size());
+	}
+
+	// endregion
+}}
@@ -0,0 +1,133 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS PatriciaTreeNodeCacheTests
+
+	namespace {
+		using NodePointer = PatriciaTreeNodeCache::NodePointer;
+
+		NodePointer CreateLeafNode(uint32_t path) {
+			auto node = tree::LeafTreeNode(tree::TreeNodePath(path), test::GenerateRandomByteArray<Hash256>());
+			return std::make_shared<const tree::TreeNode>(node);
+		}
+
+		NodePointer CreateBranchNode(uint32_t path) {
+			auto node = tree::BranchTreeNode(tree::TreeNodePath(path));
+			node.setLink(test::GenerateRandomByteArray<Hash256>(), 3);
+			node.setLink(test::GenerateRandomByteArray<Hash256>(), 11);
+			return std::make_shared<const tree::TreeNode>(node);
+		}
+
+		PatriciaTreeNodeCache CreateCache(const std::shared_ptr<DecodedValueCacheStatistics>& pStatistics = nullptr) {
+			return PatriciaTreeNodeCache(utils::FileSize::FromMegabytes(1), pStatistics);
+		}
+	}
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Act:
+		auto cache = CreateCache();
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(0u, cache.memorySize());
+	}
+
+	TEST(TEST_CLASS, CannotFindUnknownNode) {
+		// Arrange:
+		auto cache = CreateCache();
+		cache.insert(CreateLeafNode(0x64'6F'67'00));
+
+		// Act:
+		auto pNode = cache.find(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		EXPECT_FALSE(!!pNode);
+	}
+
+	TEST(TEST_CLASS, CanFindCachedNodesByHash) {
+		// Arrange:
+		auto cache = CreateCache();
+		auto pLeafNode = CreateLeafNode(0x64'6F'67'00);
+		auto pBranchNode = CreateBranchNode(0x64'6F'00'00);
+		cache.insert(pLeafNode);
+		cache.insert(pBranchNode);
+
+		// Act:
+		auto pFoundLeafNode = cache.find(pLeafNode->hash());
+		auto pFoundBranchNode = cache.find(pBranchNode->hash());
+
+		// Assert: the cached nodes are shared and not copied
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_LT(0u, cache.memorySize());
+		EXPECT_EQ(pLeafNode, pFoundLeafNode);
+		EXPECT_EQ(pBranchNode, pFoundBranchNode);
+	}
+
+	TEST(TEST_CLASS, InsertingNodeWithSameHashHasNoEffect) {
+		// Arrange:
+		auto cache = CreateCache();
+		auto pNode = CreateBranchNode(0x64'6F'00'00);
+		cache.insert(pNode);
+
+		// Act:
+		cache.insert(std::make_shared<const tree::TreeNode>(pNode->copy()));
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(pNode, cache.find(pNode->hash()));
+	}
+
+	TEST(TEST_CLASS, CacheSizeIsBounded) {
+		// Arrange:
+		auto cache = PatriciaTreeNodeCache(utils::FileSize::FromKilobytes(32), nullptr);
+
+		// Act:
+		for (auto i = 0u; i < 1000; ++i)
+			cache.insert(CreateBranchNode(i));
+
+		// Assert:
+		EXPECT_LT(0u, cache.size());
+		EXPECT_GT(1000u, cache.size());
+		EXPECT_GE(utils::FileSize::FromKilobytes(32).bytes(), cache.memorySize());
+	}
+
+	TEST(TEST_CLASS, LookupsUpdateStatistics) {
+		// Arrange:
+		auto pStatistics = std::make_shared<DecodedValueCacheStatistics>();
+		auto cache = CreateCache(pStatistics);
+		auto pNode = CreateLeafNode(0x64'6F'67'00);
+		cache.insert(pNode);
+
+		// Act:
+		cache.find(pNode->hash());
+		cache.find(test::GenerateRandomByteArray<Hash256>());
+		cache.find(pNode->hash());
+
+		// Assert:
+		EXPECT_EQ(2u, pStatistics->NumHits);
+		EXPECT_EQ(1u, pStatistics->NumMisses);
+	}
+}}
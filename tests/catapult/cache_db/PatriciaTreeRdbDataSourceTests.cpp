@@ -46,7 +46,7 @@ namespace catapult { namespace cache {
 				return m_dataSource.size();
 			}
 
-			std::unique_ptr<const tree::TreeNode> get(const Hash256& hash) {
+			std::shared_ptr<const tree::TreeNode> get(const Hash256& hash) {
 				return m_dataSource.get(hash);
 			}
 
@@ -73,4 +73,99 @@ namespace catapult { namespace cache {
 	}
 
 	DEFINE_PATRICIA_TREE_DATA_SOURCE_TESTS(RocksDataSourceTraits)
+
+	// region node cache
+
+	namespace {
+		class NodeCacheTestContext {
+		public:
+			NodeCacheTestContext()
+					: m_db(DefaultSettings(m_dbDirGuard.name()))
+					, m_container(m_db, 0)
+					, m_pNodeCache(std::make_shared<PatriciaTreeNodeCache>(utils::FileSize::FromMegabytes(1), nullptr))
+					, m_dataSource(m_container, m_pNodeCache) {
+				m_container.setSize(0);
+			}
+
+		public:
+			auto& nodeCache() {
+				return *m_pNodeCache;
+			}
+
+			auto& dataSource() {
+				return m_dataSource;
+			}
+
+			auto createDataSource() {
+				return PatriciaTreeRdbDataSource(m_container, m_pNodeCache);
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			RocksDatabase m_db;
+			PatriciaTreeContainer m_container;
+			std::shared_ptr<PatriciaTreeNodeCache> m_pNodeCache;
+			PatriciaTreeRdbDataSource m_dataSource;
+		};
+	}
+
+	TEST(TEST_CLASS, SetDoesNotCacheNode) {
+		// Arrange:
+		NodeCacheTestContext context;
+		auto node = tree::BranchTreeNode(tree::TreeNodePath(0x64'6F'67'00));
+
+		// Act:
+		context.dataSource().set(node);
+
+		// Assert:
+		EXPECT_EQ(0u, context.nodeCache().size());
+	}
+
+	TEST(TEST_CLASS, GetCachesFoundNode) {
+		// Arrange:
+		NodeCacheTestContext context;
+		auto node = tree::BranchTreeNode(tree::TreeNodePath(0x64'6F'67'00));
+		context.dataSource().set(node);
+
+		// Act:
+		auto pNode = context.dataSource().get(node.hash());
+
+		// Assert:
+		ASSERT_TRUE(!!pNode);
+		EXPECT_EQ(1u, context.nodeCache().size());
+		EXPECT_EQ(pNode, context.nodeCache().find(node.hash()));
+	}
+
+	TEST(TEST_CLASS, GetDoesNotCacheUnknownNode) {
+		// Arrange:
+		NodeCacheTestContext context;
+
+		// Act:
+		auto pNode = context.dataSource().get(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		EXPECT_FALSE(!!pNode);
+		EXPECT_EQ(0u, context.nodeCache().size());
+	}
+
+	TEST(TEST_CLASS, GetReturnsSharedNodeAcrossDataSources) {
+		// Arrange:
+		NodeCacheTestContext context;
+		auto node = tree::LeafTreeNode(tree::TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>());
+		context.dataSource().set(node);
+		auto otherDataSource = context.createDataSource();
+
+		// Act:
+		auto pNode1 = context.dataSource().get(node.hash());
+		auto pNode2 = context.dataSource().get(node.hash());
+		auto pNode3 = otherDataSource.get(node.hash());
+
+		// Assert: no copies are made
+		ASSERT_TRUE(!!pNode1);
+		EXPECT_EQ(pNode1, pNode2);
+		EXPECT_EQ(pNode1, pNode3);
+		EXPECT_EQ(node.hash(), pNode1->hash());
+	}
+
+	// endregion
 }}
@@ -125,6 +125,7 @@ namespace catapult { namespace cache {
 		public:
 			size_t Size = 0;
 			size_t NumPruned = 0;
+			DecodedValueCacheSettings DecodedValueCache;
 
 			test::ParamsCapture<InsertParamsType> InsertParams;
 			mutable test::ParamsCapture<FindParamsType> FindParams;
@@ -143,6 +144,10 @@ namespace catapult { namespace cache {
 				return m_db.size();
 			}
 
+			const auto& decodedValueCacheSettings() const {
+				return m_db.DecodedValueCache;
+			}
+
 			void insert(const RawBuffer& key, const std::string& value) {
 				m_db.InsertParams.push(key, value);
 			}
@@ -346,4 +351,149 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region decoded value cache
+
+	namespace {
+		auto CreateContainerWithDecodedValueCache(MockDb& db) {
+			db.DecodedValueCache.MaxSize = utils::FileSize::FromKilobytes(64);
+			db.DecodedValueCache.pStatistics = std::make_shared<DecodedValueCacheStatistics>();
+			return CreateContainer(db);
+		}
+
+		const auto* FindAndDereference(const RdbTypedColumnContainer<ColumnDescriptor, MockContainer>& container, const std::string& key) {
+			auto iter = container.find(test::StringKey(key));
+			return container.cend() == iter ? nullptr : &*iter;
+		}
+	}
+
+	TEST(TEST_CLASS, DecodedValuesAreNotCachedWhenCacheIsDisabled) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainer(db);
+
+		// Act:
+		FindAndDereference(container, "hello");
+		FindAndDereference(container, "hello");
+
+		// Assert:
+		EXPECT_EQ(2u, db.FindParams.params().size());
+		EXPECT_EQ(0u, container.numCachedValues());
+	}
+
+	TEST(TEST_CLASS, DecodedValuesAreCachedWhenCacheIsEnabled) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainerWithDecodedValueCache(db);
+
+		// Act:
+		auto iter1 = container.find("hello");
+		const auto& keyValuePair1 = *iter1;
+		auto iter2 = container.find("hello");
+		const auto& keyValuePair2 = *iter2;
+
+		// Assert: second find is served from the cache
+		EXPECT_EQ(1u, db.FindParams.params().size());
+		EXPECT_EQ(1u, container.numCachedValues());
+		EXPECT_NE(container.cend(), iter2);
+		EXPECT_EQ(&keyValuePair1, &keyValuePair2);
+		EXPECT_EQ(54321, keyValuePair2.second.Integer);
+
+		EXPECT_EQ(1u, db.DecodedValueCache.pStatistics->NumHits);
+		EXPECT_EQ(1u, db.DecodedValueCache.pStatistics->NumMisses);
+	}
+
+	TEST(TEST_CLASS, ValuesAreCachedOnlyWhenDereferenced) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainerWithDecodedValueCache(db);
+
+		// Act:
+		container.find("hello");
+		container.find("hello");
+
+		// Assert:
+		EXPECT_EQ(2u, db.FindParams.params().size());
+		EXPECT_EQ(0u, container.numCachedValues());
+
+		EXPECT_EQ(0u, db.DecodedValueCache.pStatistics->NumHits);
+		EXPECT_EQ(2u, db.DecodedValueCache.pStatistics->NumMisses);
+	}
+
+	TEST(TEST_CLASS, MissingValuesAreNotCached) {
+		// Arrange:
+		MockDb db(false);
+		auto container = CreateContainerWithDecodedValueCache(db);
+
+		// Act:
+		auto* pValue1 = FindAndDereference(container, "hello");
+		auto* pValue2 = FindAndDereference(container, "hello");
+
+		// Assert:
+		EXPECT_FALSE(!!pValue1);
+		EXPECT_FALSE(!!pValue2);
+		EXPECT_EQ(2u, db.FindParams.params().size());
+		EXPECT_EQ(0u, container.numCachedValues());
+	}
+
+	TEST(TEST_CLASS, InsertInvalidatesCachedValue) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainerWithDecodedValueCache(db);
+		FindAndDereference(container, "hello");
+		FindAndDereference(container, "world");
+
+		// Act:
+		container.insert(ColumnDescriptor::StorageType("hello", { "hello", 456, 3.1415 }));
+		FindAndDereference(container, "hello");
+		FindAndDereference(container, "world");
+
+		// Assert: only the inserted value was reloaded
+		EXPECT_EQ(3u, db.FindParams.params().size());
+		EXPECT_EQ(2u, container.numCachedValues());
+	}
+
+	TEST(TEST_CLASS, RemoveInvalidatesCachedValue) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainerWithDecodedValueCache(db);
+		FindAndDereference(container, "hello");
+		FindAndDereference(container, "world");
+
+		// Act:
+		container.remove("hello");
+
+		// Assert:
+		EXPECT_EQ(1u, container.numCachedValues());
+	}
+
+	TEST(TEST_CLASS, PruneInvalidatesAllCachedValues) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainerWithDecodedValueCache(db);
+		FindAndDereference(container, "hello");
+		FindAndDereference(container, "world");
+
+		// Act:
+		container.prune("hello");
+
+		// Assert:
+		EXPECT_EQ(0u, container.numCachedValues());
+	}
+
+	TEST(TEST_CLASS, ValueLoadedBeforeInvalidationIsNotCached) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainerWithDecodedValueCache(db);
+		auto iter = container.find("hello");
+
+		// Act: invalidate a value before the loaded value is dereferenced
+		container.remove("world");
+		*iter;
+
+		// Assert:
+		EXPECT_EQ(0u, container.numCachedValues());
+	}
+
+	// endregion
 }}
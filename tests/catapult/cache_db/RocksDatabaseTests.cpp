@@ -120,6 +120,31 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(database.canPrune());
 	}
 
+	TEST(TEST_CLASS, CanOpenDatabaseWithDecodedValueCacheBudget) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+
+		DecodedValueCacheSettings decodedValueCacheSettings;
+		decodedValueCacheSettings.MaxSize = utils::FileSize::FromKilobytes(64);
+		decodedValueCacheSettings.pStatistics = std::make_shared<DecodedValueCacheStatistics>();
+
+		// Act:
+		RocksDatabase database(RocksDatabaseSettings(
+				dbDirGuard.name(),
+				{ "default", "foo" },
+				utils::FileSize(),
+				FilterPruningMode::Disabled,
+				decodedValueCacheSettings));
+
+		// Assert: a single budget is created for (and shared by) all columns of the database
+		const auto& settings = database.decodedValueCacheSettings();
+		EXPECT_EQ(utils::FileSize::FromKilobytes(64), settings.MaxSize);
+		EXPECT_EQ(decodedValueCacheSettings.pStatistics, settings.pStatistics);
+		ASSERT_TRUE(!!settings.pBudget);
+		EXPECT_EQ(utils::FileSize::FromKilobytes(64).bytes(), settings.pBudget->maxSize());
+		EXPECT_EQ(0u, settings.pBudget->size());
+	}
+
 	TEST(TEST_CLASS, CanCreatePlaceholderDatabase) {
 		// Act:
 		RocksDatabase database;
@@ -202,12 +202,17 @@ namespace catapult { namespace cache {
 				m_db.setSize(newSize);
 			}
 
+			const auto& decodedValueCacheSettings() const {
+				return m_decodedValueCacheSettings;
+			}
+
 			size_t prune(uint64_t pruningBoundary) {
 				return m_db.prune(pruningBoundary);
 			}
 
 		private:
 			MockDb& m_db;
+			DecodedValueCacheSettings m_decodedValueCacheSettings;
 		};
 	}
 
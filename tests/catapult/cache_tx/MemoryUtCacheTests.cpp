@@ -534,6 +534,117 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region findTransactions
+
+	namespace {
+		std::vector<utils::ShortHash> ToShortHashes(const std::vector<model::TransactionInfo>& transactionInfos) {
+			std::vector<utils::ShortHash> shortHashes;
+			for (const auto& transactionInfo : transactionInfos)
+				shortHashes.push_back(utils::ToShortHash(transactionInfo.EntityHash));
+
+			return shortHashes;
+		}
+	}
+
+	TEST(TEST_CLASS, FindTransactionsReturnsTransactionsWithMatchingShortHashes) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+
+		// Act: request transactions in a different order than they were added
+		auto transactions = cache.view().findTransactions({
+			utils::ToShortHash(transactionInfos[3].EntityHash),
+			utils::ToShortHash(transactionInfos[0].EntityHash),
+			utils::ToShortHash(transactionInfos[4].EntityHash)
+		});
+
+		// Assert:
+		ASSERT_EQ(3u, transactions.size());
+		EXPECT_EQ(transactionInfos[3].pEntity, transactions[0]);
+		EXPECT_EQ(transactionInfos[0].pEntity, transactions[1]);
+		EXPECT_EQ(transactionInfos[4].pEntity, transactions[2]);
+	}
+
+	TEST(TEST_CLASS, FindTransactionsReturnsNullForUnknownShortHashes) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		{
+			auto modifier = cache.modifier();
+			modifier.add(transactionInfos[0]);
+			modifier.add(transactionInfos[2]);
+		}
+
+		// Act:
+		auto transactions = cache.view().findTransactions(ToShortHashes(transactionInfos));
+
+		// Assert:
+		ASSERT_EQ(5u, transactions.size());
+		EXPECT_EQ(transactionInfos[0].pEntity, transactions[0]);
+		EXPECT_FALSE(!!transactions[1]);
+		EXPECT_EQ(transactionInfos[2].pEntity, transactions[2]);
+		EXPECT_FALSE(!!transactions[3]);
+		EXPECT_FALSE(!!transactions[4]);
+	}
+
+	TEST(TEST_CLASS, FindTransactionsReturnsNullForAmbiguousShortHashes) {
+		// Arrange: give the second transaction the same short hash as the first
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		std::memcpy(transactionInfos[1].EntityHash.data(), transactionInfos[0].EntityHash.data(), sizeof(utils::ShortHash));
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto transactions = cache.view().findTransactions(ToShortHashes(transactionInfos));
+
+		// Assert:
+		ASSERT_EQ(3u, transactions.size());
+		EXPECT_FALSE(!!transactions[0]);
+		EXPECT_FALSE(!!transactions[1]);
+		EXPECT_EQ(transactionInfos[2].pEntity, transactions[2]);
+	}
+
+	TEST(TEST_CLASS, FindTransactionsRespectsRemovedTransactions) {
+		// Arrange: give the second transaction the same short hash as the first
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		std::memcpy(transactionInfos[1].EntityHash.data(), transactionInfos[0].EntityHash.data(), sizeof(utils::ShortHash));
+		test::AddAll(cache, transactionInfos);
+
+		// - remove one of the colliding transactions and one other transaction
+		{
+			auto modifier = cache.modifier();
+			modifier.remove(transactionInfos[0].EntityHash);
+			modifier.remove(transactionInfos[2].EntityHash);
+		}
+
+		// Act:
+		auto transactions = cache.view().findTransactions(ToShortHashes(transactionInfos));
+
+		// Assert: the remaining colliding transaction is no longer ambiguous
+		ASSERT_EQ(3u, transactions.size());
+		EXPECT_EQ(transactionInfos[1].pEntity, transactions[0]);
+		EXPECT_EQ(transactionInfos[1].pEntity, transactions[1]);
+		EXPECT_FALSE(!!transactions[2]);
+	}
+
+	TEST(TEST_CLASS, FindTransactionsRespectsRemoveAll) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		test::AddAll(cache, transactionInfos);
+		cache.modifier().removeAll();
+
+		// Act:
+		auto transactions = cache.view().findTransactions(ToShortHashes(transactionInfos));
+
+		// Assert:
+		EXPECT_EQ(UnknownTransactions(3), transactions);
+	}
+
+	// endregion
+
 	// region unknownTransactions
 
 	namespace {
@@ -64,8 +64,16 @@ namespace catapult { namespace chain {
 					, pIo(std::make_shared<MockPacketIo>())
 					, pChainApi(std::make_shared<MockChainApi>(remoteScore, std::move(pRemoteLastBlock), remoteHashes))
 					, BlockRangeConsumerCalls(0)
-					, Config(CreateConfiguration())
-			{}
+					, Config(CreateConfiguration()) {
+				Monitors.pCompareChains = std::make_shared<utils::LatencyHistogram>();
+				Monitors.pBlocksFrom = std::make_shared<utils::LatencyHistogram>();
+				Monitors.RoundTripTimeConsumer = [this](const auto& identity, const auto&) {
+					RoundTripTimeIdentities.push_back(identity);
+				};
+				Monitors.ThroughputConsumer = [this](const auto& identity, auto numBytes, const auto&) {
+					ThroughputSamples.emplace_back(identity, numBytes);
+				};
+			}
 
 		public:
 			void assertNoCalls() const {
@@ -90,6 +98,9 @@ namespace catapult { namespace chain {
 			std::vector<model::NodeIdentity> BlockRangeSourceIdentities;
 			ChainSynchronizerConfiguration Config;
 			disruptor::ProcessingCompleteFunc ProcessingComplete;
+			ChainSynchronizerMonitors Monitors;
+			std::vector<model::NodeIdentity> RoundTripTimeIdentities;
+			std::vector<std::pair<model::NodeIdentity, uint64_t>> ThroughputSamples;
 		};
 
 		// endregion
@@ -109,7 +120,7 @@ namespace catapult { namespace chain {
 				return ConsumerMode::Normal == mode ? context.BlockRangeConsumerCalls : 0;
 			};
 
-			return CreateChainSynchronizer(pLocal, context.Config, blockRangeConsumer);
+			return CreateChainSynchronizer(pLocal, context.Config, blockRangeConsumer, context.Monitors);
 		}
 
 		disruptor::ConsumerCompletionResult CreateContinueResult() {
@@ -351,6 +362,67 @@ namespace catapult { namespace chain {
 		AssertDefaultSinglePullRequest(*context.pChainApi);
 	}
 
+	namespace {
+		void AssertPullRequestHeights(const mocks::MockChainApi& chainApi, const std::vector<Height>& expectedRequestHeights) {
+			// Assert:
+			ASSERT_EQ(expectedRequestHeights.size(), chainApi.blocksFromRequests().size());
+
+			auto i = 0u;
+			for (const auto& params : chainApi.blocksFromRequests()) {
+				EXPECT_EQ(expectedRequestHeights[i], params.first) << "height of request " << i;
+				++i;
+			}
+		}
+
+		void AssertTargetBlocksPulls(uint32_t targetBlocks, uint32_t maxChainBytes, const std::vector<Height>& expectedRequestHeights) {
+			// Arrange: common block has height 19 (fork depth 0)
+			auto context = CreateTestContextWithHashes(9, 10);
+			context.Config.MaxChainBytesPerSyncAttempt = maxChainBytes;
+			context.Config.TargetBlocksPerSyncAttemptSupplier = [targetBlocks]() { return targetBlocks; };
+			auto synchronizer = CreateSynchronizer(context);
+
+			// Act:
+			auto code = synchronizer(*context.pChainApi).get();
+
+			// Assert: all pulled blocks are forwarded to the consumer in a single range
+			EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+			AssertSync(context, 1);
+			AssertPullRequestHeights(*context.pChainApi, expectedRequestHeights);
+		}
+	}
+
+	TEST(TEST_CLASS, SuccessfulInteractionWithSinglePullWhenTargetBlocksIsZero) {
+		AssertTargetBlocksPulls(0, 1000 * sizeof(BlockHeader), { Height(20) });
+	}
+
+	TEST(TEST_CLASS, SuccessfulInteractionWithMultiplePullsWhenTargetBlocksIsGreaterThanBlocksPerPull) {
+		// Assert: pulls 2 blocks at time: 3 attempts needed to pull 6 blocks
+		AssertTargetBlocksPulls(6, 1000 * sizeof(BlockHeader), { Height(20), Height(22), Height(24) });
+		AssertTargetBlocksPulls(5, 1000 * sizeof(BlockHeader), { Height(20), Height(22), Height(24) });
+	}
+
+	TEST(TEST_CLASS, SuccessfulInteractionWithMultiplePullsStopsWhenMaxChainBytesIsReached) {
+		// Assert: pulls 2 blocks at time: 2 attempts needed to pull 3 block sizes
+		AssertTargetBlocksPulls(10, 3 * sizeof(BlockHeader), { Height(20), Height(22) });
+	}
+
+	TEST(TEST_CLASS, SuccessfulInteractionWithMultiplePullsWhenForkDepthIsGreaterThanTargetBlocks) {
+		// Arrange:
+		// - common block has height 14 = 20 - 9 + 4 - 1 (fork depth 6)
+		// - pulls 2 blocks at time: 3 attempts needed to pull 6 blocks even though target is smaller
+		auto context = CreateTestContextWithHashes(4, 10, 6);
+		context.Config.TargetBlocksPerSyncAttemptSupplier = []() { return 1u; };
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 1);
+		AssertDefaultMultiplePullRequest(*context.pChainApi, { Height(15), Height(17), Height(19) });
+	}
+
 	TEST(TEST_CLASS, ReturnsNotReadyFutureWhenPullingBlocks) {
 		// Arrange:
 		auto context = CreateTestContextWithHashes(9, 10);
@@ -667,6 +739,107 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region monitors
+
+	TEST(TEST_CLASS, RemoteApiCallLatenciesAreRecordedInHistograms) {
+		// Arrange: pulls 2 blocks at time: 3 attempts needed to pull 6 blocks
+		auto context = CreateTestContextWithHashes(4, 10, 6);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(1u, context.Monitors.pCompareChains->snapshot().count());
+		EXPECT_EQ(3u, context.Monitors.pBlocksFrom->snapshot().count());
+	}
+
+	TEST(TEST_CLASS, CompareChainsLatencyIsNotRecordedWhenChainComparisonIsBypassed) {
+		// Arrange: leave the first pulled range unprocessed
+		auto context = CreateTestContextForUnprocessedElementTests();
+		auto synchronizer = CreateSynchronizer(context);
+		synchronizer(*context.pChainApi).get();
+
+		// Act: chain comparison is bypassed because there are unprocessed elements
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(1u, context.Monitors.pCompareChains->snapshot().count());
+		EXPECT_EQ(2u, context.Monitors.pBlocksFrom->snapshot().count());
+	}
+
+	TEST(TEST_CLASS, RemoteApiCallMeasurementsAreForwardedToConsumers) {
+		// Arrange: pulls 2 blocks at time: 3 attempts needed to pull 6 blocks
+		auto context = CreateTestContextWithHashes(4, 10, 6);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		const auto& remoteIdentity = context.pChainApi->remoteIdentity();
+		ASSERT_EQ(1u, context.RoundTripTimeIdentities.size());
+		EXPECT_EQ(remoteIdentity.PublicKey, context.RoundTripTimeIdentities[0].PublicKey);
+		EXPECT_EQ(remoteIdentity.Host, context.RoundTripTimeIdentities[0].Host);
+
+		ASSERT_EQ(3u, context.ThroughputSamples.size());
+		for (const auto& sample : context.ThroughputSamples) {
+			EXPECT_EQ(remoteIdentity.PublicKey, sample.first.PublicKey);
+			EXPECT_EQ(remoteIdentity.Host, sample.first.Host);
+			EXPECT_NE(0u, sample.second);
+		}
+	}
+
+	TEST(TEST_CLASS, RemoteApiCallMeasurementsAreNotForwardedToConsumersWhenCallsFail) {
+		// Arrange:
+		auto context = CreateTestContextWithHashes(4, 10, 6);
+		auto synchronizer = CreateSynchronizer(context);
+		context.pChainApi->setError(MockChainApi::EntryPoint::Blocks_From);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: only the (successful) chain info request was forwarded
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Failure, code);
+		EXPECT_EQ(1u, context.RoundTripTimeIdentities.size());
+		EXPECT_EQ(0u, context.ThroughputSamples.size());
+	}
+
+	TEST(TEST_CLASS, RoundTripTimeIsForwardedToConsumerWhenChainInfoSucceedsAndChainComparisonFails) {
+		// Arrange:
+		auto context = CreateTestContextWithHashes(4, 10, 6);
+		auto synchronizer = CreateSynchronizer(context);
+		context.pChainApi->setError(MockChainApi::EntryPoint::Hashes_From);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: the round trip time is measured for the chain info request only
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Failure, code);
+		EXPECT_EQ(1u, context.RoundTripTimeIdentities.size());
+		EXPECT_EQ(0u, context.ThroughputSamples.size());
+	}
+
+	TEST(TEST_CLASS, RoundTripTimeIsNotForwardedToConsumerWhenChainInfoFails) {
+		// Arrange:
+		auto context = CreateTestContextWithHashes(4, 10, 6);
+		auto synchronizer = CreateSynchronizer(context);
+		context.pChainApi->setError(MockChainApi::EntryPoint::Chain_Info);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Failure, code);
+		EXPECT_EQ(0u, context.RoundTripTimeIdentities.size());
+		EXPECT_EQ(0u, context.ThroughputSamples.size());
+	}
+
+	// endregion
+
 	// region clean shutdown
 
 	TEST(TEST_CLASS, SynchronizerFutureCanCompleteAfterSynchronizerIsDestroyed) {
@@ -325,6 +325,45 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region disableValidation
+
+	TEST(TEST_CLASS, NotificationsAreOnlyObservedWhenValidationIsDisabled) {
+		// Arrange:
+		TestContext context;
+		context.setValidationResult(ValidationResult::Failure);
+		context.sub().disableValidation();
+		auto notification1 = test::CreateNotification(Notification_Type_Validator);
+		auto notification2 = test::CreateNotification(Notification_Type_All);
+
+		// Act: process two notifications
+		context.sub().notify(notification1);
+		context.sub().notify(notification2);
+
+		// Assert: validator is bypassed, so failure does not short-circuit observer
+		EXPECT_EQ(ValidationResult::Success, context.sub().result());
+		context.assertValidatorCalls({});
+		context.assertObserverCalls({ Notification_Type_All });
+	}
+
+	TEST(TEST_CLASS, CanUndoNotificationsWhenValidationIsDisabled) {
+		// Arrange:
+		TestContext context;
+		context.sub().enableUndo();
+		context.sub().disableValidation();
+		auto notification = test::CreateNotification(Notification_Type_All);
+
+		// Act: process notification and undo it
+		context.sub().notify(notification);
+		context.sub().undo();
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Success, context.sub().result());
+		context.assertValidatorCalls({});
+		context.assertObserverCalls({ Notification_Type_All, Notification_Type_All }, 1);
+	}
+
+	// endregion
+
 	// region undo
 
 	TEST(TEST_CLASS, CannotUndoWhenUndoIsNotEnabled) {
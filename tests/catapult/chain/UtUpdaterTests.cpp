@@ -142,6 +142,11 @@ namespace catapult { namespace chain {
 							},
 							[this, throttleMode](const auto& transactionInfo, const auto& context) {
 								m_throttleParams.emplace_back(transactionInfo, context);
+								if (m_hasThrottleException && m_throttleExceptionDeadline == transactionInfo.pEntity->Deadline) {
+									m_hasThrottleException = false;
+									CATAPULT_THROW_RUNTIME_ERROR("throttle exception");
+								}
+
 								return ThrottleMode::Even == throttleMode && (0 == transactionInfo.pEntity->Deadline.unwrap() % 2);
 							})
 			{}
@@ -167,6 +172,16 @@ namespace catapult { namespace chain {
 				m_utChangeSubscriber.reset();
 			}
 
+			void setThrottleException(Timestamp deadline) {
+				// throttle throws (once) when called with the transaction with the specified deadline
+				m_hasThrottleException = true;
+				m_throttleExceptionDeadline = deadline;
+			}
+
+			const std::vector<model::TransactionStatus>& failedTransactionStatuses() const {
+				return m_failedTransactionStatuses;
+			}
+
 		private:
 			bool isRollbackExecution(size_t index) const {
 				// MockExecutionConfiguration is configured to create two notifications for each entity
@@ -471,6 +486,8 @@ namespace catapult { namespace chain {
 			std::unordered_set<size_t> m_partialUndoFailureIndexes;
 			std::vector<model::TransactionStatus> m_failedTransactionStatuses;
 			std::vector<ThrottleParams> m_throttleParams;
+			bool m_hasThrottleException = false;
+			Timestamp m_throttleExceptionDeadline;
 		};
 
 		struct TransactionData {
@@ -1063,4 +1080,171 @@ namespace catapult { namespace chain {
 	}
 
 	// endregion
+
+	// region update (incremental rebase)
+
+	namespace {
+		std::vector<UnresolvedAddress> SetExtractedAddresses(TransactionData& data, const std::vector<std::vector<size_t>>& addressIds) {
+			auto numAddresses = 0u;
+			for (const auto& ids : addressIds)
+				numAddresses = std::max<uint32_t>(numAddresses, *std::max_element(ids.cbegin(), ids.cend()) + 1);
+
+			auto addresses = test::GenerateRandomDataVector<UnresolvedAddress>(numAddresses);
+			for (auto i = 0u; i < addressIds.size(); ++i) {
+				auto pAddresses = std::make_shared<model::UnresolvedAddressSet>();
+				for (auto id : addressIds[i])
+					pAddresses->insert(addresses[id]);
+
+				data.UtInfos[i].OptionalExtractedAddresses = pAddresses;
+			}
+
+			return addresses;
+		}
+	}
+
+	TEST(TEST_CLASS, IncrementalRebaseOnlyRevalidatesOriginalTransactionsAffectedByChangedAddresses) {
+		// Arrange: initialize the UT cache with 4 (unexpired) transactions with distinct addresses
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(4, 32);
+		auto addresses = SetExtractedAddresses(originalTransactionData, { { 0 }, { 1 }, { 2 }, { 3 } });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// Act: change a single account
+		context.updater().update({}, {}, { addresses[2] });
+
+		// Assert: all transactions are still in the cache
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+
+		// - only the affected transaction was validated but all transactions were observed
+		context.assertEntityInfos(originalTransactionData.EntityInfos, { 2, 2 }, { 0, 0, 1, 1, 2, 2, 3, 3 });
+
+		context.assertSubscriberCalls({});
+	}
+
+	TEST(TEST_CLASS, IncrementalRebaseRevalidatesOriginalTransactionsAffectedByRevalidatedTransactions) {
+		// Arrange: initialize the UT cache with 4 transactions where transaction 1 and 3 share an account
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(4, 32);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		auto addresses = SetExtractedAddresses(originalTransactionData, { { 0 }, { 1, 4 }, { 2 }, { 3, 4 } });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// - fail validation of (affected) transaction 1
+		context.setValidationResult(ValidationResult::Neutral, originalHashes[1], 1);
+
+		// Act: change the account of transaction 1
+		context.updater().update({}, {}, { addresses[1] });
+
+		// Assert: the failed transaction was removed
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 0, 2, 3 }));
+
+		// - transaction 3 was revalidated because it shares an account with transaction 1
+		//   E[0] O,O; E[1] V(neutral); E[2] O,O; E[3] V,O,V,O
+		context.assertEntityInfos(originalTransactionData.EntityInfos, { 1, 3, 3 }, { 0, 0, 2, 2, 3, 3 });
+
+		context.assertSubscriberCalls({}, { 1089 });
+	}
+
+	TEST(TEST_CLASS, IncrementalRebaseRevalidatesOriginalTransactionsAffectedByRevertedTransactions) {
+		// Arrange: initialize the UT cache with 2 transactions
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(2, 32);
+		SetExtractedAddresses(originalTransactionData, { { 0 }, { 1 } });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// - prepare a reverted transaction that shares an account with the first original transaction
+		auto transactionData = CreateTransactionData(1);
+		transactionData.UtInfos[0].OptionalExtractedAddresses = originalTransactionData.UtInfos[0].OptionalExtractedAddresses;
+
+		// Act:
+		context.updater().update({}, transactionData.UtInfos, {});
+
+		// Assert: the cache contains original and reverted transactions
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+		test::AssertContainsAll(context.transactionsCache(), transactionData.Hashes);
+
+		// - the reverted transaction and the affected original transaction were validated
+		context.assertEntityInfos(
+				ConcatContainers(transactionData.EntityInfos, originalTransactionData.EntityInfos),
+				{ 0, 0, 1, 1 },
+				{ 0, 0, 1, 1, 2, 2 });
+
+		context.assertSubscriberCalls({ 0 });
+	}
+
+	TEST(TEST_CLASS, IncrementalRebaseRevalidatesExpiredOriginalTransactions) {
+		// Arrange: initialize the UT cache with 3 transactions (deadlines 900, 961 and 1024)
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3, 30);
+		SetExtractedAddresses(originalTransactionData, { { 0 }, { 1 }, { 2 } });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// Act:
+		context.updater().update({}, {}, {});
+
+		// Assert: transactions with deadlines before the current time (987) were revalidated
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		context.assertEntityInfos(originalTransactionData.EntityInfos, { 0, 0, 1, 1 }, { 0, 0, 1, 1, 2, 2 });
+
+		context.assertSubscriberCalls({});
+	}
+
+	TEST(TEST_CLASS, IncrementalRebaseDoesNotAddCommittedOriginalTransactionsToCache) {
+		// Arrange: initialize the UT cache with 4 transactions
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(4, 32);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		SetExtractedAddresses(originalTransactionData, { { 0 }, { 1 }, { 2 }, { 3 } });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// Act:
+		context.updater().update({ &originalHashes[1] }, {}, {});
+
+		// Assert: the committed original transaction was filtered out and none were revalidated
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 0, 2, 3 }));
+
+		auto unconfirmedEntityInfos = Select(originalTransactionData.EntityInfos, { 0, 2, 3 });
+		context.assertEntityInfos(unconfirmedEntityInfos, std::vector<size_t>(), { 0, 0, 1, 1, 2, 2 });
+
+		context.assertSubscriberCalls({}, { 1089 });
+	}
+
+	TEST(TEST_CLASS, IncrementalRebaseFallbackReportsEachFailedTransactionOnce) {
+		// Arrange: initialize the UT cache with 4 transactions with distinct addresses
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(4, 32);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		auto addresses = SetExtractedAddresses(originalTransactionData, { { 0 }, { 1 }, { 2 }, { 3 } });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// - fail validation of (affected) transaction 1 and throw when processing transaction 3 in the incremental rebase
+		context.setValidationResult(ValidationResult::Failure, originalHashes[1], 1);
+		context.setThrottleException(Timestamp(35 * 35));
+
+		// Act: change the account of transaction 1
+		context.updater().update({}, {}, { addresses[1] });
+
+		// Assert: the failed transaction was removed by the full rebase
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 0, 2, 3 }));
+
+		// - the failure was raised by both rebases but only reported once
+		const auto& failedTransactionStatuses = context.failedTransactionStatuses();
+		ASSERT_EQ(1u, failedTransactionStatuses.size());
+		EXPECT_EQ(originalHashes[1], failedTransactionStatuses[0].Hash);
+		EXPECT_EQ(Timestamp(33 * 33), failedTransactionStatuses[0].Deadline);
+		EXPECT_EQ(ValidationResult::Failure, ValidationResult(failedTransactionStatuses[0].Status));
+	}
+
+	// endregion
 }}
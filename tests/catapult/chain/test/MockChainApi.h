@@ -39,6 +39,7 @@ namespace catapult { namespace mocks {
 			Last_Block,
 			Block_At,
 			Blocks_From,
+			Compact_Block,
 			None
 		};
 
@@ -102,6 +103,11 @@ namespace catapult { namespace mocks {
 			return m_blocksFromRequests;
 		}
 
+		/// Gets the vector of blocks that were passed to the compact block requests.
+		const std::vector<std::shared_ptr<const model::Block>>& compactBlockRequests() const {
+			return m_compactBlockRequests;
+		}
+
 		/// Sets the number of blocks (\a numBlocksPerBlocksFromRequest) to return for multiple blocks-from requests.
 		/// \note The last value will be repeated indefinitely.
 		void setNumBlocksPerBlocksFromRequest(const std::vector<uint32_t>& numBlocksPerBlocksFromRequest) {
@@ -168,6 +174,19 @@ namespace catapult { namespace mocks {
 			return CreateFutureResponse(createRange(height, numBlocks));
 		}
 
+		/// Reconstructs a compact block and throws if the error entry point is set to Compact_Block.
+		/// \note The \a pBlock parameter is captured and an empty range of missing transaction indexes is always returned.
+		thread::future<model::EntityRange<uint32_t>> compactBlock(
+				const std::shared_ptr<const model::Block>& pBlock,
+				const std::vector<utils::ShortHash>&,
+				const std::vector<uint32_t>&) const override {
+			m_compactBlockRequests.push_back(pBlock);
+			if (shouldRaiseException(EntryPoint::Compact_Block))
+				return CreateFutureException<model::EntityRange<uint32_t>>("compact block error has been set");
+
+			return CreateFutureResponse(model::EntityRange<uint32_t>());
+		}
+
 	private:
 		bool shouldRaiseException(EntryPoint entryPoint) const {
 			return m_errorEntryPoint == entryPoint;
@@ -219,6 +238,7 @@ namespace catapult { namespace mocks {
 		mutable std::vector<Height> m_blockAtRequests;
 		mutable std::vector<std::pair<Height, uint32_t>> m_hashesFromRequests;
 		mutable std::vector<std::pair<Height, const api::BlocksFromOptions>> m_blocksFromRequests;
+		mutable std::vector<std::shared_ptr<const model::Block>> m_compactBlockRequests;
 		mutable std::list<uint32_t> m_numBlocksPerBlocksFromRequest;
 
 		utils::TimeSpan m_apiDelay;
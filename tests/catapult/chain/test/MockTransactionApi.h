@@ -30,7 +30,8 @@ namespace catapult { namespace mocks {
 	public:
 		enum class EntryPoint {
 			None,
-			Unconfirmed_Transactions
+			Unconfirmed_Transactions,
+			Unknown_Transaction_Hashes
 		};
 
 	public:
@@ -52,6 +53,11 @@ namespace catapult { namespace mocks {
 			return m_utRequests;
 		}
 
+		/// Gets a vector of parameters that were passed to the unknown transaction hashes requests.
+		const auto& unknownTransactionHashesRequests() const {
+			return m_unknownTransactionHashesRequests;
+		}
+
 	public:
 		/// Gets the configured unconfirmed transactions and throws if the error entry point is set to Unconfirmed_Transactions.
 		/// \note The \a minFeeMultiplier and \a knownShortHashes parameters are captured.
@@ -65,6 +71,21 @@ namespace catapult { namespace mocks {
 			return thread::make_ready_future(model::TransactionRange::CopyRange(m_transactions));
 		}
 
+		/// Gets the hashes of all announced transactions and throws if the error entry point is set to Unknown_Transaction_Hashes.
+		/// \note The \a transactions parameter is captured.
+		thread::future<model::HashRange> unknownTransactionHashes(model::AnnouncedTransactionRange&& transactions) const override {
+			auto hashes = model::HashRange::PrepareFixed(transactions.size());
+			auto hashesIter = hashes.begin();
+			for (const auto& transaction : transactions)
+				*hashesIter++ = transaction.EntityHash;
+
+			m_unknownTransactionHashesRequests.push_back(std::move(transactions));
+			if (shouldRaiseException(EntryPoint::Unknown_Transaction_Hashes))
+				return CreateFutureException<model::HashRange>("unknown transaction hashes error has been set");
+
+			return thread::make_ready_future(std::move(hashes));
+		}
+
 	private:
 		bool shouldRaiseException(EntryPoint entryPoint) const {
 			return m_errorEntryPoint == entryPoint;
@@ -79,5 +100,6 @@ namespace catapult { namespace mocks {
 		model::TransactionRange m_transactions;
 		EntryPoint m_errorEntryPoint;
 		mutable std::vector<std::pair<BlockFeeMultiplier, model::ShortHashRange>> m_utRequests;
+		mutable std::vector<model::AnnouncedTransactionRange> m_unknownTransactionHashesRequests;
 	};
 }}
@@ -99,12 +99,21 @@ namespace catapult { namespace config {
 			EXPECT_FALSE(config.EnableSingleThreadPool);
 			EXPECT_TRUE(config.EnableCacheDatabaseStorage);
 			EXPECT_TRUE(config.EnableAutoSyncCleanup);
+			EXPECT_FALSE(config.EnableIncrementalUtRebase);
 
 			EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
 
+			EXPECT_FALSE(config.EnableTransactionAnnouncements);
+			EXPECT_EQ(8u, config.MaxTransactionAnnouncementFanOut);
+			EXPECT_EQ(10'000u, config.MaxKnownTransactionHashesPerPeer);
+			EXPECT_FALSE(config.EnableCompactBlockRelay);
+
 			EXPECT_EQ(42u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_FALSE(config.EnableAdaptiveSync);
+			EXPECT_EQ(utils::TimeSpan::FromMilliseconds(100), config.AdaptiveSyncMinDelay);
+			EXPECT_EQ(8u, config.MaxAdaptiveSyncBatchMultiplier);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -123,6 +132,15 @@ namespace catapult { namespace config {
 			EXPECT_EQ(100u, config.SocketWorkingBufferSensitivity);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(150), config.MaxPacketDataSize);
 
+			EXPECT_FALSE(config.EnableTlsSessionResumption);
+			EXPECT_EQ(1'000u, config.MaxTlsSessionCacheSize);
+			EXPECT_EQ(1'000u, config.MaxVerifiedCertificateCacheSize);
+
+			EXPECT_FALSE(config.EnableFairShareReads);
+			EXPECT_EQ(utils::TimeSpan::FromSeconds(1), config.FairShareReadInterval);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(1), config.FairShareReadMinSize);
+			EXPECT_EQ(8u, config.FairShareReadPriorityWeight);
+
 			EXPECT_EQ(4096u, config.BlockDisruptorSize);
 			EXPECT_EQ(1u, config.BlockElementTraceInterval);
 			EXPECT_EQ(16384u, config.TransactionDisruptorSize);
@@ -130,8 +148,14 @@ namespace catapult { namespace config {
 
 			EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 			EXPECT_TRUE(config.EnableDispatcherInputAuditing);
+			EXPECT_FALSE(config.EnableTracing);
 
+			EXPECT_EQ(8u, config.MaxCacheCommitThreads);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.MaxCacheDatabaseWriteBatchSize);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(16), config.MaxCacheDatabaseDecodedValuesSize);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(32), config.MaxCacheDatabasePatriciaTreeNodesSize);
+			EXPECT_EQ(1'000u, config.MaxStatePathsKeys);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(64), config.MaxSpoolSegmentSize);
 			EXPECT_EQ(5'000u, config.MaxTrackedNodes);
 
 			EXPECT_EQ("/dev/urandom", config.BatchVerificationRandomSource);
@@ -173,6 +197,8 @@ namespace catapult { namespace config {
 			// - console (basic)
 			EXPECT_EQ(utils::LogSinkType::Sync, config.Console.SinkType);
 			EXPECT_EQ(utils::LogLevel::Info, config.Console.Level);
+			EXPECT_EQ(65'536u, config.Console.QueueCapacity);
+			EXPECT_EQ(utils::LogOverflowPolicy::Block, config.Console.OverflowPolicy);
 			EXPECT_TRUE(config.Console.ComponentLevels.empty());
 
 			// - console (specific)
@@ -181,6 +207,8 @@ namespace catapult { namespace config {
 			// - file (basic)
 			EXPECT_EQ(utils::LogSinkType::Async, config.File.SinkType);
 			EXPECT_EQ(expectedFileLogLevel, config.File.Level);
+			EXPECT_EQ(65'536u, config.File.QueueCapacity);
+			EXPECT_EQ(utils::LogOverflowPolicy::Block, config.File.OverflowPolicy);
 			EXPECT_TRUE(config.File.ComponentLevels.empty());
 
 			// - file (specific)
@@ -38,6 +38,8 @@ namespace catapult { namespace config {
 						{
 							{ "sinkType", "Async" },
 							{ "level", "Warning" },
+							{ "queueCapacity", "1024" },
+							{ "overflowPolicy", "Drop" },
 							{ "colorMode", "AnsiBold" }
 						}
 					},
@@ -53,6 +55,8 @@ namespace catapult { namespace config {
 						{
 							{ "sinkType", "Sync" },
 							{ "level", "Fatal" },
+							{ "queueCapacity", "4096" },
+							{ "overflowPolicy", "Block" },
 							{ "directory", "foo" },
 							{ "filePattern", "bar%4N.log" },
 							{ "rotationSize", "123KB" },
@@ -79,6 +83,8 @@ namespace catapult { namespace config {
 				// Assert:
 				EXPECT_EQ(utils::LogSinkType::Sync, config.SinkType);
 				EXPECT_EQ(utils::LogLevel::Trace, config.Level);
+				EXPECT_EQ(0u, config.QueueCapacity);
+				EXPECT_EQ(utils::LogOverflowPolicy::Block, config.OverflowPolicy);
 				EXPECT_TRUE(config.ComponentLevels.empty());
 			}
 
@@ -114,6 +120,8 @@ namespace catapult { namespace config {
 				// - console (basic)
 				EXPECT_EQ(utils::LogSinkType::Async, config.Console.SinkType);
 				EXPECT_EQ(utils::LogLevel::Warning, config.Console.Level);
+				EXPECT_EQ(1024u, config.Console.QueueCapacity);
+				EXPECT_EQ(utils::LogOverflowPolicy::Drop, config.Console.OverflowPolicy);
 				EXPECT_EQ(expectedConsoleComponentLevels, config.Console.ComponentLevels);
 
 				// - console (specific)
@@ -122,6 +130,8 @@ namespace catapult { namespace config {
 				// - file (basic)
 				EXPECT_EQ(utils::LogSinkType::Sync, config.File.SinkType);
 				EXPECT_EQ(utils::LogLevel::Fatal, config.File.Level);
+				EXPECT_EQ(4096u, config.File.QueueCapacity);
+				EXPECT_EQ(utils::LogOverflowPolicy::Block, config.File.OverflowPolicy);
 				EXPECT_EQ(expectedFileComponentLevels, config.File.ComponentLevels);
 
 				// - file (specific)
@@ -155,6 +165,8 @@ namespace catapult { namespace config {
 		// Assert:
 		EXPECT_EQ(utils::LogSinkType::Async, options.SinkType);
 		EXPECT_EQ(utils::LogColorMode::AnsiBold, options.ColorMode);
+		EXPECT_EQ(1024u, options.QueueCapacity);
+		EXPECT_EQ(utils::LogOverflowPolicy::Drop, options.OverflowPolicy);
 	}
 
 	TEST(TEST_CLASS, CanMapToFileLoggerOptions) {
@@ -167,6 +179,8 @@ namespace catapult { namespace config {
 		// Assert:
 		EXPECT_EQ(utils::LogSinkType::Sync, options.SinkType);
 		EXPECT_EQ(utils::LogColorMode::None, options.ColorMode);
+		EXPECT_EQ(4096u, options.QueueCapacity);
+		EXPECT_EQ(utils::LogOverflowPolicy::Block, options.OverflowPolicy);
 
 		EXPECT_EQ("foo", options.Directory);
 		EXPECT_EQ("bar%4N.log", options.FilePattern);
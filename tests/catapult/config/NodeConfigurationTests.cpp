@@ -43,12 +43,21 @@ namespace catapult { namespace config {
 							{ "enableSingleThreadPool", "true" },
 							{ "enableCacheDatabaseStorage", "true" },
 							{ "enableAutoSyncCleanup", "true" },
+							{ "enableIncrementalUtRebase", "true" },
 
 							{ "enableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
 
+							{ "enableTransactionAnnouncements", "true" },
+							{ "maxTransactionAnnouncementFanOut", "7" },
+							{ "maxKnownTransactionHashesPerPeer", "4'321" },
+							{ "enableCompactBlockRelay", "true" },
+
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "enableAdaptiveSync", "true" },
+							{ "adaptiveSyncMinDelay", "250ms" },
+							{ "maxAdaptiveSyncBatchMultiplier", "6" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -67,6 +76,15 @@ namespace catapult { namespace config {
 							{ "socketWorkingBufferSensitivity", "6225" },
 							{ "maxPacketDataSize", "10MB" },
 
+							{ "enableTlsSessionResumption", "true" },
+							{ "maxTlsSessionCacheSize", "321" },
+							{ "maxVerifiedCertificateCacheSize", "654" },
+
+							{ "enableFairShareReads", "true" },
+							{ "fairShareReadInterval", "750ms" },
+							{ "fairShareReadMinSize", "384KB" },
+							{ "fairShareReadPriorityWeight", "5" },
+
 							{ "blockDisruptorSize", "1000" },
 							{ "blockElementTraceInterval", "34" },
 							{ "transactionDisruptorSize", "9876" },
@@ -74,8 +92,14 @@ namespace catapult { namespace config {
 
 							{ "enableDispatcherAbortWhenFull", "true" },
 							{ "enableDispatcherInputAuditing", "true" },
+							{ "enableTracing", "true" },
 
+							{ "maxCacheCommitThreads", "6" },
 							{ "maxCacheDatabaseWriteBatchSize", "17KB" },
+							{ "maxCacheDatabaseDecodedValuesSize", "9MB" },
+							{ "maxCacheDatabasePatriciaTreeNodesSize", "11MB" },
+							{ "maxStatePathsKeys", "321" },
+							{ "maxSpoolSegmentSize", "3MB" },
 							{ "maxTrackedNodes", "222" },
 
 							{ "batchVerificationRandomSource", "/dev/random" },
@@ -142,12 +166,21 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.EnableSingleThreadPool);
 				EXPECT_FALSE(config.EnableCacheDatabaseStorage);
 				EXPECT_FALSE(config.EnableAutoSyncCleanup);
+				EXPECT_FALSE(config.EnableIncrementalUtRebase);
 
 				EXPECT_FALSE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
 
+				EXPECT_FALSE(config.EnableTransactionAnnouncements);
+				EXPECT_EQ(0u, config.MaxTransactionAnnouncementFanOut);
+				EXPECT_EQ(0u, config.MaxKnownTransactionHashesPerPeer);
+				EXPECT_FALSE(config.EnableCompactBlockRelay);
+
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_FALSE(config.EnableAdaptiveSync);
+				EXPECT_EQ(utils::TimeSpan::FromMilliseconds(0), config.AdaptiveSyncMinDelay);
+				EXPECT_EQ(0u, config.MaxAdaptiveSyncBatchMultiplier);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -166,6 +199,15 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.SocketWorkingBufferSensitivity);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxPacketDataSize);
 
+				EXPECT_FALSE(config.EnableTlsSessionResumption);
+				EXPECT_EQ(0u, config.MaxTlsSessionCacheSize);
+				EXPECT_EQ(0u, config.MaxVerifiedCertificateCacheSize);
+
+				EXPECT_FALSE(config.EnableFairShareReads);
+				EXPECT_EQ(utils::TimeSpan::FromSeconds(0), config.FairShareReadInterval);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.FairShareReadMinSize);
+				EXPECT_EQ(0u, config.FairShareReadPriorityWeight);
+
 				EXPECT_EQ(0u, config.BlockDisruptorSize);
 				EXPECT_EQ(0u, config.BlockElementTraceInterval);
 				EXPECT_EQ(0u, config.TransactionDisruptorSize);
@@ -173,8 +215,14 @@ namespace catapult { namespace config {
 
 				EXPECT_FALSE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_FALSE(config.EnableDispatcherInputAuditing);
+				EXPECT_FALSE(config.EnableTracing);
 
+				EXPECT_EQ(0u, config.MaxCacheCommitThreads);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxCacheDatabaseWriteBatchSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxCacheDatabaseDecodedValuesSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxCacheDatabasePatriciaTreeNodesSize);
+				EXPECT_EQ(0u, config.MaxStatePathsKeys);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxSpoolSegmentSize);
 				EXPECT_EQ(0u, config.MaxTrackedNodes);
 
 				EXPECT_EQ("", config.BatchVerificationRandomSource);
@@ -218,12 +266,21 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.EnableSingleThreadPool);
 				EXPECT_TRUE(config.EnableCacheDatabaseStorage);
 				EXPECT_TRUE(config.EnableAutoSyncCleanup);
+				EXPECT_TRUE(config.EnableIncrementalUtRebase);
 
 				EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
 
+				EXPECT_TRUE(config.EnableTransactionAnnouncements);
+				EXPECT_EQ(7u, config.MaxTransactionAnnouncementFanOut);
+				EXPECT_EQ(4'321u, config.MaxKnownTransactionHashesPerPeer);
+				EXPECT_TRUE(config.EnableCompactBlockRelay);
+
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_TRUE(config.EnableAdaptiveSync);
+				EXPECT_EQ(utils::TimeSpan::FromMilliseconds(250), config.AdaptiveSyncMinDelay);
+				EXPECT_EQ(6u, config.MaxAdaptiveSyncBatchMultiplier);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -242,6 +299,15 @@ namespace catapult { namespace config {
 				EXPECT_EQ(6225u, config.SocketWorkingBufferSensitivity);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(10), config.MaxPacketDataSize);
 
+				EXPECT_TRUE(config.EnableTlsSessionResumption);
+				EXPECT_EQ(321u, config.MaxTlsSessionCacheSize);
+				EXPECT_EQ(654u, config.MaxVerifiedCertificateCacheSize);
+
+				EXPECT_TRUE(config.EnableFairShareReads);
+				EXPECT_EQ(utils::TimeSpan::FromMilliseconds(750), config.FairShareReadInterval);
+				EXPECT_EQ(utils::FileSize::FromKilobytes(384), config.FairShareReadMinSize);
+				EXPECT_EQ(5u, config.FairShareReadPriorityWeight);
+
 				EXPECT_EQ(1000u, config.BlockDisruptorSize);
 				EXPECT_EQ(34u, config.BlockElementTraceInterval);
 				EXPECT_EQ(9876u, config.TransactionDisruptorSize);
@@ -249,8 +315,14 @@ namespace catapult { namespace config {
 
 				EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_TRUE(config.EnableDispatcherInputAuditing);
+				EXPECT_TRUE(config.EnableTracing);
 
+				EXPECT_EQ(6u, config.MaxCacheCommitThreads);
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.MaxCacheDatabaseWriteBatchSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(9), config.MaxCacheDatabaseDecodedValuesSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(11), config.MaxCacheDatabasePatriciaTreeNodesSize);
+				EXPECT_EQ(321u, config.MaxStatePathsKeys);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(3), config.MaxSpoolSegmentSize);
 				EXPECT_EQ(222u, config.MaxTrackedNodes);
 
 				EXPECT_EQ("/dev/random", config.BatchVerificationRandomSource);
@@ -22,6 +22,7 @@
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/cache_core/BlockStatisticCache.h"
 #include "catapult/io/BlockStorageCache.h"
+#include "catapult/model/Address.h"
 #include "catapult/model/ChainScore.h"
 #include "tests/catapult/consumers/test/ConsumerInputFactory.h"
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
@@ -276,14 +277,21 @@ namespace catapult { namespace consumers {
 
 		struct TransactionsChangeParams {
 		public:
-			TransactionsChangeParams(const HashSet& addedTransactionHashes, const HashSet& revertedTransactionHashes)
+			TransactionsChangeParams(
+					const HashSet& addedTransactionHashes,
+					const HashSet& revertedTransactionHashes,
+					const model::UnresolvedAddressSet* pChangedAddresses)
 					: AddedTransactionHashes(addedTransactionHashes)
 					, RevertedTransactionHashes(revertedTransactionHashes)
+					, HasChangedAddresses(!!pChangedAddresses)
+					, ChangedAddresses(pChangedAddresses ? *pChangedAddresses : model::UnresolvedAddressSet())
 			{}
 
 		public:
 			const HashSet AddedTransactionHashes;
 			const HashSet RevertedTransactionHashes;
+			const bool HasChangedAddresses;
+			const model::UnresolvedAddressSet ChangedAddresses;
 		};
 
 		class MockTransactionsChange : public test::ParamsCapture<TransactionsChangeParams> {
@@ -291,7 +299,8 @@ namespace catapult { namespace consumers {
 			void operator()(const TransactionsChangeInfo& changeInfo) const {
 				TransactionsChangeParams params(
 						CopyHashes(changeInfo.AddedTransactionHashes),
-						CopyHashes(changeInfo.RevertedTransactionInfos));
+						CopyHashes(changeInfo.RevertedTransactionInfos),
+						changeInfo.pChangedAddresses);
 				const_cast<MockTransactionsChange*>(this)->push(std::move(params));
 			}
 
@@ -902,6 +911,13 @@ namespace catapult { namespace consumers {
 					add(elementIndex, test::GenerateRandomTransaction(), test::GenerateRandomByteArray<Hash256>());
 			}
 
+			void addRandomWithExtractedAddresses(size_t elementIndex, const UnresolvedAddress& address) {
+				addRandom(elementIndex, 1);
+				auto pAddresses = std::make_shared<model::UnresolvedAddressSet>();
+				pAddresses->insert(address);
+				m_input.blocks()[elementIndex].Transactions.back().OptionalExtractedAddresses = pAddresses;
+			}
+
 			void addFromStorage(size_t elementIndex, const io::BlockStorageCache& storage, Height height, size_t txIndex) {
 				auto pBlockElement = storage.view().loadBlockElement(height);
 
@@ -976,6 +992,56 @@ namespace catapult { namespace consumers {
 		AssertHashesAreEqual(builder.hashes(), txChangeParams.AddedTransactionHashes);
 
 		EXPECT_TRUE(txChangeParams.RevertedTransactionHashes.empty());
+
+		// - changed addresses are unknown because no addresses were extracted
+		EXPECT_FALSE(txChangeParams.HasChangedAddresses);
+	}
+
+	namespace {
+		UnresolvedAddress ToUnresolvedAddress(const Key& publicKey, model::NetworkIdentifier networkIdentifier) {
+			auto address = model::PublicKeyToAddress(publicKey, networkIdentifier);
+
+			UnresolvedAddress unresolvedAddress;
+			std::memcpy(unresolvedAddress.data(), address.data(), address.size());
+			return unresolvedAddress;
+		}
+	}
+
+	TEST(TEST_CLASS, CanSyncCompatibleChains_TransactionNotificationWithChangedAddresses) {
+		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 8-9
+		ConsumerTestContext context;
+		context.seedStorage(Height(7), 3);
+		auto input = CreateInput(Height(8), 2);
+
+		// - add transactions with extracted addresses to the input
+		auto addresses = test::GenerateRandomDataVector<UnresolvedAddress>(3);
+		InputTransactionBuilder builder(input);
+		builder.addRandomWithExtractedAddresses(0, addresses[0]);
+		builder.addRandomWithExtractedAddresses(1, addresses[1]);
+		builder.addRandomWithExtractedAddresses(1, addresses[2]);
+
+		// - all block signers and beneficiaries are also changed
+		model::UnresolvedAddressSet expectedChangedAddresses(addresses.cbegin(), addresses.cend());
+		for (const auto& blockElement : input.blocks()) {
+			const auto& block = blockElement.Block;
+			expectedChangedAddresses.insert(ToUnresolvedAddress(block.SignerPublicKey, block.Network));
+			expectedChangedAddresses.insert(ToUnresolvedAddress(block.BeneficiaryPublicKey, block.Network));
+		}
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert:
+		test::AssertContinued(result);
+
+		ASSERT_EQ(1u, context.TransactionsChange.params().size());
+		const auto& txChangeParams = context.TransactionsChange.params()[0];
+
+		EXPECT_EQ(3u, txChangeParams.AddedTransactionHashes.size());
+		EXPECT_TRUE(txChangeParams.RevertedTransactionHashes.empty());
+
+		ASSERT_TRUE(txChangeParams.HasChangedAddresses);
+		EXPECT_EQ(expectedChangedAddresses, txChangeParams.ChangedAddresses);
 	}
 
 	TEST(TEST_CLASS, CanSyncIncompatibleChains_TransactionNotification) {
@@ -1013,6 +1079,9 @@ namespace catapult { namespace consumers {
 
 		EXPECT_EQ(9u, txChangeParams.RevertedTransactionHashes.size());
 		AssertHashesAreEqual(expectedRevertedHashes, txChangeParams.RevertedTransactionHashes);
+
+		// - changed addresses are never provided when there is a rollback
+		EXPECT_FALSE(txChangeParams.HasChangedAddresses);
 	}
 
 	TEST(TEST_CLASS, CanSyncIncompatibleChainsWithSharedTransacions_TransactionNotification) {
@@ -159,11 +159,11 @@ namespace catapult { namespace consumers {
 		auto elements1 = TTraits::CreateSingleEntityElements();
 		auto elements2 = TTraits::CreateSingleEntityElements();
 
-		auto consumer = TTraits::CreateConsumer(CreateTimeSupplier({ 10, 11, 612, 613 }), Default_Options);
+		auto consumer = TTraits::CreateConsumer(CreateTimeSupplier({ 10, 11, 660, 661 }), Default_Options);
 
 		// - cache the entity
 		consumer(elements1); // t11
-		consumer(elements2); // t612 - triggers prune and evicts e1 because (612 - 11) > 600
+		consumer(elements2); // t660 - triggers prune and evicts e1 because its bucket (0) expires at bucket 11
 
 		// Act:
 		auto result = consumer(elements1);
@@ -176,11 +176,11 @@ namespace catapult { namespace consumers {
 		// Arrange:
 		auto elements = TTraits::CreateSingleEntityElements();
 
-		auto consumer = TTraits::CreateConsumer(CreateTimeSupplier({ 10, 11, 612, 613 }), Default_Options);
+		auto consumer = TTraits::CreateConsumer(CreateTimeSupplier({ 10, 11, 660, 661 }), Default_Options);
 
 		// - cache the entity
 		consumer(elements); // t11
-		consumer(elements); // t612 - triggers prune but does not evict e1 because e1 time is updated to t612
+		consumer(elements); // t660 - triggers prune but does not evict e1 because e1 is moved to the current bucket
 
 		// Act:
 		auto result = consumer(elements);
@@ -189,42 +189,42 @@ namespace catapult { namespace consumers {
 		TTraits::AssertSkipped(result, elements);
 	}
 
-	SINGLE_ENTITY_BASED_TEST(MultiplePruningsCannotOccurWithinPruneInterval) {
+	SINGLE_ENTITY_BASED_TEST(SingleEntityIsNotEvictedFromCacheBeforeBucketExpires) {
 		// Arrange:
 		auto elements1 = TTraits::CreateSingleEntityElements();
 		auto elements2 = TTraits::CreateSingleEntityElements();
 
-		auto consumer = TTraits::CreateConsumer(CreateTimeSupplier({ 10, 11, 553, 612, 613 }), Default_Options);
+		auto consumer = TTraits::CreateConsumer(CreateTimeSupplier({ 10, 11, 659 }), Default_Options);
 
 		// - cache the entity
 		consumer(elements1); // t11
-		consumer(elements2); // t553 - triggers a prune but does not evict e1
-		consumer(elements2); // t612 - does not trigger a prune because (612 - 553) < 60
+		consumer(elements2); // t659 - does not evict e1 because its bucket (0) is still active in bucket 10
 
 		// Act:
-		auto result = consumer(elements1); // t613
+		auto result = consumer(elements1); // t659
 
 		// Assert:
 		TTraits::AssertSkipped(result, elements1);
 	}
 
-	SINGLE_ENTITY_BASED_TEST(MultiplePruningsCanOccurAtPruneInterval) {
+	SINGLE_ENTITY_BASED_TEST(OnlyExpiredBucketsAreEvicted) {
 		// Arrange:
 		auto elements1 = TTraits::CreateSingleEntityElements();
 		auto elements2 = TTraits::CreateSingleEntityElements();
+		auto elements3 = TTraits::CreateSingleEntityElements();
 
-		auto consumer = TTraits::CreateConsumer(CreateTimeSupplier({ 10, 11, 552, 612, 613 }), Default_Options);
+		auto consumer = TTraits::CreateConsumer(CreateTimeSupplier({ 10, 11, 70, 660, 661 }), Default_Options);
 
-		// - cache the entity
-		consumer(elements1); // t11
-		consumer(elements2); // t552 - triggers a prune but does not evict e1
-		consumer(elements2); // t612 - triggers a prune and should evict e1
+		// - cache the entities
+		consumer(elements1); // t11 - bucket 0
+		consumer(elements2); // t70 - bucket 1
 
 		// Act:
-		auto result = consumer(elements1);
+		consumer(elements3); // t660 - triggers a prune and should evict e1 (bucket 0) but not e2 (bucket 1)
 
 		// Assert:
-		TTraits::AssertContinued(result, elements1);
+		test::AssertContinued(consumer(elements1));
+		test::AssertAborted(consumer(elements2), Neutral_Consumer_Hash_In_Recency_Cache, disruptor::ConsumerResultSeverity::Neutral);
 	}
 
 	SINGLE_ENTITY_BASED_TEST(SinglePruneCanEvictMultipleEntities) {
@@ -235,7 +235,7 @@ namespace catapult { namespace consumers {
 		auto elements4 = TTraits::CreateSingleEntityElements();
 		auto elements5 = TTraits::CreateSingleEntityElements();
 
-		auto consumer = TTraits::CreateConsumer(CreateTimeSupplier({ 10, 11, 12, 12, 14, 14, 613 }), Default_Options);
+		auto consumer = TTraits::CreateConsumer(CreateTimeSupplier({ 10, 11, 12, 12, 14, 14, 613, 660 }), Default_Options);
 
 		// - cache the entities
 		consumer(elements1); // t11
@@ -245,14 +245,15 @@ namespace catapult { namespace consumers {
 		consumer(elements5); // t14
 
 		// Act:
-		consumer(elements2); // t613 - triggers a prune and should evict e1 and e3 (e2 extends itself)
+		consumer(elements2); // t613 - moves e2 into bucket 10
+		consumer(elements4); // t660 - triggers a prune and should evict e1, e3 and e5 (e4 extends itself)
 
 		// Assert:
 		test::AssertContinued(consumer(elements1));
 		test::AssertAborted(consumer(elements2), Neutral_Consumer_Hash_In_Recency_Cache, disruptor::ConsumerResultSeverity::Neutral);
 		test::AssertContinued(consumer(elements3));
 		test::AssertAborted(consumer(elements4), Neutral_Consumer_Hash_In_Recency_Cache, disruptor::ConsumerResultSeverity::Neutral);
-		test::AssertAborted(consumer(elements5), Neutral_Consumer_Hash_In_Recency_Cache, disruptor::ConsumerResultSeverity::Neutral);
+		test::AssertContinued(consumer(elements5));
 	}
 
 	namespace {
@@ -306,14 +307,14 @@ namespace catapult { namespace consumers {
 
 	SINGLE_ENTITY_BASED_TEST(SingleEntityPreviouslySeenWhenCacheIsFullAndEvictedAtLeastOneEntityIsSkipped) {
 		// Arrange:
-		auto consumer = TTraits::CreateConsumer(CreateTimeSupplier({ 10, 11, 12, 13, 14, 15, 612 }), Max_Cache_Size_Options);
+		auto consumer = TTraits::CreateConsumer(CreateTimeSupplier({ 10, 11, 12, 13, 14, 15, 660 }), Max_Cache_Size_Options);
 
 		// - fill the cache
 		FillConsumer<TTraits>(consumer, Max_Cache_Size); // t11..t15
 
 		// - consume an input with a full cache (it should evict the first input)
 		auto elements = TTraits::CreateSingleEntityElements();
-		consumer(elements); // t612
+		consumer(elements); // t660
 
 		// Act: consume the last input again
 		auto result = consumer(elements);
@@ -103,68 +103,59 @@ namespace catapult { namespace consumers {
 		EXPECT_FALSE(result);
 	}
 
-	TEST(TEST_CLASS, HashIsNotEvictedFromCacheBeforeCacheDuration) {
-		// Arrange:
-		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 405, 612 }), Default_Options);
-		auto hash1 = test::GenerateRandomByteArray<Hash256>();
-		auto hash2 = test::GenerateRandomByteArray<Hash256>();
-
-		// Act:
-		auto result1 = cache.add(hash1); // t11
-		auto result2 = cache.add(hash2); // t405 - triggers prune, but hash1 is not evicted because (405 - 11) == 394
+	namespace {
+		void AssertHashEviction(const std::vector<uint32_t>& rawTimestamps, bool shouldEvict) {
+			// Arrange:
+			RecentHashCache cache(CreateTimeSupplier(rawTimestamps), Default_Options);
+			auto hash1 = test::GenerateRandomByteArray<Hash256>();
+			auto hash2 = test::GenerateRandomByteArray<Hash256>();
+
+			// Act:
+			auto result1 = cache.add(hash1);
+			auto result2 = cache.add(hash2);
+
+			// Assert:
+			EXPECT_EQ(shouldEvict ? 1u : 2u, cache.size());
+			EXPECT_TRUE(result1);
+			EXPECT_TRUE(result2);
+			EXPECT_EQ(!shouldEvict, cache.contains(hash1));
+			EXPECT_TRUE(cache.contains(hash2));
+		}
+	}
 
-		// Assert:
-		EXPECT_EQ(2u, cache.size());
-		EXPECT_TRUE(result1);
-		EXPECT_TRUE(result2);
-		EXPECT_TRUE(cache.contains(hash1));
-		EXPECT_TRUE(cache.contains(hash2));
+	TEST(TEST_CLASS, HashIsNotEvictedFromCacheBeforeCacheDuration) {
+		// Assert: hash1 is added to bucket 0 at t11 and is not evicted at t405 (bucket 6)
+		AssertHashEviction({ 10, 11, 405 }, false);
 	}
 
 	TEST(TEST_CLASS, HashIsNotEvictedFromCacheAtCacheDuration) {
-		// Arrange:
-		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 611, 612 }), Default_Options);
-		auto hash1 = test::GenerateRandomByteArray<Hash256>();
-		auto hash2 = test::GenerateRandomByteArray<Hash256>();
-
-		// Act:
-		auto result1 = cache.add(hash1); // t11
-		auto result2 = cache.add(hash2); // t611 - triggers prune, but hash1 is not evicted because (611 - 11) == 600
-
-		// Assert:
-		EXPECT_EQ(2u, cache.size());
-		EXPECT_TRUE(result1);
-		EXPECT_TRUE(result2);
-		EXPECT_TRUE(cache.contains(hash1));
-		EXPECT_TRUE(cache.contains(hash2));
+		// Assert: hash1 is added to bucket 0 at t11 and is not evicted at t611 because (611 - 11) == 600
+		AssertHashEviction({ 10, 11, 611 }, false);
 	}
 
-	TEST(TEST_CLASS, HashIsEvictedFromCacheAfterCacheDuration) {
-		// Arrange:
-		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 612, 613 }), Default_Options);
-		auto hash1 = test::GenerateRandomByteArray<Hash256>();
-		auto hash2 = test::GenerateRandomByteArray<Hash256>();
+	TEST(TEST_CLASS, HashIsNotEvictedFromCacheBeforeBucketExpires) {
+		// Assert: hash1 is added to bucket 0 at t11 and is not evicted at t659 (bucket 10) because bucket 0 is still active
+		AssertHashEviction({ 10, 11, 659 }, false);
+	}
 
-		// Act:
-		auto result1 = cache.add(hash1); // t11
-		auto result2 = cache.add(hash2); // t612 - triggers prune, but hash1 is not evicted because (612 - 11) == 601
+	TEST(TEST_CLASS, HashIsEvictedFromCacheWhenBucketExpires) {
+		// Assert: hash1 is added to bucket 0 at t11 and is evicted at t660 (bucket 11) because bucket 0 is reused
+		AssertHashEviction({ 10, 11, 660 }, true);
+	}
 
-		// Assert: size is 1 because hash1 was removed
-		EXPECT_EQ(1u, cache.size());
-		EXPECT_TRUE(result1);
-		EXPECT_TRUE(result2);
-		EXPECT_FALSE(cache.contains(hash1));
-		EXPECT_TRUE(cache.contains(hash2));
+	TEST(TEST_CLASS, HashIsEvictedFromCacheWhenTimeAdvancesPastAllBuckets) {
+		// Assert: hash1 is added to bucket 0 at t11 and is evicted at t10000 (bucket 166) because all buckets are reused
+		AssertHashEviction({ 10, 11, 10000 }, true);
 	}
 
 	TEST(TEST_CLASS, SingleHashCannotSelfEvict) {
 		// Arrange:
-		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 612, 613 }), Default_Options);
+		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 660, 661 }), Default_Options);
 		auto hash = test::GenerateRandomByteArray<Hash256>();
 
 		// Act:
 		auto result1 = cache.add(hash); // t11
-		auto result2 = cache.add(hash); // t612 - triggers prune but does not evict hash because hash time is updated to t612
+		auto result2 = cache.add(hash); // t660 - triggers prune of bucket 0 but hash is known and moved to bucket 11
 
 		// Assert:
 		EXPECT_EQ(1u, cache.size());
@@ -173,70 +164,74 @@ namespace catapult { namespace consumers {
 		EXPECT_TRUE(cache.contains(hash));
 	}
 
-	TEST(TEST_CLASS, MultiplePruningsCannotOccurWithinPruneInterval) {
+	TEST(TEST_CLASS, KnownHashIsMovedToCurrentBucket) {
 		// Arrange:
-		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 553, 612, 613 }), Default_Options);
+		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 613, 660 }), Default_Options);
 		auto hash1 = test::GenerateRandomByteArray<Hash256>();
 		auto hash2 = test::GenerateRandomByteArray<Hash256>();
 
 		// Act:
-		auto result1 = cache.add(hash1); // t11
-		auto result2 = cache.add(hash2); // t553 - triggers a prune but does not evict hash1
-		auto result3 = cache.add(hash2); // t612 - does not trigger a prune because (612 - 553) < 60
+		auto result1 = cache.add(hash1); // t11 - bucket 0
+		auto result2 = cache.add(hash1); // t613 - bucket 10, hash1 is moved
+		auto result3 = cache.add(hash2); // t660 - bucket 11, triggers prune of bucket 0
 
 		// Assert:
 		EXPECT_EQ(2u, cache.size());
 		EXPECT_TRUE(result1);
-		EXPECT_TRUE(result2);
-		EXPECT_FALSE(result3);
+		EXPECT_FALSE(result2);
+		EXPECT_TRUE(result3);
 		EXPECT_TRUE(cache.contains(hash1));
 		EXPECT_TRUE(cache.contains(hash2));
 	}
 
-	TEST(TEST_CLASS, MultiplePruningsCanOccurAtPruneInterval) {
-		// Arrange:
-		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 552, 612, 613 }), Default_Options);
-		auto hash1 = test::GenerateRandomByteArray<Hash256>();
-		auto hash2 = test::GenerateRandomByteArray<Hash256>();
+	TEST(TEST_CLASS, SinglePruneOnlyEvictsExpiredBuckets) {
+		// Arrange: create three hashes
+		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 70, 130, 720 }), Default_Options);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(3);
+
+		// - cache the hashes at t11 (bucket 0), t70 (bucket 1), t130 (bucket 2)
+		for (const auto& hash : hashes)
+			cache.add(hash);
 
 		// Act:
-		auto result1 = cache.add(hash1); // t11
-		auto result2 = cache.add(hash2); // t552 - triggers a prune but does not evict hash1
-		auto result3 = cache.add(hash2); // t612 - triggers a prune and should evict hash1
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		auto result = cache.add(hash); // t720 - bucket 12, triggers prune of buckets 0 and 1
 
 		// Assert:
-		EXPECT_EQ(1u, cache.size());
-		EXPECT_TRUE(result1);
-		EXPECT_TRUE(result2);
-		EXPECT_FALSE(result3);
-		EXPECT_FALSE(cache.contains(hash1));
-		EXPECT_TRUE(cache.contains(hash2));
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_TRUE(result);
+		EXPECT_FALSE(cache.contains(hashes[0]));
+		EXPECT_FALSE(cache.contains(hashes[1]));
+		EXPECT_TRUE(cache.contains(hashes[2]));
+		EXPECT_TRUE(cache.contains(hash));
 	}
 
 	TEST(TEST_CLASS, SinglePruneCanEvictMultipleEntities) {
 		// Arrange: create five hashes
 		constexpr auto Num_Hashes = 5u;
-		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 12, 12, 14, 14, 613 }), Default_Options);
+		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 12, 12, 14, 14, 613, 660 }), Default_Options);
 		auto hashes = test::GenerateRandomDataVector<Hash256>(Num_Hashes);
 		std::vector<bool> results;
 
-		// - cache the hashes at t11, t12, t12, t14, t14
+		// - cache the hashes at t11, t12, t12, t14, t14 (all in bucket 0)
 		for (const auto& hash : hashes)
 			results.push_back(cache.add(hash));
 
 		// Act:
-		auto result1 = cache.add(hashes[1]); // t613 - triggers a prune and should evict hashes[0] and hashes[2] (hashes[1] extends itself)
+		auto result1 = cache.add(hashes[1]); // t613 - moves hashes[1] into bucket 10
+		auto result2 = cache.add(hashes[3]); // t660 - triggers a prune of bucket 0 but hashes[3] extends itself
 
-		// Assert: 2 hashes were pruned
-		EXPECT_EQ(3u, cache.size());
+		// Assert: 3 hashes were pruned
+		EXPECT_EQ(2u, cache.size());
 		EXPECT_FALSE(result1);
+		EXPECT_FALSE(result2);
 		for (auto result : results)
 			EXPECT_TRUE(result);
 
-		for (auto i : { 1u, 3u, 4u })
+		for (auto i : { 1u, 3u })
 			EXPECT_TRUE(cache.contains(hashes[i])) << "hash at index " << i;
 
-		for (auto i : { 0u, 2u })
+		for (auto i : { 0u, 2u, 4u })
 			EXPECT_FALSE(cache.contains(hashes[i])) << "hash at index " << i;
 	}
 
@@ -318,9 +313,9 @@ namespace catapult { namespace consumers {
 		EXPECT_FALSE(cache.contains(hash));
 	}
 
-	TEST(TEST_CLASS, CanAddUnknownHashWhenCacheIsFullButAtLeastOneHashIsEvicted) {
+	TEST(TEST_CLASS, CanAddUnknownHashWhenCacheIsFullButAtLeastOneBucketIsEvicted) {
 		// Arrange:
-		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 12, 13, 14, 15, 612 }), Max_Cache_Size_Options);
+		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 12, 13, 14, 15, 660 }), Max_Cache_Size_Options);
 		auto hashes = test::GenerateRandomDataVector<Hash256>(Max_Cache_Size);
 		FillCache(cache, hashes); // t11..t15
 
@@ -329,13 +324,73 @@ namespace catapult { namespace consumers {
 
 		// Act: try to add another hash
 		auto hash = test::GenerateRandomByteArray<Hash256>();
-		auto result = cache.add(hash); // t612 - triggers a prune and should evict hashes[0]
+		auto result = cache.add(hash); // t660 - triggers a prune of bucket 0 and should evict all hashes
 
 		// Assert: hash is unknown and was added
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_TRUE(result);
+		EXPECT_TRUE(cache.contains(hash));
+		for (const auto& evictedHash : hashes)
+			EXPECT_FALSE(cache.contains(evictedHash));
+	}
+
+	// endregion
+
+	// region bucket compaction
+
+	namespace {
+		constexpr auto Num_Rounds = 10u;
+
+		std::vector<uint32_t> CreateRoundTimestamps() {
+			// round i adds all hashes in bucket i, so every round after the first one leaves stale entries in the previous bucket
+			std::vector<uint32_t> timestamps{ 10 };
+			for (auto i = 0u; i <= Num_Rounds; ++i) {
+				for (auto j = 0u; j < Max_Cache_Size; ++j)
+					timestamps.push_back(11 + i * 60);
+			}
+
+			timestamps.push_back(11 + (Num_Rounds + 11) * 60);
+			return timestamps;
+		}
+	}
+
+	TEST(TEST_CLASS, BucketEntriesAreBoundedWhenKnownHashesAreSeenInManyBuckets) {
+		// Arrange:
+		RecentHashCache cache(CreateTimeSupplier(CreateRoundTimestamps()), Max_Cache_Size_Options);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(Max_Cache_Size);
+
+		// Act: see all hashes in multiple buckets
+		for (auto i = 0u; i <= Num_Rounds; ++i) {
+			FillCache(cache, hashes);
+
+			// Assert: stale entries never exceed twice the maximum cache size
+			EXPECT_GE(2 * Max_Cache_Size, cache.numBucketEntries()) << "round " << i;
+		}
+
+		// - all hashes are still cached
 		EXPECT_EQ(Max_Cache_Size, cache.size());
+		for (const auto& hash : hashes)
+			EXPECT_TRUE(cache.contains(hash));
+	}
+
+	TEST(TEST_CLASS, BucketCompactionDoesNotPreventExpiration) {
+		// Arrange:
+		RecentHashCache cache(CreateTimeSupplier(CreateRoundTimestamps()), Max_Cache_Size_Options);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(Max_Cache_Size);
+		for (auto i = 0u; i <= Num_Rounds; ++i)
+			FillCache(cache, hashes);
+
+		// Act: add a hash after all buckets expired
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		auto result = cache.add(hash);
+
+		// Assert: all previous hashes and their (stale) entries were evicted
 		EXPECT_TRUE(result);
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(1u, cache.numBucketEntries());
 		EXPECT_TRUE(cache.contains(hash));
-		EXPECT_FALSE(cache.contains(hashes[0]));
+		for (const auto& evictedHash : hashes)
+			EXPECT_FALSE(cache.contains(evictedHash));
 	}
 
 	// endregion
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/crypto/CatapultCertificateProcessor.h"
+#include "catapult/crypto/VerifiedCertificateCache.h"
 #include "tests/test/crypto/CertificateTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -335,4 +336,109 @@ namespace catapult { namespace crypto {
 	}
 
 	// endregion
+
+	// region verified certificate cache
+
+	namespace {
+		test::CertificateStoreContextHolder CreateCertificateStoreContext(test::CertificatePointer&& pRootCertificate) {
+			std::vector<test::CertificatePointer> certificates;
+			certificates.push_back(std::move(pRootCertificate));
+			certificates.push_back(CreateDefaultCertificate("Bob"));
+			auto holder = test::CreateCertificateStoreContextFromCertificates(std::move(certificates));
+			X509_STORE_CTX_set_error(holder.pCertificateStoreContext.get(), X509_V_ERR_SELF_SIGNED_CERT_IN_CHAIN);
+			return holder;
+		}
+
+		test::CertificatePointer CreateRootCertificate(evp_pkey_st& key, evp_pkey_st& signingKey) {
+			test::CertificateBuilder builder;
+			builder.setSubject("JP", "NEM", "Alice");
+			builder.setIssuer("JP", "NEM", "Alice");
+			builder.setPublicKey(key);
+			return builder.buildAndSign(signingKey);
+		}
+
+		void AddToCache(VerifiedCertificateCache& cache, X509& certificate) {
+			CertificateInfo certificateInfo;
+			Hash256 certificateHash;
+			TryParseCertificate(certificate, certificateInfo);
+			TryCalculateCertificateHash(certificate, certificateHash);
+			cache.add(certificateInfo.PublicKey, certificateHash);
+		}
+	}
+
+	TEST(TEST_CLASS, SuccessfulSelfSignedVerificationAddsRootCertificateToCache) {
+		// Arrange:
+		auto pKey = test::GenerateRandomCertificateKey();
+		auto pRootCertificate = CreateRootCertificate(*pKey, *pKey);
+		auto* pRawRootCertificate = pRootCertificate.get();
+		auto holder = CreateCertificateStoreContext(std::move(pRootCertificate));
+
+		VerifiedCertificateCache cache(10);
+		CatapultCertificateProcessor processor(cache);
+
+		// Act:
+		auto verifyResult = processor.verify(false, *holder.pCertificateStoreContext);
+
+		// Assert:
+		EXPECT_TRUE(verifyResult);
+		ASSERT_EQ(1u, cache.size());
+
+		CertificateInfo certificateInfo;
+		Hash256 certificateHash;
+		TryParseCertificate(*pRawRootCertificate, certificateInfo);
+		TryCalculateCertificateHash(*pRawRootCertificate, certificateHash);
+		EXPECT_TRUE(cache.contains(certificateInfo.PublicKey, certificateHash));
+	}
+
+	TEST(TEST_CLASS, FailedSelfSignedVerificationDoesNotAddRootCertificateToCache) {
+		// Arrange:
+		auto pKey = test::GenerateRandomCertificateKey();
+		auto holder = CreateCertificateStoreContext(CreateRootCertificate(*pKey, *test::GenerateRandomCertificateKey()));
+
+		VerifiedCertificateCache cache(10);
+		CatapultCertificateProcessor processor(cache);
+
+		// Act:
+		auto verifyResult = processor.verify(false, *holder.pCertificateStoreContext);
+
+		// Assert:
+		EXPECT_FALSE(verifyResult);
+		EXPECT_EQ(0u, cache.size());
+	}
+
+	TEST(TEST_CLASS, CachedRootCertificateBypassesSelfSignedVerification) {
+		// Arrange: cache a certificate signed by an external signer, which would otherwise fail verification
+		auto pRootCertificate = CreateRootCertificate(*test::GenerateRandomCertificateKey(), *test::GenerateRandomCertificateKey());
+		VerifiedCertificateCache cache(10);
+		AddToCache(cache, *pRootCertificate);
+
+		auto holder = CreateCertificateStoreContext(std::move(pRootCertificate));
+		CatapultCertificateProcessor processor(cache);
+
+		// Act:
+		auto verifyResult = processor.verify(false, *holder.pCertificateStoreContext);
+
+		// Assert:
+		EXPECT_TRUE(verifyResult);
+		EXPECT_EQ(1u, cache.size());
+	}
+
+	TEST(TEST_CLASS, CachedPublicKeyDoesNotBypassSelfSignedVerificationOfDifferentCertificate) {
+		// Arrange: cache a properly signed certificate and present an externally signed certificate with the same public key
+		auto pKey = test::GenerateRandomCertificateKey();
+		VerifiedCertificateCache cache(10);
+		AddToCache(cache, *CreateRootCertificate(*pKey, *pKey));
+
+		auto holder = CreateCertificateStoreContext(CreateRootCertificate(*pKey, *test::GenerateRandomCertificateKey()));
+		CatapultCertificateProcessor processor(cache);
+
+		// Act:
+		auto verifyResult = processor.verify(false, *holder.pCertificateStoreContext);
+
+		// Assert:
+		EXPECT_FALSE(verifyResult);
+		EXPECT_EQ(1u, cache.size());
+	}
+
+	// endregion
 }}
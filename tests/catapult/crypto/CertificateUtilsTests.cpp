@@ -222,4 +222,55 @@ namespace catapult { namespace crypto {
 	}
 
 	// endregion
+
+	// region TryCalculateCertificateHash
+
+	namespace {
+		test::CertificatePointer CreateSelfSignedCertificate(const std::string& commonName, evp_pkey_st& key) {
+			test::CertificateBuilder builder;
+			builder.setSubject("JP", "NEM", commonName);
+			builder.setIssuer("JP", "NEM", commonName);
+			builder.setPublicKey(key);
+			return builder.buildAndSign(key);
+		}
+	}
+
+	TEST(TEST_CLASS, TryCalculateCertificateHash_IsDeterministic) {
+		// Arrange:
+		auto pCertificate = CreateSelfSignedCertificate("Alice", *test::GenerateRandomCertificateKey());
+
+		// Act:
+		Hash256 hash1;
+		auto result1 = TryCalculateCertificateHash(*pCertificate, hash1);
+
+		Hash256 hash2;
+		auto result2 = TryCalculateCertificateHash(*pCertificate, hash2);
+
+		// Assert:
+		EXPECT_TRUE(result1);
+		EXPECT_TRUE(result2);
+		EXPECT_NE(Hash256(), hash1);
+		EXPECT_EQ(hash1, hash2);
+	}
+
+	TEST(TEST_CLASS, TryCalculateCertificateHash_DiffersForCertificatesWithSamePublicKey) {
+		// Arrange:
+		auto pKey = test::GenerateRandomCertificateKey();
+		auto pCertificate1 = CreateSelfSignedCertificate("Alice", *pKey);
+		auto pCertificate2 = CreateSelfSignedCertificate("Bob", *pKey);
+
+		// Act:
+		Hash256 hash1;
+		auto result1 = TryCalculateCertificateHash(*pCertificate1, hash1);
+
+		Hash256 hash2;
+		auto result2 = TryCalculateCertificateHash(*pCertificate2, hash2);
+
+		// Assert:
+		EXPECT_TRUE(result1);
+		EXPECT_TRUE(result2);
+		EXPECT_NE(hash1, hash2);
+	}
+
+	// endregion
 }}
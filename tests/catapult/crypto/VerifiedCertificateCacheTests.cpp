@@ -0,0 +1,114 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/VerifiedCertificateCache.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS VerifiedCertificateCacheTests
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		VerifiedCertificateCache cache(3);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_FALSE(cache.contains(test::GenerateRandomByteArray<Key>(), test::GenerateRandomByteArray<Hash256>()));
+	}
+
+	TEST(TEST_CLASS, CanAddCertificates) {
+		// Arrange:
+		VerifiedCertificateCache cache(3);
+		auto keys = test::GenerateRandomDataVector<Key>(2);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(2);
+
+		// Act:
+		cache.add(keys[0], hashes[0]);
+		cache.add(keys[1], hashes[1]);
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_TRUE(cache.contains(keys[0], hashes[0]));
+		EXPECT_TRUE(cache.contains(keys[1], hashes[1]));
+	}
+
+	TEST(TEST_CLASS, ContainsRequiresMatchingPublicKeyAndCertificateHash) {
+		// Arrange:
+		VerifiedCertificateCache cache(3);
+		auto keys = test::GenerateRandomDataVector<Key>(2);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(2);
+		cache.add(keys[0], hashes[0]);
+
+		// Act + Assert:
+		EXPECT_TRUE(cache.contains(keys[0], hashes[0]));
+		EXPECT_FALSE(cache.contains(keys[0], hashes[1]));
+		EXPECT_FALSE(cache.contains(keys[1], hashes[0]));
+	}
+
+	TEST(TEST_CLASS, AddReplacesCertificateHashForKnownPublicKey) {
+		// Arrange:
+		VerifiedCertificateCache cache(3);
+		auto key = test::GenerateRandomByteArray<Key>();
+		auto hashes = test::GenerateRandomDataVector<Hash256>(2);
+		cache.add(key, hashes[0]);
+
+		// Act:
+		cache.add(key, hashes[1]);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_FALSE(cache.contains(key, hashes[0]));
+		EXPECT_TRUE(cache.contains(key, hashes[1]));
+	}
+
+	TEST(TEST_CLASS, AddEvictsLeastRecentlyAddedPublicKeyWhenFull) {
+		// Arrange:
+		VerifiedCertificateCache cache(3);
+		auto keys = test::GenerateRandomDataVector<Key>(4);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(4);
+		for (auto i = 0u; i < 3; ++i)
+			cache.add(keys[i], hashes[i]);
+
+		// Act:
+		cache.add(keys[3], hashes[3]);
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		EXPECT_FALSE(cache.contains(keys[0], hashes[0]));
+		for (auto i = 1u; i < 4; ++i)
+			EXPECT_TRUE(cache.contains(keys[i], hashes[i])) << i;
+	}
+
+	TEST(TEST_CLASS, AddHasNoEffectWhenMaxSizeIsZero) {
+		// Arrange:
+		VerifiedCertificateCache cache(0);
+		auto key = test::GenerateRandomByteArray<Key>();
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		cache.add(key, hash);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_FALSE(cache.contains(key, hash));
+	}
+}}
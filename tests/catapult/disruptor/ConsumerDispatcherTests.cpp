@@ -234,6 +234,50 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region consumerLatencyHistogram
+
+	TEST(TEST_CLASS, ConsumerLatencyHistogramsAreInitiallyEmpty) {
+		// Arrange:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// Act + Assert:
+		EXPECT_EQ(0u, dispatcher.consumerLatencyHistogram(0)->snapshot().count());
+		EXPECT_EQ(0u, dispatcher.consumerLatencyHistogram(1)->snapshot().count());
+	}
+
+	TEST(TEST_CLASS, ConsumerLatencyHistogramsRecordLatenciesOfProcessedElements) {
+		// Arrange: first consumer aborts even heights, second consumer is slow
+		auto ranges = test::PrepareRanges(5);
+		auto height = 0u;
+		for (auto& range : ranges)
+			range.begin()->Height = Height(++height);
+
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, {
+			[](const auto& consumerInput) {
+				return 0 == consumerInput.blocks()[0].Block.Height.unwrap() % 2
+						? ConsumerResult::Abort()
+						: ConsumerResult::Continue();
+			},
+			[](const auto&) {
+				test::Sleep(2);
+				return ConsumerResult::Continue();
+			}
+		});
+
+		// Act:
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: skipped elements are not recorded by higher consumers
+		auto snapshot1 = dispatcher.consumerLatencyHistogram(0)->snapshot();
+		auto snapshot2 = dispatcher.consumerLatencyHistogram(1)->snapshot();
+		EXPECT_EQ(5u, snapshot1.count());
+		EXPECT_EQ(3u, snapshot2.count());
+		EXPECT_LE(std::chrono::microseconds(2'000), snapshot2.max());
+	}
+
+	// endregion
+
 	// region process + consume (no inspect)
 
 	namespace {
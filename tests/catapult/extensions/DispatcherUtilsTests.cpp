@@ -121,6 +121,28 @@ namespace catapult { namespace extensions {
 		isElementCallbackUnblocked.state()->set();
 	}
 
+	TEST(TEST_CLASS, CanAddDispatcherHistogramsToLocator) {
+		// Arrange: create a dispatcher and process a single element
+		auto pDispatcher = CreateDispatcher();
+		pDispatcher->processElement(disruptor::ConsumerInput(test::CreateTransactionEntityRange(1)));
+		WAIT_FOR_ZERO_EXPR(pDispatcher->numActiveElements());
+
+		// - create a locator and register the service
+		config::CatapultKeys keys;
+		ServiceLocator locator(keys);
+		locator.registerRootedService("foo", pDispatcher);
+
+		// Act: register the histograms
+		AddDispatcherCounters(locator, "foo", "XYZ");
+		auto histograms = locator.histograms();
+
+		// Assert: one histogram per consumer
+		ASSERT_EQ(1u, histograms.size());
+		EXPECT_EQ("XYZ CONSUMER", histograms[0].id().name());
+		EXPECT_EQ(0u, histograms[0].tag());
+		EXPECT_EQ(1u, histograms[0].snapshot().count());
+	}
+
 	TEST(TEST_CLASS, CanCreateBatchTransactionTask) {
 		// Arrange:
 		auto pDispatcher = CreateDispatcher();
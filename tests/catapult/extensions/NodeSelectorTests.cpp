@@ -181,6 +181,56 @@ namespace catapult { namespace extensions {
 
 	// endregion
 
+	// region CalculatePerformanceMultiplier
+
+	namespace {
+		ionet::NodePerformance CreatePerformance(uint64_t roundTripTimeMillis, uint64_t bytesPerSecond) {
+			ionet::NodePerformance performance;
+			performance.RoundTripTime = utils::TimeSpan::FromMilliseconds(roundTripTimeMillis);
+			performance.BytesPerSecond = bytesPerSecond;
+			return performance;
+		}
+	}
+
+	TEST(TEST_CLASS, NodeWithUnknownPerformanceIsGivenNeutralMultiplier) {
+		EXPECT_EQ(1'000u, CalculatePerformanceMultiplier(CreatePerformance(0, 0), CreatePerformance(0, 0)));
+		EXPECT_EQ(1'000u, CalculatePerformanceMultiplier(CreatePerformance(0, 0), CreatePerformance(100, 1'000)));
+		EXPECT_EQ(1'000u, CalculatePerformanceMultiplier(CreatePerformance(100, 1'000), CreatePerformance(0, 0)));
+	}
+
+	TEST(TEST_CLASS, NodeWithReferencePerformanceIsGivenNeutralMultiplier) {
+		EXPECT_EQ(1'000u, CalculatePerformanceMultiplier(CreatePerformance(100, 1'000), CreatePerformance(100, 1'000)));
+	}
+
+	TEST(TEST_CLASS, NodeIsGivenPerformanceMultiplierAccordingToFormula) {
+		// Arrange:
+		auto reference = CreatePerformance(100, 1'000);
+
+		// Assert: round trip time only
+		EXPECT_EQ(1'250u, CalculatePerformanceMultiplier(CreatePerformance(80, 0), reference));
+		EXPECT_EQ(800u, CalculatePerformanceMultiplier(CreatePerformance(125, 0), reference));
+
+		// - throughput only
+		EXPECT_EQ(1'500u, CalculatePerformanceMultiplier(CreatePerformance(0, 1'500), reference));
+		EXPECT_EQ(600u, CalculatePerformanceMultiplier(CreatePerformance(0, 600), reference));
+
+		// - both
+		EXPECT_EQ(1'875u, CalculatePerformanceMultiplier(CreatePerformance(80, 1'500), reference));
+		EXPECT_EQ(750u, CalculatePerformanceMultiplier(CreatePerformance(80, 600), reference));
+	}
+
+	TEST(TEST_CLASS, PerformanceMultiplierIsBounded) {
+		// Arrange:
+		auto reference = CreatePerformance(100, 1'000);
+
+		// Assert:
+		EXPECT_EQ(4'000u, CalculatePerformanceMultiplier(CreatePerformance(1, 1'000'000), reference));
+		EXPECT_EQ(250u, CalculatePerformanceMultiplier(CreatePerformance(10'000, 1), reference));
+		EXPECT_EQ(1'000u, CalculatePerformanceMultiplier(CreatePerformance(1, 1), reference));
+	}
+
+	// endregion
+
 	// region WeightPolicyGenerator
 
 	TEST(TEST_CLASS, WeightPolicyGeneratorGeneratedValuesAreAccordinglyBalancedBetweenInteractionsAndImportance) {
@@ -623,6 +673,8 @@ namespace catapult { namespace extensions {
 					, Interactions2(interactions2)
 					, Source1(ionet::NodeSource::Dynamic)
 					, Source2(ionet::NodeSource::Dynamic)
+					, RoundTripTimeMillis1(0)
+					, RoundTripTimeMillis2(0)
 			{}
 
 		public:
@@ -632,6 +684,8 @@ namespace catapult { namespace extensions {
 			ionet::NodeSource Source2;
 			ionet::ConnectionState ConnectionState1;
 			ionet::ConnectionState ConnectionState2;
+			uint64_t RoundTripTimeMillis1;
+			uint64_t RoundTripTimeMillis2;
 		};
 
 		std::pair<uint32_t, uint32_t> RunManyPairwiseSelections(const NodeInfos& nodeInfos) {
@@ -647,6 +701,12 @@ namespace catapult { namespace extensions {
 				test::AddNodeInteractions(modifier, node1.identity(), interactions1.NumSuccesses, interactions1.NumFailures);
 				auto& interactions2 = nodeInfos.Interactions2;
 				test::AddNodeInteractions(modifier, node2.identity(), interactions2.NumSuccesses, interactions2.NumFailures);
+
+				if (0 != nodeInfos.RoundTripTimeMillis1)
+					modifier.addRoundTripTime(node1.identity(), utils::TimeSpan::FromMilliseconds(nodeInfos.RoundTripTimeMillis1));
+
+				if (0 != nodeInfos.RoundTripTimeMillis2)
+					modifier.addRoundTripTime(node2.identity(), utils::TimeSpan::FromMilliseconds(nodeInfos.RoundTripTimeMillis2));
 			}
 
 			// Act: run a lot of selections
@@ -765,6 +825,96 @@ namespace catapult { namespace extensions {
 		});
 	}
 
+	TEST(TEST_CLASS, NodeWithShorterRoundTripTimeHasHigherPriorityThanNodeWithLongerRoundTripTime) {
+		// Arrange: reference round trip time is 200ms, so multipliers are 2'000 / 1'000
+		auto interactions1 = ionet::NodeInteractions();
+		auto interactions2 = ionet::NodeInteractions();
+		NodeInfos nodeInfos(interactions1, interactions2);
+		nodeInfos.RoundTripTimeMillis1 = 50;
+		nodeInfos.RoundTripTimeMillis2 = 200;
+
+		// Assert:
+		RunNonDeterministicPairwiseSelectionTest(nodeInfos, [](const auto& counts) {
+			return counts.second < counts.first && counts.first < 4 * counts.second;
+		});
+	}
+
+	TEST(TEST_CLASS, NodeWithUnknownPerformanceHasSamePriorityAsOnlyMeasuredNode) {
+		// Arrange: reference round trip time is 400ms (only known value), so multipliers are 1'000 / 1'000
+		auto interactions1 = ionet::NodeInteractions();
+		auto interactions2 = ionet::NodeInteractions();
+		NodeInfos nodeInfos(interactions1, interactions2);
+		nodeInfos.RoundTripTimeMillis1 = 0;
+		nodeInfos.RoundTripTimeMillis2 = 400;
+
+		// Assert:
+		RunNonDeterministicPairwiseSelectionTest(nodeInfos, [](const auto& counts) {
+			return counts.first < 2 * counts.second && counts.second < 2 * counts.first;
+		});
+	}
+
+	// endregion
+
+	// region SelectNodes: recorded performance simulation
+
+	namespace {
+		struct RecordedSample {
+			size_t NodeIndex;
+			uint64_t RoundTripTimeMillis;
+			uint64_t NumBytes;
+			uint64_t ElapsedMillis;
+		};
+
+		// samples recorded over four sync rounds from four peers with (roughly) 50ms / 100ms / 200ms / 400ms round trip times
+		// and 4MB/s / 2MB/s / 1MB/s / 512KB/s throughputs
+		std::vector<RecordedSample> GetRecordedSamples() {
+			return {
+				{ 0, 48, 4'000'000, 1'000 }, { 1, 104, 2'100'000, 1'000 }, { 2, 190, 1'000'000, 1'000 }, { 3, 420, 500'000, 1'000 },
+				{ 0, 55, 2'000'000, 500 }, { 1, 97, 1'000'000, 500 }, { 2, 210, 520'000, 500 }, { 3, 390, 260'000, 500 },
+				{ 0, 50, 8'200'000, 2'000 }, { 1, 101, 3'900'000, 2'000 }, { 2, 205, 2'000'000, 2'000 }, { 3, 405, 1'000'000, 2'000 },
+				{ 0, 47, 4'100'000, 1'000 }, { 1, 99, 2'000'000, 1'000 }, { 2, 198, 990'000, 1'000 }, { 3, 398, 510'000, 1'000 }
+			};
+		}
+
+		std::vector<uint32_t> RunManySimulatedSelections() {
+			// Arrange: seed four inactive nodes and replay the recorded samples
+			ionet::NodeContainer container;
+			auto nodes = SeedNodes(container, 4);
+			{
+				auto modifier = container.modifier();
+				for (const auto& sample : GetRecordedSamples()) {
+					const auto& identity = nodes[sample.NodeIndex].identity();
+					modifier.addRoundTripTime(identity, utils::TimeSpan::FromMilliseconds(sample.RoundTripTimeMillis));
+					modifier.addThroughput(identity, sample.NumBytes, utils::TimeSpan::FromMilliseconds(sample.ElapsedMillis));
+				}
+			}
+
+			// Act: run a lot of selections
+			std::vector<uint32_t> counts(nodes.size(), 0);
+			for (auto i = 0u; i < 1000; ++i) {
+				auto result = SelectNodes(container, CreateConfiguration(1, 8), UniformImportanceRetriever);
+				if (1 != result.AddCandidates.size())
+					CATAPULT_THROW_RUNTIME_ERROR("unexpected number of candidate nodes returned");
+
+				for (auto j = 0u; j < nodes.size(); ++j) {
+					if (nodes[j].identity().PublicKey == result.AddCandidates.cbegin()->identity().PublicKey)
+						++counts[j];
+				}
+			}
+
+			CATAPULT_LOG(debug) << "selections (" << counts[0] << ", " << counts[1] << ", " << counts[2] << ", " << counts[3] << ")";
+			return counts;
+		}
+	}
+
+	TEST(TEST_CLASS, SelectionFrequencyIsOrderedByRecordedPerformance) {
+		// Assert: expected multipliers are approximately 3'800 / 1'800 / 500 / 250
+		test::RunNonDeterministicTest("simulated node selection", []() {
+			auto counts = RunManySimulatedSelections();
+			return counts[0] > counts[1] && counts[1] > counts[2] && counts[2] > counts[3] && counts[0] > 400;
+		});
+	}
+
 	// endregion
 
 	// region SelectNodes: remove
@@ -1003,5 +1153,27 @@ namespace catapult { namespace extensions {
 		AssertRemoveOnlyRemovals(1, 1, 0);
 	}
 
+	TEST(TEST_CLASS, ForRemoval_WorstPerformingConnectionIsRemovedFirst) {
+		// Arrange: seed only active nodes that all have max age
+		ionet::NodeContainer container;
+		auto nodes = SeedNodes(container, 4);
+		SetAge(container, nodes, 8);
+
+		// - make the third node significantly slower than the others (reference round trip time is 100ms)
+		{
+			auto modifier = container.modifier();
+			for (auto i = 0u; i < nodes.size(); ++i)
+				modifier.addRoundTripTime(nodes[i].identity(), utils::TimeSpan::FromMilliseconds(2 == i ? 400 : 100));
+		}
+
+		// Act: min connections (6 * 3 / 4 == 4) so that a single connection is removed
+		auto agingConfig = CreateAgingConfiguration(6, 8);
+		auto removeCandidates = SelectNodesForRemoval(container, agingConfig, UniformImportanceRetriever);
+
+		// Assert:
+		ASSERT_EQ(1u, removeCandidates.size());
+		EXPECT_EQ(nodes[2].identity().PublicKey, removeCandidates.cbegin()->PublicKey);
+	}
+
 	// endregion
 }}
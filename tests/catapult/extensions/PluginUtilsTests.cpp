@@ -35,6 +35,10 @@ namespace catapult { namespace extensions {
 		test::MutableCatapultConfiguration config;
 		config.Node.EnableCacheDatabaseStorage = true;
 		config.Node.MaxCacheDatabaseWriteBatchSize = utils::FileSize::FromKilobytes(123);
+		config.Node.MaxCacheDatabaseDecodedValuesSize = utils::FileSize::FromKilobytes(456);
+		config.Node.MaxCacheDatabasePatriciaTreeNodesSize = utils::FileSize::FromKilobytes(789);
+		config.Node.MaxCacheCommitThreads = 7;
+		config.Node.MaxStatePathsKeys = 321;
 		config.User.DataDirectory = "foo_bar";
 
 		// Act:
@@ -44,6 +48,10 @@ namespace catapult { namespace extensions {
 		EXPECT_TRUE(storageConfig.PreferCacheDatabase);
 		EXPECT_EQ("foo_bar/statedb", storageConfig.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(123), storageConfig.MaxCacheDatabaseWriteBatchSize);
+		EXPECT_EQ(utils::FileSize::FromKilobytes(456), storageConfig.MaxCacheDatabaseDecodedValuesSize);
+		EXPECT_EQ(utils::FileSize::FromKilobytes(789), storageConfig.MaxCacheDatabasePatriciaTreeNodesSize);
+		EXPECT_EQ(7u, storageConfig.MaxCacheCommitThreads);
+		EXPECT_EQ(321u, storageConfig.MaxStatePathsKeys);
 	}
 
 	namespace {
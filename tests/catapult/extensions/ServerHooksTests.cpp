@@ -307,6 +307,53 @@ namespace catapult { namespace extensions {
 
 	// endregion
 
+	// region networkChainHeightSupplier
+
+	TEST(TEST_CLASS, UnsetNetworkChainHeightSupplierReturnsZero) {
+		// Arrange:
+		ServerHooks hooks;
+
+		// Act:
+		auto supplier = hooks.networkChainHeightSupplier();
+		ASSERT_TRUE(!!supplier);
+
+		auto height = supplier();
+
+		// Assert:
+		EXPECT_EQ(Height(0), height);
+	}
+
+	TEST(TEST_CLASS, CanSetOnce_NetworkChainHeightSupplier) {
+		// Arrange:
+		auto numCalls = 0u;
+		ServerHooks hooks;
+		hooks.setNetworkChainHeightSupplier([&numCalls]() {
+			++numCalls;
+			return Height(123);
+		});
+
+		// Act:
+		auto supplier = hooks.networkChainHeightSupplier();
+		ASSERT_TRUE(!!supplier);
+
+		auto height = supplier();
+
+		// Assert:
+		EXPECT_EQ(1u, numCalls);
+		EXPECT_EQ(Height(123), height);
+	}
+
+	TEST(TEST_CLASS, CannotSetMultipleTimes_NetworkChainHeightSupplier) {
+		// Arrange:
+		ServerHooks hooks;
+		hooks.setNetworkChainHeightSupplier([]() { return Height(123); });
+
+		// Act + Assert:
+		EXPECT_THROW(hooks.setNetworkChainHeightSupplier([]() { return Height(234); }), catapult_invalid_argument);
+	}
+
+	// endregion
+
 	// region knownHashPredicate
 
 	namespace {
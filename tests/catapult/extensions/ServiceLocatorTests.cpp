@@ -49,6 +49,7 @@ namespace catapult { namespace extensions {
 		// Assert:
 		EXPECT_EQ(&keys, &locator.keys());
 		EXPECT_TRUE(locator.counters().empty());
+		EXPECT_TRUE(locator.histograms().empty());
 		EXPECT_EQ(0u, locator.numServices());
 	}
 
@@ -289,4 +290,94 @@ namespace catapult { namespace extensions {
 	}
 
 	// endregion
+
+	// region histograms
+
+	namespace {
+		utils::DiagnosticHistograms CreateServiceHistograms(uint32_t numHistograms) {
+			utils::DiagnosticHistograms histograms;
+			for (auto i = 0u; i < numHistograms; ++i) {
+				auto pHistogram = std::make_shared<utils::LatencyHistogram>();
+				histograms.emplace_back(utils::DiagnosticCounterId("ALPHA"), i, pHistogram);
+			}
+
+			return histograms;
+		}
+	}
+
+	TEST(TEST_CLASS, ServiceHistogramsAreEmptyWhenServiceIsNotRegistered) {
+		// Arrange:
+		RunLocatorTest([](ServiceLocator& locator) {
+			// - notice that registerService is not called
+			locator.registerServiceHistograms<uint32_t>("foo", [](auto value) { return CreateServiceHistograms(value); });
+
+			// Act:
+			auto histograms = locator.histograms();
+
+			// Assert:
+			EXPECT_TRUE(histograms.empty());
+		});
+	}
+
+	TEST(TEST_CLASS, ServiceHistogramsAreReturnedWhenServiceIsRegisteredAndNotDestroyed) {
+		// Arrange:
+		RunLocatorTest([](ServiceLocator& locator) {
+			auto pService = std::make_shared<uint32_t>(3);
+			locator.registerService("foo", pService);
+			locator.registerServiceHistograms<uint32_t>("foo", [](auto value) { return CreateServiceHistograms(value); });
+
+			// Act:
+			auto histograms = locator.histograms();
+
+			// Assert:
+			ASSERT_EQ(3u, histograms.size());
+			for (auto i = 0u; i < histograms.size(); ++i) {
+				EXPECT_EQ(utils::DiagnosticCounterId("ALPHA").value(), histograms[i].id().value()) << i;
+				EXPECT_EQ(i, histograms[i].tag()) << i;
+			}
+		});
+	}
+
+	TEST(TEST_CLASS, ServiceHistogramsAreEmptyWhenServiceIsRegisteredAndDestroyed) {
+		// Arrange:
+		RunLocatorTest([](ServiceLocator& locator) {
+			auto pService = std::make_shared<uint32_t>(3);
+			locator.registerService("foo", pService);
+			locator.registerServiceHistograms<uint32_t>("foo", [](auto value) { return CreateServiceHistograms(value); });
+			pService.reset();
+
+			// Act:
+			auto histograms = locator.histograms();
+
+			// Assert:
+			EXPECT_TRUE(histograms.empty());
+		});
+	}
+
+	TEST(TEST_CLASS, HistogramsAreMergedInRegistrationOrder) {
+		// Arrange:
+		RunLocatorTest([](ServiceLocator& locator) {
+			auto pService = std::make_shared<uint32_t>(2);
+			locator.registerService("foo", pService);
+			locator.registerHistogram(utils::DiagnosticHistogram(
+					utils::DiagnosticCounterId("BETA"),
+					7,
+					std::make_shared<utils::LatencyHistogram>()));
+			locator.registerServiceHistograms<uint32_t>("foo", [](auto value) { return CreateServiceHistograms(value); });
+
+			// Act:
+			auto histograms = locator.histograms();
+
+			// Assert:
+			ASSERT_EQ(3u, histograms.size());
+			EXPECT_EQ("BETA", histograms[0].id().name());
+			EXPECT_EQ(7u, histograms[0].tag());
+			EXPECT_EQ("ALPHA", histograms[1].id().name());
+			EXPECT_EQ(0u, histograms[1].tag());
+			EXPECT_EQ("ALPHA", histograms[2].id().name());
+			EXPECT_EQ(1u, histograms[2].tag());
+		});
+	}
+
+	// endregion
 }}
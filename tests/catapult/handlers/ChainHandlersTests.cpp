@@ -20,8 +20,12 @@
 
 #include "catapult/handlers/ChainHandlers.h"
 #include "catapult/api/ChainPackets.h"
+#include "catapult/api/CompactBlockUtils.h"
 #include "catapult/utils/FileSize.h"
 #include "tests/catapult/handlers/test/HeightRequestHandlerTests.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/EntityTestUtils.h"
+#include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -101,6 +105,248 @@ namespace catapult { namespace handlers {
 
 	// endregion
 
+	// region CompactBlockHandler
+
+	namespace {
+		std::shared_ptr<ionet::Packet> PayloadToPacket(const ionet::PacketPayload& payload) {
+			const auto& header = payload.header();
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(header.Size - sizeof(ionet::Packet));
+			pPacket->Type = header.Type;
+
+			size_t dataOffset = 0;
+			for (const auto& buffer : payload.buffers()) {
+				std::memcpy(pPacket->Data() + dataOffset, buffer.pData, buffer.Size);
+				dataOffset += buffer.Size;
+			}
+
+			return pPacket;
+		}
+
+		std::shared_ptr<const model::Block> GenerateBlockWithTransactionsHash(
+				size_t numTransactions,
+				const model::TransactionRegistry& registry,
+				const GenerationHash& generationHash) {
+			auto pBlock = test::GenerateBlockWithTransactions(numTransactions, Height(345));
+			pBlock->TransactionsHash = api::CalculateBlockTransactionsHash(*pBlock, registry, generationHash);
+			return pBlock;
+		}
+
+		class CompactBlockHandlerTestContext {
+		public:
+			explicit CompactBlockHandlerTestContext(size_t numTransactions)
+					: m_registry(mocks::CreateDefaultTransactionRegistry())
+					, m_generationHash(test::GenerateRandomByteArray<GenerationHash>())
+					, m_pBlock(GenerateBlockWithTransactionsHash(numTransactions, m_registry, m_generationHash))
+					, m_sourceHost("11.22.33.44")
+					, m_handlerContext(test::GenerateRandomByteArray<Key>(), m_sourceHost) {
+				for (auto i = 0u; i < numTransactions; ++i)
+					m_shortHashes.push_back(utils::ShortHash(i + 1));
+
+				for (const auto& transaction : m_pBlock->Transactions())
+					m_transactions.push_back(test::CopyEntity(transaction));
+
+				RegisterCompactBlockHandler(m_handlers, m_registry, m_generationHash, [this](const auto& shortHashes) {
+					m_retrieverRequests.push_back(shortHashes);
+
+					model::Transactions transactions;
+					for (auto shortHash : shortHashes) {
+						auto index = shortHash.unwrap() - 1;
+						transactions.push_back(m_knownIndexes.cend() != m_knownIndexes.find(index) ? m_transactions[index] : nullptr);
+					}
+
+					return transactions;
+				}, [this](auto&& range) {
+					for (const auto& block : range.Range)
+						m_forwardedBlocks.push_back(test::CopyEntity(block));
+				});
+			}
+
+		public:
+			const model::Block& block() const {
+				return *m_pBlock;
+			}
+
+			const auto& retrieverRequests() const {
+				return m_retrieverRequests;
+			}
+
+			const auto& forwardedBlocks() const {
+				return m_forwardedBlocks;
+			}
+
+			const auto& handlerContext() const {
+				return m_handlerContext;
+			}
+
+		public:
+			void setKnownIndexes(const std::set<uint32_t>& knownIndexes) {
+				m_knownIndexes = knownIndexes;
+			}
+
+			void replaceTransaction(size_t index, const std::shared_ptr<const model::Transaction>& pTransaction) {
+				m_transactions[index] = pTransaction;
+			}
+
+			void process(const std::vector<uint32_t>& prefilledIndexes) {
+				processPacket(*createPacket(prefilledIndexes));
+			}
+
+			void processPacket(const ionet::Packet& packet) {
+				EXPECT_TRUE(m_handlers.process(packet, m_handlerContext));
+			}
+
+			std::shared_ptr<ionet::Packet> createPacket(const std::vector<uint32_t>& prefilledIndexes) const {
+				return PayloadToPacket(api::CreateCompactBlockPayload(m_pBlock, m_shortHashes, prefilledIndexes));
+			}
+
+		private:
+			model::TransactionRegistry m_registry;
+			GenerationHash m_generationHash;
+			std::shared_ptr<const model::Block> m_pBlock;
+			std::vector<utils::ShortHash> m_shortHashes;
+			std::vector<std::shared_ptr<const model::Transaction>> m_transactions;
+			std::set<uint32_t> m_knownIndexes;
+
+			ionet::ServerPacketHandlers m_handlers;
+			std::string m_sourceHost;
+			ionet::ServerPacketHandlerContext m_handlerContext;
+			std::vector<std::vector<utils::ShortHash>> m_retrieverRequests;
+			std::vector<std::unique_ptr<model::Block>> m_forwardedBlocks;
+		};
+
+		void AssertMissingIndexesResponse(
+				const ionet::ServerPacketHandlerContext& handlerContext,
+				const std::vector<uint32_t>& expectedIndexes) {
+			auto expectedSize = sizeof(ionet::PacketHeader) + expectedIndexes.size() * sizeof(uint32_t);
+			test::AssertPacketHeader(handlerContext, expectedSize, ionet::PacketType::Compact_Block);
+
+			const auto* pIndexes = reinterpret_cast<const uint32_t*>(test::GetSingleBufferData(handlerContext));
+			EXPECT_EQ(expectedIndexes, std::vector<uint32_t>(pIndexes, pIndexes + expectedIndexes.size()));
+		}
+
+		void AssertBlockForwarded(const CompactBlockHandlerTestContext& context) {
+			ASSERT_EQ(1u, context.forwardedBlocks().size());
+			EXPECT_EQ(context.block(), *context.forwardedBlocks()[0]);
+
+			test::AssertPacketHeader(context.handlerContext(), sizeof(ionet::PacketHeader), ionet::PacketType::Compact_Block);
+		}
+	}
+
+	TEST(TEST_CLASS, CompactBlockHandler_MalformedCompactBlockIsRejected) {
+		// Arrange:
+		CompactBlockHandlerTestContext context(5);
+		context.setKnownIndexes({ 0, 1, 2, 3, 4 });
+		auto pPacket = context.createPacket({});
+		--pPacket->Size;
+
+		// Act:
+		context.processPacket(*pPacket);
+
+		// Assert:
+		EXPECT_TRUE(context.retrieverRequests().empty());
+		EXPECT_TRUE(context.forwardedBlocks().empty());
+		test::AssertNoResponse(context.handlerContext());
+	}
+
+	TEST(TEST_CLASS, CompactBlockHandler_BlockWithoutTransactionsIsForwardedWithoutLookup) {
+		// Arrange:
+		CompactBlockHandlerTestContext context(0);
+
+		// Act:
+		context.process({});
+
+		// Assert:
+		EXPECT_TRUE(context.retrieverRequests().empty());
+		AssertBlockForwarded(context);
+	}
+
+	TEST(TEST_CLASS, CompactBlockHandler_BlockWithAllKnownTransactionsIsForwarded) {
+		// Arrange:
+		CompactBlockHandlerTestContext context(5);
+		context.setKnownIndexes({ 0, 1, 2, 3, 4 });
+
+		// Act:
+		context.process({});
+
+		// Assert:
+		ASSERT_EQ(1u, context.retrieverRequests().size());
+		EXPECT_EQ(5u, context.retrieverRequests()[0].size());
+		AssertBlockForwarded(context);
+	}
+
+	TEST(TEST_CLASS, CompactBlockHandler_BlockWithAllPrefilledTransactionsIsForwardedWithoutLookup) {
+		// Arrange:
+		CompactBlockHandlerTestContext context(5);
+
+		// Act:
+		context.process({ 0, 1, 2, 3, 4 });
+
+		// Assert:
+		EXPECT_TRUE(context.retrieverRequests().empty());
+		AssertBlockForwarded(context);
+	}
+
+	TEST(TEST_CLASS, CompactBlockHandler_BlockWithKnownAndPrefilledTransactionsIsForwarded) {
+		// Arrange:
+		CompactBlockHandlerTestContext context(5);
+		context.setKnownIndexes({ 0, 2, 4 });
+
+		// Act:
+		context.process({ 1, 3 });
+
+		// Assert: only short hashes of transactions that were not prefilled were looked up
+		ASSERT_EQ(1u, context.retrieverRequests().size());
+		EXPECT_EQ(std::vector<utils::ShortHash>({ utils::ShortHash(1), utils::ShortHash(3), utils::ShortHash(5) }),
+				context.retrieverRequests()[0]);
+		AssertBlockForwarded(context);
+	}
+
+	TEST(TEST_CLASS, CompactBlockHandler_BlockWithUnknownTransactionsIsNotForwarded) {
+		// Arrange:
+		CompactBlockHandlerTestContext context(5);
+		context.setKnownIndexes({ 0, 2 });
+
+		// Act:
+		context.process({ 3 });
+
+		// Assert: indexes of unknown transactions are returned
+		EXPECT_TRUE(context.forwardedBlocks().empty());
+		AssertMissingIndexesResponse(context.handlerContext(), { 1, 4 });
+	}
+
+	TEST(TEST_CLASS, CompactBlockHandler_BlockWithMismatchedTransactionsIsNotForwarded) {
+		// Arrange: replace a known transaction with a larger one that has the same short hash
+		CompactBlockHandlerTestContext context(5);
+		context.setKnownIndexes({ 0, 1, 2, 3 });
+		auto pLargerTransaction = std::shared_ptr<model::Transaction>(mocks::CreateMockTransaction(123));
+		context.replaceTransaction(2, pLargerTransaction);
+
+		// Act:
+		context.process({ 4 });
+
+		// Assert: indexes of all looked up transactions are returned
+		EXPECT_TRUE(context.forwardedBlocks().empty());
+		AssertMissingIndexesResponse(context.handlerContext(), { 0, 1, 2, 3 });
+	}
+
+	TEST(TEST_CLASS, CompactBlockHandler_BlockWithCollidingTransactionsIsNotForwarded) {
+		// Arrange: replace a known transaction with a same sized one that has the same short hash but different content
+		CompactBlockHandlerTestContext context(5);
+		context.setKnownIndexes({ 0, 1, 2, 3 });
+		auto pCollidingTransaction = test::CopyEntity(*context.block().Transactions().begin());
+		test::FillWithRandomData(pCollidingTransaction->Signature);
+		context.replaceTransaction(0, std::move(pCollidingTransaction));
+
+		// Act:
+		context.process({ 4 });
+
+		// Assert: indexes of all looked up transactions are returned
+		EXPECT_TRUE(context.forwardedBlocks().empty());
+		AssertMissingIndexesResponse(context.handlerContext(), { 0, 1, 2, 3 });
+	}
+
+	// endregion
+
 	// region PullBlockHandler
 
 	namespace {
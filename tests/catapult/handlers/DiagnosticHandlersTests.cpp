@@ -24,12 +24,18 @@
 #include "catapult/ionet/NodeInteractionResult.h"
 #include "catapult/ionet/PackedNodeInfo.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DiagnosticHistogramValue.h"
 #include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/Tracing.h"
 #include "tests/catapult/handlers/test/HeightRequestHandlerTests.h"
 #include "tests/test/core/BlockStatementTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryBlockStorage.h"
 #include "tests/test/net/NodeTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <fstream>
 
 namespace catapult { namespace handlers {
 
@@ -139,6 +145,183 @@ namespace catapult { namespace handlers {
 
 	// endregion
 
+	// region DiagnosticHistogramsHandler
+
+	namespace {
+		std::shared_ptr<utils::LatencyHistogram> CreateHistogram(const std::vector<uint64_t>& latencies) {
+			auto pHistogram = std::make_shared<utils::LatencyHistogram>();
+			for (auto latency : latencies)
+				pHistogram->record(std::chrono::microseconds(latency));
+
+			return pHistogram;
+		}
+
+		template<typename TAssertHandlerContext>
+		void AssertDiagnosticHistogramsHandlerWritesValuesInResponseToValidRequest(
+				const utils::DiagnosticHistograms& histograms,
+				TAssertHandlerContext assertHandlerContext) {
+			// Arrange:
+			ionet::ServerPacketHandlers handlers;
+			RegisterDiagnosticHistogramsHandler(handlers, [&histograms]() { return histograms; });
+
+			// - create a valid request
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+			pPacket->Type = ionet::PacketType::Diagnostic_Histograms;
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+			// Assert: header is correct
+			auto expectedPacketSize = sizeof(ionet::PacketHeader) + histograms.size() * sizeof(model::DiagnosticHistogramValue);
+			test::AssertPacketHeader(handlerContext, expectedPacketSize, ionet::PacketType::Diagnostic_Histograms);
+
+			// - histograms are written
+			assertHandlerContext(handlerContext);
+		}
+
+		void AssertHistogramValue(
+				const model::DiagnosticHistogramValue& histogramValue,
+				uint64_t expectedId,
+				uint32_t expectedTag,
+				const std::vector<uint64_t>& expectedValues) {
+			EXPECT_EQ(expectedId, histogramValue.Id);
+			EXPECT_EQ(expectedTag, histogramValue.Tag);
+			EXPECT_EQ(expectedValues[0], histogramValue.Count);
+			EXPECT_EQ(expectedValues[1], histogramValue.P50);
+			EXPECT_EQ(expectedValues[2], histogramValue.P90);
+			EXPECT_EQ(expectedValues[3], histogramValue.P99);
+			EXPECT_EQ(expectedValues[4], histogramValue.P999);
+			EXPECT_EQ(expectedValues[5], histogramValue.Max);
+		}
+	}
+
+	TEST(TEST_CLASS, DiagnosticHistogramsHandler_DoesNotRespondToMalformedRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		RegisterDiagnosticHistogramsHandler(handlers, []() { return utils::DiagnosticHistograms(); });
+
+		// Act + Assert:
+		AssertNoResponseWhenPacketIsMalformed(handlers, ionet::PacketType::Diagnostic_Histograms);
+	}
+
+	TEST(TEST_CLASS, DiagnosticHistogramsHandler_WritesValuesInResponseToValidRequest_ZeroHistograms) {
+		// Arrange:
+		auto histograms = utils::DiagnosticHistograms();
+
+		// Assert:
+		AssertDiagnosticHistogramsHandlerWritesValuesInResponseToValidRequest(histograms, [](const auto& handlerContext) {
+			EXPECT_TRUE(handlerContext.response().buffers().empty());
+		});
+	}
+
+	TEST(TEST_CLASS, DiagnosticHistogramsHandler_WritesValuesInResponseToValidRequest_MultipleHistograms) {
+		// Arrange: 90 values in bucket [960, 1024), 9 values in bucket [1920, 2048) and 1 value in bucket [3840, 4096)
+		std::vector<uint64_t> latencies(90, 1000);
+		latencies.insert(latencies.end(), 9, 2000);
+		latencies.push_back(4000);
+
+		auto histograms = utils::DiagnosticHistograms{
+			utils::DiagnosticHistogram(utils::DiagnosticCounterId(123), 7, CreateHistogram({})),
+			utils::DiagnosticHistogram(utils::DiagnosticCounterId(777), 8, CreateHistogram(latencies)),
+			utils::DiagnosticHistogram(utils::DiagnosticCounterId(225), 0, CreateHistogram({ 5 }))
+		};
+
+		// Assert:
+		AssertDiagnosticHistogramsHandlerWritesValuesInResponseToValidRequest(histograms, [](const auto& handlerContext) {
+			const auto* pHistogramValue = reinterpret_cast<const model::DiagnosticHistogramValue*>(
+					test::GetSingleBufferData(handlerContext));
+			AssertHistogramValue(*pHistogramValue, 123, 7, { 0, 0, 0, 0, 0, 0 });
+
+			++pHistogramValue;
+			AssertHistogramValue(*pHistogramValue, 777, 8, { 100, 1023, 1023, 2047, 2047, 4000 });
+
+			++pHistogramValue;
+			AssertHistogramValue(*pHistogramValue, 225, 0, { 1, 5, 5, 5, 5, 5 });
+		});
+	}
+
+	TEST(TEST_CLASS, DiagnosticHistogramsHandler_RetrievesHistogramsForEachRequest) {
+		// Arrange:
+		auto numSupplierCalls = 0u;
+		ionet::ServerPacketHandlers handlers;
+		RegisterDiagnosticHistogramsHandler(handlers, [&numSupplierCalls]() {
+			++numSupplierCalls;
+			return utils::DiagnosticHistograms();
+		});
+
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+		pPacket->Type = ionet::PacketType::Diagnostic_Histograms;
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i) {
+			ionet::ServerPacketHandlerContext handlerContext;
+			handlers.process(*pPacket, handlerContext);
+		}
+
+		// Assert:
+		EXPECT_EQ(3u, numSupplierCalls);
+	}
+
+	// endregion
+
+	// region DiagnosticTraceEventsHandler
+
+	TEST(TEST_CLASS, DiagnosticTraceEventsHandler_DoesNotRespondToMalformedRequest) {
+		// Arrange:
+		test::TempFileGuard traceFileGuard("trace.json");
+		ionet::ServerPacketHandlers handlers;
+		RegisterDiagnosticTraceEventsHandler(handlers, traceFileGuard.name());
+
+		// Act + Assert:
+		AssertNoResponseWhenPacketIsMalformed(handlers, ionet::PacketType::Diagnostic_Trace_Events);
+		EXPECT_FALSE(boost::filesystem::exists(traceFileGuard.name()));
+	}
+
+	TEST(TEST_CLASS, DiagnosticTraceEventsHandler_WritesTraceEventsToFileInResponseToValidRequest) {
+		// Arrange:
+		test::TempFileGuard traceFileGuard("trace.json");
+		ionet::ServerPacketHandlers handlers;
+		RegisterDiagnosticTraceEventsHandler(handlers, traceFileGuard.name());
+
+		// - record a single span
+		utils::SetTracingEnabled(true);
+		utils::ClearTraceEvents();
+		{
+			utils::TraceSpan span("test", "alpha");
+			span.setHeight(Height(123));
+		}
+
+		utils::SetTracingEnabled(false);
+
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+		pPacket->Type = ionet::PacketType::Diagnostic_Trace_Events;
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+		utils::ClearTraceEvents();
+
+		// Assert: header is correct
+		test::AssertPacketHeader(handlerContext, sizeof(ionet::PacketHeader), ionet::PacketType::Diagnostic_Trace_Events);
+		EXPECT_TRUE(handlerContext.response().buffers().empty());
+
+		// - trace file contains the span
+		boost::property_tree::ptree trace;
+		std::ifstream traceFile(traceFileGuard.name());
+		boost::property_tree::read_json(traceFile, trace);
+
+		const auto& traceEvents = trace.get_child("traceEvents");
+		ASSERT_EQ(1u, traceEvents.size());
+
+		const auto& traceEvent = traceEvents.begin()->second;
+		EXPECT_EQ("alpha", traceEvent.get<std::string>("name"));
+		EXPECT_EQ("test", traceEvent.get<std::string>("cat"));
+		EXPECT_EQ(123u, traceEvent.get<uint64_t>("args.height"));
+	}
+
+	// endregion
+
 	// region DiagnosticNodesHandler
 
 	TEST(TEST_CLASS, DiagnosticNodesHandler_DoesNotRespondToMalformedRequest) {
@@ -371,6 +554,100 @@ namespace catapult { namespace handlers {
 
 	// endregion
 
+	// region DiagnosticNodeTrafficHandler
+
+	TEST(TEST_CLASS, DiagnosticNodeTrafficHandler_DoesNotRespondToMalformedRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		ionet::NodeContainer nodeContainer;
+		RegisterDiagnosticNodeTrafficHandler(handlers, nodeContainer);
+
+		// Act + Assert:
+		AssertNoResponseWhenPacketIsMalformed(handlers, ionet::PacketType::Active_Node_Traffic);
+	}
+
+	namespace {
+		std::vector<ionet::PackedNodeTraffic> ProcessNodeTrafficRequest(const ionet::NodeContainer& nodeContainer) {
+			// Arrange:
+			ionet::ServerPacketHandlers handlers;
+			RegisterDiagnosticNodeTrafficHandler(handlers, nodeContainer);
+
+			// - create a valid request
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+			pPacket->Type = ionet::PacketType::Active_Node_Traffic;
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+			// Assert: header is correct
+			const auto& header = handlerContext.response().header();
+			EXPECT_EQ(ionet::PacketType::Active_Node_Traffic, header.Type);
+			EXPECT_EQ(0u, (header.Size - sizeof(ionet::PacketHeader)) % sizeof(ionet::PackedNodeTraffic));
+			if (sizeof(ionet::PacketHeader) == header.Size)
+				return {};
+
+			const auto* pNodeTraffic = reinterpret_cast<const ionet::PackedNodeTraffic*>(test::GetSingleBufferData(handlerContext));
+			auto numNodeTraffics = (header.Size - sizeof(ionet::PacketHeader)) / sizeof(ionet::PackedNodeTraffic);
+			return std::vector<ionet::PackedNodeTraffic>(pNodeTraffic, pNodeTraffic + numNodeTraffics);
+		}
+	}
+
+	TEST(TEST_CLASS, DiagnosticNodeTrafficHandler_WritesTrafficInResponseToValidRequest_ZeroActiveNodes) {
+		// Arrange: add two inactive nodes
+		auto keys = test::GenerateRandomDataVector<Key>(2);
+		ionet::NodeContainer nodeContainer;
+		{
+			auto modifier = nodeContainer.modifier();
+			modifier.add(CreateNamedNode(keys[0], "a"), ionet::NodeSource::Static);
+			modifier.add(CreateNamedNode(keys[1], "b"), ionet::NodeSource::Dynamic);
+			modifier.addReadTraffic(ToIdentity(keys[1]), 1234, 5);
+		}
+
+		// Act:
+		auto nodeTraffics = ProcessNodeTrafficRequest(nodeContainer);
+
+		// Assert:
+		EXPECT_TRUE(nodeTraffics.empty());
+	}
+
+	TEST(TEST_CLASS, DiagnosticNodeTrafficHandler_WritesTrafficInResponseToValidRequest_MultipleActiveNodes) {
+		// Arrange: add two active nodes and one inactive node
+		auto keys = test::GenerateRandomDataVector<Key>(3);
+		ionet::NodeContainer nodeContainer;
+		{
+			auto modifier = nodeContainer.modifier();
+			modifier.add(CreateNamedNode(keys[0], "a"), ionet::NodeSource::Static);
+			modifier.add(CreateNamedNode(keys[1], "b"), ionet::NodeSource::Dynamic);
+			modifier.add(CreateNamedNode(keys[2], "c"), ionet::NodeSource::Local);
+
+			modifier.addReadTraffic(ToIdentity(keys[0]), 1234, 5);
+			modifier.addReadTraffic(ToIdentity(keys[0]), 100, 2);
+			modifier.addReadTraffic(ToIdentity(keys[2]), 999, 1);
+
+			modifier.provisionConnectionState(ionet::ServiceIdentifier(123), ToIdentity(keys[0])) = CreateConnectionState(7, 3, 2);
+			modifier.provisionConnectionState(ionet::ServiceIdentifier(123), ToIdentity(keys[1])) = CreateConnectionState(1, 5, 6);
+		}
+
+		// Act:
+		auto nodeTraffics = ProcessNodeTrafficRequest(nodeContainer);
+
+		// Assert: traffic of all active nodes is returned in any order
+		ASSERT_EQ(2u, nodeTraffics.size());
+		if (keys[0] != nodeTraffics[0].IdentityKey)
+			std::swap(nodeTraffics[0], nodeTraffics[1]);
+
+		EXPECT_EQ(keys[0], nodeTraffics[0].IdentityKey);
+		EXPECT_EQ(1334u, nodeTraffics[0].NumReadBytes);
+		EXPECT_EQ(7u, nodeTraffics[0].NumReadPackets);
+
+		EXPECT_EQ(keys[1], nodeTraffics[1].IdentityKey);
+		EXPECT_EQ(0u, nodeTraffics[1].NumReadBytes);
+		EXPECT_EQ(0u, nodeTraffics[1].NumReadPackets);
+	}
+
+	// endregion
+
 	// region DiagnosticBlockStatementHandler
 
 	namespace {
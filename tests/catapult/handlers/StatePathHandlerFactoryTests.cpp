@@ -33,6 +33,7 @@ namespace catapult { namespace handlers {
 		constexpr auto Mock_Packet_Type = static_cast<ionet::PacketType>(0x1234);
 		using TestPayloadType = uint64_t;
 		constexpr auto Payload_Size = sizeof(TestPayloadType);
+		constexpr uint32_t Max_State_Paths_Keys = 5;
 
 		// region helpers
 
@@ -67,9 +68,10 @@ namespace catapult { namespace handlers {
 
 		class MockCacheView {
 		public:
-			MockCacheView(bool result, const StatePath& path)
+			MockCacheView(bool result, const StatePath& path, std::vector<uint64_t>& lookupKeys)
 					: m_result(result)
 					, m_path(path)
+					, m_lookupKeys(lookupKeys)
 			{}
 
 		public:
@@ -80,20 +82,40 @@ namespace catapult { namespace handlers {
 				return std::make_pair(Hash256(), m_result);
 			}
 
+			auto tryLookup(const std::vector<uint64_t>& keys, StatePath& nodes) const {
+				m_lookupKeys = keys;
+				for (const auto& node : m_path)
+					nodes.push_back(node.copy());
+
+				return std::vector<std::pair<Hash256, bool>>(keys.size(), std::make_pair(Hash256(), m_result));
+			}
+
 		private:
 			const bool m_result;
 			const StatePath& m_path;
+			std::vector<uint64_t>& m_lookupKeys;
 		};
 
 		class MockCache {
 		public:
-			MockCache() : m_lookupResult(false)
+			MockCache()
+					: m_lookupResult(false)
+					, m_numViews(0)
 			{}
 
 		public:
 			auto createView() const {
+				++m_numViews;
 				auto readLock = m_lock.acquireReader();
-				return cache::LockedCacheView<MockCacheView>(MockCacheView(m_lookupResult, m_path), std::move(readLock));
+				return cache::LockedCacheView<MockCacheView>(MockCacheView(m_lookupResult, m_path, m_lookupKeys), std::move(readLock));
+			}
+
+			const auto& lookupKeys() const {
+				return m_lookupKeys;
+			}
+
+			size_t numViews() const {
+				return m_numViews;
 			}
 
 		public:
@@ -110,6 +132,8 @@ namespace catapult { namespace handlers {
 			mutable utils::SpinReaderWriterLock m_lock;
 			bool m_lookupResult;
 			StatePath m_path;
+			mutable std::vector<uint64_t> m_lookupKeys;
+			mutable size_t m_numViews;
 		};
 
 		// endregion
@@ -155,6 +179,19 @@ namespace catapult { namespace handlers {
 			}
 		};
 
+		struct StatePathsRequestTraits {
+			static constexpr ionet::PacketType Packet_Type = Mock_Packet_Type;
+
+			using RequestStructureType = TestPayloadType;
+		};
+
+		struct StatePathsHandlerFactoryTraits : public StatePathHandlerFactoryTraits {
+		public:
+			static void RegisterHandler(ionet::ServerPacketHandlers& handlers, const MockCache& cache) {
+				RegisterStatePathsHandler<StatePathsRequestTraits>(handlers, cache, Max_State_Paths_Keys);
+			}
+		};
+
 		// endregion
 
 		// region base tests
@@ -172,6 +209,10 @@ namespace catapult { namespace handlers {
 			StatePathHandlerFactoryTraits,
 			CacheHandlerTraits<StatePathHandlerFactoryTraits>>;
 
+		using BasicStatePathsHandlerTests = test::BasicBatchHandlerTests<
+			StatePathsHandlerFactoryTraits,
+			CacheHandlerTraits<StatePathsHandlerFactoryTraits>>;
+
 		// endregion
 
 		// region valid packet tests
@@ -252,4 +293,92 @@ namespace catapult { namespace handlers {
 					AssertReturnedValue(expectedResponse, handlerContext.response());
 				});
 	}
+
+	// region state paths
+
+#define MAKE_BASIC_STATE_PATHS_HANDLER_TEST(NAME) TEST(TEST_CLASS, StatePaths_##NAME) { BasicStatePathsHandlerTests::Assert##NAME(); }
+
+	MAKE_BASIC_STATE_PATHS_HANDLER_TEST(TooSmallPacketIsRejected)
+	MAKE_BASIC_STATE_PATHS_HANDLER_TEST(PacketWithWrongTypeIsRejected)
+	MAKE_BASIC_STATE_PATHS_HANDLER_TEST(PacketWithInvalidPayloadIsRejected)
+	MAKE_BASIC_STATE_PATHS_HANDLER_TEST(PacketWithTooSmallPayloadIsRejected)
+	MAKE_BASIC_STATE_PATHS_HANDLER_TEST(PacketWithNoPayloadIsRejected)
+
+	namespace {
+		std::vector<uint64_t> ExtractKeys(const ionet::Packet& packet) {
+			const auto* pKeys = reinterpret_cast<const uint64_t*>(packet.Data());
+			return std::vector<uint64_t>(pKeys, pKeys + (packet.Size - sizeof(ionet::PacketHeader)) / Payload_Size);
+		}
+	}
+
+	namespace {
+		void AssertCombinedProofIsReturnedForAllKeys(uint32_t numKeys) {
+			// Arrange:
+			StatePathsHandlerFactoryTraits::TestContext testContext;
+			auto expectedResponse = testContext.getCache().setLookupResult(true, 10);
+
+			ionet::ServerPacketHandlers handlers;
+			StatePathsHandlerFactoryTraits::RegisterHandler(handlers, testContext.getCache());
+			auto pPacket = test::CreateRandomPacket(numKeys * Payload_Size, Mock_Packet_Type);
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+			// Assert: all keys were looked up together
+			EXPECT_EQ(ExtractKeys(*pPacket), testContext.getCache().lookupKeys());
+
+			// - response packet contains serialized nodes
+			ASSERT_TRUE(handlerContext.hasResponse());
+			test::AssertPacketHeader(handlerContext, sizeof(ionet::PacketHeader) + expectedResponse.size(), Mock_Packet_Type);
+			AssertReturnedValue(expectedResponse, handlerContext.response());
+		}
+	}
+
+	TEST(TEST_CLASS, StatePaths_CombinedProofIsReturnedForAllKeys) {
+		AssertCombinedProofIsReturnedForAllKeys(3);
+	}
+
+	TEST(TEST_CLASS, StatePaths_CombinedProofIsReturnedForMaxKeys) {
+		AssertCombinedProofIsReturnedForAllKeys(Max_State_Paths_Keys);
+	}
+
+	TEST(TEST_CLASS, StatePaths_NoResponseIsReturnedWhenRequestExceedsMaxKeys) {
+		// Arrange:
+		StatePathsHandlerFactoryTraits::TestContext testContext;
+		testContext.getCache().setLookupResult(true, 10);
+
+		ionet::ServerPacketHandlers handlers;
+		StatePathsHandlerFactoryTraits::RegisterHandler(handlers, testContext.getCache());
+		auto pPacket = test::CreateRandomPacket((Max_State_Paths_Keys + 1) * Payload_Size, Mock_Packet_Type);
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+		// Assert: the request was rejected without creating a cache view
+		EXPECT_EQ(0u, testContext.getCache().numViews());
+		EXPECT_TRUE(testContext.getCache().lookupKeys().empty());
+		EXPECT_FALSE(handlerContext.hasResponse());
+	}
+
+	TEST(TEST_CLASS, StatePaths_NoResponseIsReturnedWhenResponseExceedsMaxPacketDataSize) {
+		// Arrange:
+		StatePathsHandlerFactoryTraits::TestContext testContext;
+		auto expectedResponse = testContext.getCache().setLookupResult(true, 10);
+
+		ionet::ServerPacketHandlers handlers(static_cast<uint32_t>(expectedResponse.size() - 1));
+		StatePathsHandlerFactoryTraits::RegisterHandler(handlers, testContext.getCache());
+		auto pPacket = test::CreateRandomPacket(3 * Payload_Size, Mock_Packet_Type);
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+		// Assert:
+		EXPECT_EQ(3u, testContext.getCache().lookupKeys().size());
+		EXPECT_FALSE(handlerContext.hasResponse());
+	}
+
+	// endregion
 }}
@@ -179,4 +179,88 @@ namespace catapult { namespace handlers {
 	DEFINE_PULL_HANDLER_REQUEST_RESPONSE_TESTS(TEST_CLASS, AssertPullResponseIsSetWhenPacketIsValid)
 
 	// endregion
+
+	// region TransactionInventoryHandler
+
+	namespace {
+		constexpr auto Inventory_Packet_Type = ionet::PacketType::Transaction_Inventory;
+
+		void AssertInventoryResponseIsNotSet(uint32_t payloadSize) {
+			// Arrange:
+			auto pPacket = test::CreateRandomPacket(payloadSize, Inventory_Packet_Type);
+			ionet::ServerPacketHandlers handlers;
+			auto numRetrieverCalls = 0u;
+			RegisterTransactionInventoryHandler(handlers, [&numRetrieverCalls](const auto&) {
+				++numRetrieverCalls;
+				return std::vector<Hash256>();
+			});
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+			// Assert:
+			EXPECT_EQ(0u, numRetrieverCalls);
+			EXPECT_FALSE(handlerContext.hasResponse());
+		}
+
+		void AssertInventoryResponseIsSet(uint32_t numRequestTransactions, const std::vector<size_t>& unknownHashIndexes) {
+			// Arrange:
+			auto requestDataSize = numRequestTransactions * static_cast<uint32_t>(sizeof(model::AnnouncedTransaction));
+			auto pPacket = test::CreateRandomPacket(requestDataSize, Inventory_Packet_Type);
+			const auto* pRequestTransactions = reinterpret_cast<const model::AnnouncedTransaction*>(pPacket->Data());
+
+			ionet::ServerPacketHandlers handlers;
+			std::vector<model::AnnouncedTransaction> actualRequestTransactions;
+			std::vector<Hash256> unknownHashes;
+			for (auto index : unknownHashIndexes)
+				unknownHashes.push_back(pRequestTransactions[index].EntityHash);
+
+			RegisterTransactionInventoryHandler(handlers, [&actualRequestTransactions, &unknownHashes](const auto& transactions) {
+				actualRequestTransactions.assign(transactions.cbegin(), transactions.cend());
+				return unknownHashes;
+			});
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+			// Assert: all announced transactions were passed to the retriever
+			ASSERT_EQ(numRequestTransactions, actualRequestTransactions.size());
+			EXPECT_EQ_MEMORY(pRequestTransactions, actualRequestTransactions.data(), requestDataSize);
+
+			// - the response contains the unknown hashes
+			ASSERT_TRUE(handlerContext.hasResponse());
+			auto payload = handlerContext.response();
+			auto unknownHashesSize = static_cast<uint32_t>(unknownHashes.size() * Hash256::Size);
+			test::AssertPacketHeader(payload, sizeof(ionet::PacketHeader) + unknownHashesSize, Inventory_Packet_Type);
+			if (unknownHashes.empty())
+				return;
+
+			ASSERT_EQ(1u, payload.buffers().size());
+			EXPECT_EQ_MEMORY(unknownHashes.data(), payload.buffers()[0].pData, unknownHashesSize);
+		}
+	}
+
+	TEST(TEST_CLASS, TransactionInventoryHandler_DoesNotRespondToEmptyRequest) {
+		AssertInventoryResponseIsNotSet(0);
+	}
+
+	TEST(TEST_CLASS, TransactionInventoryHandler_DoesNotRespondToMalformedRequest) {
+		AssertInventoryResponseIsNotSet(static_cast<uint32_t>(3 * sizeof(model::AnnouncedTransaction) / 2));
+	}
+
+	TEST(TEST_CLASS, TransactionInventoryHandler_RespondsWithEmptyPayloadWhenAllHashesAreKnown) {
+		AssertInventoryResponseIsSet(5, {});
+	}
+
+	TEST(TEST_CLASS, TransactionInventoryHandler_RespondsWithUnknownHashes) {
+		AssertInventoryResponseIsSet(5, { 1, 3, 4 });
+	}
+
+	TEST(TEST_CLASS, TransactionInventoryHandler_RespondsWithAllHashesWhenAllHashesAreUnknown) {
+		AssertInventoryResponseIsSet(5, { 0, 1, 2, 3, 4 });
+	}
+
+	// endregion
 }}
@@ -574,6 +574,38 @@ namespace catapult { namespace io {
 		AssertIndexFiles(context, 120, 119);
 	}
 
+	DIRECTORY_TRAITS_BASED_TEST(CanReadTimedMessageWhenReaderIndexIsLessThanWriterIndex) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 118);
+
+		constexpr auto Message_Filename = "0000000000000076.dat"; // 118 == 0x76
+		auto writeBuffer = test::GenerateRandomVector(21);
+		auto startTime = std::chrono::system_clock::now() - std::chrono::seconds(1);
+		context.write(Message_Filename, writeBuffer);
+
+		// Act:
+		auto numCalls = 0u;
+		std::vector<uint8_t> readBuffer;
+		std::chrono::system_clock::time_point writeTime;
+		auto result = context.reader().tryReadNextTimedMessage([&numCalls, &readBuffer, &writeTime](const auto& buffer, auto time) {
+			++numCalls;
+			readBuffer = buffer;
+			writeTime = time;
+		});
+
+		// Assert: write time has at least second resolution
+		EXPECT_TRUE(result);
+		EXPECT_EQ(1u, numCalls);
+		EXPECT_EQ(writeBuffer, readBuffer);
+		EXPECT_LE(startTime, writeTime);
+		EXPECT_GE(std::chrono::system_clock::now(), writeTime);
+
+		// - processed data file should have been deleted
+		EXPECT_EQ(2u, context.countFiles());
+		AssertIndexFiles(context, 120, 119);
+	}
+
 	DIRECTORY_TRAITS_BASED_TEST(CanReadAtMostOneFileWhenReaderIndexIsLessThanWriterIndex) {
 		// Arrange:
 		ReaderTestContext<TTraits> context;
@@ -636,6 +668,93 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region FileQueueReader - read multiple
+
+	namespace {
+		constexpr const char* Batch_Message_Filenames[] = {
+			"0000000000000075.dat", // 117 == 0x75
+			"0000000000000076.dat", // 118 == 0x76
+			"0000000000000077.dat" // 119 == 0x77
+		};
+
+		template<typename TTraits>
+		std::vector<std::vector<uint8_t>> WriteBatchMessages(ReaderTestContext<TTraits>& context) {
+			context.setIndexes(120, 117);
+
+			std::vector<std::vector<uint8_t>> writeBuffers;
+			for (const auto* messageFilename : Batch_Message_Filenames) {
+				writeBuffers.push_back(test::GenerateRandomVector(21));
+				context.write(messageFilename, writeBuffers.back());
+			}
+
+			return writeBuffers;
+		}
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CanReadMultipleMessagesBeforeCommit) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		auto writeBuffers = WriteBatchMessages(context);
+
+		// Act:
+		std::vector<std::vector<uint8_t>> readBuffers;
+		auto numCommits = 0u;
+		auto numMessages = context.reader().readNextTimedMessages(2, [&readBuffers](const auto& buffer, auto) {
+			readBuffers.push_back(buffer);
+		}, [&context, &numCommits]() {
+			// Assert: nothing is removed before commit
+			EXPECT_EQ(5u, context.countFiles());
+			AssertIndexFiles(context, 120, 117);
+			++numCommits;
+		});
+
+		// Assert:
+		EXPECT_EQ(2u, numMessages);
+		EXPECT_EQ(1u, numCommits);
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>(writeBuffers.cbegin(), writeBuffers.cbegin() + 2), readBuffers);
+
+		// - processed data files should have been deleted
+		EXPECT_EQ(3u, context.countFiles());
+		AssertIndexFiles(context, 120, 119);
+		EXPECT_TRUE(context.exists(Batch_Message_Filenames[2]));
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CanReadAtMostPendingMessagesBeforeCommit) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		auto writeBuffers = WriteBatchMessages(context);
+
+		// Act:
+		std::vector<std::vector<uint8_t>> readBuffers;
+		auto numMessages = context.reader().readNextTimedMessages(10, [&readBuffers](const auto& buffer, auto) {
+			readBuffers.push_back(buffer);
+		}, []() {});
+
+		// Assert:
+		EXPECT_EQ(3u, numMessages);
+		EXPECT_EQ(writeBuffers, readBuffers);
+
+		EXPECT_EQ(2u, context.countFiles());
+		AssertIndexFiles(context, 120, 120);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(ReadMultipleDoesNotRemoveDataFilesWhenCommitFails) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		WriteBatchMessages(context);
+
+		// Act:
+		EXPECT_THROW(context.reader().readNextTimedMessages(2, [](const auto&, auto) {}, []() {
+			CATAPULT_THROW_RUNTIME_ERROR("commit failed");
+		}), catapult_runtime_error);
+
+		// Assert: data files should not have been deleted because they were not committed
+		EXPECT_EQ(5u, context.countFiles());
+		AssertIndexFiles(context, 120, 117);
+	}
+
+	// endregion
+
 	// region FileQueueReader - skip
 
 	namespace {
@@ -690,4 +809,394 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region segmented queue
+
+	namespace {
+		constexpr auto Max_Segment_Size = utils::FileSize::FromBytes(100);
+		constexpr auto Segment_Record_Header_Size = sizeof(uint32_t) + sizeof(uint64_t);
+
+		class SegmentedQueueTestContext : public BasicQueueTestContext<DefaultTraits> {
+		public:
+			SegmentedQueueTestContext() : BasicQueueTestContext<DefaultTraits>("q")
+			{}
+
+		public:
+			std::string directoryName() {
+				return directory().generic_string();
+			}
+
+		public:
+			void write(const std::vector<std::vector<uint8_t>>& buffers, utils::FileSize maxSegmentSize = Max_Segment_Size) {
+				FileQueueWriter writer(directoryName(), DefaultTraits::Index_Writer_Filename, maxSegmentSize);
+				for (const auto& buffer : buffers) {
+					writer.write(buffer);
+					writer.flush();
+				}
+			}
+
+			std::vector<std::vector<uint8_t>> readAllMessages() {
+				std::vector<std::vector<uint8_t>> buffers;
+				FileQueueReader reader(directoryName());
+				while (reader.tryReadNextMessage([&buffers](const auto& buffer) { buffers.push_back(buffer); })) {}
+
+				return buffers;
+			}
+		};
+
+		std::vector<std::vector<uint8_t>> GenerateBuffers(size_t count, size_t size) {
+			std::vector<std::vector<uint8_t>> buffers;
+			for (auto i = 0u; i < count; ++i)
+				buffers.push_back(test::GenerateRandomVector(size));
+
+			return buffers;
+		}
+	}
+
+	TEST(TEST_CLASS, SegmentedWriterAppendsMessagesToSegment) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto buffers = GenerateBuffers(3, 21);
+
+		// Act:
+		context.write(buffers, utils::FileSize::FromKilobytes(1));
+
+		// Assert: single segment contains all records
+		EXPECT_EQ(2u, context.countFiles());
+		EXPECT_TRUE(context.exists("0000000000000000.seg"));
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+		EXPECT_EQ(3 * (Segment_Record_Header_Size + 21), context.readAll("0000000000000000.seg").size());
+	}
+
+	TEST(TEST_CLASS, SegmentedWriterStartsNewSegmentWhenSegmentIsFull) {
+		// Arrange: two records fit into a segment
+		SegmentedQueueTestContext context;
+		auto buffers = GenerateBuffers(5, 30);
+
+		// Act:
+		context.write(buffers);
+
+		// Assert:
+		EXPECT_EQ(4u, context.countFiles());
+		EXPECT_TRUE(context.exists("0000000000000000.seg"));
+		EXPECT_TRUE(context.exists("0000000000000002.seg"));
+		EXPECT_TRUE(context.exists("0000000000000004.seg"));
+		EXPECT_EQ(5u, context.readIndexWriterFile());
+	}
+
+	TEST(TEST_CLASS, SegmentedWriterWritesLargeMessageToOwnSegment) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		std::vector<std::vector<uint8_t>> buffers{ test::GenerateRandomVector(10), test::GenerateRandomVector(250) };
+
+		// Act:
+		context.write(buffers);
+
+		// Assert:
+		EXPECT_EQ(3u, context.countFiles());
+		EXPECT_TRUE(context.exists("0000000000000000.seg"));
+		EXPECT_TRUE(context.exists("0000000000000001.seg"));
+		EXPECT_EQ(Segment_Record_Header_Size + 250, context.readAll("0000000000000001.seg").size());
+	}
+
+	TEST(TEST_CLASS, SegmentedWriterStartsNewSegmentWhenCreated) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+
+		// Act:
+		context.write(GenerateBuffers(1, 10));
+		context.write(GenerateBuffers(1, 10));
+
+		// Assert:
+		EXPECT_EQ(3u, context.countFiles());
+		EXPECT_TRUE(context.exists("0000000000000000.seg"));
+		EXPECT_TRUE(context.exists("0000000000000001.seg"));
+		EXPECT_EQ(2u, context.readIndexWriterFile());
+	}
+
+	TEST(TEST_CLASS, SegmentedWriterFlushDoesNothingWhenNoPendingDataToWrite) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		FileQueueWriter writer(context.directoryName(), DefaultTraits::Index_Writer_Filename, Max_Segment_Size);
+
+		// Act:
+		writer.flush();
+
+		// Assert:
+		EXPECT_EQ(1u, context.countFiles());
+		EXPECT_EQ(0u, context.readIndexWriterFile());
+	}
+
+	TEST(TEST_CLASS, SegmentedWriterRemovesMessagesAtOrAfterWriterIndex) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		IndexFile((context.directory() / DefaultTraits::Index_Writer_Filename).generic_string()).set(0x77);
+		for (const auto* name : { "0000000000000070.seg", "0000000000000076.dat", "0000000000000077.seg", "0000000000000078.dat" })
+			RawFile((context.directory() / name).generic_string(), OpenMode::Read_Write).write(test::GenerateRandomVector(10));
+
+		// Act:
+		FileQueueWriter writer(context.directoryName(), DefaultTraits::Index_Writer_Filename, Max_Segment_Size);
+
+		// Assert:
+		EXPECT_EQ(3u, context.countFiles());
+		EXPECT_TRUE(context.exists("0000000000000070.seg"));
+		EXPECT_TRUE(context.exists("0000000000000076.dat"));
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderCanReadAllMessages) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto buffers = GenerateBuffers(5, 30);
+		context.write(buffers);
+
+		// Act:
+		auto readBuffers = context.readAllMessages();
+
+		// Assert: only the last segment is retained
+		EXPECT_EQ(buffers, readBuffers);
+		EXPECT_EQ(4u, context.countFiles());
+		EXPECT_TRUE(context.exists("0000000000000004.seg"));
+		EXPECT_TRUE(context.exists("index_reader.pos"));
+		EXPECT_EQ(5u, context.readIndexReaderFile());
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderCanReadMessagesWrittenWhileReading) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto buffers1 = GenerateBuffers(3, 30);
+		auto buffers2 = GenerateBuffers(4, 20);
+
+		// Act:
+		context.write(buffers1);
+		auto readBuffers1 = context.readAllMessages();
+		context.write(buffers2);
+		auto readBuffers2 = context.readAllMessages();
+
+		// Assert:
+		EXPECT_EQ(buffers1, readBuffers1);
+		EXPECT_EQ(buffers2, readBuffers2);
+		EXPECT_EQ(7u, context.readIndexReaderFile());
+	}
+
+	namespace {
+		void AssertCanReadMessagesInterleavedWithWrites(utils::FileSize maxSegmentSize, size_t numExpectedFiles) {
+			// Arrange: use a single reader so that its open segment is reused across messages
+			SegmentedQueueTestContext context;
+			auto buffers = GenerateBuffers(5, 30);
+			FileQueueWriter writer(context.directoryName(), DefaultTraits::Index_Writer_Filename, maxSegmentSize);
+			FileQueueReader reader(context.directoryName());
+
+			// Act: read each message after it is written
+			std::vector<std::vector<uint8_t>> readBuffers;
+			for (const auto& buffer : buffers) {
+				writer.write(buffer);
+				writer.flush();
+
+				reader.tryReadNextMessage([&readBuffers](const auto& readBuffer) { readBuffers.push_back(readBuffer); });
+			}
+
+			// Assert:
+			EXPECT_EQ(buffers, readBuffers);
+			EXPECT_EQ(numExpectedFiles, context.countFiles());
+			EXPECT_EQ(5u, context.readIndexReaderFile());
+		}
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderCanReadMessagesAppendedToOpenSegment) {
+		// Assert: single segment, index files and saved position
+		AssertCanReadMessagesInterleavedWithWrites(utils::FileSize::FromKilobytes(1), 4);
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderCanReadMessagesAppendedToNewSegments) {
+		// Assert: only the last segment is retained
+		AssertCanReadMessagesInterleavedWithWrites(Max_Segment_Size, 4);
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderSavesPositionAfterEachMessage) {
+		// Arrange: write four messages into a single segment
+		SegmentedQueueTestContext context;
+		auto buffers = GenerateBuffers(4, 10);
+		context.write(buffers, utils::FileSize::FromKilobytes(1));
+
+		// - read two messages with a reader that remains open
+		FileQueueReader reader(context.directoryName());
+		for (auto i = 0u; i < 2; ++i)
+			reader.tryReadNextMessage([](const auto&) {});
+
+		// Act: corrupt the first two records so that only the saved position allows reading the third one
+		{
+			RawFile segmentFile((context.directory() / "0000000000000000.seg").generic_string(), OpenMode::Read_Append);
+			segmentFile.seek(0);
+			segmentFile.write(std::vector<uint8_t>(2 * (Segment_Record_Header_Size + 10), 0xFF));
+		}
+
+		auto readBuffers = context.readAllMessages();
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>(buffers.cbegin() + 2, buffers.cend()), readBuffers);
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderCanReadWhenSavedPositionIsStale) {
+		// Arrange: write four messages into a single segment and read the first one
+		SegmentedQueueTestContext context;
+		auto buffers = GenerateBuffers(4, 10);
+		context.write(buffers, utils::FileSize::FromKilobytes(1));
+		FileQueueReader(context.directoryName()).tryReadNextMessage([](const auto&) {});
+
+		// - move the reader index without updating the saved position
+		IndexFile((context.directory() / DefaultTraits::Index_Reader_Filename).generic_string()).set(2);
+
+		// Act:
+		auto readBuffers = context.readAllMessages();
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>(buffers.cbegin() + 2, buffers.cend()), readBuffers);
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderCanReadMessageFilesAndSegments) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto buffers1 = GenerateBuffers(2, 30);
+		auto buffers2 = GenerateBuffers(3, 30);
+		context.write(buffers1, utils::FileSize());
+		context.write(buffers2);
+
+		// Act:
+		auto readBuffers = context.readAllMessages();
+
+		// Assert:
+		EXPECT_EQ(5u, readBuffers.size());
+		EXPECT_EQ(buffers1, std::vector<std::vector<uint8_t>>(readBuffers.cbegin(), readBuffers.cbegin() + 2));
+		EXPECT_EQ(buffers2, std::vector<std::vector<uint8_t>>(readBuffers.cbegin() + 2, readBuffers.cend()));
+		EXPECT_FALSE(context.exists("0000000000000000.dat"));
+		EXPECT_FALSE(context.exists("0000000000000001.dat"));
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderCanReadTimedMessage) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto startTime = std::chrono::system_clock::now() - std::chrono::milliseconds(1);
+		context.write(GenerateBuffers(1, 10));
+
+		// Act:
+		std::chrono::system_clock::time_point writeTime;
+		auto result = FileQueueReader(context.directoryName()).tryReadNextTimedMessage([&writeTime](const auto&, auto time) {
+			writeTime = time;
+		});
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_LE(startTime, writeTime);
+		EXPECT_GE(std::chrono::system_clock::now(), writeTime);
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderDoesNotAdvanceWhenMessageIsUnsuccessfullyProcessed) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto buffers = GenerateBuffers(3, 30);
+		context.write(buffers);
+
+		// Act:
+		EXPECT_THROW(FileQueueReader(context.directoryName()).tryReadNextMessage([](const auto&) {
+			CATAPULT_THROW_RUNTIME_ERROR("read error");
+		}), catapult_runtime_error);
+		auto readBuffers = context.readAllMessages();
+
+		// Assert:
+		EXPECT_EQ(buffers, readBuffers);
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderCanRetryUnsuccessfullyProcessedMessage) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto buffers = GenerateBuffers(3, 30);
+		context.write(buffers);
+
+		FileQueueReader reader(context.directoryName());
+		reader.tryReadNextMessage([](const auto&) {});
+
+		// Act: fail processing of the second message and retry it with the same reader
+		EXPECT_THROW(reader.tryReadNextMessage([](const auto&) {
+			CATAPULT_THROW_RUNTIME_ERROR("read error");
+		}), catapult_runtime_error);
+
+		std::vector<std::vector<uint8_t>> readBuffers;
+		while (reader.tryReadNextMessage([&readBuffers](const auto& buffer) { readBuffers.push_back(buffer); })) {}
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>(buffers.cbegin() + 1, buffers.cend()), readBuffers);
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderCanReadMultipleMessagesBeforeCommit) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto buffers = GenerateBuffers(5, 30);
+		context.write(buffers);
+
+		// Act: read messages spanning multiple segments
+		FileQueueReader reader(context.directoryName());
+		std::vector<std::vector<uint8_t>> readBuffers;
+		auto numMessages = reader.readNextTimedMessages(4, [&readBuffers](const auto& buffer, auto) {
+			readBuffers.push_back(buffer);
+		}, [&context]() {
+			// Assert: reader index is not advanced before commit
+			EXPECT_EQ(0u, context.readIndexReaderFile());
+		});
+
+		// Assert:
+		EXPECT_EQ(4u, numMessages);
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>(buffers.cbegin(), buffers.cbegin() + 4), readBuffers);
+		EXPECT_EQ(4u, context.readIndexReaderFile());
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>(buffers.cbegin() + 4, buffers.cend()), context.readAllMessages());
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderCanRetryMultipleMessagesWhenCommitFails) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto buffers = GenerateBuffers(5, 30);
+		context.write(buffers);
+
+		FileQueueReader reader(context.directoryName());
+		reader.tryReadNextMessage([](const auto&) {});
+
+		// Act: fail commit of the next three messages and retry them with the same reader
+		EXPECT_THROW(reader.readNextTimedMessages(3, [](const auto&, auto) {}, []() {
+			CATAPULT_THROW_RUNTIME_ERROR("commit failed");
+		}), catapult_runtime_error);
+
+		std::vector<std::vector<uint8_t>> readBuffers;
+		while (reader.tryReadNextMessage([&readBuffers](const auto& buffer) { readBuffers.push_back(buffer); })) {}
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>(buffers.cbegin() + 1, buffers.cend()), readBuffers);
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderCanSkipMessages) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		auto buffers = GenerateBuffers(5, 30);
+		context.write(buffers);
+
+		// Act:
+		FileQueueReader(context.directoryName()).skip(3);
+		auto readBuffers = context.readAllMessages();
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>(buffers.cbegin() + 3, buffers.cend()), readBuffers);
+	}
+
+	TEST(TEST_CLASS, SegmentedReaderCannotReadTruncatedSegment) {
+		// Arrange:
+		SegmentedQueueTestContext context;
+		context.write(GenerateBuffers(1, 30));
+		IndexFile((context.directory() / DefaultTraits::Index_Writer_Filename).generic_string()).set(2);
+
+		FileQueueReader reader(context.directoryName());
+		reader.tryReadNextMessage([](const auto&) {});
+
+		// Act + Assert:
+		EXPECT_THROW(reader.tryReadNextMessage([](const auto&) {}), catapult_runtime_error);
+	}
+
+	// endregion
 }}
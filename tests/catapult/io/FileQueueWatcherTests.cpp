@@ -0,0 +1,143 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileQueueWatcher.h"
+#include "catapult/io/FileQueue.h"
+#include "catapult/io/IndexFile.h"
+#include "catapult/utils/StackTimer.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS FileQueueWatcherTests
+
+	namespace {
+		constexpr auto Index_Filename = "index.dat";
+
+		void WriteMessage(const std::string& directory) {
+			FileQueueWriter writer(directory, Index_Filename);
+			writer.write(test::GenerateRandomVector(21));
+			writer.flush();
+		}
+	}
+
+	TEST(TEST_CLASS, WaitTimesOutWhenIndexFileIsNotChanged) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), Index_Filename);
+
+		// Act:
+		utils::StackTimer stopwatch;
+		auto result = watcher.wait(utils::TimeSpan::FromMilliseconds(20));
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_LE(15u, stopwatch.millis());
+	}
+
+#ifdef __linux__
+
+	TEST(TEST_CLASS, WatcherIsEventDrivenWhenDirectoryExists) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+
+		// Act:
+		FileQueueWatcher watcher(tempDir.name(), Index_Filename);
+
+		// Assert:
+		EXPECT_TRUE(watcher.isEventDriven());
+	}
+
+	TEST(TEST_CLASS, WatcherIsNotEventDrivenWhenDirectoryDoesNotExist) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+
+		// Act:
+		FileQueueWatcher watcher(tempDir.name() + "/missing", Index_Filename);
+
+		// Assert:
+		EXPECT_FALSE(watcher.isEventDriven());
+	}
+
+	TEST(TEST_CLASS, WaitReturnsTrueWhenIndexFileWasChangedBeforeWait) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), Index_Filename);
+		WriteMessage(tempDir.name());
+
+		// Act:
+		auto result = watcher.wait(utils::TimeSpan::FromSeconds(5));
+
+		// Assert:
+		EXPECT_TRUE(result);
+	}
+
+	TEST(TEST_CLASS, WaitReturnsTrueWhenIndexFileIsChangedDuringWait) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), Index_Filename);
+		std::thread writerThread([directory = tempDir.name()]() {
+			test::Sleep(10);
+			WriteMessage(directory);
+		});
+
+		// Act:
+		utils::StackTimer stopwatch;
+		auto result = watcher.wait(utils::TimeSpan::FromSeconds(5));
+		writerThread.join();
+
+		// Assert: wait should not have timed out
+		EXPECT_TRUE(result);
+		EXPECT_GT(5000u, stopwatch.millis());
+	}
+
+	TEST(TEST_CLASS, WaitConsumesAllPendingChanges) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), Index_Filename);
+		for (auto i = 0u; i < 3; ++i)
+			WriteMessage(tempDir.name());
+
+		// Act:
+		auto result1 = watcher.wait(utils::TimeSpan::FromSeconds(5));
+		auto result2 = watcher.wait(utils::TimeSpan::FromMilliseconds(10));
+
+		// Assert:
+		EXPECT_TRUE(result1);
+		EXPECT_FALSE(result2);
+	}
+
+	TEST(TEST_CLASS, WaitIgnoresChangesToOtherFiles) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), Index_Filename);
+		IndexFile(tempDir.name() + "/index_reader.dat").set(7);
+
+		// Act:
+		auto result = watcher.wait(utils::TimeSpan::FromMilliseconds(10));
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
+
+#endif
+}}
@@ -1120,6 +1120,82 @@ namespace catapult { namespace ionet {
 
 	// endregion
 
+	// region addRoundTripTime / addThroughput
+
+	TEST(TEST_CLASS, NoPerformanceSampleIsAddedWhenNodeIsNotFound) {
+		// Arrange:
+		auto identity = ToIdentity(test::GenerateRandomByteArray<Key>());
+		NodeContainer container;
+
+		// Act:
+		{
+			auto modifier = container.modifier();
+			modifier.addRoundTripTime(identity, utils::TimeSpan::FromMilliseconds(100));
+			modifier.addThroughput(identity, 1000, utils::TimeSpan::FromSeconds(1));
+		}
+
+		// Assert: no node was added to the container
+		EXPECT_FALSE(container.view().contains(identity));
+	}
+
+	TEST(TEST_CLASS, CanAddPerformanceSamplesWhenNodeIsFound) {
+		// Arrange:
+		auto identity = ToIdentity(test::GenerateRandomByteArray<Key>());
+		NodeContainer container;
+		Add(container, identity, "bob", NodeSource::Dynamic);
+
+		// Act:
+		{
+			auto modifier = container.modifier();
+			modifier.addRoundTripTime(identity, utils::TimeSpan::FromMilliseconds(100));
+			modifier.addThroughput(identity, 1000, utils::TimeSpan::FromSeconds(1));
+		}
+
+		// Assert:
+		auto view = container.view();
+		const auto& performance = view.getNodeInfo(identity).performance();
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(100), performance.RoundTripTime);
+		EXPECT_EQ(1000u, performance.BytesPerSecond);
+	}
+
+	// endregion
+
+	// region addReadTraffic
+
+	TEST(TEST_CLASS, NoReadTrafficIsAddedWhenNodeIsNotFound) {
+		// Arrange:
+		auto identity = ToIdentity(test::GenerateRandomByteArray<Key>());
+		NodeContainer container;
+
+		// Act:
+		container.modifier().addReadTraffic(identity, 1000, 4);
+
+		// Assert: no node was added to the container
+		EXPECT_FALSE(container.view().contains(identity));
+	}
+
+	TEST(TEST_CLASS, CanAddReadTrafficWhenNodeIsFound) {
+		// Arrange:
+		auto identity = ToIdentity(test::GenerateRandomByteArray<Key>());
+		NodeContainer container;
+		Add(container, identity, "bob", NodeSource::Dynamic);
+
+		// Act:
+		{
+			auto modifier = container.modifier();
+			modifier.addReadTraffic(identity, 1000, 4);
+			modifier.addReadTraffic(identity, 500, 1);
+		}
+
+		// Assert:
+		auto view = container.view();
+		const auto& traffic = view.getNodeInfo(identity).traffic();
+		EXPECT_EQ(1500u, traffic.NumReadBytes);
+		EXPECT_EQ(5u, traffic.NumReadPackets);
+	}
+
+	// endregion
+
 	// region banning
 
 	namespace {
@@ -57,6 +57,12 @@ namespace catapult { namespace ionet {
 		EXPECT_EQ(0u, interactions.NumSuccesses);
 		EXPECT_EQ(0u, interactions.NumFailures);
 
+		EXPECT_EQ(utils::TimeSpan(), nodeInfo.performance().RoundTripTime);
+		EXPECT_EQ(0u, nodeInfo.performance().BytesPerSecond);
+
+		EXPECT_EQ(0u, nodeInfo.traffic().NumReadBytes);
+		EXPECT_EQ(0u, nodeInfo.traffic().NumReadPackets);
+
 		EXPECT_EQ(0u, nodeInfo.numConnectionStates());
 		EXPECT_TRUE(nodeInfo.services().empty());
 	}
@@ -76,6 +82,93 @@ namespace catapult { namespace ionet {
 
 	// endregion
 
+	// region addRoundTripTime / addThroughput
+
+	namespace {
+		void AddRoundTripTimes(NodeInfo& nodeInfo, std::initializer_list<uint64_t> roundTripTimes) {
+			for (auto roundTripTime : roundTripTimes)
+				nodeInfo.addRoundTripTime(utils::TimeSpan::FromMilliseconds(roundTripTime));
+		}
+	}
+
+	TEST(TEST_CLASS, FirstRoundTripTimeSampleIsUsedAsEstimate) {
+		// Arrange:
+		NodeInfo nodeInfo(NodeSource::Static);
+
+		// Act:
+		AddRoundTripTimes(nodeInfo, { 240 });
+
+		// Assert:
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(240), nodeInfo.performance().RoundTripTime);
+		EXPECT_EQ(0u, nodeInfo.performance().BytesPerSecond);
+	}
+
+	TEST(TEST_CLASS, SubsequentRoundTripTimeSamplesAreSmoothed) {
+		// Arrange:
+		NodeInfo nodeInfo(NodeSource::Static);
+
+		// Act: 240 -> 240 + (320 - 240) / 8 = 250 -> 250 + (170 - 250) / 8 = 240
+		AddRoundTripTimes(nodeInfo, { 240, 320, 170 });
+
+		// Assert:
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(240), nodeInfo.performance().RoundTripTime);
+	}
+
+	TEST(TEST_CLASS, ZeroRoundTripTimeSampleResultsInMinimumKnownEstimate) {
+		// Arrange:
+		NodeInfo nodeInfo(NodeSource::Static);
+
+		// Act:
+		AddRoundTripTimes(nodeInfo, { 0 });
+
+		// Assert:
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(1), nodeInfo.performance().RoundTripTime);
+	}
+
+	TEST(TEST_CLASS, ThroughputSamplesAreConvertedToBytesPerSecondAndSmoothed) {
+		// Arrange:
+		NodeInfo nodeInfo(NodeSource::Static);
+
+		// Act: 4000 -> 4000 + (12000 - 4000) / 8 = 5000
+		nodeInfo.addThroughput(1000, utils::TimeSpan::FromMilliseconds(250));
+		nodeInfo.addThroughput(6000, utils::TimeSpan::FromMilliseconds(500));
+
+		// Assert:
+		EXPECT_EQ(utils::TimeSpan(), nodeInfo.performance().RoundTripTime);
+		EXPECT_EQ(5000u, nodeInfo.performance().BytesPerSecond);
+	}
+
+	TEST(TEST_CLASS, ThroughputSampleWithZeroElapsedTimeIsTreatedAsOneMillisecond) {
+		// Arrange:
+		NodeInfo nodeInfo(NodeSource::Static);
+
+		// Act:
+		nodeInfo.addThroughput(7, utils::TimeSpan());
+
+		// Assert:
+		EXPECT_EQ(7000u, nodeInfo.performance().BytesPerSecond);
+	}
+
+	// endregion
+
+	// region traffic
+
+	TEST(TEST_CLASS, CanAddReadTraffic) {
+		// Arrange:
+		NodeInfo nodeInfo(NodeSource::Static);
+
+		// Act:
+		nodeInfo.addReadTraffic(1000, 3);
+		nodeInfo.addReadTraffic(234, 2);
+
+		// Assert:
+		EXPECT_EQ(1234u, nodeInfo.traffic().NumReadBytes);
+		EXPECT_EQ(5u, nodeInfo.traffic().NumReadPackets);
+		EXPECT_EQ(0u, nodeInfo.performance().BytesPerSecond);
+	}
+
+	// endregion
+
 	// region addNodeInteraction
 
 	namespace {
@@ -85,6 +85,33 @@ namespace catapult { namespace ionet {
 
 	// endregion
 
+	// region size + alignment (PackedNodeTraffic)
+
+#define PACKED_NODE_TRAFFIC_FIELDS FIELD(IdentityKey) FIELD(NumReadBytes) FIELD(NumReadPackets)
+
+	TEST(TEST_CLASS, PackedNodeTrafficHasExpectedSize) {
+		// Arrange:
+		auto expectedSize = 0u;
+
+#define FIELD(X) expectedSize += sizeof(PackedNodeTraffic::X);
+		PACKED_NODE_TRAFFIC_FIELDS
+#undef FIELD
+
+		// Assert:
+		EXPECT_EQ(expectedSize, sizeof(PackedNodeTraffic));
+		EXPECT_EQ(48u, sizeof(PackedNodeTraffic));
+	}
+
+	TEST(TEST_CLASS, PackedNodeTrafficHasProperAlignment) {
+#define FIELD(X) EXPECT_ALIGNED(PackedNodeTraffic, X);
+		PACKED_NODE_TRAFFIC_FIELDS
+#undef FIELD
+	}
+
+#undef PACKED_NODE_TRAFFIC_FIELDS
+
+	// endregion
+
 	// region size + alignment (PackedNodeInfo)
 
 #define PACKED_NODE_INFO_FIELDS FIELD(Source) FIELD(IdentityKey) FIELD(Interactions) FIELD(ConnectionStatesCount)
@@ -204,5 +231,20 @@ namespace catapult { namespace ionet {
 		EXPECT_EQ(234u, packedInteractions.NumFailures);
 	}
 
+	TEST(TEST_CLASS, CanCopyNodeTrafficValuesIntoPackedNodeTraffic) {
+		// Arrange:
+		auto traffic = NodeTraffic();
+		traffic.NumReadBytes = 12345;
+		traffic.NumReadPackets = 67;
+
+		// Act:
+		auto packedTraffic = PackedNodeTraffic();
+		packedTraffic.Update(traffic);
+
+		// Assert:
+		EXPECT_EQ(12345u, packedTraffic.NumReadBytes);
+		EXPECT_EQ(67u, packedTraffic.NumReadPackets);
+	}
+
 	// endregion
 }}
@@ -392,6 +392,62 @@ namespace catapult { namespace ionet {
 
 	// endregion
 
+	// region histograms
+
+	TEST(TEST_CLASS, HistogramsAreInitiallyEmpty) {
+		// Arrange:
+		PacketHandlers handlers;
+
+		// Act:
+		auto histograms = handlers.histograms();
+
+		// Assert:
+		EXPECT_TRUE(histograms.empty());
+	}
+
+	TEST(TEST_CLASS, HistogramIsAvailableForEachRegisteredHandler) {
+		// Arrange:
+		auto marker = 0u;
+		PacketHandlers handlers;
+		RegisterHandlers(handlers, { 1, 3, 5 }, marker);
+
+		// Act:
+		auto histograms = handlers.histograms();
+
+		// Assert:
+		ASSERT_EQ(3u, histograms.size());
+
+		auto i = 0u;
+		for (auto type : { 1u, 3u, 5u }) {
+			EXPECT_EQ("PKT HANDLER", histograms[i].id().name()) << type;
+			EXPECT_EQ(type, histograms[i].tag()) << type;
+			EXPECT_EQ(0u, histograms[i].snapshot().count()) << type;
+			++i;
+		}
+	}
+
+	TEST(TEST_CLASS, ProcessRecordsLatencyInHistogramOfMatchingHandler) {
+		// Arrange:
+		auto marker = 0u;
+		PacketHandlers handlers;
+		RegisterHandlers(handlers, { 1, 3, 5 }, marker);
+
+		// Act:
+		ProcessPacket(handlers, 3);
+		ProcessPacket(handlers, 5);
+		ProcessPacket(handlers, 3);
+		ProcessPacket(handlers, 4);
+		auto histograms = handlers.histograms();
+
+		// Assert:
+		ASSERT_EQ(3u, histograms.size());
+		EXPECT_EQ(0u, histograms[0].snapshot().count());
+		EXPECT_EQ(2u, histograms[1].snapshot().count());
+		EXPECT_EQ(1u, histograms[2].snapshot().count());
+	}
+
+	// endregion
+
 	// region process + setAllowedHosts
 
 	namespace {
@@ -102,6 +102,30 @@ namespace catapult { namespace ionet {
 		EXPECT_EQ(&sslContext1, &sslContext2);
 	}
 
+	TEST(TEST_CLASS, CreateSslContextSupplier_CanCreateSslContextWithSessionResumption) {
+		// Arrange:
+		auto supplier = CreateSslContextSupplier(test::GetDefaultCertificateDirectory(), 10);
+
+		// Act:
+		auto& sslContext1 = supplier();
+		auto& sslContext2 = supplier();
+
+		// Assert:
+		EXPECT_EQ(&sslContext1, &sslContext2);
+		EXPECT_EQ(1u, SSL_CTX_get_num_tickets(sslContext1.native_handle()));
+	}
+
+	TEST(TEST_CLASS, CreateSslContextSupplier_DoesNotIssueSessionTicketsWhenSessionResumptionIsDisabled) {
+		// Arrange:
+		auto supplier = CreateSslContextSupplier(test::GetDefaultCertificateDirectory(), 0);
+
+		// Act:
+		auto& sslContext = supplier();
+
+		// Assert:
+		EXPECT_EQ(0u, SSL_CTX_get_num_tickets(sslContext.native_handle()));
+	}
+
 	// endregion
 
 	// region CreateSslVerifyCallbackSupplier
@@ -133,48 +157,68 @@ namespace catapult { namespace ionet {
 		}
 	}
 
-	TEST(TEST_CLASS, CreateSslVerifyCallbackSupplier_SuccessVerificationDelegatesToProcessor) {
-		// Arrange:
-		auto predicate = CreateSslVerifyCallbackSupplier()();
+	namespace {
+		using VerifyCallbackSupplier = supplier<predicate<PacketSocketSslVerifyContext&>>;
 
-		auto keyPair = test::GenerateKeyPair();
-		auto holder = CreateChainedCertificateStoreContext(keyPair, true);
+		void AssertSuccessVerificationDelegatesToProcessor(const VerifyCallbackSupplier& verifyCallbackSupplier) {
+			// Arrange:
+			auto predicate = verifyCallbackSupplier();
 
-		Key publicKey;
-		boost::asio::ssl::verify_context asioVerifyContext(holder.pCertificateStoreContext.get());
-		PacketSocketSslVerifyContext contextPreverifyFalse(false, asioVerifyContext, publicKey);
-		PacketSocketSslVerifyContext contextPreverifyTrue(true, asioVerifyContext, publicKey);
+			auto keyPair = test::GenerateKeyPair();
+			auto holder = CreateChainedCertificateStoreContext(keyPair, true);
 
-		// Act: simulate two level chain  - root(false), root(true), node(true)
-		auto result1 = predicate(contextPreverifyFalse);
-		auto result2 = predicate(contextPreverifyTrue);
+			Key publicKey;
+			boost::asio::ssl::verify_context asioVerifyContext(holder.pCertificateStoreContext.get());
+			PacketSocketSslVerifyContext contextPreverifyFalse(false, asioVerifyContext, publicKey);
+			PacketSocketSslVerifyContext contextPreverifyTrue(true, asioVerifyContext, publicKey);
 
-		test::SetActiveCertificate(holder, 1);
-		auto result3 = predicate(contextPreverifyTrue);
+			// Act: simulate two level chain  - root(false), root(true), node(true)
+			auto result1 = predicate(contextPreverifyFalse);
+			auto result2 = predicate(contextPreverifyTrue);
 
-		// Assert:
-		EXPECT_TRUE(result1);
-		EXPECT_TRUE(result2);
-		EXPECT_TRUE(result3);
-		EXPECT_EQ(keyPair.publicKey(), publicKey);
-	}
+			test::SetActiveCertificate(holder, 1);
+			auto result3 = predicate(contextPreverifyTrue);
 
-	TEST(TEST_CLASS, CreateSslVerifyCallbackSupplier_FailureVerificationDelegatesToProcessor) {
-		// Arrange:
-		auto predicate = CreateSslVerifyCallbackSupplier()();
+			// Assert:
+			EXPECT_TRUE(result1);
+			EXPECT_TRUE(result2);
+			EXPECT_TRUE(result3);
+			EXPECT_EQ(keyPair.publicKey(), publicKey);
+		}
 
-		auto keyPair = test::GenerateKeyPair();
-		auto holder = CreateChainedCertificateStoreContext(keyPair, false);
+		void AssertFailureVerificationDelegatesToProcessor(const VerifyCallbackSupplier& verifyCallbackSupplier) {
+			// Arrange:
+			auto predicate = verifyCallbackSupplier();
 
-		Key publicKey;
-		boost::asio::ssl::verify_context asioVerifyContext(holder.pCertificateStoreContext.get());
-		PacketSocketSslVerifyContext contextPreverifyFalse(false, asioVerifyContext, publicKey);
+			auto keyPair = test::GenerateKeyPair();
+			auto holder = CreateChainedCertificateStoreContext(keyPair, false);
 
-		// Act: simulate two level chain  - root(false); first failure short circuits processing of certificate chain
-		auto result1 = predicate(contextPreverifyFalse);
+			Key publicKey;
+			boost::asio::ssl::verify_context asioVerifyContext(holder.pCertificateStoreContext.get());
+			PacketSocketSslVerifyContext contextPreverifyFalse(false, asioVerifyContext, publicKey);
 
-		// Assert:
-		EXPECT_FALSE(result1);
+			// Act: simulate two level chain  - root(false); first failure short circuits processing of certificate chain
+			auto result1 = predicate(contextPreverifyFalse);
+
+			// Assert:
+			EXPECT_FALSE(result1);
+		}
+	}
+
+	TEST(TEST_CLASS, CreateSslVerifyCallbackSupplier_SuccessVerificationDelegatesToProcessor) {
+		AssertSuccessVerificationDelegatesToProcessor(CreateSslVerifyCallbackSupplier());
+	}
+
+	TEST(TEST_CLASS, CreateSslVerifyCallbackSupplier_FailureVerificationDelegatesToProcessor) {
+		AssertFailureVerificationDelegatesToProcessor(CreateSslVerifyCallbackSupplier());
+	}
+
+	TEST(TEST_CLASS, CreateSslVerifyCallbackSupplier_WithCache_SuccessVerificationDelegatesToProcessor) {
+		AssertSuccessVerificationDelegatesToProcessor(CreateSslVerifyCallbackSupplier(10));
+	}
+
+	TEST(TEST_CLASS, CreateSslVerifyCallbackSupplier_WithCache_FailureVerificationDelegatesToProcessor) {
+		AssertFailureVerificationDelegatesToProcessor(CreateSslVerifyCallbackSupplier(10));
 	}
 
 	// endregion
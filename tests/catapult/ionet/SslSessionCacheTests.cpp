@@ -0,0 +1,353 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/SslSessionCache.h"
+#include "catapult/crypto/CertificateUtils.h"
+#include "catapult/ionet/PacketSocketOptions.h"
+#include "tests/test/net/CertificateLocator.h"
+#include "tests/TestHarness.h"
+#include <boost/asio/ssl.hpp>
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS SslSessionCacheTests
+
+	namespace {
+		using SslPointer = std::shared_ptr<SSL>;
+		using SslSessionPointer = std::shared_ptr<SSL_SESSION>;
+
+		NodeEndpoint CreateEndpoint(unsigned short port) {
+			return { "alice.example.com", port };
+		}
+
+		SslSessionPointer CreateSession() {
+			// only sessions created by a successful handshake are resumable
+			return SslSessionPointer(SSL_SESSION_new(), SSL_SESSION_free);
+		}
+
+		void AddSession(SslSessionCache& cache, const NodeEndpoint& endpoint, const SslSessionPointer& pSession) {
+			// cache takes ownership of one reference
+			SSL_SESSION_up_ref(pSession.get());
+			cache.add(endpoint, *pSession);
+		}
+
+		int AcceptAllCertificates(int, X509_STORE_CTX*) {
+			return 1;
+		}
+
+		struct HandshakeResult {
+		public:
+			bool IsClientResumed;
+			bool IsServerResumed;
+			Key ClientResumedPublicKey;
+			Key ServerResumedPublicKey;
+		};
+
+		class SslConnectionPair {
+		public:
+			SslConnectionPair(boost::asio::ssl::context& clientContext, boost::asio::ssl::context& serverContext)
+					: m_pClient(SSL_new(clientContext.native_handle()), SSL_free)
+					, m_pServer(SSL_new(serverContext.native_handle()), SSL_free) {
+				BIO* pClientBio;
+				BIO* pServerBio;
+				BIO_new_bio_pair(&pClientBio, 0, &pServerBio, 0);
+				SSL_set_bio(m_pClient.get(), pClientBio, pClientBio);
+				SSL_set_bio(m_pServer.get(), pServerBio, pServerBio);
+
+				SSL_set_connect_state(m_pClient.get());
+				SSL_set_accept_state(m_pServer.get());
+				SSL_set_verify(m_pClient.get(), SSL_VERIFY_PEER, AcceptAllCertificates);
+				SSL_set_verify(m_pServer.get(), SSL_VERIFY_PEER, AcceptAllCertificates);
+			}
+
+		public:
+			SSL& client() {
+				return *m_pClient;
+			}
+
+			SSL& server() {
+				return *m_pServer;
+			}
+
+		public:
+			bool handshake() {
+				for (auto i = 0u; i < 10; ++i) {
+					auto clientResult = SSL_do_handshake(m_pClient.get());
+					auto serverResult = SSL_do_handshake(m_pServer.get());
+					if (1 == clientResult && 1 == serverResult) {
+						// process the session tickets sent by the server after the handshake
+						uint8_t byte;
+						SSL_read(m_pClient.get(), &byte, 1);
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+		private:
+			SslPointer m_pClient;
+			SslPointer m_pServer;
+		};
+
+		Key GetVerifiedRootPublicKey(SSL& ssl) {
+			crypto::CertificateInfo certificateInfo;
+			crypto::TryParseCertificate(*sk_X509_value(SSL_get0_verified_chain(&ssl), 1), certificateInfo);
+			return certificateInfo.PublicKey;
+		}
+
+		class ResumptionTestContext {
+		public:
+			explicit ResumptionTestContext(size_t maxResumableSessions = 10)
+					: m_clientContextSupplier(CreateSslContextSupplier(test::GetDefaultCertificateDirectory(), maxResumableSessions))
+					, m_serverContextSupplier(CreateSslContextSupplier(test::GetDefaultCertificateDirectory(), maxResumableSessions))
+			{}
+
+		public:
+			HandshakeResult connect(const NodeEndpoint& endpoint, bool shouldPrepare = true) {
+				SslConnectionPair connectionPair(m_clientContextSupplier(), m_serverContextSupplier());
+				if (shouldPrepare)
+					PrepareSslSessionResumption(connectionPair.client(), endpoint);
+
+				HandshakeResult result{};
+				EXPECT_TRUE(connectionPair.handshake());
+				result.IsClientResumed = !!SSL_session_reused(&connectionPair.client());
+				result.IsServerResumed = !!SSL_session_reused(&connectionPair.server());
+				TryGetResumedSessionPublicKey(connectionPair.client(), result.ClientResumedPublicKey);
+				TryGetResumedSessionPublicKey(connectionPair.server(), result.ServerResumedPublicKey);
+
+				if (!result.IsClientResumed) {
+					m_serverPublicKey = GetVerifiedRootPublicKey(connectionPair.client());
+					m_clientPublicKey = GetVerifiedRootPublicKey(connectionPair.server());
+				}
+
+				return result;
+			}
+
+		public:
+			const Key& clientPublicKey() const {
+				return m_clientPublicKey;
+			}
+
+			const Key& serverPublicKey() const {
+				return m_serverPublicKey;
+			}
+
+		private:
+			supplier<boost::asio::ssl::context&> m_clientContextSupplier;
+			supplier<boost::asio::ssl::context&> m_serverContextSupplier;
+			Key m_clientPublicKey;
+			Key m_serverPublicKey;
+		};
+	}
+
+	// region SslSessionCache
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		SslSessionCache cache(3);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+	}
+
+	TEST(TEST_CLASS, CanAddSessionsForDifferentEndpoints) {
+		// Arrange:
+		SslSessionCache cache(3);
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i)
+			AddSession(cache, CreateEndpoint(static_cast<unsigned short>(1000 + i)), CreateSession());
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+	}
+
+	TEST(TEST_CLASS, AddReplacesSessionForSameEndpoint) {
+		// Arrange:
+		SslSessionCache cache(3);
+
+		// Act:
+		AddSession(cache, CreateEndpoint(1000), CreateSession());
+		AddSession(cache, CreateEndpoint(1000), CreateSession());
+		AddSession(cache, { "bob.example.com", 1000 }, CreateSession());
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+	}
+
+	TEST(TEST_CLASS, AddEvictsLeastRecentlyAddedSessionWhenFull) {
+		// Arrange:
+		auto sslContextSupplier = CreateSslContextSupplier(test::GetDefaultCertificateDirectory());
+		auto pSsl = SslPointer(SSL_new(sslContextSupplier().native_handle()), SSL_free);
+		SslSessionCache cache(3);
+		for (auto i = 0u; i < 4; ++i)
+			AddSession(cache, CreateEndpoint(static_cast<unsigned short>(1000 + i)), CreateSession());
+
+		// Act: sessions are always removed when resumption is attempted
+		auto sizeBefore = cache.size();
+		cache.tryResume(CreateEndpoint(1000), *pSsl);
+		auto sizeAfterEvicted = cache.size();
+		cache.tryResume(CreateEndpoint(1001), *pSsl);
+		auto sizeAfterPresent = cache.size();
+
+		// Assert:
+		EXPECT_EQ(3u, sizeBefore);
+		EXPECT_EQ(3u, sizeAfterEvicted);
+		EXPECT_EQ(2u, sizeAfterPresent);
+	}
+
+	TEST(TEST_CLASS, AddHasNoEffectWhenMaxSizeIsZero) {
+		// Arrange:
+		SslSessionCache cache(0);
+
+		// Act:
+		AddSession(cache, CreateEndpoint(1000), CreateSession());
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+	}
+
+	TEST(TEST_CLASS, TryResumeFailsWhenNoSessionIsCachedForEndpoint) {
+		// Arrange:
+		auto sslContextSupplier = CreateSslContextSupplier(test::GetDefaultCertificateDirectory());
+		auto pSsl = SslPointer(SSL_new(sslContextSupplier().native_handle()), SSL_free);
+		SslSessionCache cache(3);
+		AddSession(cache, CreateEndpoint(1000), CreateSession());
+
+		// Act:
+		auto result = cache.tryResume(CreateEndpoint(1001), *pSsl);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(1u, cache.size());
+	}
+
+	TEST(TEST_CLASS, TryResumeRemovesUnresumableSessionWithoutAttachingIt) {
+		// Arrange:
+		auto sslContextSupplier = CreateSslContextSupplier(test::GetDefaultCertificateDirectory());
+		auto pSsl = SslPointer(SSL_new(sslContextSupplier().native_handle()), SSL_free);
+		auto pSession = CreateSession();
+		SslSessionCache cache(3);
+		AddSession(cache, CreateEndpoint(1000), pSession);
+
+		// Act:
+		auto result = cache.tryResume(CreateEndpoint(1000), *pSsl);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_NE(pSession.get(), SSL_get_session(pSsl.get()));
+	}
+
+	// endregion
+
+	// region resumption
+
+	TEST(TEST_CLASS, FirstHandshakeIsNotResumed) {
+		// Arrange:
+		ResumptionTestContext context;
+
+		// Act:
+		auto result = context.connect(CreateEndpoint(1000));
+
+		// Assert:
+		EXPECT_FALSE(result.IsClientResumed);
+		EXPECT_FALSE(result.IsServerResumed);
+		EXPECT_EQ(Key(), result.ClientResumedPublicKey);
+		EXPECT_EQ(Key(), result.ServerResumedPublicKey);
+		EXPECT_NE(Key(), context.serverPublicKey());
+		EXPECT_NE(Key(), context.clientPublicKey());
+	}
+
+	TEST(TEST_CLASS, SecondHandshakeToSameEndpointIsResumedWithVerifiedPublicKeys) {
+		// Arrange:
+		ResumptionTestContext context;
+		context.connect(CreateEndpoint(1000));
+
+		// Act:
+		auto result = context.connect(CreateEndpoint(1000));
+
+		// Assert:
+		EXPECT_TRUE(result.IsClientResumed);
+		EXPECT_TRUE(result.IsServerResumed);
+		EXPECT_EQ(context.serverPublicKey(), result.ClientResumedPublicKey);
+		EXPECT_EQ(context.clientPublicKey(), result.ServerResumedPublicKey);
+	}
+
+	TEST(TEST_CLASS, ResumedHandshakeCanBeResumedAgain) {
+		// Arrange:
+		ResumptionTestContext context;
+		context.connect(CreateEndpoint(1000));
+		context.connect(CreateEndpoint(1000));
+
+		// Act:
+		auto result = context.connect(CreateEndpoint(1000));
+
+		// Assert:
+		EXPECT_TRUE(result.IsClientResumed);
+		EXPECT_TRUE(result.IsServerResumed);
+		EXPECT_EQ(context.serverPublicKey(), result.ClientResumedPublicKey);
+		EXPECT_EQ(context.clientPublicKey(), result.ServerResumedPublicKey);
+	}
+
+	TEST(TEST_CLASS, HandshakeToDifferentEndpointIsNotResumed) {
+		// Arrange:
+		ResumptionTestContext context;
+		context.connect(CreateEndpoint(1000));
+
+		// Act:
+		auto result = context.connect(CreateEndpoint(1001));
+
+		// Assert:
+		EXPECT_FALSE(result.IsClientResumed);
+		EXPECT_FALSE(result.IsServerResumed);
+	}
+
+	TEST(TEST_CLASS, HandshakeIsNotResumedWhenClientIsNotPrepared) {
+		// Arrange:
+		ResumptionTestContext context;
+		context.connect(CreateEndpoint(1000));
+
+		// Act:
+		auto result = context.connect(CreateEndpoint(1000), false);
+
+		// Assert:
+		EXPECT_FALSE(result.IsClientResumed);
+		EXPECT_FALSE(result.IsServerResumed);
+	}
+
+	TEST(TEST_CLASS, HandshakeIsNotResumedWhenResumptionIsDisabled) {
+		// Arrange:
+		ResumptionTestContext context(0);
+		context.connect(CreateEndpoint(1000));
+
+		// Act:
+		auto result = context.connect(CreateEndpoint(1000));
+
+		// Assert:
+		EXPECT_FALSE(result.IsClientResumed);
+		EXPECT_FALSE(result.IsServerResumed);
+		EXPECT_EQ(Key(), result.ClientResumedPublicKey);
+		EXPECT_EQ(Key(), result.ServerResumedPublicKey);
+	}
+
+	// endregion
+}}
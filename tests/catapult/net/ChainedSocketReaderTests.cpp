@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/net/ChainedSocketReader.h"
+#include "catapult/net/FairShareReadScheduler.h"
 #include "catapult/ionet/BufferedPacketIo.h"
 #include "catapult/ionet/PacketSocket.h"
 #include "catapult/ionet/SocketReader.h"
@@ -40,10 +41,12 @@ namespace catapult { namespace net {
 				const std::shared_ptr<ionet::PacketSocket>& pSocket,
 				const ionet::ServerPacketHandlers& handlers,
 				const model::NodeIdentity& identity,
-				ChainedReaderCompletionCode& completionCode) {
-			return CreateChainedSocketReader(pSocket, handlers, identity, [&completionCode](auto code) {
+				ChainedReaderCompletionCode& completionCode,
+				const std::shared_ptr<FairShareReadScheduler>& pReadScheduler = nullptr) {
+			auto completionHandler = [&completionCode](auto code) {
 				completionCode = code;
-			});
+			};
+			return CreateChainedSocketReader(pSocket, handlers, identity, completionHandler, pReadScheduler);
 		}
 
 		// options for configuring SendBuffers
@@ -60,6 +63,9 @@ namespace catapult { namespace net {
 
 			// hook that is passed every packet as it is read
 			consumer<ChainedSocketReader&> HookPacketReceived;
+
+			// read scheduler (optional)
+			std::shared_ptr<FairShareReadScheduler> pReadScheduler;
 		};
 
 		class WriteHandshakeContext {
@@ -124,7 +130,7 @@ namespace catapult { namespace net {
 			std::weak_ptr<ChainedSocketReader> pReader;
 			ionet::SocketOperationCode completionCode;
 			test::SpawnPacketServerWork(pPool->ioContext(), [&](const auto& pServerSocket) {
-				auto pReaderShared = CreateChainedReader(pServerSocket, handlers, clientIdentity, completionCode);
+				auto pReaderShared = CreateChainedReader(pServerSocket, handlers, clientIdentity, completionCode, options.pReadScheduler);
 				pReader = pReaderShared;
 
 				// Arrange: set up a packet handler that copies the received packet bytes into receivedBuffers
@@ -315,4 +321,70 @@ namespace catapult { namespace net {
 		EXPECT_EQUAL_BUFFERS(sendBuffers[1], 0, 1024u, receivedBuffers[3]);
 		EXPECT_EQUAL_BUFFERS(sendBuffers[1], 1024, 2048u, receivedBuffers[4]);
 	}
+
+	// region read scheduler
+
+	namespace {
+		class MockFairShareReadScheduler : public FairShareReadScheduler {
+		public:
+			std::vector<uint32_t> recordedPacketSizes() const {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				return m_recordedPacketSizes;
+			}
+
+			size_t numScheduledReads() const {
+				return m_numScheduledReads;
+			}
+
+		public:
+			size_t numDeferredReads() const override {
+				return 0;
+			}
+
+			void recordPacket(const model::NodeIdentity&, const ionet::PacketHeader& header) override {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_recordedPacketSizes.push_back(header.Size);
+			}
+
+			void scheduleRead(const model::NodeIdentity&, const action& read) override {
+				++m_numScheduledReads;
+				read();
+			}
+
+			void shutdown() override
+			{}
+
+		private:
+			std::vector<uint32_t> m_recordedPacketSizes;
+			std::atomic<size_t> m_numScheduledReads{ 0 };
+			mutable std::mutex m_mutex;
+		};
+	}
+
+	TEST(TEST_CLASS, ReadsAreChainedThroughReadScheduler) {
+		// Arrange: send two multi-packet buffers
+		std::vector<ionet::ByteBuffer> sendBuffers{
+			test::GenerateRandomPacketBuffer(87, { 20, 17, 50 }),
+			test::GenerateRandomPacketBuffer(3072, { 1024, 2048 })
+		};
+
+		SendBuffersOptions options;
+		auto pReadScheduler = std::make_shared<MockFairShareReadScheduler>();
+		options.pReadScheduler = pReadScheduler;
+
+		// Act:
+		auto resultPair = SendBuffers(sendBuffers, options);
+		const auto& receivedBuffers = resultPair.first;
+		auto completionCode = resultPair.second;
+
+		// Assert: all packets were successfully read
+		EXPECT_EQ(ionet::SocketOperationCode::Closed, completionCode);
+		EXPECT_EQ(5u, receivedBuffers.size());
+
+		// - all packets were recorded and every completed batch scheduled the next read
+		EXPECT_EQ(std::vector<uint32_t>({ 20, 17, 50, 1024, 2048 }), pReadScheduler->recordedPacketSizes());
+		EXPECT_LE(1u, pReadScheduler->numScheduledReads());
+	}
+
+	// endregion
 }}
@@ -0,0 +1,326 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/net/FairShareReadScheduler.h"
+#include "catapult/ionet/PacketHeader.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace net {
+
+#define TEST_CLASS FairShareReadSchedulerTests
+
+	// region IsPrioritizedReadPacketType
+
+	TEST(TEST_CLASS, BlockAndSyncPacketTypesArePrioritized) {
+		for (auto type : {
+			ionet::PacketType::Push_Block,
+			ionet::PacketType::Compact_Block,
+			ionet::PacketType::Pull_Block,
+			ionet::PacketType::Chain_Info,
+			ionet::PacketType::Block_Hashes,
+			ionet::PacketType::Pull_Blocks,
+			ionet::PacketType::Sub_Cache_Merkle_Roots
+		}) {
+			EXPECT_TRUE(IsPrioritizedReadPacketType(type)) << type;
+		}
+	}
+
+	TEST(TEST_CLASS, OtherPacketTypesAreNotPrioritized) {
+		for (auto type : {
+			ionet::PacketType::Push_Transactions,
+			ionet::PacketType::Pull_Transactions,
+			ionet::PacketType::Node_Discovery_Pull_Peers,
+			ionet::PacketType::Undefined
+		}) {
+			EXPECT_FALSE(IsPrioritizedReadPacketType(type)) << type;
+		}
+	}
+
+	// endregion
+
+	// region test context
+
+	namespace {
+		struct TrafficEntry {
+			model::NodeIdentity Identity;
+			uint64_t NumBytes;
+			uint64_t NumPackets;
+		};
+
+		ionet::PacketHeader CreatePacketHeader(uint32_t size, ionet::PacketType type = ionet::PacketType::Push_Transactions) {
+			return ionet::PacketHeader{ size, type };
+		}
+
+		model::NodeIdentity CreateRandomIdentity() {
+			return { test::GenerateRandomByteArray<Key>(), "11.22.33.44" };
+		}
+
+		class TestContext {
+		public:
+			explicit TestContext(bool enableFairShare, const utils::TimeSpan& interval = utils::TimeSpan::FromHours(1))
+					: m_pPool(test::CreateStartedIoThreadPool()) {
+				FairShareReadSchedulerSettings settings;
+				settings.EnableFairShare = enableFairShare;
+				settings.Interval = interval;
+				settings.MinShareSize = utils::FileSize::FromBytes(1000);
+				settings.PriorityWeight = 4;
+				settings.TrafficConsumer = [this](const auto& identity, auto numBytes, auto numPackets) {
+					m_trafficEntries.push_back({ identity, numBytes, numPackets });
+				};
+
+				m_pScheduler = CreateFairShareReadScheduler(m_pPool, settings, model::NodeIdentityEqualityStrategy::Key);
+			}
+
+			~TestContext() {
+				m_pScheduler->shutdown();
+				m_pPool->join();
+			}
+
+		public:
+			auto& scheduler() {
+				return *m_pScheduler;
+			}
+
+			const auto& trafficEntries() const {
+				return m_trafficEntries;
+			}
+
+		public:
+			// schedules a read from \a identity and returns \c true if it was executed immediately
+			bool scheduleRead(const model::NodeIdentity& identity, std::atomic<size_t>& numReads) {
+				auto numReadsBefore = numReads.load();
+				m_pScheduler->scheduleRead(identity, [&numReads]() { ++numReads; });
+				return numReadsBefore != numReads;
+			}
+
+		private:
+			std::shared_ptr<thread::IoThreadPool> m_pPool;
+			std::shared_ptr<FairShareReadScheduler> m_pScheduler;
+			std::vector<TrafficEntry> m_trafficEntries;
+		};
+	}
+
+	// endregion
+
+	// region traffic accounting
+
+	TEST(TEST_CLASS, CanCreateScheduler) {
+		// Act:
+		TestContext context(true);
+
+		// Assert:
+		EXPECT_EQ(0u, context.scheduler().numDeferredReads());
+		EXPECT_TRUE(context.trafficEntries().empty());
+	}
+
+	TEST(TEST_CLASS, RecordedTrafficIsForwardedWhenReadIsScheduled) {
+		// Arrange:
+		TestContext context(false);
+		auto identity = CreateRandomIdentity();
+		std::atomic<size_t> numReads(0);
+
+		context.scheduler().recordPacket(identity, CreatePacketHeader(100));
+		context.scheduler().recordPacket(identity, CreatePacketHeader(250, ionet::PacketType::Push_Block));
+
+		// Sanity:
+		EXPECT_TRUE(context.trafficEntries().empty());
+
+		// Act:
+		auto isExecuted = context.scheduleRead(identity, numReads);
+
+		// Assert: unweighted traffic was forwarded
+		EXPECT_TRUE(isExecuted);
+		ASSERT_EQ(1u, context.trafficEntries().size());
+		EXPECT_EQ(identity.PublicKey, context.trafficEntries()[0].Identity.PublicKey);
+		EXPECT_EQ(identity.Host, context.trafficEntries()[0].Identity.Host);
+		EXPECT_EQ(350u, context.trafficEntries()[0].NumBytes);
+		EXPECT_EQ(2u, context.trafficEntries()[0].NumPackets);
+	}
+
+	TEST(TEST_CLASS, RecordedTrafficIsForwardedOnlyOnce) {
+		// Arrange:
+		TestContext context(false);
+		auto identity = CreateRandomIdentity();
+		std::atomic<size_t> numReads(0);
+
+		context.scheduler().recordPacket(identity, CreatePacketHeader(100));
+		context.scheduleRead(identity, numReads);
+
+		// Act:
+		context.scheduleRead(identity, numReads);
+		context.scheduler().recordPacket(identity, CreatePacketHeader(40));
+		context.scheduleRead(identity, numReads);
+
+		// Assert:
+		EXPECT_EQ(3u, numReads);
+		ASSERT_EQ(2u, context.trafficEntries().size());
+		EXPECT_EQ(100u, context.trafficEntries()[0].NumBytes);
+		EXPECT_EQ(40u, context.trafficEntries()[1].NumBytes);
+	}
+
+	TEST(TEST_CLASS, ReadsAreNeverDeferredWhenFairShareIsDisabled) {
+		// Arrange:
+		TestContext context(false);
+		auto identity1 = CreateRandomIdentity();
+		auto identity2 = CreateRandomIdentity();
+		std::atomic<size_t> numReads(0);
+
+		context.scheduler().recordPacket(identity1, CreatePacketHeader(100'000));
+		context.scheduler().recordPacket(identity2, CreatePacketHeader(10));
+
+		// Act:
+		auto isExecuted = context.scheduleRead(identity1, numReads);
+
+		// Assert:
+		EXPECT_TRUE(isExecuted);
+		EXPECT_EQ(0u, context.scheduler().numDeferredReads());
+	}
+
+	// endregion
+
+	// region fair share
+
+	TEST(TEST_CLASS, ReadsAreNotDeferredWhenPeerIsWithinMinShare) {
+		// Arrange:
+		TestContext context(true);
+		auto identity1 = CreateRandomIdentity();
+		auto identity2 = CreateRandomIdentity();
+		std::atomic<size_t> numReads(0);
+
+		context.scheduler().recordPacket(identity1, CreatePacketHeader(1000));
+		context.scheduler().recordPacket(identity2, CreatePacketHeader(10));
+
+		// Act:
+		auto isExecuted = context.scheduleRead(identity1, numReads);
+
+		// Assert:
+		EXPECT_TRUE(isExecuted);
+		EXPECT_EQ(0u, context.scheduler().numDeferredReads());
+	}
+
+	TEST(TEST_CLASS, ReadsAreNotDeferredWhenSinglePeerExceedsMinShare) {
+		// Arrange: a single active peer always gets all read capacity
+		TestContext context(true);
+		auto identity = CreateRandomIdentity();
+		std::atomic<size_t> numReads(0);
+
+		context.scheduler().recordPacket(identity, CreatePacketHeader(100'000));
+
+		// Act:
+		auto isExecuted = context.scheduleRead(identity, numReads);
+
+		// Assert:
+		EXPECT_TRUE(isExecuted);
+		EXPECT_EQ(0u, context.scheduler().numDeferredReads());
+	}
+
+	TEST(TEST_CLASS, ReadsAreDeferredWhenPeerExceedsFairShare) {
+		// Arrange: fair share is (5000 + 10) / 2
+		TestContext context(true);
+		auto identity1 = CreateRandomIdentity();
+		auto identity2 = CreateRandomIdentity();
+		std::atomic<size_t> numReads(0);
+
+		context.scheduler().recordPacket(identity1, CreatePacketHeader(5000));
+		context.scheduler().recordPacket(identity2, CreatePacketHeader(10));
+
+		// Act:
+		auto isExecuted1 = context.scheduleRead(identity1, numReads);
+		auto isExecuted2 = context.scheduleRead(identity2, numReads);
+
+		// Assert: only the read of the heavy peer was deferred
+		EXPECT_FALSE(isExecuted1);
+		EXPECT_TRUE(isExecuted2);
+		EXPECT_EQ(1u, context.scheduler().numDeferredReads());
+
+		// - traffic is forwarded even when a read is deferred
+		ASSERT_EQ(2u, context.trafficEntries().size());
+		EXPECT_EQ(5000u, context.trafficEntries()[0].NumBytes);
+		EXPECT_EQ(10u, context.trafficEntries()[1].NumBytes);
+	}
+
+	TEST(TEST_CLASS, PrioritizedPacketsAreChargedLess) {
+		// Arrange: weighted usage of first peer is 5000 / 4 = 1250, which is below fair share (1250 + 2000) / 2
+		TestContext context(true);
+		auto identity1 = CreateRandomIdentity();
+		auto identity2 = CreateRandomIdentity();
+		std::atomic<size_t> numReads(0);
+
+		context.scheduler().recordPacket(identity1, CreatePacketHeader(5000, ionet::PacketType::Push_Block));
+		context.scheduler().recordPacket(identity2, CreatePacketHeader(2000));
+
+		// Act:
+		auto isExecuted1 = context.scheduleRead(identity1, numReads);
+		auto isExecuted2 = context.scheduleRead(identity2, numReads);
+
+		// Assert: only the read of the peer pushing transactions was deferred
+		EXPECT_TRUE(isExecuted1);
+		EXPECT_FALSE(isExecuted2);
+		EXPECT_EQ(1u, context.scheduler().numDeferredReads());
+	}
+
+	TEST(TEST_CLASS, DeferredReadsAreExecutedInNextInterval) {
+		// Arrange:
+		TestContext context(true, utils::TimeSpan::FromMilliseconds(50));
+		auto identity1 = CreateRandomIdentity();
+		auto identity2 = CreateRandomIdentity();
+		std::atomic<size_t> numReads(0);
+
+		context.scheduler().recordPacket(identity1, CreatePacketHeader(5000));
+		context.scheduler().recordPacket(identity2, CreatePacketHeader(10));
+
+		// Act:
+		auto isExecuted = context.scheduleRead(identity1, numReads);
+
+		// Assert: the deferred read is executed after the interval elapses
+		EXPECT_FALSE(isExecuted);
+		WAIT_FOR_ONE(numReads);
+		EXPECT_EQ(0u, context.scheduler().numDeferredReads());
+	}
+
+	TEST(TEST_CLASS, ShutdownDropsDeferredReads) {
+		// Arrange:
+		TestContext context(true);
+		auto identity1 = CreateRandomIdentity();
+		auto identity2 = CreateRandomIdentity();
+		std::atomic<size_t> numReads(0);
+
+		context.scheduler().recordPacket(identity1, CreatePacketHeader(5000));
+		context.scheduler().recordPacket(identity2, CreatePacketHeader(10));
+		context.scheduleRead(identity1, numReads);
+
+		// Sanity:
+		EXPECT_EQ(1u, context.scheduler().numDeferredReads());
+
+		// Act:
+		context.scheduler().shutdown();
+		auto isExecuted = context.scheduleRead(identity2, numReads);
+
+		// Assert: deferred reads were dropped and new reads are ignored
+		EXPECT_FALSE(isExecuted);
+		EXPECT_EQ(0u, numReads);
+		EXPECT_EQ(0u, context.scheduler().numDeferredReads());
+	}
+
+	// endregion
+}}
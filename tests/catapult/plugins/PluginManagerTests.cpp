@@ -43,6 +43,7 @@ namespace catapult { namespace plugins {
 		// Assert:
 		EXPECT_FALSE(config.PreferCacheDatabase);
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
+		EXPECT_EQ(std::numeric_limits<uint32_t>::max(), config.MaxStatePathsKeys);
 	}
 
 	TEST(TEST_CLASS, CanCreateManager) {
@@ -99,6 +100,89 @@ namespace catapult { namespace plugins {
 		assertCacheConfiguration(manager.cacheConfig("bar"), "abc/bar");
 	}
 
+	namespace {
+		PluginManager CreatePluginManager(const StorageConfiguration& storageConfig, bool enableVerifiableState = false) {
+			auto config = model::BlockChainConfiguration::Uninitialized();
+			config.EnableVerifiableState = enableVerifiableState;
+			return PluginManager(
+					config,
+					storageConfig,
+					config::UserConfiguration::Uninitialized(),
+					config::InflationConfiguration::Uninitialized());
+		}
+
+		StorageConfiguration CreateStorageConfigurationWithDecodedValueCache() {
+			auto storageConfig = StorageConfiguration();
+			storageConfig.PreferCacheDatabase = true;
+			storageConfig.CacheDatabaseDirectory = "abc";
+			storageConfig.MaxCacheDatabaseDecodedValuesSize = utils::FileSize::FromKilobytes(45);
+			return storageConfig;
+		}
+
+		StorageConfiguration CreateStorageConfigurationWithPatriciaTreeNodeCache() {
+			auto storageConfig = StorageConfiguration();
+			storageConfig.PreferCacheDatabase = true;
+			storageConfig.CacheDatabaseDirectory = "abc";
+			storageConfig.MaxCacheDatabasePatriciaTreeNodesSize = utils::FileSize::FromKilobytes(67);
+			return storageConfig;
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithDecodedValueCache) {
+		// Arrange:
+		auto manager = CreatePluginManager(CreateStorageConfigurationWithDecodedValueCache());
+
+		// Act:
+		auto cacheConfig1 = manager.cacheConfig("foo");
+		auto cacheConfig2 = manager.cacheConfig("bar");
+
+		// Assert: all caches share the same statistics
+		EXPECT_EQ(utils::FileSize::FromKilobytes(45), cacheConfig1.DecodedValueCache.MaxSize);
+		EXPECT_EQ(utils::FileSize::FromKilobytes(45), cacheConfig2.DecodedValueCache.MaxSize);
+		EXPECT_TRUE(!!cacheConfig1.DecodedValueCache.pStatistics);
+		EXPECT_EQ(cacheConfig1.DecodedValueCache.pStatistics, cacheConfig2.DecodedValueCache.pStatistics);
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithoutDecodedValueCache) {
+		// Arrange:
+		auto storageConfig = StorageConfiguration();
+		storageConfig.PreferCacheDatabase = true;
+		storageConfig.CacheDatabaseDirectory = "abc";
+
+		auto manager = CreatePluginManager(storageConfig);
+
+		// Act:
+		auto cacheConfig = manager.cacheConfig("foo");
+
+		// Assert:
+		EXPECT_EQ(utils::FileSize(), cacheConfig.DecodedValueCache.MaxSize);
+		EXPECT_FALSE(!!cacheConfig.DecodedValueCache.pStatistics);
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithPatriciaTreeNodeCache) {
+		// Arrange:
+		auto manager = CreatePluginManager(CreateStorageConfigurationWithPatriciaTreeNodeCache(), true);
+
+		// Act:
+		auto cacheConfig1 = manager.cacheConfig("foo");
+		auto cacheConfig2 = manager.cacheConfig("bar");
+
+		// Assert: all caches share the same node cache
+		EXPECT_TRUE(!!cacheConfig1.DecodedValueCache.pPatriciaTreeNodeCache);
+		EXPECT_EQ(cacheConfig1.DecodedValueCache.pPatriciaTreeNodeCache, cacheConfig2.DecodedValueCache.pPatriciaTreeNodeCache);
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithoutPatriciaTreeNodeCacheWhenVerifiableStateIsDisabled) {
+		// Arrange:
+		auto manager = CreatePluginManager(CreateStorageConfigurationWithPatriciaTreeNodeCache(), false);
+
+		// Act:
+		auto cacheConfig = manager.cacheConfig("foo");
+
+		// Assert:
+		EXPECT_FALSE(!!cacheConfig.DecodedValueCache.pPatriciaTreeNodeCache);
+	}
+
 	// endregion
 
 	// region tx plugins
@@ -279,6 +363,44 @@ namespace catapult { namespace plugins {
 		EXPECT_EQ("D", counters[2].id().name());
 	}
 
+	TEST(TEST_CLASS, DecodedValueCacheDiagnosticCountersAreAddedWhenDecodedValueCacheIsEnabled) {
+		// Arrange:
+		auto manager = CreatePluginManager(CreateStorageConfigurationWithDecodedValueCache());
+		manager.addDiagnosticCounterHook([](auto& counters, const auto&) {
+			counters.push_back(MakeDiagnosticCounter(7));
+		});
+
+		auto pStatistics = manager.cacheConfig("foo").DecodedValueCache.pStatistics;
+		pStatistics->NumHits = 11;
+		pStatistics->NumMisses = 4;
+
+		// Act:
+		std::vector<utils::DiagnosticCounter> counters;
+		manager.addDiagnosticCounters(counters, manager.createCache());
+
+		// Assert:
+		ASSERT_EQ(3u, counters.size());
+		EXPECT_EQ("G", counters[0].id().name());
+		EXPECT_EQ("DECODED HIT", counters[1].id().name());
+		EXPECT_EQ(11u, counters[1].value());
+		EXPECT_EQ("DECODED MISS", counters[2].id().name());
+		EXPECT_EQ(4u, counters[2].value());
+	}
+
+	TEST(TEST_CLASS, PatriciaTreeNodeCacheDiagnosticCountersAreAddedWhenPatriciaTreeNodeCacheIsEnabled) {
+		// Arrange:
+		auto manager = CreatePluginManager(CreateStorageConfigurationWithPatriciaTreeNodeCache(), true);
+
+		// Act:
+		std::vector<utils::DiagnosticCounter> counters;
+		manager.addDiagnosticCounters(counters, manager.createCache());
+
+		// Assert:
+		ASSERT_EQ(2u, counters.size());
+		EXPECT_EQ("PT NODE HIT", counters[0].id().name());
+		EXPECT_EQ("PT NODE MISS", counters[1].id().name());
+	}
+
 	// endregion
 
 	// region validators - helpers
@@ -22,6 +22,7 @@
 #include "catapult/utils/Casting.h"
 #include "tests/test/nodeps/IteratorTestTraits.h"
 #include "tests/TestHarness.h"
+#include <boost/thread.hpp>
 #include <unordered_map>
 
 namespace catapult { namespace state {
@@ -164,6 +165,70 @@ namespace catapult { namespace state {
 
 	// endregion
 
+	// region copy + move
+
+	TEST(TEST_CLASS, CanCopyConstructMap) {
+		// Arrange:
+		CompactMosaicMap map;
+		InsertMany(map, 10);
+		map.optimize(MosaicId(106));
+
+		// Act:
+		CompactMosaicMap mapCopy(map);
+
+		// Assert:
+		EXPECT_TRUE(mapCopy.sharesStorageWith(map));
+		AssertContents(mapCopy, MosaicId(106), GetTenExpectedMosaics());
+		AssertContents(map, MosaicId(106), GetTenExpectedMosaics());
+	}
+
+	TEST(TEST_CLASS, CanAssignMap) {
+		// Arrange:
+		CompactMosaicMap map;
+		InsertMany(map, 10);
+		map.optimize(MosaicId(106));
+
+		CompactMosaicMap mapCopy;
+		InsertMany(mapCopy, 3);
+
+		// Act:
+		const auto& assignResult = mapCopy = map;
+
+		// Assert:
+		EXPECT_EQ(&mapCopy, &assignResult);
+		EXPECT_TRUE(mapCopy.sharesStorageWith(map));
+		AssertContents(mapCopy, MosaicId(106), GetTenExpectedMosaics());
+		AssertContents(map, MosaicId(106), GetTenExpectedMosaics());
+	}
+
+	TEST(TEST_CLASS, CanMoveConstructMap) {
+		// Arrange:
+		CompactMosaicMap map;
+		InsertMany(map, 10);
+
+		// Act:
+		CompactMosaicMap mapMoved(std::move(map));
+
+		// Assert:
+		EXPECT_FALSE(mapMoved.sharesStorageWith(map));
+		AssertContents(mapMoved, GetTenExpectedMosaics());
+	}
+
+	TEST(TEST_CLASS, CopiesOfMapWithSingleMosaicDoNotShareStorage) {
+		// Arrange:
+		CompactMosaicMap map;
+		InsertMany(map, 1);
+
+		// Act:
+		CompactMosaicMap mapCopy(map);
+
+		// Assert:
+		EXPECT_FALSE(mapCopy.sharesStorageWith(map));
+		AssertContents(mapCopy, { { MosaicId(1), Amount(1) } });
+	}
+
+	// endregion
+
 	// region insert
 
 	TEST(TEST_CLASS, CanInsertMosaic) {
@@ -725,4 +790,128 @@ namespace catapult { namespace state {
 	}
 
 	// endregion
+
+	// region copy on write
+
+	namespace {
+		template<typename TAction>
+		void AssertModificationDetachesCopy(TAction action, const MosaicMap& expectedCopyMosaics) {
+			// Arrange:
+			CompactMosaicMap map;
+			InsertMany(map, 10);
+
+			CompactMosaicMap mapCopy(map);
+
+			// Act:
+			action(mapCopy);
+
+			// Assert: only the copy was modified
+			EXPECT_FALSE(mapCopy.sharesStorageWith(map));
+			AssertContents(mapCopy, expectedCopyMosaics);
+			AssertContents(map, GetTenExpectedMosaics());
+		}
+	}
+
+	TEST(TEST_CLASS, ConstAccessDoesNotDetachCopy) {
+		// Arrange:
+		CompactMosaicMap map;
+		InsertMany(map, 10);
+
+		CompactMosaicMap mapCopy(map);
+
+		// Act:
+		const auto& constMapCopy = mapCopy;
+		auto numMosaics = 0u;
+		for (auto iter = constMapCopy.begin(); constMapCopy.end() != iter; ++iter)
+			++numMosaics;
+
+		auto isFound = constMapCopy.end() != constMapCopy.find(MosaicId(110));
+
+		// Assert:
+		EXPECT_EQ(10u, numMosaics);
+		EXPECT_TRUE(isFound);
+		EXPECT_TRUE(mapCopy.sharesStorageWith(map));
+	}
+
+	TEST(TEST_CLASS, InsertDetachesCopy) {
+		auto expectedMosaics = GetTenExpectedMosaics();
+		expectedMosaics.emplace(MosaicId(111), Amount(999));
+		AssertModificationDetachesCopy([](auto& map) { map.insert(std::make_pair(MosaicId(111), Amount(999))); }, expectedMosaics);
+	}
+
+	TEST(TEST_CLASS, EraseDetachesCopy) {
+		auto expectedMosaics = GetTenExpectedMosaics();
+		expectedMosaics.erase(MosaicId(110));
+		AssertModificationDetachesCopy([](auto& map) { map.erase(MosaicId(110)); }, expectedMosaics);
+	}
+
+	TEST(TEST_CLASS, ModificationViaFindDetachesCopy) {
+		auto expectedMosaics = GetTenExpectedMosaics();
+		expectedMosaics[MosaicId(110)] = Amount(999);
+		AssertModificationDetachesCopy([](auto& map) { map.find(MosaicId(110))->second = Amount(999); }, expectedMosaics);
+	}
+
+	TEST(TEST_CLASS, ModificationViaIterationDetachesCopy) {
+		MosaicMap expectedMosaics;
+		for (const auto& pair : GetTenExpectedMosaics())
+			expectedMosaics.emplace(pair.first, pair.second + Amount(1));
+
+		AssertModificationDetachesCopy([](auto& map) {
+			for (auto& pair : map)
+				pair.second = pair.second + Amount(1);
+		}, expectedMosaics);
+	}
+
+	TEST(TEST_CLASS, OptimizeDetachesCopy) {
+		AssertModificationDetachesCopy([](auto& map) { map.optimize(MosaicId(1)); }, GetTenExpectedMosaics());
+	}
+
+	TEST(TEST_CLASS, ModificationOfOriginalDoesNotModifyCopy) {
+		// Arrange:
+		CompactMosaicMap map;
+		InsertMany(map, 10);
+
+		CompactMosaicMap mapCopy(map);
+
+		// Act:
+		map.erase(MosaicId(110));
+
+		// Assert:
+		EXPECT_FALSE(mapCopy.sharesStorageWith(map));
+		AssertContents(mapCopy, GetTenExpectedMosaics());
+		EXPECT_EQ(9u, map.size());
+	}
+
+	TEST(TEST_CLASS, CopiesSharingStorageCanBeModifiedConcurrently) {
+		// Arrange:
+		constexpr auto Num_Copies = 8u;
+		CompactMosaicMap map;
+		InsertMany(map, 10);
+
+		std::vector<CompactMosaicMap> mapCopies(Num_Copies, map);
+
+		// Act: modify all copies concurrently
+		boost::thread_group threads;
+		for (auto i = 0u; i < Num_Copies; ++i) {
+			threads.create_thread([&mapCopy = mapCopies[i], i] {
+				mapCopy.erase(MosaicId(110));
+				mapCopy.insert(std::make_pair(MosaicId(200 + i), Amount(i)));
+			});
+		}
+
+		threads.join_all();
+
+		// Assert: each copy detached from the shared storage before it was modified
+		AssertContents(map, GetTenExpectedMosaics());
+		for (auto i = 0u; i < Num_Copies; ++i) {
+			auto expectedMosaics = GetTenExpectedMosaics();
+			expectedMosaics.erase(MosaicId(110));
+			expectedMosaics.emplace(MosaicId(200 + i), Amount(i));
+
+			EXPECT_FALSE(mapCopies[i].sharesStorageWith(map)) << i;
+			AssertContents(mapCopies[i], expectedMosaics);
+		}
+	}
+
+	// endregion
 }}
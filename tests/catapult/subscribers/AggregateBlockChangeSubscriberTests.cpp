@@ -77,4 +77,20 @@ namespace catapult { namespace subscribers {
 			EXPECT_EQ(Height(553), pSubscriber->dropBlocksAfterHeights()[0]) << message;
 		}
 	}
+
+	TEST(TEST_CLASS, FlushForwardsToAllSubscribers) {
+		// Arrange:
+		DEFINE_MOCK_FLUSH_CAPTURE(BlockChangeSubscriber);
+
+		TestContext<MockBlockChangeSubscriber> context;
+
+		// Sanity:
+		EXPECT_EQ(3u, context.subscribers().size());
+
+		// Act:
+		context.aggregate().flush();
+
+		// Assert:
+		test::AssertFlushDelegation(context);
+	}
 }}
@@ -228,6 +228,39 @@ namespace catapult { namespace subscribers {
 				return subscribers::ReadAll({ context.queuePath(), "index_r.dat", "index.dat" }, subscriber, readNextMessage);
 			}
 		};
+
+		struct ReadAllTimedFileQueueTraits {
+			template<typename TSubscriber, typename TMessageReader>
+			static void ReadAll(QueueTestContext& context, TSubscriber& subscriber, TMessageReader readNextMessage) {
+				ReadAll(context, subscriber, readNextMessage, [](const auto&) {});
+			}
+
+			template<typename TSubscriber, typename TMessageReader>
+			static void ReadAll(
+					QueueTestContext& context,
+					TSubscriber& subscriber,
+					TMessageReader readNextMessage,
+					const LatencyRecorder& recordLatency) {
+				return subscribers::ReadAll(context.reader(), subscriber, readNextMessage, recordLatency);
+			}
+		};
+
+		struct ReadAllTimedMessageQueueDescriptorTraits {
+			template<typename TSubscriber, typename TMessageReader>
+			static void ReadAll(QueueTestContext& context, TSubscriber& subscriber, TMessageReader readNextMessage) {
+				ReadAll(context, subscriber, readNextMessage, [](const auto&) {});
+			}
+
+			template<typename TSubscriber, typename TMessageReader>
+			static void ReadAll(
+					QueueTestContext& context,
+					TSubscriber& subscriber,
+					TMessageReader readNextMessage,
+					const LatencyRecorder& recordLatency) {
+				subscribers::MessageQueueDescriptor descriptor{ context.queuePath(), "index_r.dat", "index.dat" };
+				return subscribers::ReadAll(descriptor, subscriber, readNextMessage, recordLatency);
+			}
+		};
 	}
 
 #define READ_ALL_FILE_BASED_TEST(TEST_NAME) \
@@ -236,6 +269,10 @@ namespace catapult { namespace subscribers {
 	TEST(TEST_CLASS, TEST_NAME##_MessageQueueDescriptor) { \
 		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllMessageQueueDescriptorTraits>(); \
 	} \
+	TEST(TEST_CLASS, TEST_NAME##_TimedFileQueue) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllTimedFileQueueTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_TimedMessageQueueDescriptor) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllTimedMessageQueueDescriptorTraits>(); \
+	} \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	READ_ALL_FILE_BASED_TEST(ReadAllFileQueue_CanReadZero) {
@@ -342,4 +379,184 @@ namespace catapult { namespace subscribers {
 	}
 
 	// endregion
+
+	// region ReadAll (latency)
+
+#define READ_ALL_TIMED_FILE_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_TimedFileQueue) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllTimedFileQueueTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_TimedMessageQueueDescriptor) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllTimedMessageQueueDescriptorTraits>(); \
+	} \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	READ_ALL_TIMED_FILE_BASED_TEST(ReadAllFileQueue_RecordsNoLatenciesWhenNoMessagesAreProcessed) {
+		// Arrange:
+		QueueTestContext context;
+
+		MockBufferSubscriber subscriber;
+		std::vector<utils::TimeSpan> latencies;
+
+		// Act:
+		TTraits::ReadAll(context, subscriber, ReadNextBuffer, [&latencies](const auto& latency) { latencies.push_back(latency); });
+
+		// Assert:
+		EXPECT_TRUE(subscriber.notifications().empty());
+		EXPECT_TRUE(latencies.empty());
+	}
+
+	READ_ALL_TIMED_FILE_BASED_TEST(ReadAllFileQueue_RecordsLatencyOfEachProcessedMessage) {
+		// Arrange:
+		QueueTestContext context;
+		context.write({ test::GenerateRandomVector(141), test::GenerateRandomVector(132) });
+		context.write(test::GenerateRandomVector(144));
+
+		MockBufferSubscriber subscriber;
+		std::vector<std::pair<size_t, utils::TimeSpan>> latencies;
+
+		// Act:
+		TTraits::ReadAll(context, subscriber, ReadNextBuffer, [&subscriber, &latencies](const auto& latency) {
+			latencies.emplace_back(subscriber.breadcrumbs().size(), latency);
+		});
+
+		// Assert: latencies are recorded after messages are processed and flushed
+		ASSERT_EQ(2u, latencies.size());
+		EXPECT_EQ(3u, latencies[0].first);
+		EXPECT_EQ(5u, latencies[1].first);
+
+		for (const auto& pair : latencies)
+			EXPECT_GT(utils::TimeSpan::FromMinutes(1), pair.second);
+	}
+
+	// endregion
+
+	// region ReadAll (batched)
+
+	namespace {
+		class MockBufferSubscriberWithFailingFlush : public MockBufferSubscriberWithoutFlush {
+		public:
+			explicit MockBufferSubscriberWithFailingFlush(size_t numFailures) : m_numFailures(numFailures)
+			{}
+
+		public:
+			void flush() {
+				m_breadcrumbs.push_back(Breadcrumb::Flush);
+				if (0 == m_numFailures)
+					return;
+
+				--m_numFailures;
+				CATAPULT_THROW_RUNTIME_ERROR("flush failed");
+			}
+
+		private:
+			size_t m_numFailures;
+		};
+
+		struct ReadAllBatchedFileQueueTraits {
+			static size_t Pending(QueueTestContext& context) {
+				return context.reader().pending();
+			}
+
+			template<typename TSubscriber, typename TMessageReader>
+			static void ReadAll(
+					QueueTestContext& context,
+					TSubscriber& subscriber,
+					TMessageReader readNextMessage,
+					size_t maxMessagesPerFlush,
+					const LatencyRecorder& recordLatency) {
+				return subscribers::ReadAll(context.reader(), subscriber, readNextMessage, maxMessagesPerFlush, recordLatency);
+			}
+		};
+
+		struct ReadAllBatchedMessageQueueDescriptorTraits {
+			static size_t Pending(QueueTestContext& context) {
+				return io::FileQueueReader(context.queuePath(), "index_r.dat", "index.dat").pending();
+			}
+
+			template<typename TSubscriber, typename TMessageReader>
+			static void ReadAll(
+					QueueTestContext& context,
+					TSubscriber& subscriber,
+					TMessageReader readNextMessage,
+					size_t maxMessagesPerFlush,
+					const LatencyRecorder& recordLatency) {
+				subscribers::MessageQueueDescriptor descriptor{ context.queuePath(), "index_r.dat", "index.dat" };
+				return subscribers::ReadAll(descriptor, subscriber, readNextMessage, maxMessagesPerFlush, recordLatency);
+			}
+		};
+	}
+
+#define READ_ALL_BATCHED_FILE_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_BatchedFileQueue) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllBatchedFileQueueTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_BatchedMessageQueueDescriptor) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllBatchedMessageQueueDescriptorTraits>(); \
+	} \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	READ_ALL_BATCHED_FILE_BASED_TEST(ReadAllFileQueue_FlushesOncePerBatch) {
+		// Arrange:
+		QueueTestContext context;
+		for (auto i = 0u; i < 5; ++i)
+			context.write(test::GenerateRandomVector(100 + i));
+
+		MockBufferSubscriber subscriber;
+		std::vector<size_t> latencyBreadcrumbCounts;
+
+		// Act:
+		TTraits::ReadAll(context, subscriber, ReadNextBuffer, 2, [&subscriber, &latencyBreadcrumbCounts](const auto&) {
+			latencyBreadcrumbCounts.push_back(subscriber.breadcrumbs().size());
+		});
+
+		// Assert: multiple messages are processed before each flush
+		std::vector<Breadcrumb> expectedBreadcrumbs{
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Flush
+		};
+		EXPECT_EQ(expectedBreadcrumbs, subscriber.breadcrumbs());
+		EXPECT_EQ(5u, subscriber.notifications().size());
+
+		// - latencies of all messages in a batch are recorded after the batch is flushed
+		EXPECT_EQ(std::vector<size_t>({ 3, 3, 6, 6, 8 }), latencyBreadcrumbCounts);
+		EXPECT_EQ(0u, TTraits::Pending(context));
+	}
+
+	READ_ALL_BATCHED_FILE_BASED_TEST(ReadAllFileQueue_ReadsAllMessagesOfBatchAgainWhenFlushFails) {
+		// Arrange:
+		auto notificationBuffers = std::vector<std::vector<uint8_t>>{
+			test::GenerateRandomVector(141), test::GenerateRandomVector(132), test::GenerateRandomVector(144)
+		};
+		QueueTestContext context;
+		for (const auto& notificationBuffer : notificationBuffers)
+			context.write(notificationBuffer);
+
+		MockBufferSubscriberWithFailingFlush subscriber(1);
+		std::vector<utils::TimeSpan> latencies;
+		auto recordLatency = [&latencies](const auto& latency) { latencies.push_back(latency); };
+
+		// Act: first batch is not flushed successfully
+		EXPECT_THROW(TTraits::ReadAll(context, subscriber, ReadNextBuffer, 2, recordLatency), catapult_runtime_error);
+
+		// Sanity:
+		EXPECT_EQ(3u, TTraits::Pending(context));
+		EXPECT_TRUE(latencies.empty());
+
+		// Act:
+		TTraits::ReadAll(context, subscriber, ReadNextBuffer, 2, recordLatency);
+
+		// Assert: messages of the failed batch are processed again
+		const auto& notifications = subscriber.notifications();
+		ASSERT_EQ(5u, notifications.size());
+		EXPECT_EQ(notificationBuffers[0], notifications[0]);
+		EXPECT_EQ(notificationBuffers[1], notifications[1]);
+		EXPECT_EQ(notificationBuffers[0], notifications[2]);
+		EXPECT_EQ(notificationBuffers[1], notifications[3]);
+		EXPECT_EQ(notificationBuffers[2], notifications[4]);
+
+		EXPECT_EQ(3u, latencies.size());
+		EXPECT_EQ(0u, TTraits::Pending(context));
+	}
+
+	// endregion
 }}
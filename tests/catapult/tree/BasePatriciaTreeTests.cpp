@@ -160,6 +160,26 @@ namespace catapult { namespace tree {
 		EXPECT_NE(nodePathLeaf.value(), result.first);
 	}
 
+	TEST(TEST_CLASS, BatchLookupForwardsToUnderlyingTree) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+
+		// Act:
+		std::vector<TreeNode> nodes;
+		auto results = tree.lookup(std::vector<uint32_t>{ 0x64'6F'67'64, 0x64'6F'67'65 }, nodes);
+
+		// Assert:
+		ASSERT_EQ(2u, results.size());
+		EXPECT_FALSE(results[0].second);
+		EXPECT_TRUE(results[1].second);
+
+		ASSERT_FALSE(nodes.empty());
+		EXPECT_TRUE(nodes.back().isLeaf());
+		EXPECT_EQ(nodes.back().asLeafNode().value(), results[1].first);
+	}
+
 	// endregion
 
 	// region loading
@@ -158,6 +158,16 @@ namespace catapult { namespace utils {
 		AssertEnumParseFailure("Ansi", LogColorMode::None);
 	}
 
+	TEST(TEST_CLASS, CanParseValidLogOverflowPolicy) {
+		using T = LogOverflowPolicy;
+		AssertSuccessfulParse("Block", T::Block);
+		AssertSuccessfulParse("Drop", T::Drop);
+	}
+
+	TEST(TEST_CLASS, CannotParseInvalidLogOverflowPolicy) {
+		AssertEnumParseFailure("Drop", LogOverflowPolicy::Block);
+	}
+
 	// endregion
 
 	// region bool
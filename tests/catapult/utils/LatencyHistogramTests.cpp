@@ -0,0 +1,294 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/LatencyHistogram.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+#include <sstream>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS LatencyHistogramTests
+
+	namespace {
+		using Snapshot = LatencyHistogram::Snapshot;
+
+		struct UnsynchronizedTraits {
+			static constexpr auto Policy = LatencyHistogramPolicy::Unsynchronized;
+		};
+
+		struct AtomicTraits {
+			static constexpr auto Policy = LatencyHistogramPolicy::Atomic;
+		};
+
+		void RecordAll(LatencyHistogram& histogram, const std::vector<uint64_t>& latencies) {
+			for (auto latency : latencies)
+				histogram.record(std::chrono::microseconds(latency));
+		}
+
+		void AssertBucketCounts(const Snapshot& snapshot, const std::map<size_t, uint64_t>& expectedBucketCounts) {
+			for (auto i = 0u; i < LatencyHistogram::Num_Buckets; ++i) {
+				auto iter = expectedBucketCounts.find(i);
+				auto expectedBucketCount = expectedBucketCounts.cend() == iter ? 0 : iter->second;
+				EXPECT_EQ(expectedBucketCount, snapshot.bucketCount(i)) << "bucket " << i;
+			}
+		}
+	}
+
+#define POLICY_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Unsynchronized) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<UnsynchronizedTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Atomic) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<AtomicTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	// region constructor
+
+	TEST(TEST_CLASS, HistogramHasAtomicPolicyByDefault) {
+		// Act:
+		LatencyHistogram histogram;
+
+		// Assert:
+		EXPECT_EQ(LatencyHistogramPolicy::Atomic, histogram.policy());
+	}
+
+	POLICY_BASED_TEST(HistogramIsInitiallyEmpty) {
+		// Act:
+		LatencyHistogram histogram(TTraits::Policy);
+		auto snapshot = histogram.snapshot();
+
+		// Assert:
+		EXPECT_EQ(TTraits::Policy, histogram.policy());
+		EXPECT_EQ(0u, snapshot.count());
+		EXPECT_EQ(std::chrono::microseconds(0), snapshot.max());
+		EXPECT_EQ(std::chrono::microseconds(0), snapshot.percentile(50));
+		AssertBucketCounts(snapshot, {});
+	}
+
+	// endregion
+
+	// region record
+
+	POLICY_BASED_TEST(CanRecordSingleLatency) {
+		// Arrange:
+		LatencyHistogram histogram(TTraits::Policy);
+
+		// Act:
+		histogram.record(std::chrono::microseconds(5));
+		auto snapshot = histogram.snapshot();
+
+		// Assert:
+		EXPECT_EQ(1u, snapshot.count());
+		EXPECT_EQ(std::chrono::microseconds(5), snapshot.max());
+		AssertBucketCounts(snapshot, { { 5, 1 } });
+	}
+
+	POLICY_BASED_TEST(NegativeLatenciesAreRecordedAsZero) {
+		// Arrange:
+		LatencyHistogram histogram(TTraits::Policy);
+
+		// Act:
+		histogram.record(std::chrono::microseconds(-5));
+		auto snapshot = histogram.snapshot();
+
+		// Assert:
+		EXPECT_EQ(1u, snapshot.count());
+		EXPECT_EQ(std::chrono::microseconds(0), snapshot.max());
+		AssertBucketCounts(snapshot, { { 0, 1 } });
+	}
+
+	POLICY_BASED_TEST(CanRecordLatenciesInLogLinearBuckets) {
+		// Arrange:
+		LatencyHistogram histogram(TTraits::Policy);
+
+		// Act: [0, 8) have own buckets, [8, 16) have unit buckets, [16, 32) have buckets of width two, ...
+		RecordAll(histogram, { 0, 1, 7, 8, 15, 16, 17, 18, 31, 1000, 1023, 1024 });
+		auto snapshot = histogram.snapshot();
+
+		// Assert:
+		EXPECT_EQ(12u, snapshot.count());
+		EXPECT_EQ(std::chrono::microseconds(1024), snapshot.max());
+		AssertBucketCounts(snapshot, {
+			{ 0, 1 }, { 1, 1 }, { 7, 1 },
+			{ 8, 1 }, { 15, 1 },
+			{ 16, 2 }, { 17, 1 }, { 23, 1 },
+			{ 63, 2 }, { 64, 1 }
+		});
+	}
+
+	POLICY_BASED_TEST(LastBucketContainsAllLargeLatencies) {
+		// Arrange:
+		LatencyHistogram histogram(TTraits::Policy);
+
+		// Act:
+		RecordAll(histogram, { (1ull << 32) - 1, 1ull << 32, 1ull << 40 });
+		auto snapshot = histogram.snapshot();
+
+		// Assert:
+		EXPECT_EQ(3u, snapshot.count());
+		EXPECT_EQ(std::chrono::microseconds(1ull << 40), snapshot.max());
+		EXPECT_EQ(3u, snapshot.bucketCount(LatencyHistogram::Num_Buckets - 1));
+	}
+
+	TEST(TEST_CLASS, CanRecordLatenciesFromMultipleThreadsWithAtomicPolicy) {
+		// Arrange:
+		constexpr auto Num_Threads = 2 * LatencyHistogram::Num_Stripes + 1;
+		constexpr auto Num_Latencies_Per_Thread = 1000u;
+		LatencyHistogram histogram(LatencyHistogramPolicy::Atomic);
+		boost::thread_group threads;
+
+		// Act:
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.create_thread([&histogram, i] {
+				for (auto j = 0u; j < Num_Latencies_Per_Thread; ++j)
+					histogram.record(std::chrono::microseconds(i * Num_Latencies_Per_Thread + j));
+			});
+		}
+
+		threads.join_all();
+		auto snapshot = histogram.snapshot();
+
+		// Assert: all latencies are merged
+		EXPECT_EQ(Num_Threads * Num_Latencies_Per_Thread, snapshot.count());
+		EXPECT_EQ(std::chrono::microseconds(Num_Threads * Num_Latencies_Per_Thread - 1), snapshot.max());
+	}
+
+	TEST(TEST_CLASS, CanSnapshotWhileSingleThreadRecordsWithUnsynchronizedPolicy) {
+		// Arrange:
+		constexpr auto Num_Latencies = 10'000u;
+		LatencyHistogram histogram(LatencyHistogramPolicy::Unsynchronized);
+
+		// Act: take snapshots while another thread is recording
+		boost::thread recordThread([&histogram] {
+			for (auto i = 0u; i < Num_Latencies; ++i)
+				histogram.record(std::chrono::microseconds(i));
+		});
+
+		uint64_t previousCount = 0;
+		for (auto i = 0u; i < 100; ++i) {
+			auto count = histogram.snapshot().count();
+
+			// Assert: counts never decrease
+			EXPECT_LE(previousCount, count);
+			previousCount = count;
+		}
+
+		recordThread.join();
+		auto snapshot = histogram.snapshot();
+
+		// Assert: all latencies were recorded
+		EXPECT_EQ(Num_Latencies, snapshot.count());
+		EXPECT_EQ(std::chrono::microseconds(Num_Latencies - 1), snapshot.max());
+	}
+
+	// endregion
+
+	// region percentile
+
+	POLICY_BASED_TEST(PercentileReturnsUpperBoundOfContainingBucket) {
+		// Arrange: 900 values in bucket [960, 1024) and 100 values in bucket [1920, 2048)
+		LatencyHistogram histogram(TTraits::Policy);
+		RecordAll(histogram, std::vector<uint64_t>(900, 1000));
+		RecordAll(histogram, std::vector<uint64_t>(99, 2000));
+		RecordAll(histogram, { 1950 });
+		auto snapshot = histogram.snapshot();
+
+		// Act + Assert:
+		EXPECT_EQ(std::chrono::microseconds(1023), snapshot.percentile(0));
+		EXPECT_EQ(std::chrono::microseconds(1023), snapshot.percentile(50));
+		EXPECT_EQ(std::chrono::microseconds(1023), snapshot.percentile(90));
+		EXPECT_EQ(std::chrono::microseconds(2000), snapshot.percentile(91));
+		EXPECT_EQ(std::chrono::microseconds(2000), snapshot.percentile(99.9));
+		EXPECT_EQ(std::chrono::microseconds(2000), snapshot.percentile(100));
+	}
+
+	POLICY_BASED_TEST(PercentileIsCappedByMaxLatency) {
+		// Arrange:
+		LatencyHistogram histogram(TTraits::Policy);
+		RecordAll(histogram, { 961, 962 });
+		auto snapshot = histogram.snapshot();
+
+		// Act + Assert: upper bound of bucket [960, 1024) is 1023
+		EXPECT_EQ(std::chrono::microseconds(962), snapshot.percentile(50));
+		EXPECT_EQ(std::chrono::microseconds(962), snapshot.percentile(150));
+	}
+
+	// endregion
+
+	// region reset
+
+	POLICY_BASED_TEST(ResetRemovesAllRecordedLatencies) {
+		// Arrange:
+		LatencyHistogram histogram(TTraits::Policy);
+		RecordAll(histogram, { 0, 1, 7, 8, 15, 16, 1000 });
+
+		// Act:
+		histogram.reset();
+		auto snapshot = histogram.snapshot();
+
+		// Assert:
+		EXPECT_EQ(0u, snapshot.count());
+		EXPECT_EQ(std::chrono::microseconds(0), snapshot.max());
+		AssertBucketCounts(snapshot, {});
+	}
+
+	// endregion
+
+	// region merge
+
+	TEST(TEST_CLASS, CanMergeSnapshotsOfHistogramsWithDifferentPolicies) {
+		// Arrange:
+		LatencyHistogram histogram1(LatencyHistogramPolicy::Unsynchronized);
+		RecordAll(histogram1, { 1, 1000 });
+
+		LatencyHistogram histogram2(LatencyHistogramPolicy::Atomic);
+		RecordAll(histogram2, { 1, 7, 500 });
+
+		auto snapshot = histogram1.snapshot();
+
+		// Act:
+		snapshot.merge(histogram2.snapshot());
+
+		// Assert:
+		EXPECT_EQ(5u, snapshot.count());
+		EXPECT_EQ(std::chrono::microseconds(1000), snapshot.max());
+		AssertBucketCounts(snapshot, { { 1, 2 }, { 7, 1 }, { 55, 1 }, { 63, 1 } });
+	}
+
+	// endregion
+
+	// region insertion operator
+
+	TEST(TEST_CLASS, CanOutputSnapshot) {
+		// Arrange:
+		LatencyHistogram histogram;
+		RecordAll(histogram, std::vector<uint64_t>(900, 1000));
+		RecordAll(histogram, std::vector<uint64_t>(100, 2000));
+
+		// Act:
+		std::ostringstream out;
+		out << histogram.snapshot();
+		auto str = out.str();
+
+		// Assert:
+		EXPECT_EQ("count = 1000, p50 <= 1023us, p99 <= 2000us, p999 <= 2000us, max = 2000us", str);
+	}
+
+	// endregion
+}}
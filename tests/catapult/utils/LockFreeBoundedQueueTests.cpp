@@ -0,0 +1,201 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/LockFreeBoundedQueue.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+#include <set>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS LockFreeBoundedQueueTests
+
+	// region capacity
+
+	TEST(TEST_CLASS, QueueIsInitiallyEmpty) {
+		// Act:
+		LockFreeBoundedQueue<int> queue(16);
+
+		// Assert:
+		EXPECT_EQ(16u, queue.capacity());
+		EXPECT_EQ(0u, queue.size());
+	}
+
+	TEST(TEST_CLASS, CapacityIsRoundedUpToPowerOfTwo) {
+		// Act + Assert:
+		EXPECT_EQ(2u, LockFreeBoundedQueue<int>(0).capacity());
+		EXPECT_EQ(2u, LockFreeBoundedQueue<int>(1).capacity());
+		EXPECT_EQ(2u, LockFreeBoundedQueue<int>(2).capacity());
+		EXPECT_EQ(4u, LockFreeBoundedQueue<int>(3).capacity());
+		EXPECT_EQ(1024u, LockFreeBoundedQueue<int>(1000).capacity());
+		EXPECT_EQ(1024u, LockFreeBoundedQueue<int>(1024).capacity());
+		EXPECT_EQ(2048u, LockFreeBoundedQueue<int>(1025).capacity());
+	}
+
+	// endregion
+
+	// region tryPush / tryPop
+
+	TEST(TEST_CLASS, CannotPopFromEmptyQueue) {
+		// Arrange:
+		LockFreeBoundedQueue<int> queue(4);
+		auto value = 7;
+
+		// Act:
+		auto result = queue.tryPop(value);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(7, value);
+	}
+
+	TEST(TEST_CLASS, CanPushLvaluesAndRvalues) {
+		// Arrange:
+		LockFreeBoundedQueue<std::string> queue(4);
+		std::string alpha = "alpha";
+
+		// Act:
+		auto result1 = queue.tryPush(alpha);
+		auto result2 = queue.tryPush(std::string("beta"));
+
+		// Assert:
+		EXPECT_TRUE(result1);
+		EXPECT_TRUE(result2);
+		EXPECT_EQ(2u, queue.size());
+		EXPECT_EQ("alpha", alpha);
+	}
+
+	TEST(TEST_CLASS, ElementsArePoppedInPushOrder) {
+		// Arrange:
+		LockFreeBoundedQueue<int> queue(4);
+		for (auto value : { 5, 7, 3 })
+			queue.tryPush(value);
+
+		// Act:
+		std::vector<int> values;
+		int value;
+		while (queue.tryPop(value))
+			values.push_back(value);
+
+		// Assert:
+		EXPECT_EQ(std::vector<int>({ 5, 7, 3 }), values);
+		EXPECT_EQ(0u, queue.size());
+	}
+
+	TEST(TEST_CLASS, CannotPushToFullQueue) {
+		// Arrange:
+		LockFreeBoundedQueue<int> queue(4);
+		for (auto value : { 5, 7, 3, 2 })
+			EXPECT_TRUE(queue.tryPush(value)) << value;
+
+		// Act:
+		auto result = queue.tryPush(9);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(4u, queue.size());
+	}
+
+	TEST(TEST_CLASS, CanPushAfterPopFromFullQueue) {
+		// Arrange:
+		LockFreeBoundedQueue<int> queue(4);
+		for (auto value : { 5, 7, 3, 2 })
+			queue.tryPush(value);
+
+		int value;
+		queue.tryPop(value);
+
+		// Act:
+		auto result = queue.tryPush(9);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(5, value);
+
+		std::vector<int> values;
+		while (queue.tryPop(value))
+			values.push_back(value);
+
+		EXPECT_EQ(std::vector<int>({ 7, 3, 2, 9 }), values);
+	}
+
+	TEST(TEST_CLASS, PopReleasesElement) {
+		// Arrange:
+		LockFreeBoundedQueue<std::shared_ptr<int>> queue(4);
+		auto pValue = std::make_shared<int>(7);
+		queue.tryPush(pValue);
+
+		// Act:
+		{
+			std::shared_ptr<int> pPoppedValue;
+			queue.tryPop(pPoppedValue);
+		}
+
+		// Assert: the queue does not hold a reference
+		EXPECT_EQ(1, pValue.use_count());
+	}
+
+	// endregion
+
+	// region multithreaded
+
+	TEST(TEST_CLASS, CanPushAndPopFromMultipleThreads) {
+		// Arrange:
+		constexpr auto Num_Producers = 4u;
+		constexpr auto Num_Values_Per_Producer = 10'000u;
+		LockFreeBoundedQueue<uint32_t> queue(64);
+
+		// Act: push values from multiple producers and pop all of them from a single consumer
+		boost::thread_group threads;
+		for (auto i = 0u; i < Num_Producers; ++i) {
+			threads.create_thread([&queue, i] {
+				for (auto j = 0u; j < Num_Values_Per_Producer; ++j) {
+					while (!queue.tryPush(i * Num_Values_Per_Producer + j))
+						boost::this_thread::yield();
+				}
+			});
+		}
+
+		std::set<uint32_t> values;
+		std::vector<uint32_t> lastValues(Num_Producers, 0);
+		auto isOrdered = true;
+		while (values.size() < Num_Producers * Num_Values_Per_Producer) {
+			uint32_t value;
+			if (!queue.tryPop(value))
+				continue;
+
+			auto producerId = value / Num_Values_Per_Producer;
+			isOrdered = isOrdered && (0 == value % Num_Values_Per_Producer || lastValues[producerId] < value);
+			lastValues[producerId] = value;
+			values.insert(value);
+		}
+
+		threads.join_all();
+
+		// Assert: all values were popped exactly once and values from each producer were popped in order
+		EXPECT_EQ(Num_Producers * Num_Values_Per_Producer, values.size());
+		EXPECT_EQ(0u, *values.cbegin());
+		EXPECT_EQ(Num_Producers * Num_Values_Per_Producer - 1, *values.crbegin());
+		EXPECT_TRUE(isOrdered);
+		EXPECT_EQ(0u, queue.size());
+	}
+
+	// endregion
+}}
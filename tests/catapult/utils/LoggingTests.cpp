@@ -356,4 +356,107 @@ namespace catapult { namespace utils {
 			});
 		}
 	}
+
+	// region asynchronous sink
+
+	namespace {
+		std::vector<size_t> LogNumberedMessagesToAsyncFileLogger(LogOverflowPolicy overflowPolicy, size_t numMessages) {
+			test::TempLogsDirectoryGuard logFileGuard;
+
+			{
+				// Arrange: add an asynchronous file logger with a tiny queue
+				auto options = test::CreateTestFileLoggerOptions();
+				options.SinkType = LogSinkType::Async;
+				options.QueueCapacity = 2;
+				options.OverflowPolicy = overflowPolicy;
+
+				LoggingBootstrapper bootstrapper;
+				bootstrapper.addFileLogger(options, LogFilter(LogLevel::Min));
+
+				// Act: log messages
+				for (auto i = 0u; i < numMessages; ++i)
+					CATAPULT_LOG(info) << "message " << i;
+			}
+
+			// Assert: extract message numbers
+			auto records = test::ParseLogLines(logFileGuard.name());
+			test::AssertTimestampsAreIncreasing(records);
+
+			std::vector<size_t> messageNumbers;
+			for (const auto& record : records) {
+				auto messageStartIndex = record.Message.find("message ");
+				messageNumbers.push_back(std::stoul(record.Message.substr(messageStartIndex + 8)));
+			}
+
+			return messageNumbers;
+		}
+	}
+
+	TEST(TEST_CLASS, AsyncSinkWithBlockPolicyWritesAllMessages) {
+		// Act:
+		auto messageNumbers = LogNumberedMessagesToAsyncFileLogger(LogOverflowPolicy::Block, 1000);
+
+		// Assert: all messages were written in order
+		ASSERT_EQ(1000u, messageNumbers.size());
+		for (auto i = 0u; i < messageNumbers.size(); ++i)
+			EXPECT_EQ(i, messageNumbers[i]) << i;
+	}
+
+	TEST(TEST_CLASS, AsyncSinkWithDropPolicyWritesSubsetOfMessages) {
+		// Act:
+		auto messageNumbers = LogNumberedMessagesToAsyncFileLogger(LogOverflowPolicy::Drop, 1000);
+
+		// Assert: the first message is always written because the queue is initially empty
+		ASSERT_LE(1u, messageNumbers.size());
+		ASSERT_GE(1000u, messageNumbers.size());
+		EXPECT_EQ(0u, messageNumbers[0]);
+
+		// - written messages are in order
+		for (auto i = 1u; i < messageNumbers.size(); ++i)
+			EXPECT_LT(messageNumbers[i - 1], messageNumbers[i]) << i;
+	}
+
+	TEST(TEST_CLASS, AsyncSinkWithBlockPolicyWritesAllMessagesFromMultipleThreads) {
+		// Arrange:
+		constexpr auto Num_Threads = 4u;
+		constexpr auto Num_Messages_Per_Thread = 250u;
+		test::TempLogsDirectoryGuard logFileGuard;
+
+		{
+			// - add an asynchronous file logger with a tiny queue
+			auto options = test::CreateTestFileLoggerOptions();
+			options.SinkType = LogSinkType::Async;
+			options.QueueCapacity = 2;
+			options.OverflowPolicy = LogOverflowPolicy::Block;
+
+			LoggingBootstrapper bootstrapper;
+			bootstrapper.addFileLogger(options, LogFilter(LogLevel::Min));
+
+			// Act: log messages from multiple threads so that producers contend for the full queue
+			boost::thread_group threads;
+			for (auto i = 0u; i < Num_Threads; ++i) {
+				threads.create_thread([i] {
+					for (auto j = 0u; j < Num_Messages_Per_Thread; ++j)
+						CATAPULT_LOG(info) << "message " << (i * Num_Messages_Per_Thread + j);
+				});
+			}
+
+			threads.join_all();
+		}
+
+		// Assert: all messages were written exactly once
+		auto records = test::ParseLogLines(logFileGuard.name());
+		std::vector<size_t> messageNumbers;
+		for (const auto& record : records) {
+			auto messageStartIndex = record.Message.find("message ");
+			messageNumbers.push_back(std::stoul(record.Message.substr(messageStartIndex + 8)));
+		}
+
+		std::sort(messageNumbers.begin(), messageNumbers.end());
+		ASSERT_EQ(Num_Threads * Num_Messages_Per_Thread, messageNumbers.size());
+		for (auto i = 0u; i < messageNumbers.size(); ++i)
+			EXPECT_EQ(i, messageNumbers[i]) << i;
+	}
+
+	// endregion
 }}
@@ -0,0 +1,264 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/Tracing.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/thread.hpp>
+#include <sstream>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS TracingTests
+
+	namespace {
+		// region test utils
+
+		class TracingGuard {
+		public:
+			explicit TracingGuard(bool isEnabled) {
+				SetTracingEnabled(isEnabled);
+				ClearTraceEvents();
+			}
+
+			~TracingGuard() {
+				SetTracingEnabled(false);
+				ClearTraceEvents();
+			}
+		};
+
+		std::vector<boost::property_tree::ptree> GetTraceEvents() {
+			std::stringstream out;
+			WriteTraceEvents(out);
+
+			boost::property_tree::ptree trace;
+			boost::property_tree::read_json(out, trace);
+
+			std::vector<boost::property_tree::ptree> events;
+			for (const auto& pair : trace.get_child("traceEvents"))
+				events.push_back(pair.second);
+
+			return events;
+		}
+
+		// endregion
+	}
+
+	// region enable / disable
+
+	TEST(TEST_CLASS, TracingIsInitiallyDisabled) {
+		// Assert:
+		EXPECT_FALSE(IsTracingEnabled());
+	}
+
+	TEST(TEST_CLASS, CanEnableAndDisableTracing) {
+		// Arrange:
+		TracingGuard guard(false);
+
+		// Act + Assert:
+		SetTracingEnabled(true);
+		EXPECT_TRUE(IsTracingEnabled());
+
+		SetTracingEnabled(false);
+		EXPECT_FALSE(IsTracingEnabled());
+	}
+
+	TEST(TEST_CLASS, SpanIsNotRecordedWhenTracingIsDisabled) {
+		// Arrange:
+		TracingGuard guard(false);
+
+		// Act:
+		{
+			TraceSpan span("test", "alpha");
+			span.setHeight(Height(12));
+		}
+
+		// Assert:
+		EXPECT_TRUE(GetTraceEvents().empty());
+	}
+
+	TEST(TEST_CLASS, SpanIsNotRecordedWhenTracingIsEnabledAfterSpanIsCreated) {
+		// Arrange:
+		TracingGuard guard(false);
+
+		// Act:
+		{
+			TraceSpan span("test", "alpha");
+			SetTracingEnabled(true);
+		}
+
+		// Assert:
+		EXPECT_TRUE(GetTraceEvents().empty());
+	}
+
+	// endregion
+
+	// region TraceSpan
+
+	TEST(TEST_CLASS, SpanIsRecordedAsCompleteEventWhenTracingIsEnabled) {
+		// Arrange:
+		TracingGuard guard(true);
+
+		// Act:
+		{
+			TraceSpan span("test", "alpha");
+			test::Sleep(2);
+		}
+
+		// Assert:
+		auto events = GetTraceEvents();
+		ASSERT_EQ(1u, events.size());
+
+		const auto& event = events[0];
+		EXPECT_EQ("alpha", event.get<std::string>("name"));
+		EXPECT_EQ("test", event.get<std::string>("cat"));
+		EXPECT_EQ("X", event.get<std::string>("ph"));
+		EXPECT_EQ(1u, event.get<uint32_t>("pid"));
+		EXPECT_LE(2'000u, event.get<uint64_t>("dur"));
+		EXPECT_TRUE(event.get_child("args").empty());
+	}
+
+	TEST(TEST_CLASS, SpanCanCarryBlockAttributes) {
+		// Arrange:
+		TracingGuard guard(true);
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		{
+			TraceSpan span("test", "alpha");
+			span.setHeight(Height(1234));
+			span.setHash(hash);
+		}
+
+		// Assert:
+		auto events = GetTraceEvents();
+		ASSERT_EQ(1u, events.size());
+
+		std::ostringstream expectedHash;
+		expectedHash << hash;
+		EXPECT_EQ(1234u, events[0].get<uint64_t>("args.height"));
+		EXPECT_EQ(expectedHash.str(), events[0].get<std::string>("args.hash"));
+	}
+
+	TEST(TEST_CLASS, SpanNamesAreTruncatedAndEscaped) {
+		// Arrange:
+		TracingGuard guard(true);
+
+		// Act:
+		{ TraceSpan span("test", "a \"quoted\" and \\escaped\\ name that is too long"); }
+
+		// Assert:
+		auto events = GetTraceEvents();
+		ASSERT_EQ(1u, events.size());
+		EXPECT_EQ("a \"quoted\" and \\escaped\\ name t", events[0].get<std::string>("name"));
+	}
+
+	TEST(TEST_CLASS, NestedSpansAreRecordedInCompletionOrder) {
+		// Arrange:
+		TracingGuard guard(true);
+
+		// Act:
+		{
+			TraceSpan outerSpan("test", "outer");
+			{ TraceSpan innerSpan("test", "inner"); }
+		}
+
+		// Assert:
+		auto events = GetTraceEvents();
+		ASSERT_EQ(2u, events.size());
+		EXPECT_EQ("inner", events[0].get<std::string>("name"));
+		EXPECT_EQ("outer", events[1].get<std::string>("name"));
+
+		// - outer span contains inner span
+		EXPECT_LE(events[1].get<uint64_t>("ts"), events[0].get<uint64_t>("ts"));
+		EXPECT_LE(events[0].get<uint64_t>("dur"), events[1].get<uint64_t>("dur"));
+	}
+
+	// endregion
+
+	// region ring buffer
+
+	TEST(TEST_CLASS, OldestEventsAreOverwrittenWhenThreadBufferIsFull) {
+		// Arrange:
+		TracingGuard guard(true);
+		std::vector<std::string> names;
+		for (auto i = 0u; i < Max_Trace_Events_Per_Thread + 2; ++i)
+			names.push_back(std::to_string(i));
+
+		// Act:
+		for (const auto& name : names)
+			TraceSpan span("test", name.c_str());
+
+		// Assert:
+		auto events = GetTraceEvents();
+		ASSERT_EQ(Max_Trace_Events_Per_Thread, events.size());
+		EXPECT_EQ("2", events.front().get<std::string>("name"));
+		EXPECT_EQ(names.back(), events.back().get<std::string>("name"));
+	}
+
+	TEST(TEST_CLASS, EventsAreRecordedInSeparateBuffersPerThread) {
+		// Arrange:
+		constexpr auto Num_Threads = 4u;
+		TracingGuard guard(true);
+		boost::thread_group threads;
+
+		// Act:
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.create_thread([] {
+				TraceSpan span1("test", "alpha");
+				TraceSpan span2("test", "beta");
+			});
+		}
+
+		threads.join_all();
+
+		// Assert: events of exited threads are retained
+		auto events = GetTraceEvents();
+		ASSERT_EQ(2 * Num_Threads, events.size());
+
+		std::map<uint32_t, size_t> threadIdCounts;
+		for (const auto& event : events)
+			++threadIdCounts[event.get<uint32_t>("tid")];
+
+		EXPECT_EQ(Num_Threads, threadIdCounts.size());
+		for (const auto& pair : threadIdCounts)
+			EXPECT_EQ(2u, pair.second) << pair.first;
+	}
+
+	TEST(TEST_CLASS, ClearRemovesAllEvents) {
+		// Arrange:
+		TracingGuard guard(true);
+		{ TraceSpan span("test", "alpha"); }
+		boost::thread thread([] { TraceSpan span("test", "beta"); });
+		thread.join();
+
+		// Sanity:
+		EXPECT_EQ(2u, GetTraceEvents().size());
+
+		// Act:
+		ClearTraceEvents();
+
+		// Assert:
+		EXPECT_TRUE(GetTraceEvents().empty());
+	}
+
+	// endregion
+}}
@@ -23,6 +23,7 @@
 #include "catapult/tree/DataSourceVerbosity.h"
 #include "catapult/tree/PatriciaTree.h"
 #include "tests/TestHarness.h"
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -1399,6 +1400,107 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region lookup - batch
+
+	private:
+		template<typename TTree>
+		static void AssertBatchLookupMatchesSingleLookups(
+				const TTree& tree,
+				const std::vector<uint32_t>& keys,
+				std::vector<tree::TreeNode>& nodes) {
+			// Act:
+			auto results = tree.lookup(keys, nodes);
+
+			// Assert: all results match single lookups
+			ASSERT_EQ(keys.size(), results.size());
+
+			std::set<Hash256> expectedNodeHashes;
+			for (auto i = 0u; i < keys.size(); ++i) {
+				std::vector<tree::TreeNode> nodePath;
+				auto result = tree.lookup(keys[i], nodePath);
+				EXPECT_EQ(result.first, results[i].first) << keys[i];
+				EXPECT_EQ(result.second, results[i].second) << keys[i];
+
+				for (const auto& node : nodePath)
+					expectedNodeHashes.insert(node.hash());
+			}
+
+			// - combined proof contains all nodes of all single proofs exactly once
+			std::set<Hash256> nodeHashes;
+			for (const auto& node : nodes)
+				nodeHashes.insert(node.hash());
+
+			EXPECT_EQ(nodes.size(), nodeHashes.size());
+			EXPECT_EQ(expectedNodeHashes, nodeHashes);
+
+			// - combined proof starts with root
+			if (!nodes.empty())
+				EXPECT_EQ(tree.root(), nodes[0].hash());
+		}
+
+	public:
+		static void AssertBatchLookupReturnsNoNodesWhenTreeIsEmpty() {
+			// Arrange:
+			TestContext context;
+
+			// Act + Assert:
+			std::vector<tree::TreeNode> nodes;
+			AssertBatchLookupMatchesSingleLookups(context.tree(), { 0x64'6F'67'00, 0x64'6F'67'01 }, nodes);
+			EXPECT_TRUE(nodes.empty());
+		}
+
+		static void AssertBatchLookupMatchesSingleLookupsWithRootLeafNode() {
+			// Arrange:
+			TestContext context;
+			context.tree().set(0x64'6F'67'00, "alpha");
+
+			// Act + Assert:
+			std::vector<tree::TreeNode> nodes;
+			AssertBatchLookupMatchesSingleLookups(context.tree(), { 0x64'6F'67'00, 0x64'6F'67'01, 0x64'6F'67'00 }, nodes);
+			EXPECT_EQ(1u, nodes.size());
+		}
+
+		static void AssertBatchLookupMatchesSingleLookupsWithRootExtensionNode() {
+			// Arrange:
+			TestContext context;
+			context.tree().set(0x64'6F'00'00, "verb");
+			context.tree().set(0x64'6F'67'00, "puppy");
+			context.tree().set(0x64'6F'67'65, "coin");
+			context.tree().set(0x68'6F'72'73, "stallion");
+
+			// Act + Assert: mix of existing, non-existing and duplicate keys
+			std::vector<tree::TreeNode> nodes;
+			AssertBatchLookupMatchesSingleLookups(context.tree(), {
+				0x64'6F'67'65, 0x54'6F'67'00, 0x64'6F'00'00, 0x65'6F'67'00,
+				0x64'6F'77'65, 0x68'6F'72'73, 0x64'6F'67'44, 0x64'6F'67'65
+			}, nodes);
+		}
+
+		static void AssertBatchLookupReturnsSharedNodesOnce() {
+			// Arrange:
+			TestContext context;
+			context.tree().set(0x64'6F'00'00, "verb");
+			context.tree().set(0x64'6F'67'00, "puppy");
+			context.tree().set(0x64'6F'67'65, "coin");
+			context.tree().set(0x68'6F'72'73, "stallion");
+
+			std::vector<uint32_t> keys{ 0x64'6F'00'00, 0x64'6F'67'00, 0x64'6F'67'65, 0x68'6F'72'73 };
+			size_t numSingleProofNodes = 0;
+			for (auto key : keys) {
+				std::vector<tree::TreeNode> nodePath;
+				context.tree().lookup(key, nodePath);
+				numSingleProofNodes += nodePath.size();
+			}
+
+			// Act + Assert: 3 branches and 4 leaves are each returned once instead of once per key
+			std::vector<tree::TreeNode> nodes;
+			AssertBatchLookupMatchesSingleLookups(context.tree(), keys, nodes);
+			EXPECT_EQ(7u, nodes.size());
+			EXPECT_LT(nodes.size(), numSingleProofNodes);
+		}
+
+		// endregion
+
 		// region any order tests
 
 	private:
@@ -1701,6 +1803,11 @@ namespace catapult { namespace test {
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupSucceedsWhenKeyIsTreeRoot) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, LookupSucceedsWhenKeyIsInTree) \
 	\
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, BatchLookupReturnsNoNodesWhenTreeIsEmpty) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, BatchLookupMatchesSingleLookupsWithRootLeafNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, BatchLookupMatchesSingleLookupsWithRootExtensionNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, BatchLookupReturnsSharedNodesOnce) \
+	\
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanCreatePuppyTreeWithRootExtensionNode_AnyOrder) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanUndoPuppyTreeWithRootExtensionNode_AnyOrder) \
 	\
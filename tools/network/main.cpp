@@ -47,6 +47,7 @@ namespace catapult { namespace tools { namespace network {
 			ionet::Node Remote;
 			model::NodeIdentityMap<ionet::Node> Partners;
 			model::EntityRange<ionet::PackedNodeInfo> PartnerNodeInfos;
+			model::EntityRange<ionet::PackedNodeTraffic> PartnerNodeTraffics;
 		};
 
 		using NodeInfoPointer = NetworkCensusTool<NodeInfo>::NodeInfoPointer;
@@ -108,14 +109,15 @@ namespace catapult { namespace tools { namespace network {
 					: !node.metadata().Name.empty() ? node.metadata().Name : "?";
 		}
 
-		const ionet::PackedNodeInfo* TryFindPartnerNodeInfo(
+		template<typename TPackedInfo>
+		const TPackedInfo* TryFindPartnerInfo(
 				const model::NodeIdentity& partnerIdentity,
-				const model::EntityRange<ionet::PackedNodeInfo>& partnerNodeInfos) {
-			auto iter = std::find_if(partnerNodeInfos.cbegin(), partnerNodeInfos.cend(), [&partnerIdentity](const auto& nodeInfo) {
-				return partnerIdentity.PublicKey == nodeInfo.IdentityKey;
+				const model::EntityRange<TPackedInfo>& partnerInfos) {
+			auto iter = std::find_if(partnerInfos.cbegin(), partnerInfos.cend(), [&partnerIdentity](const auto& partnerInfo) {
+				return partnerIdentity.PublicKey == partnerInfo.IdentityKey;
 			});
 
-			return partnerNodeInfos.cend() == iter ? nullptr : &*iter;
+			return partnerInfos.cend() == iter ? nullptr : &*iter;
 		}
 
 		std::string ToString(ionet::NodeSource source) {
@@ -147,6 +149,14 @@ namespace catapult { namespace tools { namespace network {
 			return out.str();
 		}
 
+		std::string ToString(const ionet::PackedNodeTraffic& traffic) {
+			std::ostringstream out;
+			out
+					<< "read bytes: " << traffic.NumReadBytes
+					<< ", read packets: " << traffic.NumReadPackets;
+			return out.str();
+		}
+
 		std::string ToString(const ionet::PackedConnectionState& connectionState) {
 			std::ostringstream out;
 			out
@@ -182,13 +192,17 @@ namespace catapult { namespace tools { namespace network {
 				builder.add(keyOut.str(), partnerNode.metadata().Roles);
 
 				// get detailed partner information
-				const auto* pPartnerNodeInfo = TryFindPartnerNodeInfo(partnerNode.identity(), nodeInfo.PartnerNodeInfos);
+				const auto* pPartnerNodeInfo = TryFindPartnerInfo(partnerNode.identity(), nodeInfo.PartnerNodeInfos);
 				if (!pPartnerNodeInfo)
 					continue;
 
-				// output interactions
+				// output interactions and traffic (traffic is only available from nodes with fair share reads enabled)
 				builder.add("interactions", ToString(pPartnerNodeInfo->Interactions));
 
+				const auto* pPartnerNodeTraffic = TryFindPartnerInfo(partnerNode.identity(), nodeInfo.PartnerNodeTraffics);
+				if (pPartnerNodeTraffic)
+					builder.add("traffic", ToString(*pPartnerNodeTraffic));
+
 				// output source and number of connections
 				builder.add(ToString(pPartnerNodeInfo->Source), static_cast<uint16_t>(pPartnerNodeInfo->ConnectionStatesCount));
 
@@ -254,7 +268,7 @@ namespace catapult { namespace tools { namespace network {
 			}
 
 			std::string toValueString(const NodeInfo& rowNodeInfo, const ionet::Node& columnNode) {
-				const auto* pPartnerNodeInfo = TryFindPartnerNodeInfo(columnNode.identity(), rowNodeInfo.PartnerNodeInfos);
+				const auto* pPartnerNodeInfo = TryFindPartnerInfo(columnNode.identity(), rowNodeInfo.PartnerNodeInfos);
 				if (!pPartnerNodeInfo)
 					return "ERROR";
 
@@ -339,6 +353,14 @@ namespace catapult { namespace tools { namespace network {
 					});
 				}));
 
+				// request traffic last because nodes without the traffic handler close the connection
+				infoFutures.emplace_back(pDiagnosticApi->activeNodeTraffic().then([&nodeInfo](auto&& nodeTrafficsFuture) {
+					auto message = "querying peers traffic";
+					return UnwrapFutureAndSuppressErrors(message, std::move(nodeTrafficsFuture), [&nodeInfo](auto&& nodeTraffics) {
+						nodeInfo.PartnerNodeTraffics = std::move(nodeTraffics);
+					});
+				}));
+
 				return infoFutures;
 			}
 